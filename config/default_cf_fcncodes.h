@@ -439,7 +439,11 @@ typedef enum
      * \brief Write queue
      *
      *  \par Description
-     *       Writes requested queue(s) to a file
+     *       Writes requested queue(s) to a file, as text or as fixed size
+     *       #CF_QueueRecord_t records.  The file is written in the background
+     *       over the following wakeups, a bounded number of entries at a time,
+     *       and #CF_CMD_WQ_DONE_INF_EID is sent once it is complete.  Only one
+     *       file is written at a time.
      *
      *  \par Command Structure
      *       #CF_WriteQueueCmd_t
@@ -455,6 +459,7 @@ typedef enum
      *       - Command packet length not as expected, #CF_CMD_LEN_ERR_EID
      *       - Invalid parameter combination, #CF_CMD_WQ_ARGS_ERR_EID
      *       - Invalid channel number, #CF_CMD_WQ_CHAN_ERR_EID
+     *       - A previous queue file is still being written, #CF_CMD_WQ_BUSY_ERR_EID
      *       - Open file to write failed, #CF_CMD_WQ_OPEN_ERR_EID
      *       - Write RX data failed, #CF_CMD_WQ_WRITEQ_RX_ERR_EID
      *       - Write RX history data failed, #CF_CMD_WQ_WRITEHIST_RX_ERR_EID
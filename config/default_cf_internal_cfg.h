@@ -72,6 +72,9 @@
  * CF_CHANNEL_NUM_TX_CHUNKS_PER_TRANSACTION is an array for each channel indicating the number of chunks to keep track
  * of NAK requests from the receiver per transaction
  *
+ * These are averages: all the chunks of a channel are in one pool that its transactions
+ * take blocks from as they need them, up to txn_max_chunks in the configuration table.
+ *
  *  @par Limits:
  *
  */
@@ -94,6 +97,19 @@
         CF_NAK_MAX_SEGMENTS, CF_NAK_MAX_SEGMENTS \
     }
 
+/**
+ *  @brief Chunks per block of the channel chunk pools
+ *
+ *  @par Description:
+ *       Chunk lists grow and shrink a block at a time.  A list needs room
+ *       for one more block than it holds to grow, so smaller blocks spread
+ *       the pool more finely, and larger ones move lists less often.
+ *
+ *  @par Limits:
+ *       Must be at least 1.
+ */
+#define CF_CHUNK_BLOCK_SIZE (8)
+
 /**
  *  @brief Application Pipe Depth
  *
@@ -129,6 +145,186 @@
  */
 #define CF_MAX_SIMULTANEOUS_RX (5)
 
+/**
+ *  @brief Number of transaction lookup hash buckets per channel.
+ *
+ *  @par Description:
+ *       Active transactions on each channel are indexed by (source EID, sequence number)
+ *       so received PDUs can be matched to their transaction without scanning the queues.
+ *       This sets the number of buckets in each channel's index.
+ *
+ *  @par Limits:
+ *       Must be a power of two. Should be at least the number of transactions per channel.
+ *
+ */
+#define CF_NUM_TRANSACTION_HASH_BUCKETS_PER_CHAN (64)
+
+/**
+ *  @brief Number of send read-ahead buffers per channel.
+ *
+ *  @par Description:
+ *       Each send transaction takes a read-ahead buffer from its channel when it
+ *       starts sending file data, and gives it back when it finishes. File data
+ *       is then read in blocks of CF_SEND_READ_AHEAD_SIZE and each PDU is copied
+ *       out of the buffer. Transactions that find no free buffer read each PDU
+ *       directly from the file.
+ *
+ *  @par Limits:
+ *       Must be at least 1.
+ *
+ */
+#define CF_NUM_SEND_READ_AHEAD_BUFFERS_PER_CHAN (4)
+
+/**
+ *  @brief Size of each send read-ahead buffer.
+ *
+ *  @par Description:
+ *       File data for sending is read in blocks of this size, aligned to this
+ *       size within the file. Larger blocks mean fewer file system calls, at
+ *       the cost of CF_NUM_CHANNELS * CF_NUM_SEND_READ_AHEAD_BUFFERS_PER_CHAN
+ *       times this much memory.
+ *
+ *  @par Limits:
+ *       Must be a power of two.
+ *
+ */
+#define CF_SEND_READ_AHEAD_SIZE (4096)
+
+/**
+ *  @brief Number of receive write-behind buffers per channel.
+ *
+ *  @par Description:
+ *       Each receive transaction takes a write-behind buffer from its channel
+ *       when it gets its first file data PDU, and gives it back when it
+ *       finishes. Contiguous file data is gathered in the buffer and written
+ *       to the file in one call. Transactions that find no free buffer write
+ *       each PDU directly to the file.
+ *
+ *  @par Limits:
+ *       Must be at least 1.
+ *
+ */
+#define CF_NUM_RECV_WRITE_BEHIND_BUFFERS_PER_CHAN (4)
+
+/**
+ *  @brief Size of each receive write-behind buffer.
+ *
+ *  @par Description:
+ *       The buffer is written to the file once it holds this many bytes, or
+ *       sooner if the next file data PDU does not follow on from the data in
+ *       it, or on EOF or cancel. Uses CF_NUM_CHANNELS *
+ *       CF_NUM_RECV_WRITE_BEHIND_BUFFERS_PER_CHAN times this much memory.
+ *
+ *  @par Limits:
+ *       Must be at least CF_MAX_PDU_SIZE, so any file data PDU fits.
+ *
+ */
+#define CF_RECV_WRITE_BEHIND_SIZE (4096)
+
+/**
+ *  @brief Number of receive bitmaps per channel.
+ *
+ *  @par Description:
+ *       On channels with rx_bitmap_enabled set in the configuration table,
+ *       each class 2 receive transaction takes a bitmap from its channel
+ *       with its first file data PDU after the metadata that starts on a
+ *       multiple of its own length and does not end the file, and gives
+ *       it back when it finishes. The bitmap marks each PDU sized piece of
+ *       the file received, so the chunk list only has to hold pieces that
+ *       do not line up with those. Transactions that find no free bitmap
+ *       use the chunk list alone.
+ *
+ *  @par Limits:
+ *       Must be at least 1.
+ *
+ */
+#define CF_NUM_RECV_BITMAPS_PER_CHAN (2)
+
+/**
+ *  @brief Size in bytes of each receive bitmap.
+ *
+ *  @par Description:
+ *       Each bit tracks one PDU sized piece of the file, so this covers
+ *       files up to 8 * CF_RECV_BITMAP_SIZE times the PDU size, and only
+ *       the part a file needs is used. Pieces past that are tracked in
+ *       the chunk list. Uses CF_NUM_CHANNELS * CF_NUM_RECV_BITMAPS_PER_CHAN
+ *       times this much memory.
+ *
+ *  @par Limits:
+ *       Must be a nonzero multiple of 4.
+ *
+ */
+#define CF_RECV_BITMAP_SIZE (8192)
+
+/**
+ *  @brief Depth of the receive ring of each channel.
+ *
+ *  @par Description:
+ *       When a channel has rx_task_enabled set in the configuration table, a
+ *       child task blocks on the channel input pipe and copies each PDU into
+ *       this ring, and the engine takes them from it on each wakeup. The ring
+ *       holds PDUs that arrive between wakeups; any more are dropped and
+ *       counted in the recv ring_overflow counter. Uses CF_NUM_CHANNELS times
+ *       this many slots of CF_MAX_PDU_SIZE plus message header.
+ *
+ *  @par Limits:
+ *       Must be a power of two, and no more than 32768.
+ *
+ */
+#define CF_RX_RING_DEPTH_PER_CHAN (32)
+
+/**
+ *  @brief Priority of the receive child task of each channel.
+ *
+ *  @par Description:
+ *       Passed to CFE_ES_CreateChildTask() for the receive task of each
+ *       channel with rx_task_enabled set. It is normally higher priority
+ *       (lower number) than the CF main task, so the pipe is emptied as
+ *       soon as PDUs arrive.
+ *
+ *  @par Limits:
+ *       Must be a valid cFE task priority.
+ *
+ */
+#define CF_RX_TASK_PRIORITY (80)
+
+/**
+ *  @brief Stack size of the receive child task of each channel.
+ *
+ *  @par Limits:
+ *       Must be a valid cFE task stack size.
+ *
+ */
+#define CF_RX_TASK_STACK_SIZE (8192)
+
+/**
+ *  @brief Priority of the worker child task of each channel.
+ *
+ *  @par Description:
+ *       Passed to CFE_ES_CreateChildTask() for the worker task of each
+ *       channel with worker_task_enabled set in the configuration table.
+ *       Each wakeup, the CF main task starts the cycle of every such channel
+ *       in its worker, cycles the other channels itself, and then waits for
+ *       the workers to finish.  On a multi-core processor the workers run
+ *       alongside each other; they should be no higher priority than the
+ *       receive tasks, which keep their pipes emptied.
+ *
+ *  @par Limits:
+ *       Must be a valid cFE task priority.
+ *
+ */
+#define CF_WORKER_TASK_PRIORITY (90)
+
+/**
+ *  @brief Stack size of the worker child task of each channel.
+ *
+ *  @par Limits:
+ *       Must be a valid cFE task stack size.  The worker runs the whole
+ *       channel cycle, file I/O and event messages included.
+ *
+ */
+#define CF_WORKER_TASK_STACK_SIZE (16384)
+
 /* definitions that affect execution */
 
 /**
@@ -147,11 +343,83 @@
  *
  *  @par Description:
  *       Each channel can support this number of file receive transactions at a time.
+ *       History entries keep their file names in the channel name arena, see
+ *       CF_NAME_ARENA_SIZE, so the arena may run out before this many are kept.
  *
  *  @par Limits:
  *       65536 is the current max.
  */
-#define CF_NUM_HISTORIES_PER_CHANNEL (256)
+#define CF_NUM_HISTORIES_PER_CHANNEL (512)
+
+/**
+ *  @brief Size in bytes of the file name arena of each channel
+ *
+ *  @par Description:
+ *       Entries on the history queue keep their file names here, without the
+ *       directory, which is stored once for all the names sharing it.  When a
+ *       finished transaction's names do not fit, the oldest history entries are
+ *       recycled to make room.
+ *
+ *  @par Limits:
+ *       Must be even and at least 256.
+ */
+#define CF_NAME_ARENA_SIZE (16384)
+
+/**
+ *  @brief Number of directories each channel name arena can share
+ *
+ *  @par Description:
+ *       Names in a directory not among these while all are in use are kept
+ *       whole in the arena, and counted in the channel name_dir_misses HK
+ *       counter.  Each entry takes CF_FILENAME_MAX_LEN bytes.
+ *
+ *  @par Limits:
+ *       Must be from 1 to 254.
+ */
+#define CF_NAME_DIRS_PER_CHAN (16)
+
+/**
+ *  @brief Size in bytes of the output buffer used to write queue files
+ *
+ *  @par Description:
+ *       Entries for the write queue command are formatted into this buffer,
+ *       which is written to the file whenever the next entry may not fit.
+ *
+ *  @par Limits:
+ *       Must hold at least one entry in either format, a little over twice
+ *       CF_FILENAME_MAX_LEN.
+ */
+#define CF_QUEUE_FILE_BUFFER_SIZE (8192)
+
+/**
+ *  @brief Number of queue entries visited per wakeup while writing a queue file
+ *
+ *  @par Description:
+ *       The write queue command spreads the work of writing its file over
+ *       wakeups, so that a long history does not hold up the engine.
+ *
+ *  @par Limits:
+ *       Must be at least 1.
+ */
+#define CF_QUEUE_FILE_ENTRIES_PER_WAKEUP (64)
+
+/**
+ *  @brief Size in bytes of the transaction, history and chunk pool arena
+ *
+ *  @par Description:
+ *       All channels take their transaction, history and chunk pools from one
+ *       arena when the engine is initialized.  Each channel sizes its pools with
+ *       max_transactions, max_histories, rx_max_chunks and tx_max_chunks in the
+ *       configuration table, where 0 selects the compile-time default.  The
+ *       default arena holds the compile-time defaults of every channel; a
+ *       mission may instead give a byte count and divide it among the channels
+ *       through the table.
+ *
+ *  @par Limits:
+ *       The pools configured in the table must fit, or the engine fails to
+ *       initialize.
+ */
+#define CF_POOL_ARENA_SIZE CF_POOL_ARENA_DEFAULT_SIZE
 
 /**
  *  @brief Number of transactions per playback directory.
@@ -165,6 +433,40 @@
  */
 #define CF_NUM_TRANSACTIONS_PER_PLAYBACK (5)
 
+/**
+ *  @brief Most PDUs a send transaction gets per round-robin turn.
+ *
+ *  @par Description:
+ *       On channels with tx_drr_enabled set in the configuration table, each
+ *       active send transaction may send up to this many PDUs per turn when
+ *       its priority is 0, scaling down to 1 PDU per turn at priority 255.
+ *       Larger values give high priority transactions a bigger share of the
+ *       output, but longer bursts from each transaction.
+ *
+ *  @par Limits:
+ *       Must be from 1 to 255.
+ *
+ */
+#define CF_TX_DRR_MAX_QUANTUM (8)
+
+/**
+ *  @brief Most output buffers a channel reserves at once.
+ *
+ *  @par Description:
+ *       The engine takes output pipe semaphore credits and software bus
+ *       buffers for a channel in a batch, and hands them out to the PDUs
+ *       built during the channel cycle.  The first batch of a cycle is one
+ *       buffer and each one after is twice the last, up to this many.  Buffers
+ *       left over at the end of the cycle are released along with their
+ *       credits.
+ *
+ *  @par Limits:
+ *       Must be from 1 to 255.  Each reserved buffer holds CF_MAX_PDU_SIZE
+ *       bytes of the software bus pool until it is sent or released.
+ *
+ */
+#define CF_OUTPUT_BATCH_PER_CHAN (8)
+
 /**
  *  @brief Name of the CF Configuration Table
  *
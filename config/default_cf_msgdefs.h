@@ -48,8 +48,11 @@ typedef struct CF_HkCmdCounters
 typedef struct CF_HkSent
 {
     uint64 file_data_bytes;      /**< \brief Sent File data bytes */
+    uint64 retransmit_bytes;     /**< \brief Sent File data bytes resent for NAKs, included in file_data_bytes */
     uint32 pdu;                  /**< \brief Sent PDUs counter */
     uint32 nak_segment_requests; /**< \brief Sent NAK segment requests counter */
+    uint32 read_ahead_hit;       /**< \brief File data PDUs read entirely from the read-ahead buffer */
+    uint32 read_ahead_miss;      /**< \brief File data PDUs that needed the read-ahead buffer refilled */
 } CF_HkSent_t;
 
 /**
@@ -66,6 +69,9 @@ typedef struct CF_HkRecv
                                   */
     uint16 dropped;              /**< \brief Received PDUs dropped due to a transaction error */
     uint32 nak_segment_requests; /**< \brief Received NAK segment requests counter */
+    uint32 ring_overflow;        /**< \brief Received PDUs dropped: receive ring full or PDU too big */
+    uint16 ring_occupancy;       /**< \brief PDUs waiting in the receive ring at the last wakeup */
+    uint16 ring_high_water;      /**< \brief Most PDUs seen waiting in the receive ring at a wakeup */
 } CF_HkRecv_t;
 
 /**
@@ -104,10 +110,18 @@ typedef struct CF_HkChannel_Data
 {
     CF_HkCounters_t counters;                /**< \brief Counters */
     uint16          q_size[CF_QueueIdx_NUM]; /**< \brief Queue sizes */
+    uint16          txn_hwm;                 /**< \brief Most transactions in use at once */
+    uint16          hist_hwm;                /**< \brief Most history entries in use at once */
+    uint16          chunk_hwm;               /**< \brief Most chunks used by a single transaction, at most 65535 */
     uint8           poll_counter;            /**< \brief Number of active polling directories */
     uint8           playback_counter;        /**< \brief Number of active playback directories */
     uint8           frozen;                  /**< \brief Frozen state: 0 == not frozen, else frozen */
-    uint8           spare[7];                /**< \brief Alignment spare (uint64 values in the counters) */
+    uint8           spare[1];                /**< \brief Alignment spare (uint64 values in the counters) */
+    uint32          name_arena_used;         /**< \brief Bytes of the file name arena in use */
+    uint32          name_evictions;          /**< \brief History entries recycled early to make room for names */
+    uint32          name_dir_misses;         /**< \brief Names stored whole because the directory table was full */
+    uint32          chunk_merges;            /**< \brief Chunk list entries merged to make room */
+    uint32          chunk_drops;             /**< \brief Receive chunk list entries dropped to make room */
 } CF_HkChannel_Data_t;
 
 /**
@@ -126,16 +140,19 @@ typedef struct CF_HkPacket_Payload
  */
 typedef struct CF_EotPacket_Payload
 {
-    CF_TransactionSeq_t seq_num;    /**< \brief transaction identifier, stays constant for entire transfer */
-    uint32              channel;    /**< \brief Channel number */
-    uint32              direction;  /**< \brief direction of this transaction */
-    uint32              state;      /**< \brief Transaction state */
-    uint32              txn_stat;   /**< \brief final status code of transaction (extended CFDP CC) */
-    CF_EntityId_t       src_eid;    /**< \brief the source eid of the transaction */
-    CF_EntityId_t       peer_eid;   /**< \brief peer_eid is always the "other guy", same src_eid for RX */
-    uint32              fsize;      /**< \brief File size */
-    uint32              crc_result; /**< \brief CRC result */
-    CF_TxnFilenames_t   fnames;     /**< \brief file names associated with this transaction */
+    CF_TransactionSeq_t seq_num;          /**< \brief transaction identifier, stays constant for entire transfer */
+    uint32              channel;          /**< \brief Channel number */
+    uint32              direction;        /**< \brief direction of this transaction */
+    uint32              state;            /**< \brief Transaction state */
+    uint32              txn_stat;         /**< \brief final status code of transaction (extended CFDP CC) */
+    CF_EntityId_t       src_eid;          /**< \brief the source eid of the transaction */
+    CF_EntityId_t       peer_eid;         /**< \brief peer_eid is always the "other guy", same src_eid for RX */
+    uint32              crc_result;       /**< \brief CRC result */
+    uint64              fsize;            /**< \brief File size */
+    uint64              file_data_bytes;  /**< \brief file data bytes sent or received, including retransmits */
+    uint32              elapsed_ms;       /**< \brief milliseconds from transaction start to end */
+    uint32              bytes_per_second; /**< \brief average file data throughput over elapsed_ms */
+    CF_TxnFilenames_t   fnames;           /**< \brief file names associated with this transaction */
 } CF_EotPacket_Payload_t;
 
 /**\}*/
@@ -188,6 +205,34 @@ typedef enum
     CF_Queue_all     = 3  /**< \brief Queue all */
 } CF_Queue_t;
 
+/**
+ * \brief File formats for use for Write Queue cmd
+ */
+typedef enum
+{
+    CF_QueueFormat_text   = 0, /**< \brief One line of text per entry */
+    CF_QueueFormat_binary = 1, /**< \brief One CF_QueueRecord_t per entry */
+    CF_QueueFormat_num    = 2  /**< \brief Number of formats, not a valid format */
+} CF_QueueFormat_t;
+
+/**
+ * \brief Record written for each entry by the Write Queue cmd in binary format
+ *
+ * Records are written back to back with no file header, in host byte order.
+ */
+typedef struct CF_QueueRecord
+{
+    CF_EntityId_t       src_eid;                           /**< \brief Source entity id of the transaction */
+    CF_TransactionSeq_t seq_num;                           /**< \brief Transaction sequence number */
+    CF_EntityId_t       peer_eid;                          /**< \brief Entity id of the other side */
+    uint8               dir;                               /**< \brief Direction: rx=0, tx=1 */
+    uint8               txn_stat;                          /**< \brief Transaction status, final if history */
+    uint8               queue;                             /**< \brief Internal queue index the entry was on */
+    uint8               spare;                             /**< \brief Alignment spare */
+    char                src_filename[CF_FILENAME_MAX_LEN]; /**< \brief Source filename */
+    char                dst_filename[CF_FILENAME_MAX_LEN]; /**< \brief Destination filename */
+} CF_QueueRecord_t;
+
 /**
  * \brief Parameter IDs for use with Get/Set parameter messages
  *
@@ -206,6 +251,7 @@ typedef enum
     CF_GetSet_ValueID_nak_limit,                             /**< \brief NAK retry limit key */
     CF_GetSet_ValueID_local_eid,                             /**< \brief Local entity id key */
     CF_GetSet_ValueID_chan_max_outgoing_messages_per_wakeup, /**< \brief Max outgoing messages per wake-up key */
+    CF_GetSet_ValueID_chan_max_outgoing_bytes_per_second,    /**< \brief Max outgoing PDU bytes per second key */
     CF_GetSet_ValueID_MAX                                    /**< \brief Key limit used for validity check */
 } CF_GetSet_ValueID_t;
 
@@ -256,10 +302,10 @@ typedef struct CF_TxFile_Payload
  */
 typedef struct CF_WriteQueue_Payload
 {
-    uint8 type;  /**< \brief Transaction direction: all=0, up=1, down=2 */
-    uint8 chan;  /**< \brief Channel number */
-    uint8 queue; /**< \brief Queue type: 0=pending, 1=active, 2=history, 3=all */
-    uint8 spare; /**< \brief Alignment spare, puts filename on 32-bit boundary */
+    uint8 type;   /**< \brief Transaction direction: all=0, up=1, down=2 */
+    uint8 chan;   /**< \brief Channel number */
+    uint8 queue;  /**< \brief Queue type: 0=pending, 1=active, 2=history, 3=all */
+    uint8 format; /**< \brief File format: text=0, binary=1 */
 
     char filename[CF_FILENAME_MAX_LEN]; /**< \brief Filename written to */
 } CF_WriteQueue_Payload_t;
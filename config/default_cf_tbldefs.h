@@ -76,6 +76,22 @@ typedef struct CF_ChannelConfig
     char  sem_name[OS_MAX_API_NAME]; /**< \brief name of throttling semaphore in TO */
     uint8 dequeue_enabled;           /**< \brief if 1, then the channel will make pending transactions active */
     char  move_dir[OS_MAX_PATH_LEN]; /**< \brief Move directory if not empty */
+    uint8 checksum_type;             /**< \brief CFDP checksum type for files sent on this channel: 0 modular,
+                                      *          2 CRC-32C, 3 IEEE CRC-32, or 15 null */
+    uint8 rx_task_enabled;           /**< \brief if 1, then a child task receives PDUs from the input pipe */
+    uint8 rx_bitmap_enabled;         /**< \brief if 1, then class 2 receive tracks file data in a bitmap */
+
+    uint32 max_outgoing_bytes_per_second; /**< \brief max number of PDU bytes to send per second (0 - unlimited) */
+    uint8  tx_drr_enabled;                /**< \brief if 1, active TX transactions share output round-robin */
+    uint8  max_active_tx;                 /**< \brief max TX transactions active at once when tx_drr_enabled is set */
+    uint16 max_transactions;              /**< \brief transaction pool size (0 - CF_NUM_TRANSACTIONS_PER_CHANNEL) */
+    uint16 max_histories;                 /**< \brief history pool size (0 - CF_NUM_HISTORIES_PER_CHANNEL),
+                                           *          no fewer than the transactions */
+    uint16 rx_max_chunks;                 /**< \brief chunk pool share per receive transaction (0 - compile default) */
+    uint16 tx_max_chunks;                 /**< \brief chunk pool share per send transaction (0 - compile default) */
+    uint8  worker_task_enabled;           /**< \brief if 1, then a child task runs the channel cycle */
+    uint16 rx_immediate_nak_ticks;        /**< \brief min wakeups between immediate class 2 NAKs (0 - disabled) */
+    uint16 txn_max_chunks;                /**< \brief most chunks one transaction may take from the pool (0 - no cap) */
 } CF_ChannelConfig_t;
 
 
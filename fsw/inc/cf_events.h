@@ -212,6 +212,68 @@
  */
 #define CF_INIT_OUTGOING_SIZE_ERR_EID (35)
 
+/**
+ * \brief CF Checksum Type Config Table Validation Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  Configuration table channel checksum type has no digest engine
+ */
+#define CF_INIT_CHECKSUM_TYPE_ERR_EID (37)
+
+/**
+ * \brief CF Channel Receive Task Create Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  Failure from create child task call, or from create mutex call for the
+ *  transaction index it shares, for a channel with the receive task
+ *  enabled during engine channel initialization
+ */
+#define CF_INIT_RX_TASK_ERR_EID (38)
+
+/**
+ * \brief CF Channel Pools Do Not Fit In Arena Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  The transaction, history and chunk pools configured for a channel in the
+ *  configuration table need more than is left of the pool arena during engine
+ *  channel initialization
+ */
+#define CF_INIT_POOL_ERR_EID (39)
+
+/**
+ * \brief CF Channel Worker Task Start Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  Failure from a create semaphore or create child task call for a channel
+ *  with the worker task enabled during engine channel initialization
+ */
+#define CF_INIT_WORKER_TASK_ERR_EID (51)
+
+/**
+ * \brief CF Channel Pool Config Table Validation Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  Configuration table channel has fewer history entries than transactions,
+ *  a worker task or round-robin flag other than 0 or 1, or more active sends
+ *  allowed than it has transactions
+ */
+#define CF_INIT_POOL_CFG_ERR_EID (52)
+
 /**
  * \brief CF Create SB Command Pipe at Initialization Failed Event ID
  *
@@ -249,6 +311,17 @@
  */
 #define CF_PDU_SHORT_HEADER_ERR_EID (41)
 
+/**
+ * \brief CF Metadata PDU Checksum Type Unsupported Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  Metadata PDU checksum type has no digest engine
+ */
+#define CF_PDU_MD_CHECKSUM_TYPE_ERR_EID (42)
+
 /**
  * \brief CF Metadata PDU Too Short Event ID
  *
@@ -348,17 +421,6 @@
  */
 #define CF_PDU_FD_UNSUPPORTED_ERR_EID (54)
 
-/**
- * \brief CF PDU Header Large File Flag Set Event ID
- *
- *  \par Type: ERROR
- *
- *  \par Cause:
- *
- *  PDU Header received with the unsupported large file flag set
- */
-#define CF_PDU_LARGE_FILE_ERR_EID (55)
-
 /**
  * \brief CF PDU Header Field Truncation
  *
@@ -395,7 +457,8 @@
  *  \par Cause:
  *
  *  PDU without a matching/existing transaction received when channel receive queue is already
- *  handling the maximum number of concurrent receive transactions
+ *  handling the maximum number of concurrent receive transactions, or when every transaction
+ *  in the channel's transaction pool is in use
  */
 #define CF_CFDP_RX_DROPPED_ERR_EID (60)
 
@@ -490,6 +553,18 @@
  */
 #define CF_CFDP_CLOSE_ERR_EID (68)
 
+/**
+ * \brief CF Transmission Request Rejected Due To No Free Transaction Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  Command request to transmit a file received when every transaction in the
+ *  channel's transaction pool is in use
+ */
+#define CF_CFDP_NO_TXN_ERR_EID (69)
+
 /**************************************************************************
  * CF_CFDP_R event IDs - Engine receive
  */
@@ -781,28 +856,16 @@
 #define CF_CFDP_S_OPEN_ERR_EID (95)
 
 /**
- * \brief CF TX Metadata PDU File Seek End Failed Event ID
+ * \brief CF TX Metadata PDU File Size Failed Event ID
  *
  *  \par Type: ERROR
  *
  *  \par Cause:
  *
- *  Failure in file lseek to end of file call when preparing
- *  to send metadata PDU
- */
-#define CF_CFDP_S_SEEK_END_ERR_EID (96)
-
-/**
- * \brief CF TX Metadata PDU File Seek Beginning Failed Event ID
- *
- *  \par Type: ERROR
- *
- *  \par Cause:
- *
- *  Failure in file lseek to beginning of file call when
+ *  Failure in file stat call to get the file size when
  *  preparing to send metadata PDU
  */
-#define CF_CFDP_S_SEEK_BEG_ERR_EID (97)
+#define CF_CFDP_S_SEEK_END_ERR_EID (96)
 
 /**
  * \brief CF TX Metadata PDU Send Failed Event ID
@@ -912,6 +975,28 @@
  * CF_CMD event IDs - Command processing
  */
 
+/**
+ * \brief CF Write Queue Complete Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *
+ *  A queue file started by the write queue command has been completely written
+ */
+#define CF_CMD_WQ_DONE_INF_EID (108)
+
+/**
+ * \brief CF Write Queue Command Busy Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  Write queue command received while the file from a previous one is still being written
+ */
+#define CF_CMD_WQ_BUSY_ERR_EID (109)
+
 /**
  * \brief CF NOOP Command Received Event ID
  *
@@ -974,7 +1059,8 @@
  *
  *  \par Cause:
  *
- *  Receipt and successful processing of write queue command
+ *  Receipt and successful processing of write queue command, the file is then
+ *  written over the following wakeups
  */
 #define CF_CMD_WQ_INF_EID (115)
 
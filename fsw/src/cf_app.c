@@ -100,8 +100,37 @@ void CF_CheckTables(void)
  *-----------------------------------------------------------------*/
 CFE_Status_t CF_ValidateConfigTable(void *tbl_ptr)
 {
-    CF_ConfigTable_t *tbl = (CF_ConfigTable_t *)tbl_ptr;
-    CFE_Status_t      ret = CFE_STATUS_VALIDATION_FAILURE;
+    CF_ConfigTable_t *        tbl = (CF_ConfigTable_t *)tbl_ptr;
+    const CF_ChannelConfig_t *cc;
+    CFE_Status_t              ret = CFE_STATUS_VALIDATION_FAILURE;
+    uint32                    num_txn;
+    uint32                    num_hist;
+    int                       i;
+    int                       j;
+
+    /* find the first channel with a checksum type that cannot be computed, if any */
+    for (i = 0; i < CF_NUM_CHANNELS; ++i)
+    {
+        if (!CF_CRC_IsSupported(tbl->chan[i].checksum_type))
+        {
+            break;
+        }
+    }
+
+    /* and the first with pools that cannot work, as a zero selects the compile-time default */
+    for (j = 0; j < CF_NUM_CHANNELS; ++j)
+    {
+        cc       = &tbl->chan[j];
+        num_txn  = cc->max_transactions ? cc->max_transactions : CF_NUM_TRANSACTIONS_PER_CHANNEL;
+        num_hist = cc->max_histories ? cc->max_histories : CF_NUM_HISTORIES_PER_CHANNEL;
+
+        /* each transaction holds a history entry, so a new one must always find one to take */
+        if ((num_hist < num_txn) || (cc->worker_task_enabled > 1) || (cc->tx_drr_enabled > 1) ||
+            (cc->max_active_tx > num_txn))
+        {
+            break;
+        }
+    }
 
     if (!tbl->ticks_per_second)
     {
@@ -117,6 +146,19 @@ CFE_Status_t CF_ValidateConfigTable(void *tbl_ptr)
         CFE_EVS_SendEvent(CF_INIT_OUTGOING_SIZE_ERR_EID, CFE_EVS_EventType_ERROR,
                           "CF: config table has outgoing file chunk size too large");
     }
+    else if (i < CF_NUM_CHANNELS)
+    {
+        CFE_EVS_SendEvent(CF_INIT_CHECKSUM_TYPE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "CF: config table channel %d has unsupported checksum type %u", i,
+                          (unsigned int)tbl->chan[i].checksum_type);
+    }
+    else if (j < CF_NUM_CHANNELS)
+    {
+        CFE_EVS_SendEvent(CF_INIT_POOL_CFG_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "CF: config table channel %d has invalid pool settings: %lu histories, %lu transactions, "
+                          "%u active sends",
+                          j, (unsigned long)num_hist, (unsigned long)num_txn, (unsigned int)cc->max_active_tx);
+    }
     else
     {
         ret = CFE_SUCCESS;
@@ -197,6 +239,9 @@ CFE_Status_t CF_AppInit(void)
 
     CF_AppData.RunStatus = CFE_ES_RunStatus_APP_RUN;
 
+    /* the CRC tables are only read from here on, so channel worker tasks can share them */
+    CF_CRC_Init();
+
     CFE_MSG_Init(CFE_MSG_PTR(CF_AppData.hk.TelemetryHeader), CFE_SB_ValueToMsgId(CF_HK_TLM_MID), sizeof(CF_AppData.hk));
 
     status = CFE_EVS_Register(NULL, 0, CFE_EVS_EventFilter_BINARY);
@@ -36,6 +36,7 @@
 #include "cf_platform_cfg.h"
 #include "cf_cfdp.h"
 #include "cf_clist.h"
+#include "cf_dump.h"
 
 /**************************************************************************
  **
@@ -66,6 +67,36 @@
  */
 #define CF_CHANNEL_PIPE_PREFIX ("CF_CHAN_")
 
+/**
+ * @brief A common prefix for all channel receive child tasks of CF
+ */
+#define CF_RX_TASK_NAME_PREFIX ("CF_RX_")
+
+/**
+ * @brief A common prefix for the mutexes guarding each channel transaction index against its receive task
+ */
+#define CF_INDEX_MUTEX_PREFIX ("CF_IDX_")
+
+/**
+ * @brief A common prefix for all channel worker child tasks of CF
+ */
+#define CF_WORKER_TASK_NAME_PREFIX ("CF_WK_")
+
+/**
+ * @brief A common prefix for the semaphores that start a worker channel cycle
+ */
+#define CF_WORKER_WAKE_SEM_PREFIX ("CF_WK_WAKE_")
+
+/**
+ * @brief A common prefix for the semaphores that signal a worker channel cycle is done
+ */
+#define CF_WORKER_DONE_SEM_PREFIX ("CF_WK_DONE_")
+
+/**
+ * @brief The name of the mutex guarding the transaction sequence number
+ */
+#define CF_SEQ_MUTEX_NAME ("CF_SEQ")
+
 /**
  * @brief Marker used to flag filenames suspected of being truncated
  */
@@ -94,6 +125,8 @@ typedef struct
     CF_ConfigTable_t *config_table;
 
     CF_Engine_t engine;
+
+    CF_Dump_t dump;
 } CF_AppData_t;
 
 /**************************************************************************
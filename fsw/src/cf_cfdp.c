@@ -122,8 +122,43 @@ void CF_CFDP_DecodeStart(CF_DecoderState_t *pdec, const void *msgbuf, CF_Logical
  *-----------------------------------------------------------------*/
 void CF_CFDP_ArmAckTimer(CF_Transaction_t *txn)
 {
-    CF_Timer_InitRelSec(&txn->ack_timer, CF_AppData.config_table->chan[txn->chan_num].ack_timer_s);
+    CF_TimerWheel_t *wheel = &CF_AppData.engine.channels[txn->chan_num].timer_wheel;
+
+    CF_Timer_InitRelSec(wheel, &txn->ack_timer, CF_AppData.config_table->chan[txn->chan_num].ack_timer_s,
+                        CF_CFDP_AckTimerExpired);
     txn->flags.com.ack_timer_armed = true;
+
+    /* a suspended transaction's timers stand still until it is resumed */
+    if (txn->flags.com.suspended)
+    {
+        CF_Timer_Pause(wheel, &txn->ack_timer);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_CFDP_AckTimerExpired(CF_Timer_t *timer)
+{
+    CF_Transaction_t *txn = container_of(timer, CF_Transaction_t, ack_timer);
+
+    CF_InsertTransactionTick(&CF_AppData.engine.channels[txn->chan_num], txn);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_CFDP_InactTimerExpired(CF_Timer_t *timer)
+{
+    CF_Transaction_t *txn = container_of(timer, CF_Transaction_t, inactivity_timer);
+
+    CF_InsertTransactionTick(&CF_AppData.engine.channels[txn->chan_num], txn);
 }
 
 /*----------------------------------------------------------------
@@ -152,12 +187,22 @@ static inline bool CF_CFDP_IsSender(CF_Transaction_t *txn)
 
 /*----------------------------------------------------------------
  *
- * Internal helper routine only, not part of API.
+ * Application-scope internal function
+ * See description in cf_cfdp.h for argument/return detail
  *
  *-----------------------------------------------------------------*/
-static inline void CF_CFDP_ArmInactTimer(CF_Transaction_t *txn)
+void CF_CFDP_ArmInactTimer(CF_Transaction_t *txn)
 {
-    CF_Timer_InitRelSec(&txn->inactivity_timer, CF_AppData.config_table->chan[txn->chan_num].inactivity_timer_s);
+    CF_TimerWheel_t *wheel = &CF_AppData.engine.channels[txn->chan_num].timer_wheel;
+
+    CF_Timer_InitRelSec(wheel, &txn->inactivity_timer, CF_AppData.config_table->chan[txn->chan_num].inactivity_timer_s,
+                        CF_CFDP_InactTimerExpired);
+
+    /* a suspended transaction's timers stand still until it is resumed */
+    if (txn->flags.com.suspended)
+    {
+        CF_Timer_Pause(wheel, &txn->inactivity_timer);
+    }
 }
 
 /*----------------------------------------------------------------
@@ -176,7 +221,15 @@ void CF_CFDP_DispatchRecv(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *ph)
                                                                     [CF_TxnState_DROP] = CF_CFDP_RecvDrop}};
 
     CF_CFDP_RxStateDispatch(txn, ph, &state_fns);
-    CF_CFDP_ArmInactTimer(txn); /* whenever a packet was received by the other size, always arm its inactivity timer */
+
+    /* the transaction may have been freed while handling the PDU */
+    if (txn->flags.com.q_index != CF_QueueIdx_FREE)
+    {
+        CF_CFDP_ArmInactTimer(txn); /* whenever a packet was received by the other size, always arm its inactivity timer */
+
+        /* the PDU may have left something to send from tick processing */
+        CF_InsertTransactionTick(&CF_AppData.engine.channels[txn->chan_num], txn);
+    }
 }
 
 /*----------------------------------------------------------------
@@ -229,6 +282,47 @@ static void CF_CFDP_SetPduLength(CF_Logical_PduBuffer_t *ph)
     CF_CFDP_EncodeHeaderFinalSize(ph->penc, &ph->pdu_header);
 }
 
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Fills in the logical PDU base header for a transaction
+ *
+ *-----------------------------------------------------------------*/
+static void CF_CFDP_SetPduHeader(CF_Logical_PduHeader_t *hdr, const CF_Transaction_t *txn,
+                                 CF_CFDP_FileDirective_t directive_code, CF_EntityId_t src_eid, CF_EntityId_t dst_eid,
+                                 bool towards_sender, CF_TransactionSeq_t tsn)
+{
+    uint8 eid_len;
+
+    hdr->version    = 1;
+    hdr->pdu_type   = (directive_code == 0); /* set to '1' for file data PDU, '0' for a directive PDU */
+    hdr->direction  = (towards_sender != false); /* set to '1' for toward sender, '0' for toward receiver */
+    hdr->txm_mode   = (CF_CFDP_GetClass(txn) == CF_CFDP_CLASS_1); /* set to '1' for class 1 data, '0' for class 2 */
+    hdr->large_flag = txn->flags.com.large_file; /* set to '1' for 64-bit file sizes and offsets */
+
+    /* choose the larger of the two EIDs to determine size */
+    if (src_eid > dst_eid)
+    {
+        eid_len = CF_CFDP_GetValueEncodedSize(src_eid);
+    }
+    else
+    {
+        eid_len = CF_CFDP_GetValueEncodedSize(dst_eid);
+    }
+
+    /*
+     * This struct holds the "real" length - when assembled into the final packet
+     * this is encoded as 1 less than this value
+     */
+    hdr->eid_length     = eid_len;
+    hdr->txn_seq_length = CF_CFDP_GetValueEncodedSize(tsn);
+
+    hdr->source_eid      = src_eid;
+    hdr->destination_eid = dst_eid;
+    hdr->sequence_num    = tsn;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -241,40 +335,12 @@ CF_Logical_PduBuffer_t *CF_CFDP_ConstructPduHeader(const CF_Transaction_t *txn,
 {
     /* directive_code == 0 if file data */
     CF_Logical_PduBuffer_t *ph;
-    CF_Logical_PduHeader_t *hdr;
-    uint8                   eid_len;
 
     ph = CF_CFDP_MsgOutGet(txn, silent);
 
     if (ph)
     {
-        hdr = &ph->pdu_header;
-
-        hdr->version   = 1;
-        hdr->pdu_type  = (directive_code == 0); /* set to '1' for file data PDU, '0' for a directive PDU */
-        hdr->direction = (towards_sender != false); /* set to '1' for toward sender, '0' for toward receiver */
-        hdr->txm_mode  = (CF_CFDP_GetClass(txn) == CF_CFDP_CLASS_1); /* set to '1' for class 1 data, '0' for class 2 */
-
-        /* choose the larger of the two EIDs to determine size */
-        if (src_eid > dst_eid)
-        {
-            eid_len = CF_CFDP_GetValueEncodedSize(src_eid);
-        }
-        else
-        {
-            eid_len = CF_CFDP_GetValueEncodedSize(dst_eid);
-        }
-
-        /*
-         * This struct holds the "real" length - when assembled into the final packet
-         * this is encoded as 1 less than this value
-         */
-        hdr->eid_length     = eid_len;
-        hdr->txn_seq_length = CF_CFDP_GetValueEncodedSize(tsn);
-
-        hdr->source_eid      = src_eid;
-        hdr->destination_eid = dst_eid;
-        hdr->sequence_num    = tsn;
+        CF_CFDP_SetPduHeader(&ph->pdu_header, txn, directive_code, src_eid, dst_eid, towards_sender, tsn);
 
         /*
          * encode the known parts so far.  total_size field cannot be
@@ -282,7 +348,7 @@ CF_Logical_PduBuffer_t *CF_CFDP_ConstructPduHeader(const CF_Transaction_t *txn,
          * encoding of the other stuff needs to be done so the position
          * of any data fields can be determined.
          */
-        CF_CFDP_EncodeHeaderWithoutSize(ph->penc, hdr);
+        CF_CFDP_EncodeHeaderWithoutSize(ph->penc, &ph->pdu_header);
 
         /* If directive code is zero, the PDU is a file data PDU which has no directive code field.
          * So only set if non-zero, otherwise it will write a 0 to a byte in a file data PDU where we
@@ -299,6 +365,48 @@ CF_Logical_PduBuffer_t *CF_CFDP_ConstructPduHeader(const CF_Transaction_t *txn,
     return ph;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_CFDP_InitFileDataHeader(CF_Transaction_t *txn)
+{
+    CF_Logical_PduHeader_t hdr;
+
+    memset(&hdr, 0, sizeof(hdr));
+    CF_CFDP_SetPduHeader(&hdr, txn, 0, CF_AppData.config_table->local_eid, txn->history->peer_eid, false,
+                         txn->history->seq_num);
+    CF_CFDP_EncodeHeaderTemplate(&txn->state_data.send.fd_header, &hdr);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CF_Logical_PduBuffer_t *CF_CFDP_ConstructFileDataHeader(CF_Transaction_t *txn, bool silent)
+{
+    CF_Logical_PduBuffer_t *ph;
+
+    /* normally built when the metadata is sent, nothing in it changes for the rest of the transaction */
+    if (txn->state_data.send.fd_header.hdr.header_encoded_length == 0)
+    {
+        CF_CFDP_InitFileDataHeader(txn);
+    }
+
+    ph = CF_CFDP_MsgOutGet(txn, silent);
+
+    if (ph)
+    {
+        CF_CFDP_EncodeHeaderFromTemplate(ph->penc, &ph->pdu_header, &txn->state_data.send.fd_header);
+    }
+
+    return ph;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -323,16 +431,17 @@ CFE_Status_t CF_CFDP_SendMd(CF_Transaction_t *txn)
 
         CF_Assert((txn->state == CF_TxnState_S1) || (txn->state == CF_TxnState_S2));
 
-        md->size = txn->fsize;
+        md->size          = txn->fsize;
+        md->checksum_type = txn->crc.type;
 
         /* at this point, need to append filenames into md packet */
         /* this does not actually copy here - that is done during encode */
         md->source_filename.length =
-            OS_strnlen(txn->history->fnames.src_filename, sizeof(txn->history->fnames.src_filename));
-        md->source_filename.data_ptr = txn->history->fnames.src_filename;
+            OS_strnlen(txn->fnames.src_filename, sizeof(txn->fnames.src_filename));
+        md->source_filename.data_ptr = txn->fnames.src_filename;
         md->dest_filename.length =
-            OS_strnlen(txn->history->fnames.dst_filename, sizeof(txn->history->fnames.dst_filename));
-        md->dest_filename.data_ptr = txn->history->fnames.dst_filename;
+            OS_strnlen(txn->fnames.dst_filename, sizeof(txn->fnames.dst_filename));
+        md->dest_filename.data_ptr = txn->fnames.dst_filename;
 
         CF_CFDP_EncodeMd(ph->penc, md);
         CF_CFDP_SetPduLength(ph);
@@ -569,11 +678,10 @@ CFE_Status_t CF_CFDP_SendNak(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *ph)
  * See description in cf_cfdp.h for argument/return detail
  *
  *-----------------------------------------------------------------*/
-CFE_Status_t CF_CFDP_RecvPh(uint8 chan_num, CF_Logical_PduBuffer_t *ph)
+CFE_Status_t CF_CFDP_DecodePh(CF_Logical_PduBuffer_t *ph)
 {
     CFE_Status_t ret = CFE_SUCCESS;
 
-    CF_Assert(chan_num < CF_NUM_CHANNELS);
     /*
      * If the source eid, destination eid, or sequence number fields
      * are larger than the sizes configured in the cf platform config
@@ -583,20 +691,6 @@ CFE_Status_t CF_CFDP_RecvPh(uint8 chan_num, CF_Logical_PduBuffer_t *ph)
     {
         CFE_EVS_SendEvent(CF_PDU_TRUNCATION_ERR_EID, CFE_EVS_EventType_ERROR,
                           "CF: PDU rejected due to EID/seq number field truncation");
-        ++CF_AppData.hk.Payload.channel_hk[chan_num].counters.recv.error;
-        ret = CF_ERROR;
-    }
-    /*
-     * The "large file" flag is not supported by this implementation yet.
-     * This means file sizes and offsets will be 64 bits, so codec routines
-     * will need to be updated to understand this.  OSAL also doesn't support
-     * 64-bit file access yet.
-     */
-    else if (CF_CODEC_IS_OK(ph->pdec) && ph->pdu_header.large_flag)
-    {
-        CFE_EVS_SendEvent(CF_PDU_LARGE_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
-                          "CF: PDU with large file bit received (unsupported)");
-        ++CF_AppData.hk.Payload.channel_hk[chan_num].counters.recv.error;
         ret = CF_ERROR;
     }
     else
@@ -610,14 +704,34 @@ CFE_Status_t CF_CFDP_RecvPh(uint8 chan_num, CF_Logical_PduBuffer_t *ph)
         {
             CFE_EVS_SendEvent(CF_PDU_SHORT_HEADER_ERR_EID, CFE_EVS_EventType_ERROR, "CF: PDU too short (%lu received)",
                               (unsigned long)CF_CODEC_GET_SIZE(ph->pdec));
-            ++CF_AppData.hk.Payload.channel_hk[chan_num].counters.recv.error;
             ret = CF_SHORT_PDU_ERROR;
         }
-        else
-        {
-            /* PDU is ok, so continue processing */
-            ++CF_AppData.hk.Payload.channel_hk[chan_num].counters.recv.pdu;
-        }
+    }
+
+    return ret;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CF_CFDP_RecvPh(uint8 chan_num, CF_Logical_PduBuffer_t *ph)
+{
+    CFE_Status_t ret;
+
+    CF_Assert(chan_num < CF_NUM_CHANNELS);
+
+    ret = CF_CFDP_DecodePh(ph);
+    if (ret != CFE_SUCCESS)
+    {
+        ++CF_AppData.hk.Payload.channel_hk[chan_num].counters.recv.error;
+    }
+    else
+    {
+        /* PDU is ok, so continue processing */
+        ++CF_AppData.hk.Payload.channel_hk[chan_num].counters.recv.pdu;
     }
 
     return ret;
@@ -644,11 +758,28 @@ CFE_Status_t CF_CFDP_RecvMd(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *ph)
         ++CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.recv.error;
         ret = CF_PDU_METADATA_ERROR;
     }
+    else if (!CF_CRC_IsSupported(md->checksum_type))
+    {
+        CFE_EVS_SendEvent(CF_PDU_MD_CHECKSUM_TYPE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "CF: metadata PDU rejected due to unsupported checksum type %u",
+                          (unsigned int)md->checksum_type);
+        ++CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.recv.error;
+        CF_CFDP_SetTxnStatus(txn, CF_TxnStatus_UNSUPPORTED_CHECKSUM_TYPE);
+        ret = CF_PDU_METADATA_ERROR;
+    }
     else
     {
         /* store the expected file size in transaction */
         txn->fsize = md->size;
 
+        /* the sender picks the checksum type. Anything digested before the md arrived
+         * assumed the modular checksum, so start over. R2 will re-read the file. */
+        if (txn->crc.type != md->checksum_type)
+        {
+            CF_CRC_Start(&txn->crc, md->checksum_type);
+            txn->state_data.receive.r2.rx_crc_inline_bytes = 0;
+        }
+
         /*
          * store the filenames in transaction.
          *
@@ -656,7 +787,7 @@ CFE_Status_t CF_CFDP_RecvMd(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *ph)
          * and ensures that the output content is properly terminated, so this only needs to check that
          * it worked.
          */
-        lv_ret = CF_CFDP_CopyStringFromLV(txn->history->fnames.src_filename, sizeof(txn->history->fnames.src_filename),
+        lv_ret = CF_CFDP_CopyStringFromLV(txn->fnames.src_filename, sizeof(txn->fnames.src_filename),
                                           &md->source_filename);
         if (lv_ret < 0)
         {
@@ -668,8 +799,8 @@ CFE_Status_t CF_CFDP_RecvMd(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *ph)
         }
         else
         {
-            lv_ret = CF_CFDP_CopyStringFromLV(txn->history->fnames.dst_filename,
-                                              sizeof(txn->history->fnames.dst_filename), &md->dest_filename);
+            lv_ret = CF_CFDP_CopyStringFromLV(txn->fnames.dst_filename,
+                                              sizeof(txn->fnames.dst_filename), &md->dest_filename);
             if (lv_ret < 0)
             {
                 CFE_EVS_SendEvent(CF_PDU_INVALID_DST_LEN_ERR_EID, CFE_EVS_EventType_ERROR,
@@ -681,8 +812,8 @@ CFE_Status_t CF_CFDP_RecvMd(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *ph)
             else
             {
                 CFE_EVS_SendEvent(CF_PDU_MD_RECVD_INF_EID, CFE_EVS_EventType_INFORMATION,
-                                  "CF: md received for source: %s, dest: %s", txn->history->fnames.src_filename,
-                                  txn->history->fnames.dst_filename);
+                                  "CF: md received for source: %s, dest: %s", txn->fnames.src_filename,
+                                  txn->fnames.dst_filename);
             }
         }
     }
@@ -856,9 +987,13 @@ void CF_CFDP_RecvIdle(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *ph)
      * in this case, they are the same */
     txn->history->peer_eid = ph->pdu_header.source_eid;
     txn->history->src_eid  = ph->pdu_header.source_eid;
+    CF_InsertTransactionIndex(&CF_AppData.engine.channels[txn->chan_num], txn);
 
     txn->chunks = CF_CFDP_FindUnusedChunks(&CF_AppData.engine.channels[txn->chan_num], CF_Direction_RX);
 
+    /* the sender picks the large file mode for the transaction, and the replies follow it */
+    txn->flags.com.large_file = ph->pdu_header.large_flag;
+
     /* this is an idle transaction, so see if there's a received packet that can
      * be bound to the transaction */
     if (ph->pdu_header.pdu_type)
@@ -922,6 +1057,176 @@ void CF_CFDP_RecvIdle(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *ph)
     }
 }
 
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static uint64 CF_CFDP_PoolBytes(uint64 size)
+{
+    /* round up so the pool after this one is aligned as well */
+    return (size + sizeof(uint64) - 1) & ~(uint64)(sizeof(uint64) - 1);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static CFE_Status_t CF_CFDP_InitChannelPools(uint8 chan_num)
+{
+    static const int CF_DIR_MAX_CHUNKS[CF_Direction_NUM][CF_NUM_CHANNELS] = {CF_CHANNEL_NUM_RX_CHUNKS_PER_TRANSACTION,
+                                                                             CF_CHANNEL_NUM_TX_CHUNKS_PER_TRANSACTION};
+
+    const CF_ChannelConfig_t *cc   = &CF_AppData.config_table->chan[chan_num];
+    CF_Channel_t *            chan = &CF_AppData.engine.channels[chan_num];
+    CF_HkChannel_Data_t *     hk   = &CF_AppData.hk.Payload.channel_hk[chan_num];
+    CF_Transaction_t *        txn;
+    CF_ChunkWrapper_t *       cw;
+    CF_History_t *            history;
+    uint8 *                   arena;
+    uint32                    max_chunks[CF_Direction_NUM];
+    uint32                    num_txn;
+    uint32                    num_hist;
+    uint64                    num_blocks;
+    uint32                    txn_cap;
+    uint64                    txn_bytes;
+    uint64                    cw_bytes;
+    uint64                    block_bytes;
+    uint64                    chunk_bytes;
+    uint64                    hist_bytes;
+    uint64                    avail;
+    CFE_Status_t              ret = CFE_SUCCESS;
+    uint32                    i;
+    int                       k;
+
+    /* a zero in the table selects the compile-time default */
+    num_txn  = cc->max_transactions ? cc->max_transactions : CF_NUM_TRANSACTIONS_PER_CHANNEL;
+    num_hist = cc->max_histories ? cc->max_histories : CF_NUM_HISTORIES_PER_CHANNEL;
+    max_chunks[CF_Direction_RX] = cc->rx_max_chunks ? cc->rx_max_chunks : CF_DIR_MAX_CHUNKS[CF_Direction_RX][chan_num];
+    max_chunks[CF_Direction_TX] = cc->tx_max_chunks ? cc->tx_max_chunks : CF_DIR_MAX_CHUNKS[CF_Direction_TX][chan_num];
+
+    /*
+     * The chunks per transaction size one pool shared by every list of the
+     * channel, so a transaction with many gaps can use what the others do not.
+     * The sizes are worked out in 64 bits, so table values too large for the
+     * arena fail the check below rather than wrapping into a smaller pool.
+     */
+    num_blocks = (((uint64)num_txn * (max_chunks[CF_Direction_RX] + max_chunks[CF_Direction_TX])) +
+                  CF_CHUNK_BLOCK_SIZE - 1) /
+                 CF_CHUNK_BLOCK_SIZE;
+    txn_cap    = cc->txn_max_chunks ? cc->txn_max_chunks
+                                    : (uint32)CF_Chunk_MIN(num_blocks * CF_CHUNK_BLOCK_SIZE, UINT32_MAX);
+
+    txn_bytes   = CF_CFDP_PoolBytes((uint64)num_txn * sizeof(CF_Transaction_t));
+    cw_bytes    = CF_CFDP_PoolBytes((uint64)num_txn * CF_Direction_NUM * sizeof(CF_ChunkWrapper_t));
+    block_bytes = CF_CFDP_PoolBytes(num_blocks * CF_CHUNK_BLOCK_SIZE * sizeof(CF_Chunk_t));
+    chunk_bytes = block_bytes + CF_CFDP_PoolBytes(num_blocks);
+    hist_bytes  = CF_CFDP_PoolBytes((uint64)num_hist * sizeof(CF_History_t));
+    avail       = sizeof(CF_AppData.engine.pool_arena) - CF_AppData.engine.pool_arena_used;
+
+    if ((txn_bytes + cw_bytes + chunk_bytes + hist_bytes) > avail)
+    {
+        CFE_EVS_SendEvent(CF_INIT_POOL_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "CF: channel %d pools need %lu bytes, only %lu left in arena", chan_num,
+                          (unsigned long)(txn_bytes + cw_bytes + chunk_bytes + hist_bytes), (unsigned long)avail);
+        ret = CF_ERROR;
+    }
+    else
+    {
+        arena = (uint8 *)CF_AppData.engine.pool_arena + CF_AppData.engine.pool_arena_used;
+        CF_AppData.engine.pool_arena_used += txn_bytes + cw_bytes + chunk_bytes + hist_bytes;
+
+        chan->transactions     = (CF_Transaction_t *)arena;
+        cw                     = (CF_ChunkWrapper_t *)(arena + txn_bytes);
+        chan->histories        = (CF_History_t *)(arena + txn_bytes + cw_bytes + chunk_bytes);
+        chan->num_transactions = num_txn;
+        chan->num_histories    = num_hist;
+
+        CF_ChunkPool_Init(&chan->chunk_pool, (CF_Chunk_t *)(arena + txn_bytes + cw_bytes),
+                          arena + txn_bytes + cw_bytes + block_bytes, num_blocks, CF_CHUNK_BLOCK_SIZE);
+
+        for (i = 0, txn = chan->transactions; i < num_txn; ++i, ++txn)
+        {
+            txn->chan_num = chan_num;
+            CF_FreeTransaction(txn);
+
+            for (k = 0; k < CF_Direction_NUM; ++k, ++cw)
+            {
+                CF_ChunkListInitPool(&cw->chunks, &chan->chunk_pool, txn_cap);
+
+                /* space merged into a send list is only sent again, but a receive list must keep it pending */
+                cw->chunks.cover_gaps = (k == CF_Direction_TX);
+                CF_CList_InitNode(&cw->cl_node);
+                CF_CList_InsertBack(&chan->cs[k], &cw->cl_node);
+            }
+        }
+
+        for (i = 0, history = chan->histories; i < num_hist; ++i, ++history)
+        {
+            CF_CList_InitNode(&history->cl_node);
+            CF_CList_InsertBack_Ex(chan, CF_QueueIdx_HIST_FREE, &history->cl_node);
+        }
+
+        /* the high-water marks describe these pools, so they start over with them */
+        hk->txn_hwm   = 0;
+        hk->hist_hwm  = 0;
+        hk->chunk_hwm = 0;
+    }
+
+    return ret;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Creates the semaphores the main task and the worker task of a channel
+ * hand its cycle back and forth with, then the worker task itself.
+ *
+ *-----------------------------------------------------------------*/
+static CFE_Status_t CF_CFDP_StartWorker(int chan_num)
+{
+    CF_Channel_t *chan   = &CF_AppData.engine.channels[chan_num];
+    int32         status = OS_SUCCESS;
+    char          nbuf[OS_MAX_API_NAME];
+
+    /* the sequence number is the one thing channels running alongside each other share */
+    snprintf(nbuf, sizeof(nbuf), "%s", CF_SEQ_MUTEX_NAME);
+    if (!OS_ObjectIdDefined(CF_AppData.engine.seq_mutex))
+    {
+        status = OS_MutSemCreate(&CF_AppData.engine.seq_mutex, nbuf, 0);
+    }
+
+    if (status == OS_SUCCESS)
+    {
+        snprintf(nbuf, sizeof(nbuf), "%s%d", CF_WORKER_WAKE_SEM_PREFIX, chan_num);
+        status = OS_CountSemCreate(&chan->worker_wake_sem, nbuf, 0, 0);
+    }
+
+    if (status == OS_SUCCESS)
+    {
+        snprintf(nbuf, sizeof(nbuf), "%s%d", CF_WORKER_DONE_SEM_PREFIX, chan_num);
+        status = OS_CountSemCreate(&chan->worker_done_sem, nbuf, 0, 0);
+    }
+
+    if (status == OS_SUCCESS)
+    {
+        snprintf(nbuf, sizeof(nbuf), "%s%d", CF_WORKER_TASK_NAME_PREFIX, chan_num);
+        status = CFE_ES_CreateChildTask(&chan->worker_task_id, nbuf, CF_CFDP_WorkerTaskMain, CFE_ES_TASK_STACK_ALLOCATE,
+                                        CF_WORKER_TASK_STACK_SIZE, CF_WORKER_TASK_PRIORITY, 0);
+    }
+
+    if (status != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(CF_INIT_WORKER_TASK_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "CF: failed to start worker %s, returned 0x%08lx", nbuf, (unsigned long)status);
+        status = CF_ERROR;
+    }
+
+    return status;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -931,18 +1236,13 @@ void CF_CFDP_RecvIdle(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *ph)
 CFE_Status_t CF_CFDP_InitEngine(void)
 {
     /* initialize all transaction nodes */
-    CF_History_t *     history;
-    CF_Transaction_t * txn              = CF_AppData.engine.transactions;
-    CF_ChunkWrapper_t *cw               = CF_AppData.engine.chunks;
-    CFE_Status_t       ret              = CFE_SUCCESS;
-    int                chunk_mem_offset = 0;
-    int                i;
-    int                j;
-    int                k;
-    char               nbuf[64];
-
-    static const int CF_DIR_MAX_CHUNKS[CF_Direction_NUM][CF_NUM_CHANNELS] = {CF_CHANNEL_NUM_RX_CHUNKS_PER_TRANSACTION,
-                                                                             CF_CHANNEL_NUM_TX_CHUNKS_PER_TRANSACTION};
+    CF_ReadAhead_t *  ra  = CF_AppData.engine.read_ahead;
+    CF_WriteBehind_t *wb  = CF_AppData.engine.write_behind;
+    CF_RecvBitmap_t * rb  = CF_AppData.engine.recv_bitmap;
+    CFE_Status_t      ret = CFE_SUCCESS;
+    int               i;
+    int               j;
+    char              nbuf[64];
 
     memset(&CF_AppData.engine, 0, sizeof(CF_AppData.engine));
 
@@ -1001,27 +1301,65 @@ CFE_Status_t CF_CFDP_InitEngine(void)
             }
         }
 
-        for (j = 0; j < CF_NUM_TRANSACTIONS_PER_CHANNEL; ++j, ++txn)
+        if (CF_AppData.config_table->chan[i].rx_task_enabled)
         {
-            txn->chan_num = i;
-            CF_FreeTransaction(txn);
+            /* the receive task looks up transactions, so the index needs guarding from then on */
+            snprintf(nbuf, sizeof(nbuf) - 1, "%s%d", CF_INDEX_MUTEX_PREFIX, i);
+            ret = OS_MutSemCreate(&CF_AppData.engine.channels[i].index_mutex, nbuf, 0);
+            if (ret != OS_SUCCESS)
+            {
+                CFE_EVS_SendEvent(CF_INIT_RX_TASK_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "CF: failed to create index mutex %s, returned %ld", nbuf, (long)ret);
+                break;
+            }
 
-            for (k = 0; k < CF_Direction_NUM; ++k, ++cw)
+            snprintf(nbuf, sizeof(nbuf) - 1, "%s%d", CF_RX_TASK_NAME_PREFIX, i);
+            ret = CFE_ES_CreateChildTask(&CF_AppData.engine.channels[i].rx_task_id, nbuf, CF_CFDP_RxTaskMain,
+                                         CFE_ES_TASK_STACK_ALLOCATE, CF_RX_TASK_STACK_SIZE, CF_RX_TASK_PRIORITY, 0);
+            if (ret != CFE_SUCCESS)
             {
-                CF_Assert((chunk_mem_offset + CF_DIR_MAX_CHUNKS[k][i]) <= CF_NUM_CHUNKS_ALL_CHANNELS);
-                CF_ChunkListInit(&cw->chunks, CF_DIR_MAX_CHUNKS[k][i], &CF_AppData.engine.chunk_mem[chunk_mem_offset]);
-                chunk_mem_offset += CF_DIR_MAX_CHUNKS[k][i];
-                CF_CList_InitNode(&cw->cl_node);
-                CF_CList_InsertBack(&CF_AppData.engine.channels[i].cs[k], &cw->cl_node);
+                CFE_EVS_SendEvent(CF_INIT_RX_TASK_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "CF: failed to create receive task %s, returned 0x%08lx", nbuf, (unsigned long)ret);
+                break;
             }
         }
 
-        for (j = 0; j < CF_NUM_HISTORIES_PER_CHANNEL; ++j)
+        if (CF_AppData.config_table->chan[i].worker_task_enabled)
         {
-            history = &CF_AppData.engine.histories[(i * CF_NUM_HISTORIES_PER_CHANNEL) + j];
-            CF_CList_InitNode(&history->cl_node);
-            CF_CList_InsertBack_Ex(&CF_AppData.engine.channels[i], CF_QueueIdx_HIST_FREE, &history->cl_node);
+            ret = CF_CFDP_StartWorker(i);
+            if (ret != CFE_SUCCESS)
+            {
+                break;
+            }
+        }
+
+        /* output byte rate tokens accumulate from now on */
+        CF_AppData.engine.channels[i].out_fill_time = CFE_TIME_GetTime();
+
+        ret = CF_CFDP_InitChannelPools(i);
+        if (ret != CFE_SUCCESS)
+        {
+            break;
         }
+
+        for (j = 0; j < CF_NUM_SEND_READ_AHEAD_BUFFERS_PER_CHAN; ++j, ++ra)
+        {
+            CF_CList_InitNode(&ra->cl_node);
+            CF_CList_InsertBack(&CF_AppData.engine.channels[i].read_ahead_free, &ra->cl_node);
+        }
+
+        for (j = 0; j < CF_NUM_RECV_WRITE_BEHIND_BUFFERS_PER_CHAN; ++j, ++wb)
+        {
+            CF_CList_InitNode(&wb->cl_node);
+            CF_CList_InsertBack(&CF_AppData.engine.channels[i].write_behind_free, &wb->cl_node);
+        }
+
+        for (j = 0; j < CF_NUM_RECV_BITMAPS_PER_CHAN; ++j, ++rb)
+        {
+            CF_CList_InitNode(&rb->cl_node);
+            CF_CList_InsertBack(&CF_AppData.engine.channels[i].recv_bitmap_free, &rb->cl_node);
+        }
+
     }
 
     if (ret == CFE_SUCCESS)
@@ -1068,6 +1406,112 @@ CF_CListTraverse_Status_t CF_CFDP_CycleTxFirstActive(CF_CListNode_t *node, void
     return ret;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static CF_Transaction_t *CF_CFDP_ActivateTx(CF_Channel_t *chan)
+{
+    CF_Transaction_t *txn = container_of(chan->qs[CF_QueueIdx_PEND], CF_Transaction_t, cl_node);
+
+    CF_MoveTransaction(txn, CF_QueueIdx_TXA);
+
+    /* throughput in the EOT packet does not count time spent pending */
+    txn->start_time = CFE_TIME_GetTime();
+
+    return txn;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CF_CListTraverse_Status_t CF_CFDP_CountActiveTx(CF_CListNode_t *node, void *context)
+{
+    CF_CFDP_ActiveTx_args_t *args = (CF_CFDP_ActiveTx_args_t *)context;
+    CF_Transaction_t *       txn  = container_of(node, CF_Transaction_t, cl_node);
+
+    if (!txn->flags.com.suspended)
+    {
+        if (!args->first)
+        {
+            args->first = txn;
+        }
+
+        ++args->num_active;
+    }
+
+    return CF_CLIST_CONT;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_CFDP_CycleTxDrr(CF_Channel_t *chan)
+{
+    const CF_ChannelConfig_t *cc = &CF_AppData.config_table->chan[(chan - CF_AppData.engine.channels)];
+    CF_CFDP_ActiveTx_args_t   args;
+    CF_Transaction_t *        txn;
+    uint32                    max_active;
+
+    max_active = cc->max_active_tx ? cc->max_active_tx : 1;
+
+    while (!chan->cur)
+    {
+        args = (CF_CFDP_ActiveTx_args_t) {NULL, 0};
+        CF_CList_Traverse(chan->qs[CF_QueueIdx_TXA], CF_CFDP_CountActiveTx, &args);
+
+        /* top up the active set from the pending queue, which is kept in priority order */
+        while (args.num_active < max_active && chan->qs[CF_QueueIdx_PEND])
+        {
+            txn = CF_CFDP_ActivateTx(chan);
+            if (!args.first)
+            {
+                args.first = txn;
+            }
+
+            ++args.num_active;
+        }
+
+        if (!args.first)
+        {
+            break; /* nothing left to send */
+        }
+
+        txn = args.first;
+        if (!txn->drr_deficit)
+        {
+            /* start a new turn, lower priority values are more important and get more PDUs */
+            txn->drr_deficit = CF_TX_DRR_MAX_QUANTUM - ((txn->priority * CF_TX_DRR_MAX_QUANTUM) >> 8);
+        }
+
+        while (txn->drr_deficit && !chan->cur && txn->flags.com.q_index == CF_QueueIdx_TXA)
+        {
+            CFE_ES_PerfLogEntry(CF_PERF_ID_PDUSENT(txn->chan_num));
+            CF_CFDP_DispatchTx(txn);
+            CFE_ES_PerfLogExit(CF_PERF_ID_PDUSENT(txn->chan_num));
+
+            /* chan->cur is set when no buffer was available, which does not use up the turn */
+            if (!chan->cur)
+            {
+                --txn->drr_deficit;
+            }
+        }
+
+        if (!txn->drr_deficit && txn->flags.com.q_index == CF_QueueIdx_TXA)
+        {
+            /* turn is over, go to the back of the line */
+            CF_MoveTransaction(txn, CF_QueueIdx_TXA);
+        }
+    }
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -1076,7 +1520,6 @@ CF_CListTraverse_Status_t CF_CFDP_CycleTxFirstActive(CF_CListNode_t *node, void
  *-----------------------------------------------------------------*/
 void CF_CFDP_CycleTx(CF_Channel_t *chan)
 {
-    CF_Transaction_t *     txn;
     CF_CFDP_CycleTx_args_t args;
 
     if (CF_AppData.config_table->chan[(chan - CF_AppData.engine.channels)].dequeue_enabled)
@@ -1090,19 +1533,25 @@ void CF_CFDP_CycleTx(CF_Channel_t *chan)
         if (!chan->cur)
         { /* don't enter if cur is set, since we need to pick up where we left off on tick processing next wakeup */
 
-            while (true)
+            if (CF_AppData.config_table->chan[(chan - CF_AppData.engine.channels)].tx_drr_enabled)
             {
-                /* Attempt to run something on TXA */
-                CF_CList_Traverse(chan->qs[CF_QueueIdx_TXA], CF_CFDP_CycleTxFirstActive, &args);
-
-                /* Keep going until CF_QueueIdx_PEND is empty or something is run */
-                if (args.ran_one || chan->qs[CF_QueueIdx_PEND] == NULL)
+                CF_CFDP_CycleTxDrr(chan);
+            }
+            else
+            {
+                while (true)
                 {
-                    break;
-                }
+                    /* Attempt to run something on TXA */
+                    CF_CList_Traverse(chan->qs[CF_QueueIdx_TXA], CF_CFDP_CycleTxFirstActive, &args);
 
-                txn = container_of(chan->qs[CF_QueueIdx_PEND], CF_Transaction_t, cl_node);
-                CF_MoveTransaction(txn, CF_QueueIdx_TXA);
+                    /* Keep going until CF_QueueIdx_PEND is empty or something is run */
+                    if (args.ran_one || chan->qs[CF_QueueIdx_PEND] == NULL)
+                    {
+                        break;
+                    }
+
+                    CF_CFDP_ActivateTx(chan);
+                }
             }
         }
 
@@ -1111,6 +1560,39 @@ void CF_CFDP_CycleTx(CF_Channel_t *chan)
     }
 }
 
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static bool CF_CFDP_TxnNeedsTick(const CF_Transaction_t *txn)
+{
+    bool ret = false;
+
+    /* NOTE: the transaction may have been freed by the tick, which leaves it idle */
+    if (!txn->flags.com.suspended)
+    {
+        if (txn->state == CF_TxnState_R2)
+        {
+            ret = txn->flags.rx.send_ack || txn->flags.rx.send_nak || txn->flags.rx.send_fin ||
+                  txn->flags.rx.send_imm_nak;
+        }
+        else if ((txn->state == CF_TxnState_S2) && (txn->flags.com.q_index == CF_QueueIdx_TXW))
+        {
+            ret = (txn->state_data.send.sub_state == CF_TxSubState_SEND_FIN_ACK) || txn->flags.tx.md_need_send ||
+                  (CF_ChunkList_GetFirstChunk(&txn->chunks->chunks) != NULL) ||
+                  ((txn->state_data.send.sub_state == CF_TxSubState_WAIT_FOR_EOF_ACK) &&
+                   txn->flags.com.ack_timer_armed && CF_Timer_Expired(&txn->ack_timer));
+        }
+        else
+        {
+            /* everything else only has timers to check */
+        }
+    }
+
+    return ret;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -1121,12 +1603,15 @@ CF_CListTraverse_Status_t CF_CFDP_DoTick(CF_CListNode_t *node, void *context)
 {
     CF_CListTraverse_Status_t ret  = CF_CLIST_CONT; /* CF_CLIST_CONT means don't tick one, keep looking for cur */
     CF_CFDP_Tick_args_t *     args = (CF_CFDP_Tick_args_t *)context;
-    CF_Transaction_t *        txn  = container_of(node, CF_Transaction_t, cl_node);
+    CF_Transaction_t *        txn  = container_of(node, CF_Transaction_t, tick_node);
     if (!args->chan->cur || (args->chan->cur == txn))
     {
         /* found where we left off, so clear that and move on */
         args->chan->cur = NULL;
-        if (!txn->flags.com.suspended)
+
+        /* senders only tick once they are waiting on the receiver; before that, CF_CFDP_CycleTx runs them */
+        if (!txn->flags.com.suspended &&
+            (!CF_CFDP_IsSender(txn) || (txn->flags.com.q_index == CF_QueueIdx_TXW)))
         {
             args->fn(txn, &args->cont);
         }
@@ -1139,6 +1624,11 @@ CF_CListTraverse_Status_t CF_CFDP_DoTick(CF_CListNode_t *node, void *context)
             ret              = CF_CLIST_EXIT;
             args->early_exit = true;
         }
+        else if (!CF_CFDP_TxnNeedsTick(txn))
+        {
+            /* nothing left to do until a timer expires or a PDU comes in */
+            CF_RemoveTransactionTick(txn);
+        }
     }
 
     return ret; /* don't tick one, keep looking for cur */
@@ -1156,7 +1646,7 @@ void CF_CFDP_TickTransactions(CF_Channel_t *chan)
 
     void (*fns[CF_TickType_NUM_TYPES])(CF_Transaction_t *, int *) = {CF_CFDP_R_Tick, CF_CFDP_S_Tick,
                                                                      CF_CFDP_S_Tick_Nak};
-    int qs[CF_TickType_NUM_TYPES]                                 = {CF_QueueIdx_RX, CF_QueueIdx_TXW, CF_QueueIdx_TXW};
+    int dirs[CF_TickType_NUM_TYPES] = {CF_Direction_RX, CF_Direction_TX, CF_Direction_TX};
 
     CF_Assert(chan->tick_type < CF_TickType_NUM_TYPES);
 
@@ -1167,7 +1657,7 @@ void CF_CFDP_TickTransactions(CF_Channel_t *chan)
         do
         {
             args.cont = 0;
-            CF_CList_Traverse(chan->qs[qs[chan->tick_type]], CF_CFDP_DoTick, &args);
+            CF_CList_Traverse(chan->tick_list[dirs[chan->tick_type]], CF_CFDP_DoTick, &args);
             if (args.early_exit)
             {
                 /* early exit means we ran out of available outgoing messages this wakeup.
@@ -1219,6 +1709,8 @@ void CF_CFDP_InitTxnTxFile(CF_Transaction_t *txn, CF_CFDP_Class_t cfdp_class, ui
     txn->priority = priority;
     txn->keep     = keep;
     txn->state    = cfdp_class ? CF_TxnState_S2 : CF_TxnState_S1;
+
+    CF_CRC_Start(&txn->crc, CF_AppData.config_table->chan[chan].checksum_type);
 }
 
 /*----------------------------------------------------------------
@@ -1232,19 +1724,27 @@ static void CF_CFDP_TxFile_Initiate(CF_Transaction_t *txn, CF_CFDP_Class_t cfdp_
     CFE_EVS_SendEvent(CF_CFDP_S_START_SEND_INF_EID, CFE_EVS_EventType_INFORMATION,
                       "CF: start class %d tx of file %lu:%.*s -> %lu:%.*s", cfdp_class + 1,
                       (unsigned long)CF_AppData.config_table->local_eid, CF_FILENAME_MAX_LEN,
-                      txn->history->fnames.src_filename, (unsigned long)dest_id, CF_FILENAME_MAX_LEN,
-                      txn->history->fnames.dst_filename);
+                      txn->fnames.src_filename, (unsigned long)dest_id, CF_FILENAME_MAX_LEN,
+                      txn->fnames.dst_filename);
 
     CF_CFDP_InitTxnTxFile(txn, cfdp_class, keep, chan, priority);
 
-    /* Increment sequence number for new transaction */
-    ++CF_AppData.engine.seq_num;
+    /* Increment sequence number for new transaction, worker tasks may be doing the same */
+    if (OS_ObjectIdDefined(CF_AppData.engine.seq_mutex))
+    {
+        OS_MutSemTake(CF_AppData.engine.seq_mutex);
+    }
+    txn->history->seq_num = ++CF_AppData.engine.seq_num;
+    if (OS_ObjectIdDefined(CF_AppData.engine.seq_mutex))
+    {
+        OS_MutSemGive(CF_AppData.engine.seq_mutex);
+    }
 
     /* Capture info for history */
     txn->history->dir      = CF_Direction_TX;
-    txn->history->seq_num  = CF_AppData.engine.seq_num;
     txn->history->src_eid  = CF_AppData.config_table->local_eid;
     txn->history->peer_eid = dest_id;
+    CF_InsertTransactionIndex(&CF_AppData.engine.channels[chan], txn);
 
     CF_CFDP_ArmInactTimer(txn);
 
@@ -1262,7 +1762,7 @@ static void CF_CFDP_TxFile_Initiate(CF_Transaction_t *txn, CF_CFDP_Class_t cfdp_
 CFE_Status_t CF_CFDP_TxFile(const char *src_filename, const char *dst_filename, CF_CFDP_Class_t cfdp_class, uint8 keep,
                             uint8 chan_num, uint8 priority, CF_EntityId_t dest_id)
 {
-    CF_Transaction_t *txn;
+    CF_Transaction_t *txn  = NULL;
     CF_Channel_t *    chan = &CF_AppData.engine.channels[chan_num];
     CF_Assert(chan_num < CF_NUM_CHANNELS);
 
@@ -1276,16 +1776,25 @@ CFE_Status_t CF_CFDP_TxFile(const char *src_filename, const char *dst_filename,
     }
     else
     {
+        /* the table may size the pool below the worst case, so this can run out */
         txn = CF_FindUnusedTransaction(&CF_AppData.engine.channels[chan_num]);
-        CF_Assert(txn); /* should always have a free transaction at this point */
+        if (txn == NULL)
+        {
+            CFE_EVS_SendEvent(CF_CFDP_NO_TXN_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "CF: no free transaction on channel %d", chan_num);
+            ret = CF_ERROR;
+        }
+    }
 
+    if (txn != NULL)
+    {
         CF_Assert(txn->state == CF_TxnState_IDLE);
 
         /* NOTE: the caller of this function ensures the provided src and dst filenames are NULL terminated */
-        strncpy(txn->history->fnames.src_filename, src_filename, sizeof(txn->history->fnames.src_filename) - 1);
-        txn->history->fnames.src_filename[sizeof(txn->history->fnames.src_filename) - 1] = 0;
-        strncpy(txn->history->fnames.dst_filename, dst_filename, sizeof(txn->history->fnames.dst_filename) - 1);
-        txn->history->fnames.dst_filename[sizeof(txn->history->fnames.dst_filename) - 1] = 0;
+        strncpy(txn->fnames.src_filename, src_filename, sizeof(txn->fnames.src_filename) - 1);
+        txn->fnames.src_filename[sizeof(txn->fnames.src_filename) - 1] = 0;
+        strncpy(txn->fnames.dst_filename, dst_filename, sizeof(txn->fnames.dst_filename) - 1);
+        txn->fnames.dst_filename[sizeof(txn->fnames.dst_filename) - 1] = 0;
         CF_CFDP_TxFile_Initiate(txn, cfdp_class, keep, chan_num, priority, dest_id);
 
         ++chan->num_cmd_tx;
@@ -1380,7 +1889,8 @@ void CF_CFDP_ProcessPlaybackDirectory(CF_Channel_t *chan, CF_Playback_t *pb)
 
     memset(&dirent, 0, sizeof(dirent));
 
-    while (pb->diropen && (pb->num_ts < CF_NUM_TRANSACTIONS_PER_PLAYBACK))
+    /* stop while the channel's transaction pool is empty, the next entry is read once one is freed */
+    while (pb->diropen && (pb->num_ts < CF_NUM_TRANSACTIONS_PER_PLAYBACK) && (chan->qs[CF_QueueIdx_FREE] != NULL))
     {
         CFE_ES_PerfLogEntry(CF_PERF_ID_DIRREAD);
         status = OS_DirectoryRead(pb->dir_id, &dirent);
@@ -1394,18 +1904,17 @@ void CF_CFDP_ProcessPlaybackDirectory(CF_Channel_t *chan, CF_Playback_t *pb)
             }
 
             txn = CF_FindUnusedTransaction(chan);
-            CF_Assert(pt); /* should be impossible not to have one because there are limits on the number of uses of
-                                them */
+            CF_Assert(txn); /* the loop only runs while the free queue has one */
 
             /* the -1 below is to make room for the slash */
-            snprintf(txn->history->fnames.src_filename, sizeof(txn->history->fnames.src_filename), "%.*s/%.*s",
+            snprintf(txn->fnames.src_filename, sizeof(txn->fnames.src_filename), "%.*s/%.*s",
                      CF_FILENAME_MAX_PATH - 1, pb->fnames.src_filename, CF_FILENAME_MAX_NAME - 1, dirent.FileName);
-            snprintf(txn->history->fnames.dst_filename, sizeof(txn->history->fnames.dst_filename), "%.*s/%.*s",
+            snprintf(txn->fnames.dst_filename, sizeof(txn->fnames.dst_filename), "%.*s/%.*s",
                      CF_FILENAME_MAX_PATH - 1, pb->fnames.dst_filename, CF_FILENAME_MAX_NAME - 1, dirent.FileName);
 
             /* in case snprintf didn't have room for NULL terminator */
-            txn->history->fnames.src_filename[CF_FILENAME_MAX_LEN - 1] = 0;
-            txn->history->fnames.dst_filename[CF_FILENAME_MAX_LEN - 1] = 0;
+            txn->fnames.src_filename[CF_FILENAME_MAX_LEN - 1] = 0;
+            txn->fnames.dst_filename[CF_FILENAME_MAX_LEN - 1] = 0;
 
             CF_CFDP_TxFile_Initiate(txn, pb->cfdp_class, pb->keep, (chan - CF_AppData.engine.channels), pb->priority,
                                     pb->dest_id);
@@ -1502,7 +2011,7 @@ void CF_CFDP_ProcessPollingDirectories(CF_Channel_t *chan)
                 if (!poll->timer_set && pd->interval_sec)
                 {
                     /* timer was not set, so set it now */
-                    CF_Timer_InitRelSec(&poll->interval_timer, pd->interval_sec);
+                    CF_Timer_InitRelSec(&chan->timer_wheel, &poll->interval_timer, pd->interval_sec, NULL);
                     poll->timer_set = true;
                 }
                 else if (CF_Timer_Expired(&poll->interval_timer))
@@ -1519,13 +2028,9 @@ void CF_CFDP_ProcessPollingDirectories(CF_Channel_t *chan)
                         /* error occurred in playback directory, so reset the timer */
                         /* an event is sent in CF_CFDP_PlaybackDir_Initiate so there is no reason to
                          * to have another here */
-                        CF_Timer_InitRelSec(&poll->interval_timer, pd->interval_sec);
+                        CF_Timer_InitRelSec(&chan->timer_wheel, &poll->interval_timer, pd->interval_sec, NULL);
                     }
                 }
-                else
-                {
-                    CF_Timer_Tick(&poll->interval_timer);
-                }
             }
             else
             {
@@ -1540,6 +2045,46 @@ void CF_CFDP_ProcessPollingDirectories(CF_Channel_t *chan)
     }
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_CFDP_CycleChannel(CF_Channel_t *chan)
+{
+    const int chan_num = (chan - CF_AppData.engine.channels);
+
+    chan->outgoing_counter = 0;
+
+    CF_CFDP_RefillOutputTokens(chan);
+
+    /* consume all received messages, even if channel is frozen */
+    CF_CFDP_ReceiveMessage(chan);
+
+    if (!CF_AppData.hk.Payload.channel_hk[chan_num].frozen)
+    {
+        /* handle ticks before tx cycle. Do this because there may be a limited number of TX messages available
+         * this cycle, and it's important to respond to class 2 ACK/NAK more than it is to send new filedata
+         * PDUs. */
+
+        /* expire timers, which puts their transactions on the tick list */
+        CF_Timer_Tick(&chan->timer_wheel);
+
+        /* cycle all transactions (tick) */
+        CF_CFDP_TickTransactions(chan);
+
+        /* cycle the current tx transaction */
+        CF_CFDP_CycleTx(chan);
+
+        CF_CFDP_ProcessPlaybackDirectories(chan);
+        CF_CFDP_ProcessPollingDirectories(chan);
+    }
+
+    /* buffers and pipe credits not used this cycle go back */
+    CF_CFDP_ReleaseOutput(chan);
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -1553,31 +2098,82 @@ void CF_CFDP_CycleEngine(void)
 
     if (CF_AppData.engine.enabled)
     {
+        /* start the channels with a worker first, so they run alongside the rest */
         for (i = 0; i < CF_NUM_CHANNELS; ++i)
         {
-            chan                               = &CF_AppData.engine.channels[i];
-            CF_AppData.engine.outgoing_counter = 0;
+            chan = &CF_AppData.engine.channels[i];
+            if (CFE_RESOURCEID_TEST_DEFINED(chan->worker_task_id))
+            {
+                OS_CountSemGive(chan->worker_wake_sem);
+            }
+        }
 
-            /* consume all received messages, even if channel is frozen */
-            CF_CFDP_ReceiveMessage(chan);
+        for (i = 0; i < CF_NUM_CHANNELS; ++i)
+        {
+            chan = &CF_AppData.engine.channels[i];
+            if (!CFE_RESOURCEID_TEST_DEFINED(chan->worker_task_id))
+            {
+                CF_CFDP_CycleChannel(chan);
+            }
+        }
 
-            if (!CF_AppData.hk.Payload.channel_hk[i].frozen)
+        /* commands and housekeeping only run in between cycles, so wait for every worker to finish */
+        for (i = 0; i < CF_NUM_CHANNELS; ++i)
+        {
+            chan = &CF_AppData.engine.channels[i];
+            if (CFE_RESOURCEID_TEST_DEFINED(chan->worker_task_id))
             {
-                /* handle ticks before tx cycle. Do this because there may be a limited number of TX messages available
-                 * this cycle, and it's important to respond to class 2 ACK/NAK more than it is to send new filedata
-                 * PDUs. */
+                OS_CountSemTake(chan->worker_done_sem);
+            }
+        }
+    }
+}
 
-                /* cycle all transactions (tick) */
-                CF_CFDP_TickTransactions(chan);
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_CFDP_WorkerTaskMain(void)
+{
+    CF_Channel_t *  chan = NULL;
+    CFE_ES_TaskId_t task_id;
+    int             chan_num;
+    int             i;
 
-                /* cycle the current tx transaction */
-                CF_CFDP_CycleTx(chan);
+    CFE_ES_GetTaskID(&task_id);
 
-                CF_CFDP_ProcessPlaybackDirectories(chan);
-                CF_CFDP_ProcessPollingDirectories(chan);
+    /* the engine stores the task id when CFE_ES_CreateChildTask() returns,
+     * which may be after this task has started, so allow it some time */
+    for (i = 0; chan == NULL && i < CF_STARTUP_SEM_MAX_RETRIES; ++i)
+    {
+        for (chan_num = 0; chan_num < CF_NUM_CHANNELS; ++chan_num)
+        {
+            if (CFE_RESOURCEID_TEST_EQUAL(CF_AppData.engine.channels[chan_num].worker_task_id, task_id))
+            {
+                chan = &CF_AppData.engine.channels[chan_num];
+                break;
             }
         }
+
+        if (chan == NULL)
+        {
+            OS_TaskDelay(CF_STARTUP_SEM_TASK_DELAY);
+        }
     }
+
+    if (chan != NULL)
+    {
+        /* runs until the engine deletes this task, or its semaphores */
+        while (OS_CountSemTake(chan->worker_wake_sem) == OS_SUCCESS)
+        {
+            CF_CFDP_CycleChannel(chan);
+            OS_CountSemGive(chan->worker_done_sem);
+        }
+    }
+
+    CFE_ES_ExitChildTask();
 }
 
 /*----------------------------------------------------------------
@@ -1628,12 +2224,31 @@ void CF_CFDP_ResetTransaction(CF_Transaction_t *txn, bool keep_history)
             CF_Assert(txn->pb->num_ts);
             --txn->pb->num_ts;
         }
+
+        if (txn->state_data.send.read_ahead)
+        {
+            CF_CList_InsertBack(&chan->read_ahead_free, &txn->state_data.send.read_ahead->cl_node);
+        }
+    }
+    else
+    {
+        if (txn->state_data.receive.write_behind)
+        {
+            /* any data still in it was flushed before the file was kept, otherwise the file is gone */
+            CF_CList_InsertBack(&chan->write_behind_free, &txn->state_data.receive.write_behind->cl_node);
+        }
+
+        if (txn->state_data.receive.bitmap)
+        {
+            CF_CList_InsertBack(&chan->recv_bitmap_free, &txn->state_data.receive.bitmap->cl_node);
+        }
     }
 
     /* bookkeeping for all transactions */
     /* move transaction history to history queue */
     if (keep_history)
     {
+        CF_StoreHistoryNames(chan, txn->history, &txn->fnames);
         CF_CList_InsertBack_Ex(chan, CF_QueueIdx_HIST, &txn->history->cl_node);
     }
     else
@@ -1641,6 +2256,16 @@ void CF_CFDP_ResetTransaction(CF_Transaction_t *txn, bool keep_history)
         CF_CList_InsertBack_Ex(chan, CF_QueueIdx_HIST_FREE, &txn->history->cl_node);
     }
 
+    /* a list may grow past what the 16 bit counter holds, which then stays at its maximum */
+    if (txn->chunks->chunks.hwm > CF_AppData.hk.Payload.channel_hk[txn->chan_num].chunk_hwm)
+    {
+        CF_AppData.hk.Payload.channel_hk[txn->chan_num].chunk_hwm = CF_Chunk_MIN(txn->chunks->chunks.hwm, UINT16_MAX);
+    }
+    CF_AppData.hk.Payload.channel_hk[txn->chan_num].chunk_merges += txn->chunks->chunks.merges;
+    CF_AppData.hk.Payload.channel_hk[txn->chan_num].chunk_drops += txn->chunks->chunks.drops;
+
+    /* the next transaction starts with an empty list, with no bitmap attached */
+    CF_ChunkListReset(&txn->chunks->chunks);
     CF_CList_InsertBack(&chan->cs[!!CF_CFDP_IsSender(txn)], &txn->chunks->cl_node);
 
     if (chan->cur == txn)
@@ -1672,8 +2297,10 @@ void CF_CFDP_SetTxnStatus(CF_Transaction_t *txn, CF_TxnStatus_t txn_stat)
  *-----------------------------------------------------------------*/
 void CF_CFDP_SendEotPkt(CF_Transaction_t *txn)
 {
-    CF_EotPacket_t * EotPktPtr;
-    CFE_SB_Buffer_t *BufPtr;
+    CF_EotPacket_t *   EotPktPtr;
+    CFE_SB_Buffer_t *  BufPtr;
+    CFE_TIME_SysTime_t elapsed;
+    uint32             elapsed_ms;
 
     /*
     ** Get a Message block of memory and initialize it
@@ -1688,14 +2315,28 @@ void CF_CFDP_SendEotPkt(CF_Transaction_t *txn)
 
         EotPktPtr->Payload.channel    = txn->chan_num;
         EotPktPtr->Payload.direction  = txn->history->dir;
-        EotPktPtr->Payload.fnames     = txn->history->fnames;
+        EotPktPtr->Payload.fnames     = txn->fnames;
         EotPktPtr->Payload.state      = txn->state;
         EotPktPtr->Payload.txn_stat   = txn->history->txn_stat;
         EotPktPtr->Payload.src_eid    = txn->history->src_eid;
         EotPktPtr->Payload.peer_eid   = txn->history->peer_eid;
         EotPktPtr->Payload.seq_num    = txn->history->seq_num;
-        EotPktPtr->Payload.fsize      = txn->fsize;
         EotPktPtr->Payload.crc_result = txn->crc.result;
+        EotPktPtr->Payload.fsize      = txn->fsize;
+
+        elapsed    = CFE_TIME_Subtract(CFE_TIME_GetTime(), txn->start_time);
+        elapsed_ms = (elapsed.Seconds * 1000) + (CFE_TIME_Sub2MicroSecs(elapsed.Subseconds) / 1000);
+
+        EotPktPtr->Payload.file_data_bytes = txn->file_data_bytes;
+        EotPktPtr->Payload.elapsed_ms      = elapsed_ms;
+        if (elapsed_ms)
+        {
+            EotPktPtr->Payload.bytes_per_second = (uint32)((txn->file_data_bytes * 1000) / elapsed_ms);
+        }
+        else
+        {
+            EotPktPtr->Payload.bytes_per_second = (uint32)txn->file_data_bytes;
+        }
 
         /*
         ** Timestamp and send eod of transaction telemetry
@@ -1739,6 +2380,12 @@ void CF_CFDP_CancelTransaction(CF_Transaction_t *txn)
         txn->flags.com.canceled = true;
         CF_CFDP_SetTxnStatus(txn, CF_TxnStatus_CANCEL_REQUEST_RECEIVED);
         fns[!!CF_CFDP_IsSender(txn)](txn);
+
+        /* cancel handling may have left something to send from tick processing */
+        if (txn->flags.com.q_index != CF_QueueIdx_FREE)
+        {
+            CF_InsertTransactionTick(&CF_AppData.engine.channels[txn->chan_num], txn);
+        }
     }
 }
 
@@ -1803,8 +2450,53 @@ void CF_CFDP_DisableEngine(void)
         /* finally all queue counters must be reset */
         memset(&CF_AppData.hk.Payload.channel_hk[i].q_size, 0, sizeof(CF_AppData.hk.Payload.channel_hk[i].q_size));
 
+        /*
+         * The receive task blocks on the pipe, so stop it first.  Holding the index mutex
+         * keeps it from being stopped in the middle of a lookup with the mutex held, which
+         * could then not be deleted.
+         */
+        if (OS_ObjectIdDefined(chan->index_mutex))
+        {
+            OS_MutSemTake(chan->index_mutex);
+        }
+        if (CFE_RESOURCEID_TEST_DEFINED(chan->rx_task_id))
+        {
+            CFE_ES_DeleteChildTask(chan->rx_task_id);
+            chan->rx_task_id = CFE_ES_TASKID_UNDEFINED;
+        }
+        if (OS_ObjectIdDefined(chan->index_mutex))
+        {
+            OS_MutSemGive(chan->index_mutex);
+            OS_MutSemDelete(chan->index_mutex);
+            chan->index_mutex = OS_OBJECT_ID_UNDEFINED;
+        }
+
+        /* the worker is waiting for the next cycle, which will not come */
+        if (CFE_RESOURCEID_TEST_DEFINED(chan->worker_task_id))
+        {
+            CFE_ES_DeleteChildTask(chan->worker_task_id);
+            chan->worker_task_id = CFE_ES_TASKID_UNDEFINED;
+        }
+        if (OS_ObjectIdDefined(chan->worker_wake_sem))
+        {
+            OS_CountSemDelete(chan->worker_wake_sem);
+            chan->worker_wake_sem = OS_OBJECT_ID_UNDEFINED;
+        }
+        if (OS_ObjectIdDefined(chan->worker_done_sem))
+        {
+            OS_CountSemDelete(chan->worker_done_sem);
+            chan->worker_done_sem = OS_OBJECT_ID_UNDEFINED;
+        }
+
+        CF_CFDP_ReleaseOutput(chan);
         CFE_SB_DeletePipe(chan->pipe);
     }
+
+    if (OS_ObjectIdDefined(CF_AppData.engine.seq_mutex))
+    {
+        OS_MutSemDelete(CF_AppData.engine.seq_mutex);
+        CF_AppData.engine.seq_mutex = OS_OBJECT_ID_UNDEFINED;
+    }
 }
 
 /*----------------------------------------------------------------
@@ -1855,22 +2547,22 @@ void CF_CFDP_HandleNotKeepFile(CF_Transaction_t *txn)
         if(!CF_TxnStatus_IsError(txn->history->txn_stat))
         {
             /* If move directory is defined attempt move */
-            CF_CFDP_MoveFile(txn->history->fnames.src_filename, CF_AppData.config_table->chan[txn->chan_num].move_dir);
+            CF_CFDP_MoveFile(txn->fnames.src_filename, CF_AppData.config_table->chan[txn->chan_num].move_dir);
         }
         else
         {
             /* file inside an polling directory */
-            if(CF_CFDP_IsPollingDir(txn->history->fnames.src_filename, txn->chan_num))
+            if(CF_CFDP_IsPollingDir(txn->fnames.src_filename, txn->chan_num))
             {
                 /* If fail directory is defined attempt move */
-                CF_CFDP_MoveFile(txn->history->fnames.src_filename, CF_AppData.config_table->fail_dir);
+                CF_CFDP_MoveFile(txn->fnames.src_filename, CF_AppData.config_table->fail_dir);
             }
         }
     }
     /* Not Sender */
     else
     {
-        OS_remove(txn->history->fnames.dst_filename);
+        OS_remove(txn->fnames.dst_filename);
     }
 }
 
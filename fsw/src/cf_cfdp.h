@@ -37,6 +37,15 @@ typedef struct CF_CFDP_CycleTx_args
     int           ran_one; /**< \brief should be set to 1 if a transaction was cycled */
 } CF_CFDP_CycleTx_args_t;
 
+/**
+ * @brief Structure for use with the CF_CFDP_CountActiveTx() function
+ */
+typedef struct CF_CFDP_ActiveTx_args
+{
+    CF_Transaction_t *first;      /**< \brief first transaction on the queue that is not suspended */
+    uint32            num_active; /**< \brief number of transactions on the queue that are not suspended */
+} CF_CFDP_ActiveTx_args_t;
+
 /**
  * @brief Structure for use with the CF_CFDP_DoTick() function
  */
@@ -134,6 +143,12 @@ CFE_Status_t CF_CFDP_InitEngine(void);
 
 /************************************************************************/
 /** @brief Cycle the engine. Called once per wakeup.
+ *
+ * @par Description
+ *       Starts the cycle of each channel that has a worker task, cycles the
+ *       other channels in the calling task, then waits until every worker
+ *       is done.  So commands and housekeeping, which run in the main task
+ *       between calls, never run alongside a channel cycle.
  *
  * @par Assumptions, External Events, and Notes:
  *       None
@@ -141,6 +156,39 @@ CFE_Status_t CF_CFDP_InitEngine(void);
  */
 void CF_CFDP_CycleEngine(void);
 
+/************************************************************************/
+/** @brief Cycle one channel of the engine.
+ *
+ * @par Description
+ *       Receives the PDUs waiting for the channel, then unless it is frozen
+ *       runs its timers, ticks its transactions, sends file data and steps
+ *       its playback and polling directories.  Unused output buffers are
+ *       given back at the end.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       chan must be a member of the array within the CF_AppData global object.
+ *       This only changes the state of chan and its own housekeeping, apart
+ *       from the sequence number, which is guarded.  So channels may be
+ *       cycled alongside each other.
+ *
+ * @param chan  Channel to cycle
+ */
+void CF_CFDP_CycleChannel(CF_Channel_t *chan);
+
+/************************************************************************/
+/** @brief Entry point of the worker child task of a channel.
+ *
+ * @par Description
+ *       Waits for the main task to start each cycle, cycles the channel and
+ *       signals the main task when done.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       Started by CF_CFDP_InitEngine() for channels with worker_task_enabled
+ *       set in the configuration table. It finds its channel by its task id.
+ *
+ */
+void CF_CFDP_WorkerTaskMain(void);
+
 /************************************************************************/
 /** @brief Disables the CFDP engine and resets all state in it.
  *
@@ -219,6 +267,37 @@ CF_Logical_PduBuffer_t *CF_CFDP_ConstructPduHeader(const CF_Transaction_t *txn,
                                                    CF_EntityId_t src_eid, CF_EntityId_t dst_eid, bool towards_sender,
                                                    CF_TransactionSeq_t tsn, bool silent);
 
+/************************************************************************/
+/** @brief Build the file data PDU header template for a send transaction.
+ *
+ * Encodes the base header used by every file data PDU of the transaction, so that
+ * CF_CFDP_ConstructFileDataHeader() only needs to copy it.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       txn must not be NULL.
+ *
+ * @param txn              Pointer to the transaction object
+ */
+void CF_CFDP_InitFileDataHeader(CF_Transaction_t *txn);
+
+/************************************************************************/
+/** @brief Build a file data PDU header in the output buffer from the transaction template.
+ *
+ * Produces the same result as CF_CFDP_ConstructPduHeader() with a directive code of 0,
+ * the local and peer EIDs and the transaction sequence number.  The template is built
+ * first if CF_CFDP_InitFileDataHeader() has not been called yet.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       txn must not be NULL.
+ *
+ * @param txn              Pointer to the transaction object
+ * @param silent         If true, suppress error event if no message buffer available
+ *
+ * @returns Pointer to PDU buffer which may be filled with additional data
+ * @retval  NULL if no message buffer available
+ */
+CF_Logical_PduBuffer_t *CF_CFDP_ConstructFileDataHeader(CF_Transaction_t *txn, bool silent);
+
 /************************************************************************/
 /** @brief Build a metadata PDU for transmit.
  *
@@ -344,11 +423,32 @@ CFE_Status_t CF_CFDP_SendNak(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *ph);
 void CF_CFDP_AppendTlv(CF_Logical_TlvList_t *ptlv_list, CF_CFDP_TlvType_t tlv_type);
 
 /************************************************************************/
-/** @brief Unpack a basic PDU header from a received message.
+/** @brief Decode a basic PDU header from a received message.
  *
  * @par Description
  *       This interprets the common PDU header and the file directive header
- *       (if applicable) and populates the logical PDU buffer.
+ *       (if applicable) and populates the logical PDU buffer.  Errors are
+ *       reported by event, but not counted.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       A new message has been received.  Safe to call from the channel
+ *       receive task, as it touches nothing but ph.
+ *
+ * @param ph       The logical PDU buffer being received
+ *
+ * @returns integer status code
+ * @retval CFE_SUCCESS on success
+ * @retval CF_ERROR for general errors
+ * @retval CF_SHORT_PDU_ERROR if PDU too short
+ */
+CFE_Status_t CF_CFDP_DecodePh(CF_Logical_PduBuffer_t *ph);
+
+/************************************************************************/
+/** @brief Unpack a basic PDU header from a received message.
+ *
+ * @par Description
+ *       Decodes the header with CF_CFDP_DecodePh(), and counts the PDU as
+ *       received or in error.
  *
  * @par Assumptions, External Events, and Notes:
  *       A new message has been received.
@@ -546,7 +646,8 @@ int CF_CFDP_CopyStringFromLV(char *buf, size_t buf_maxsz, const CF_Logical_Lv_t
 /** @brief Arm the ACK timer
  *
  * @par Description
- *       Helper function to arm the ACK timer and set the flag.
+ *       Helper function to arm the ACK timer and set the flag.  The timer
+ *       of a suspended transaction is armed paused.
  *
  * @par Assumptions, External Events, and Notes:
  *       txn must not be NULL.
@@ -555,6 +656,48 @@ int CF_CFDP_CopyStringFromLV(char *buf, size_t buf_maxsz, const CF_Logical_Lv_t
  */
 void CF_CFDP_ArmAckTimer(CF_Transaction_t *txn);
 
+/************************************************************************/
+/** @brief Arm the inactivity timer
+ *
+ * @par Description
+ *       Helper function to (re)start the inactivity timer from the channel configuration.
+ *       The timer of a suspended transaction is armed paused.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       txn must not be NULL.
+ *
+ * @param txn          Pointer to the transaction state
+ */
+void CF_CFDP_ArmInactTimer(CF_Transaction_t *txn);
+
+/************************************************************************/
+/** @brief Expire function of the ACK timer
+ *
+ * @par Description
+ *       Puts the transaction on its channel's tick list, so tick
+ *       processing can act on the expired timer.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       timer must not be NULL, and must be the ack_timer of a transaction.
+ *
+ * @param timer        Pointer to the timer that expired
+ */
+void CF_CFDP_AckTimerExpired(CF_Timer_t *timer);
+
+/************************************************************************/
+/** @brief Expire function of the inactivity timer
+ *
+ * @par Description
+ *       Puts the transaction on its channel's tick list, so tick
+ *       processing can act on the expired timer.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       timer must not be NULL, and must be the inactivity_timer of a transaction.
+ *
+ * @param timer        Pointer to the timer that expired
+ */
+void CF_CFDP_InactTimerExpired(CF_Timer_t *timer);
+
 /************************************************************************/
 /** @brief Receive state function to ignore a packet.
  *
@@ -614,12 +757,49 @@ CF_CListTraverse_Status_t CF_CFDP_CloseFiles(CF_CListNode_t *node, void *context
  *       tries again to find an active one.
  *
  * @par Assumptions, External Events, and Notes:
- *       None
+ *       Channels with tx_drr_enabled set in the configuration table use
+ *       CF_CFDP_CycleTxDrr() instead.
  *
  * @param chan Channel to cycle
  */
 void CF_CFDP_CycleTx(CF_Channel_t *chan);
 
+/************************************************************************/
+/** @brief Share outgoing PDUs among several active tx transactions.
+ *
+ * @par Description
+ *       Keeps up to max_active_tx transactions from the configuration
+ *       table on the active queue, moving pending transactions in as
+ *       others finish. The first transaction on the active queue that is
+ *       not suspended gets a turn of up to CF_TX_DRR_MAX_QUANTUM PDUs,
+ *       fewer for lower priorities, and then goes to the back of the
+ *       queue. This repeats until there are no outgoing message buffers.
+ *       A turn cut short by running out of buffers carries on at the
+ *       next wakeup.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       chan must not be NULL. chan->cur must be NULL on entry.
+ *
+ * @param chan Channel to cycle
+ */
+void CF_CFDP_CycleTxDrr(CF_Channel_t *chan);
+
+/************************************************************************/
+/** @brief List traversal function that counts active tx transactions.
+ *
+ * This helper is used in conjunction with CF_CList_Traverse().
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       node must not be NULL. Context must not be NULL.
+ *
+ * @param node    Pointer to list node
+ * @param context Pointer to CF_CFDP_ActiveTx_args_t object (passed through)
+ *
+ * @returns integer traversal code
+ * @retval CF_CLIST_CONT always, so every transaction is counted
+ */
+CF_CListTraverse_Status_t CF_CFDP_CountActiveTx(CF_CListNode_t *node, void *context);
+
 /************************************************************************/
 /** @brief List traversal function that cycles the first active tx.
  *
@@ -646,9 +826,11 @@ CF_CListTraverse_Status_t CF_CFDP_CycleTxFirstActive(CF_CListNode_t *node, void
 /** @brief Call R and then S tick functions for all active transactions.
  *
  * @par Description
- *       Traverses all transactions in the RX and TXW queues, and calls
- *       their tick functions. Note that the TXW queue is used twice:
+ *       Traverses the transactions on the RX and TX tick lists, and calls
+ *       their tick functions. Note that the TX tick list is used twice:
  *       once for regular tick processing, and one for NAK response.
+ *       A transaction stays on its tick list until it has nothing left
+ *       to do, see CF_InsertTransactionTick().
  *
  * @par Assumptions, External Events, and Notes:
  *       chan must not be NULL.
@@ -690,11 +872,13 @@ void CF_CFDP_ProcessPollingDirectories(CF_Channel_t *chan);
 /** @brief List traversal function that calls a r or s tick function.
  *
  * This helper is used in conjunction with CF_CList_Traverse().
+ * The transaction is taken off the tick list when it has nothing
+ * left to do until a timer expires or a PDU is received.
  *
  * @par Assumptions, External Events, and Notes:
  *       node must not be NULL, context must not be NULL.
  *
- * @param node    Pointer to list node
+ * @param node    Pointer to tick_node of a transaction
  * @param context Pointer to CF_CFDP_Tick_args_t object (passed through)
  *
  * @returns integer traversal code
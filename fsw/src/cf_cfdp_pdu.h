@@ -289,16 +289,33 @@ typedef enum
     CF_CFDP_ConditionCode_CANCEL_REQUEST_RECEIVED   = 15,
 } CF_CFDP_ConditionCode_t;
 
+/**
+ * @brief Values for "checksum type" in the metadata PDU
+ *
+ * Defined per the SANA checksum identifiers registry referenced by
+ * section 5.2.5 of CCSDS 727.0-B-5
+ */
+typedef enum
+{
+    CF_CFDP_ChecksumType_MODULAR = 0,  /**< \brief legacy modular checksum */
+    CF_CFDP_ChecksumType_CRC32C  = 2,  /**< \brief CRC-32C (Castagnoli), as in RFC 4960 */
+    CF_CFDP_ChecksumType_CRC32   = 3,  /**< \brief IEEE 802.3 CRC-32 */
+    CF_CFDP_ChecksumType_NULL    = 15, /**< \brief null checksum, always 0 */
+} CF_CFDP_ChecksumType_t;
+
 /**
  * @brief Structure representing CFDP End of file PDU
  *
  * Defined per section 5.2.2 / table 5-6 of CCSDS 727.0-B-5
+ *
+ * The file size follows, as a file size sensitive (FSS) field.  These are
+ * 32 bits, or 64 bits when the large file flag in the PDU header is set,
+ * so they are not part of any fixed structure here.
  */
 typedef struct CF_CFDP_PduEof
 {
     CF_CFDP_uint8_t  cc;
     CF_CFDP_uint32_t crc;
-    CF_CFDP_uint32_t size;
 } CF_CFDP_PduEof_t;
 
 /**
@@ -322,64 +339,32 @@ typedef struct CF_CFDP_PduAck
     CF_CFDP_uint8_t cc_and_transaction_status;
 } CF_CFDP_PduAck_t;
 
-/**
- * @brief Structure representing CFDP Segment Request
- *
- * Defined per section 5.2.6 / table 5-11 of CCSDS 727.0-B-5
- */
-typedef struct CF_CFDP_SegmentRequest
-{
-    CF_CFDP_uint32_t offset_start;
-    CF_CFDP_uint32_t offset_end;
-} CF_CFDP_SegmentRequest_t;
-
-/**
- * @brief Structure representing CFDP Non-Acknowledge PDU
- *
- * Defined per section 5.2.6 / table 5-10 of CCSDS 727.0-B-5
- */
-typedef struct CF_CFDP_PduNak
-{
-    CF_CFDP_uint32_t scope_start;
-    CF_CFDP_uint32_t scope_end;
-} CF_CFDP_PduNak_t;
-
 /**
  * @brief Structure representing CFDP Metadata PDU
  *
  * Defined per section 5.2.5 / table 5-9 of CCSDS 727.0-B-5
+ *
+ * The file size follows as an FSS field, see CF_CFDP_PduEof_t.  The NAK
+ * scope and segment requests, and the file data offset, are made only of
+ * FSS fields, so they have no fixed structure at all.
  */
 typedef struct CF_CFDP_PduMd
 {
-    CF_CFDP_uint8_t  segmentation_control;
-    CF_CFDP_uint32_t size;
+    CF_CFDP_uint8_t segmentation_control;
 } CF_CFDP_PduMd_t;
 
-/**
- * @brief PDU file data header
- */
-typedef struct CF_CFDP_PduFileDataHeader
-{
-    /**
-     * NOTE: while this is the only fixed/required field in the data PDU, it may
-     * have segment metadata prior to this, depending on how the fields in the
-     * base header are set
-     */
-    CF_CFDP_uint32_t offset;
-} CF_CFDP_PduFileDataHeader_t;
-
 /**
  * @brief
  * PDU file data content typedef for limit checking outgoing_file_chunk_size
  * table value and set parameter command.
  *
  * This definition allows for the largest data block possible, as CF_MAX_PDU_SIZE -
- * the minimum possible header size.  In practice the outgoing file chunk size is limited by
+ * the minimum possible header size and a 32-bit offset.  In practice the outgoing file chunk size is limited by
  * whichever is smaller; the remaining data, remaining space in the packet, and outgoing_file_chunk_size.
  */
 typedef struct CF_CFDP_PduFileDataContent
 {
-    uint8 data[CF_MAX_PDU_SIZE - sizeof(CF_CFDP_PduFileDataHeader_t) - CF_CFDP_MIN_HEADER_SIZE];
+    uint8 data[CF_MAX_PDU_SIZE - sizeof(CF_CFDP_uint32_t) - CF_CFDP_MIN_HEADER_SIZE];
 } CF_CFDP_PduFileDataContent_t;
 
 #endif /* !CF_CFDP_PDU_H */
@@ -187,31 +187,68 @@ void CF_CFDP_R2_Complete(CF_Transaction_t *txn, int ok_to_send_nak)
  * See description in cf_cfdp_r.h for argument/return detail
  *
  *-----------------------------------------------------------------*/
-CFE_Status_t CF_CFDP_R_ProcessFd(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *ph)
+CF_WriteBehind_t *CF_CFDP_R_GetWriteBehind(CF_Transaction_t *txn)
 {
-    const CF_Logical_PduFileDataHeader_t *fd;
-    int32                                 fret;
-    CFE_Status_t                          ret;
+    CF_CListNode_t *  node = CF_CList_Pop(&CF_AppData.engine.channels[txn->chan_num].write_behind_free);
+    CF_WriteBehind_t *wb   = NULL;
 
-    /* this function is only entered for data PDUs */
-    fd  = &ph->int_header.fd;
-    ret = CFE_SUCCESS;
+    if (node)
+    {
+        wb      = container_of(node, CF_WriteBehind_t, cl_node);
+        wb->len = 0; /* nothing buffered for this transaction yet */
+    }
 
-    /*
-     * NOTE: The decode routine should have left a direct pointer to the data and actual data length
-     * within the PDU.  The length has already been verified, too.  Should not need to make any
-     * adjustments here, just write it.
-     */
+    return wb;
+}
 
-    if (txn->state_data.receive.cached_pos != fd->offset)
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp_r.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CF_RecvBitmap_t *CF_CFDP_R2_GetBitmap(CF_Transaction_t *txn, uint32 granule)
+{
+    CF_CListNode_t * node      = CF_CList_Pop(&CF_AppData.engine.channels[txn->chan_num].recv_bitmap_free);
+    CF_RecvBitmap_t *rb        = NULL;
+    uint32           num_words = sizeof(rb->words) / sizeof(rb->words[0]);
+
+    if (node)
     {
-        fret = CF_WrappedLseek(txn->fd, fd->offset, OS_SEEK_SET);
-        if (fret != fd->offset)
+        rb = container_of(node, CF_RecvBitmap_t, cl_node);
+
+        /* one bit per granule up to the end of the file, if that is known yet */
+        if (txn->flags.rx.md_recv && ((txn->fsize / granule / CF_CHUNK_BITMAP_WORD_BITS) < num_words))
+        {
+            num_words = (txn->fsize / granule / CF_CHUNK_BITMAP_WORD_BITS) + 1;
+        }
+
+        CF_ChunkList_AttachBitmap(&txn->chunks->chunks, rb->words, num_words, rb->summary, granule);
+    }
+
+    return rb;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp_r.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CF_CFDP_R_WriteFile(CF_Transaction_t *txn, CF_FileSize_t offset, const void *data, uint32 len)
+{
+    int32        fret;
+    CFE_Status_t ret = CFE_SUCCESS;
+
+    if (txn->state_data.receive.cached_pos != offset)
+    {
+        fret = CF_WrappedSeekTo(txn->fd, offset);
+        if (fret != CFE_SUCCESS)
         {
             CFE_EVS_SendEvent(CF_CFDP_R_SEEK_FD_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "CF R%d(%lu:%lu): failed to seek offset %ld, got %ld", (txn->state == CF_TxnState_R2),
+                              "CF R%d(%lu:%lu): failed to seek offset %llu, got %ld", (txn->state == CF_TxnState_R2),
                               (unsigned long)txn->history->src_eid, (unsigned long)txn->history->seq_num,
-                              (long)fd->offset, (long)fret);
+                              (unsigned long long)offset, (long)fret);
             CF_CFDP_SetTxnStatus(txn, CF_TxnStatus_FILE_SIZE_ERROR);
             ++CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.fault.file_seek;
             ret = CF_ERROR; /* connection will reset in caller */
@@ -220,23 +257,113 @@ CFE_Status_t CF_CFDP_R_ProcessFd(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *
 
     if (ret != CF_ERROR)
     {
-        fret = CF_WrappedWrite(txn->fd, fd->data_ptr, fd->data_len);
-        if (fret != fd->data_len)
+        fret = CF_WrappedWrite(txn->fd, data, len);
+        if (fret != len)
         {
             CFE_EVS_SendEvent(CF_CFDP_R_WRITE_ERR_EID, CFE_EVS_EventType_ERROR,
                               "CF R%d(%lu:%lu): OS_write expected %ld, got %ld", (txn->state == CF_TxnState_R2),
                               (unsigned long)txn->history->src_eid, (unsigned long)txn->history->seq_num,
-                              (long)fd->data_len, (long)fret);
+                              (long)len, (long)fret);
             CF_CFDP_SetTxnStatus(txn, CF_TxnStatus_FILESTORE_REJECTION);
             ++CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.fault.file_write;
             ret = CF_ERROR; /* connection will reset in caller */
         }
         else
         {
-            txn->state_data.receive.cached_pos = fd->data_len + fd->offset;
-            CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.recv.file_data_bytes += fd->data_len;
+            txn->state_data.receive.cached_pos = offset + len;
+        }
+    }
+
+    return ret;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp_r.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CF_CFDP_R_FlushWriteBehind(CF_Transaction_t *txn)
+{
+    CF_WriteBehind_t *wb  = txn->state_data.receive.write_behind;
+    CFE_Status_t      ret = CFE_SUCCESS;
+
+    if (wb && (wb->len > 0))
+    {
+        ret     = CF_CFDP_R_WriteFile(txn, wb->offset, wb->data, wb->len);
+        wb->len = 0; /* on failure the transaction is done anyway, so the data is dropped */
+    }
+
+    return ret;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp_r.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CF_CFDP_R_ProcessFd(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *ph)
+{
+    const CF_Logical_PduFileDataHeader_t *fd;
+    CF_WriteBehind_t *                    wb;
+    uint32                                end;
+    CFE_Status_t                          ret;
+
+    /* this function is only entered for data PDUs */
+    fd  = &ph->int_header.fd;
+    ret = CFE_SUCCESS;
+
+    /*
+     * NOTE: The decode routine should have left a direct pointer to the data and actual data length
+     * within the PDU.  The length has already been verified, too.  Should not need to make any
+     * adjustments here, just write it.
+     */
+
+    if (!txn->state_data.receive.write_behind)
+    {
+        /* try to get a write-behind buffer, if there are none free this writes directly to the file */
+        txn->state_data.receive.write_behind = CF_CFDP_R_GetWriteBehind(txn);
+    }
+
+    wb = txn->state_data.receive.write_behind;
+    if (wb)
+    {
+        /* data starting inside or right after the buffered data is merged in memory, as long as
+         * it fits. Anything else leaves a gap, so write out what is buffered and start again here. */
+        if ((wb->len == 0) || (fd->offset < wb->offset) || (fd->offset > (wb->offset + wb->len)) ||
+            ((fd->offset + fd->data_len) > (wb->offset + CF_RECV_WRITE_BEHIND_SIZE)))
+        {
+            ret        = CF_CFDP_R_FlushWriteBehind(txn);
+            wb->offset = fd->offset;
+        }
+
+        if (ret == CFE_SUCCESS)
+        {
+            memcpy(&wb->data[fd->offset - wb->offset], fd->data_ptr, fd->data_len);
+
+            end = (fd->offset + fd->data_len) - wb->offset;
+            if (end > wb->len)
+            {
+                wb->len = end;
+            }
+
+            if (wb->len == CF_RECV_WRITE_BEHIND_SIZE)
+            {
+                ret = CF_CFDP_R_FlushWriteBehind(txn);
+            }
         }
     }
+    else
+    {
+        ret = CF_CFDP_R_WriteFile(txn, fd->offset, fd->data_ptr, fd->data_len);
+    }
+
+    if (ret == CFE_SUCCESS)
+    {
+        CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.recv.file_data_bytes += fd->data_len;
+        txn->file_data_bytes += fd->data_len;
+    }
 
     return ret;
 }
@@ -261,10 +388,10 @@ CFE_Status_t CF_CFDP_R_SubstateRecvEof(CF_Transaction_t *txn, CF_Logical_PduBuff
         if (txn->flags.rx.md_recv && (eof->size != txn->fsize))
         {
             CFE_EVS_SendEvent(CF_CFDP_R_SIZE_MISMATCH_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "CF R%d(%lu:%lu): EOF file size mismatch: got %lu expected %lu",
+                              "CF R%d(%lu:%lu): EOF file size mismatch: got %llu expected %llu",
                               (txn->state == CF_TxnState_R2), (unsigned long)txn->history->src_eid,
-                              (unsigned long)txn->history->seq_num, (unsigned long)eof->size,
-                              (unsigned long)txn->fsize);
+                              (unsigned long)txn->history->seq_num, (unsigned long long)eof->size,
+                              (unsigned long long)txn->fsize);
             ++CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.fault.file_size_mismatch;
             ret = CF_REC_PDU_FSIZE_MISMATCH_ERROR;
         }
@@ -297,6 +424,12 @@ void CF_CFDP_R1_SubstateRecvEof(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *p
     eof = &ph->int_header.eof;
     crc = eof->crc;
 
+    if (ret == CFE_SUCCESS)
+    {
+        /* the file must be complete on disk before it is kept */
+        ret = CF_CFDP_R_FlushWriteBehind(txn);
+    }
+
     if (ret == CFE_SUCCESS)
     {
         /* Verify CRC */
@@ -343,8 +476,13 @@ void CF_CFDP_R2_SubstateRecvEof(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *p
             txn->state_data.receive.r2.eof_cc = eof->cc;
             txn->flags.rx.send_ack            = true; /* defer sending ACK to tick handling */
 
+            if (CF_CFDP_R_FlushWriteBehind(txn) != CFE_SUCCESS)
+            {
+                /* Reset transaction on failure */
+                CF_CFDP_R2_Reset(txn);
+            }
             /* only check for complete if EOF with no errors */
-            if (txn->state_data.receive.r2.eof_cc == CF_CFDP_ConditionCode_NO_ERROR)
+            else if (txn->state_data.receive.r2.eof_cc == CF_CFDP_ConditionCode_NO_ERROR)
             {
                 CF_CFDP_R2_Complete(txn, 1); /* CF_CFDP_R2_Complete() will change state */
             }
@@ -408,7 +546,10 @@ void CF_CFDP_R1_SubstateRecvFileData(CF_Transaction_t *txn, CF_Logical_PduBuffer
 void CF_CFDP_R2_SubstateRecvFileData(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *ph)
 {
     const CF_Logical_PduFileDataHeader_t *fd;
+    CF_RxS2_Data_t *                      r2 = &txn->state_data.receive.r2;
     int                                   ret;
+    CF_DigestGapArgs_t                    args;
+    uint16                                nak_ticks;
 
     /* this function is only entered for data PDUs */
     fd = &ph->int_header.fd;
@@ -422,12 +563,48 @@ void CF_CFDP_R2_SubstateRecvFileData(CF_Transaction_t *txn, CF_Logical_PduBuffer
 
     if (ret == CFE_SUCCESS)
     {
-        /* class 2 does CRC at FIN, but track gaps */
+        /* the first PDU after the metadata that starts on a multiple of its own length and
+         * does not end the file is taken to be the size the sender uses, so from then on
+         * each PDU it sends fills one bit of the bitmap.  A short last PDU, or a resent
+         * range cut at an arbitrary offset, would give a granule far smaller than that */
+        if (!txn->state_data.receive.bitmap && CF_AppData.config_table->chan[txn->chan_num].rx_bitmap_enabled &&
+            txn->flags.rx.md_recv && fd->data_len && ((fd->offset % fd->data_len) == 0) &&
+            ((fd->offset + fd->data_len) < txn->fsize))
+        {
+            txn->state_data.receive.bitmap = CF_CFDP_R2_GetBitmap(txn, fd->data_len);
+        }
+
+        /* class 2 digests the CRC of only the bytes not already received, then tracks gaps */
+        args.txn      = txn;
+        args.fd       = fd;
+        args.digested = 0;
+        CF_ChunkList_ComputeUncovered(&txn->chunks->chunks, fd->offset, fd->data_len, CF_CFDP_R2_DigestGap, &args);
+        txn->state_data.receive.r2.rx_crc_inline_bytes += args.digested;
         CF_ChunkListAdd(&txn->chunks->chunks, fd->offset, fd->data_len);
 
-        if (txn->flags.rx.fd_nak_sent)
+        /* data past the furthest received so far means the PDUs between were lost, so in
+         * immediate mode NAK them at the next tick rather than waiting for the EOF or the ACK
+         * timer.  Sending from the tick keeps the output budget and the resume point for the
+         * transmit side of the cycle, as a PDU received here has no place to resume from */
+        nak_ticks = CF_AppData.config_table->chan[txn->chan_num].rx_immediate_nak_ticks;
+        if (nak_ticks && !txn->flags.rx.eof_recv && (fd->offset > r2->rx_frontier) &&
+            (!r2->imm_nak_end ||
+             (CF_AppData.engine.channels[txn->chan_num].timer_wheel.now - r2->imm_nak_tick) >= nak_ticks))
+        {
+            txn->flags.rx.send_imm_nak = true;
+            r2->imm_nak_scope          = fd->offset;
+        }
+
+        if ((fd->offset + fd->data_len) > r2->rx_frontier)
+        {
+            r2->rx_frontier = fd->offset + fd->data_len;
+        }
+
+        if (txn->flags.rx.fd_nak_sent || txn->flags.rx.eof_recv)
         {
-            CF_CFDP_R2_Complete(txn, 0); /* once nak-retransmit received, start checking for completion at each fd */
+            /* once nak-retransmit received or EOF is in, check for completion at each fd so the
+             * FIN goes out as soon as the last gap is filled */
+            CF_CFDP_R2_Complete(txn, 0);
         }
 
         if (!txn->flags.rx.complete)
@@ -462,20 +639,47 @@ void CF_CFDP_R2_GapCompute(const CF_ChunkList_t *chunks, const CF_Chunk_t *chunk
     pseglist = &nak->segment_list;
     CF_Assert(chunk->size > 0);
 
-    /* it seems that scope in the old engine is not used the way I read it in the spec, so
-     * leave this code here for now for future reference */
-
+    /* segment requests are file offsets, the scope only bounds where they may be */
     if (pseglist->num_segments < CF_PDU_MAX_SEGMENTS)
     {
         pseg = &pseglist->segments[pseglist->num_segments];
 
-        pseg->offset_start = chunk->offset - nak->scope_start;
+        pseg->offset_start = chunk->offset;
         pseg->offset_end   = pseg->offset_start + chunk->size;
 
         ++pseglist->num_segments;
     }
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp_r.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_CFDP_R2_DigestGap(const CF_ChunkList_t *chunks, const CF_Chunk_t *chunk, void *opaque)
+{
+    CF_DigestGapArgs_t *args = (CF_DigestGapArgs_t *)opaque;
+    const uint8 *       data = (const uint8 *)args->fd->data_ptr;
+
+    if (CF_CRC_DigestAt(&args->txn->crc, chunk->offset, &data[chunk->offset - args->fd->offset], chunk->size))
+    {
+        args->digested += chunk->size;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Segment requests in large file mode are twice the size, so fewer fit in a NAK.
+ *
+ *-----------------------------------------------------------------*/
+static uint32 CF_CFDP_R2_MaxNakSegments(const CF_Transaction_t *txn)
+{
+    return txn->flags.com.large_file ? CF_PDU_MAX_SEGMENTS_LARGE : CF_PDU_MAX_SEGMENTS;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -487,10 +691,13 @@ CFE_Status_t CF_CFDP_R_SubstateSendNak(CF_Transaction_t *txn)
     CF_Logical_PduBuffer_t *ph =
         CF_CFDP_ConstructPduHeader(txn, CF_CFDP_FileDirective_NAK, txn->history->peer_eid,
                                    CF_AppData.config_table->local_eid, 1, txn->history->seq_num, 1);
+    CF_RxS2_Data_t *     r2 = &txn->state_data.receive.r2;
     CF_Logical_PduNak_t *nak;
     CFE_Status_t         sret;
     uint32               cret;
-    CFE_Status_t         ret = CF_ERROR;
+    CF_FileSize_t        scope_end;
+    uint32               max_segs = CF_CFDP_R2_MaxNakSegments(txn);
+    CFE_Status_t         ret      = CF_ERROR;
 
     if (ph)
     {
@@ -498,36 +705,70 @@ CFE_Status_t CF_CFDP_R_SubstateSendNak(CF_Transaction_t *txn)
 
         if (txn->flags.rx.md_recv)
         {
-            /* we have metadata, so send valid NAK */
+            /* we have metadata, so send valid NAKs. Each one's scope starts where the last one's
+             * ended, until all gaps are covered. If the buffers run out first, the next call
+             * picks up from there */
             CF_GapComputeArgs_t args = {txn, nak};
 
-            nak->scope_start = 0;
-            cret             = CF_ChunkList_ComputeGaps(&txn->chunks->chunks,
-                                            (txn->chunks->chunks.count < txn->chunks->chunks.max_chunks)
-                                                            ? txn->chunks->chunks.max_chunks
-                                                            : (txn->chunks->chunks.max_chunks - 1),
-                                            txn->fsize, 0, CF_CFDP_R2_GapCompute, &args);
-
-            if (!cret)
+            if (r2->nak_cursor >= txn->fsize)
             {
-                /* no gaps left, so go ahead and check for completion */
-                txn->flags.rx.complete = true; /* we know md was received, and there's no gaps -- it's complete */
-                ret                    = CFE_SUCCESS;
+                r2->nak_cursor = 0;
             }
-            else
+
+            while (ph)
             {
+                nak              = &ph->int_header.nak;
+                args.nak         = nak;
+                nak->scope_start = r2->nak_cursor;
+                cret = CF_ChunkList_ComputeGaps(&txn->chunks->chunks, max_segs, txn->fsize, nak->scope_start,
+                                                CF_CFDP_R2_GapCompute, &args);
+
+                if (!cret)
+                {
+                    if (!r2->nak_cursor)
+                    {
+                        /* no gaps left, so go ahead and check for completion */
+                        txn->flags.rx.complete = true; /* we know md was received, and there's no gaps */
+                    }
+                    r2->nak_cursor = 0;
+                    ret            = CFE_SUCCESS;
+                    break;
+                }
+
+                /* a full PDU may leave more gaps, so its scope ends with its last segment */
+                if (cret < max_segs)
+                {
+                    scope_end = txn->fsize;
+                }
+                else
+                {
+                    scope_end = nak->segment_list.segments[max_segs - 1].offset_end;
+                }
+
                 /* gaps are present, so let's send the NAK PDU */
-                nak->scope_end            = 0;
+                nak->scope_end            = scope_end;
                 sret                      = CF_CFDP_SendNak(txn, ph);
                 txn->flags.rx.fd_nak_sent = true; /* latch that at least one NAK has been sent requesting filedata */
                 CF_Assert(sret != CF_SEND_PDU_ERROR); /* NOTE: this CF_Assert is here because CF_CFDP_SendNak()
                                                      does not return CF_SEND_PDU_ERROR, so if it's ever added to
                                                      that function we need to test handling it here */
-                if (sret == CFE_SUCCESS)
+                if (sret != CFE_SUCCESS)
+                {
+                    break;
+                }
+
+                CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.sent.nak_segment_requests += cret;
+
+                if (scope_end >= txn->fsize)
                 {
-                    CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.sent.nak_segment_requests += cret;
-                    ret = CFE_SUCCESS;
+                    r2->nak_cursor = 0;
+                    ret            = CFE_SUCCESS;
+                    break;
                 }
+
+                r2->nak_cursor = scope_end;
+                ph = CF_CFDP_ConstructPduHeader(txn, CF_CFDP_FileDirective_NAK, txn->history->peer_eid,
+                                                CF_AppData.config_table->local_eid, 1, txn->history->seq_num, 1);
             }
         }
         else
@@ -557,6 +798,54 @@ CFE_Status_t CF_CFDP_R_SubstateSendNak(CF_Transaction_t *txn)
     return ret;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp_r.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CF_CFDP_R2_SendImmediateNak(CF_Transaction_t *txn, CF_FileSize_t scope_end)
+{
+    CF_Logical_PduBuffer_t *ph =
+        CF_CFDP_ConstructPduHeader(txn, CF_CFDP_FileDirective_NAK, txn->history->peer_eid,
+                                   CF_AppData.config_table->local_eid, 1, txn->history->seq_num, 1);
+    CF_RxS2_Data_t *     r2 = &txn->state_data.receive.r2;
+    CF_Logical_PduNak_t *nak;
+    CF_GapComputeArgs_t  args;
+    CFE_Status_t         sret;
+    uint32               cret;
+    CFE_Status_t         ret = CF_SEND_PDU_NO_BUF_AVAIL_ERROR;
+
+    if (ph)
+    {
+        ret      = CF_ERROR;
+        nak      = &ph->int_header.nak;
+        args.txn = txn;
+        args.nak = nak;
+
+        /* only the gaps since the last immediate NAK, so none is requested twice from here */
+        nak->scope_start = r2->imm_nak_end;
+        nak->scope_end   = scope_end;
+        cret = CF_ChunkList_ComputeGaps(&txn->chunks->chunks, CF_CFDP_R2_MaxNakSegments(txn), scope_end,
+                                        nak->scope_start, CF_CFDP_R2_GapCompute, &args);
+
+        if (cret)
+        {
+            sret = CF_CFDP_SendNak(txn, ph);
+            CF_Assert(sret != CF_SEND_PDU_ERROR); /* CF_CFDP_SendNak() does not return CF_SEND_PDU_ERROR */
+            if (sret == CFE_SUCCESS)
+            {
+                CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.sent.nak_segment_requests += cret;
+                r2->imm_nak_end  = scope_end;
+                r2->imm_nak_tick = CF_AppData.engine.channels[txn->chan_num].timer_wheel.now;
+            }
+            ret = sret;
+        }
+    }
+
+    return ret;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -575,26 +864,26 @@ void CF_CFDP_R_Init(CF_Transaction_t *txn)
             /* the transaction already has a history, and that has a buffer that we can use to
              * hold the temp filename which is defined by the sequence number and the source entity ID */
             /* the -1 below is to make room for the slash */
-            snprintf(txn->history->fnames.dst_filename, sizeof(txn->history->fnames.dst_filename) - 1, "%.*s/%lu:%lu.tmp",
+            snprintf(txn->fnames.dst_filename, sizeof(txn->fnames.dst_filename) - 1, "%.*s/%lu:%lu.tmp",
                      CF_FILENAME_MAX_PATH - 1, CF_AppData.config_table->tmp_dir, 
                      (unsigned long)txn->history->src_eid, (unsigned long)txn->history->seq_num);
             CFE_EVS_SendEvent(CF_CFDP_R_TEMP_FILE_INF_EID, CFE_EVS_EventType_INFORMATION,
                               "CF R%d(%lu:%lu): making temp file %s for transaction without MD",
                               (txn->state == CF_TxnState_R2), (unsigned long)txn->history->src_eid,
-                              (unsigned long)txn->history->seq_num, txn->history->fnames.dst_filename);
+                              (unsigned long)txn->history->seq_num, txn->fnames.dst_filename);
         }
 
         CF_CFDP_ArmAckTimer(txn);
     }
 
-    ret = CF_WrappedOpenCreate(&txn->fd, txn->history->fnames.dst_filename, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE,
+    ret = CF_WrappedOpenCreate(&txn->fd, txn->fnames.dst_filename, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE,
                                OS_READ_WRITE);
     if (ret < 0)
     {
         CFE_EVS_SendEvent(CF_CFDP_R_CREAT_ERR_EID, CFE_EVS_EventType_ERROR,
                           "CF R%d(%lu:%lu): failed to create file %s for writing, error=%ld",
                           (txn->state == CF_TxnState_R2), (unsigned long)txn->history->src_eid,
-                          (unsigned long)txn->history->seq_num, txn->history->fnames.dst_filename, (long)ret);
+                          (unsigned long)txn->history->seq_num, txn->fnames.dst_filename, (long)ret);
         ++CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.fault.file_open;
         txn->fd = OS_OBJECT_ID_UNDEFINED; /* just in case */
         if (txn->state == CF_TxnState_R2)
@@ -621,12 +910,12 @@ void CF_CFDP_R_Init(CF_Transaction_t *txn)
 CFE_Status_t CF_CFDP_R2_CalcCrcChunk(CF_Transaction_t *txn)
 {
     uint8        buf[CF_R2_CRC_CHUNK_SIZE];
-    size_t       count_bytes;
-    size_t       want_offs_size;
-    size_t       read_size;
-    int          fret;
-    CFE_Status_t ret;
-    bool         success = true;
+    size_t        count_bytes;
+    CF_FileSize_t want_offs_size;
+    size_t        read_size;
+    int           fret;
+    CFE_Status_t  ret;
+    bool          success = true;
 
     memset(buf, 0, sizeof(buf));
 
@@ -635,10 +924,27 @@ CFE_Status_t CF_CFDP_R2_CalcCrcChunk(CF_Transaction_t *txn)
 
     if (txn->state_data.receive.r2.rx_crc_calc_bytes == 0)
     {
-        CF_CRC_Start(&txn->crc);
+        /* the file is kept (or read back) after this, so it must all be on disk */
+        if (CF_CFDP_R_FlushWriteBehind(txn) != CFE_SUCCESS)
+        {
+            success = false;
+        }
+        else if (txn->state_data.receive.r2.rx_crc_inline_bytes == txn->fsize)
+        {
+            /* there are no gaps, and every byte was digested exactly once as it arrived,
+             * so the CRC is already complete and the file does not need to be read back */
+            txn->state_data.receive.r2.rx_crc_calc_bytes = txn->fsize;
+        }
+        else
+        {
+            /* some bytes were digested more than once, which happens if the chunk list
+             * overflowed and forgot data it had received, or were skipped because the
+             * checksum type needs them in order. Fall back to reading the file. */
+            CF_CRC_Start(&txn->crc, txn->crc.type);
+        }
     }
 
-    while ((count_bytes < CF_AppData.config_table->rx_crc_calc_bytes_per_wakeup) &&
+    while (success && (count_bytes < CF_AppData.config_table->rx_crc_calc_bytes_per_wakeup) &&
            (txn->state_data.receive.r2.rx_crc_calc_bytes < txn->fsize))
     {
         want_offs_size = txn->state_data.receive.r2.rx_crc_calc_bytes + sizeof(buf);
@@ -654,13 +960,14 @@ CFE_Status_t CF_CFDP_R2_CalcCrcChunk(CF_Transaction_t *txn)
 
         if (txn->state_data.receive.cached_pos != txn->state_data.receive.r2.rx_crc_calc_bytes)
         {
-            fret = CF_WrappedLseek(txn->fd, txn->state_data.receive.r2.rx_crc_calc_bytes, OS_SEEK_SET);
-            if (fret != txn->state_data.receive.r2.rx_crc_calc_bytes)
+            fret = CF_WrappedSeekTo(txn->fd, txn->state_data.receive.r2.rx_crc_calc_bytes);
+            if (fret != CFE_SUCCESS)
             {
                 CFE_EVS_SendEvent(CF_CFDP_R_SEEK_CRC_ERR_EID, CFE_EVS_EventType_ERROR,
-                                  "CF R%d(%lu:%lu): failed to seek offset %lu, got %ld", (txn->state == CF_TxnState_R2),
-                                  (unsigned long)txn->history->src_eid, (unsigned long)txn->history->seq_num,
-                                  (unsigned long)txn->state_data.receive.r2.rx_crc_calc_bytes, (long)fret);
+                                  "CF R%d(%lu:%lu): failed to seek offset %llu, got %ld",
+                                  (txn->state == CF_TxnState_R2), (unsigned long)txn->history->src_eid,
+                                  (unsigned long)txn->history->seq_num,
+                                  (unsigned long long)txn->state_data.receive.r2.rx_crc_calc_bytes, (long)fret);
                 CF_CFDP_SetTxnStatus(txn, CF_TxnStatus_FILE_SIZE_ERROR);
                 ++CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.fault.file_seek;
                 success = false;
@@ -794,7 +1101,7 @@ void CF_CFDP_R2_RecvMd(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *ph)
 
         strcpy(
             fname,
-            txn->history->fnames.dst_filename); /* strcpy is ok, since fname is CF_FILENAME_MAX_LEN like dst_filename */
+            txn->fnames.dst_filename); /* strcpy is ok, since fname is CF_FILENAME_MAX_LEN like dst_filename */
         status = CF_CFDP_RecvMd(txn, ph);
         if (!status)
         {
@@ -805,16 +1112,22 @@ void CF_CFDP_R2_RecvMd(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *ph)
                 if (txn->state_data.receive.r2.eof_size != txn->fsize)
                 {
                     CFE_EVS_SendEvent(CF_CFDP_R_EOF_MD_SIZE_ERR_EID, CFE_EVS_EventType_ERROR,
-                                      "CF R%d(%lu:%lu): EOF/md size mismatch md: %lu, EOF: %lu",
+                                      "CF R%d(%lu:%lu): EOF/md size mismatch md: %llu, EOF: %llu",
                                       (txn->state == CF_TxnState_R2), (unsigned long)txn->history->src_eid,
-                                      (unsigned long)txn->history->seq_num, (unsigned long)txn->fsize,
-                                      (unsigned long)txn->state_data.receive.r2.eof_size);
+                                      (unsigned long)txn->history->seq_num, (unsigned long long)txn->fsize,
+                                      (unsigned long long)txn->state_data.receive.r2.eof_size);
                     ++CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.fault.file_size_mismatch;
                     CF_CFDP_R2_SetFinTxnStatus(txn, CF_TxnStatus_FILE_SIZE_ERROR);
                     success = false;
                 }
             }
 
+            if (success && (CF_CFDP_R_FlushWriteBehind(txn) != CFE_SUCCESS))
+            {
+                CF_CFDP_R2_SetFinTxnStatus(txn, CF_TxnStatus_FILESTORE_REJECTION);
+                success = false;
+            }
+
             if (success)
             {
                 /* close and rename file */
@@ -822,7 +1135,7 @@ void CF_CFDP_R2_RecvMd(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *ph)
                 CFE_ES_PerfLogEntry(CF_PERF_ID_RENAME);
 
                 /* Note OS_mv attempts a rename, then copy/delete if that fails so it works across file systems */
-                status = OS_mv(fname, txn->history->fnames.dst_filename);
+                status = OS_mv(fname, txn->fnames.dst_filename);
 
                 CFE_ES_PerfLogExit(CF_PERF_ID_RENAME);
                 if (status != OS_SUCCESS)
@@ -838,7 +1151,7 @@ void CF_CFDP_R2_RecvMd(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *ph)
                 }
                 else
                 {
-                    ret = CF_WrappedOpenCreate(&txn->fd, txn->history->fnames.dst_filename, OS_FILE_FLAG_NONE,
+                    ret = CF_WrappedOpenCreate(&txn->fd, txn->fnames.dst_filename, OS_FILE_FLAG_NONE,
                                                OS_READ_WRITE);
                     if (ret < 0)
                     {
@@ -862,6 +1175,11 @@ void CF_CFDP_R2_RecvMd(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *ph)
                 }
             }
         }
+        else if (txn->history->txn_stat == CF_TxnStatus_UNSUPPORTED_CHECKSUM_TYPE)
+        {
+            /* the file can never be verified, so there is no point asking for the md again */
+            CF_CFDP_R2_SetFinTxnStatus(txn, CF_TxnStatus_UNSUPPORTED_CHECKSUM_TYPE);
+        }
         else
         {
             CFE_EVS_SendEvent(CF_CFDP_R_PDU_MD_ERR_EID, CFE_EVS_EventType_ERROR, "CF R%d(%lu:%lu): invalid md received",
@@ -925,6 +1243,9 @@ void CF_CFDP_R2_Recv(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *ph)
  *-----------------------------------------------------------------*/
 void CF_CFDP_R_Cancel(CF_Transaction_t *txn)
 {
+    /* write out whatever was received; a failure just sets the transaction status */
+    CF_CFDP_R_FlushWriteBehind(txn);
+
     /* for cancel, only need to send FIN if R2 */
     if ((txn->state == CF_TxnState_R2) && (txn->state_data.receive.sub_state < CF_RxSubState_WAIT_FOR_FIN_ACK))
     {
@@ -978,10 +1299,6 @@ void CF_CFDP_R_Tick(CF_Transaction_t *txn, int *cont /* unused */)
                 CF_CFDP_R2_SetFinTxnStatus(txn, CF_TxnStatus_INACTIVITY_DETECTED);
                 txn->flags.rx.inactivity_fired = true;
             }
-            else
-            {
-                CF_Timer_Tick(&txn->inactivity_timer);
-            }
         }
 
         /* rx maintenance: possibly process send_eof_ack, send_nak or send_fin */
@@ -1012,6 +1329,21 @@ void CF_CFDP_R_Tick(CF_Transaction_t *txn, int *cont /* unused */)
                 txn->flags.rx.send_fin = false; /* will re-enter on error */
             }
         }
+        else if (txn->flags.rx.send_imm_nak)
+        {
+            /* once the EOF is in, the regular NAK covers these gaps */
+            sret = CFE_SUCCESS;
+            if (!txn->flags.rx.eof_recv)
+            {
+                sret = CF_CFDP_R2_SendImmediateNak(txn, txn->state_data.receive.r2.imm_nak_scope);
+            }
+
+            /* only kept to try again when there was no buffer */
+            if (sret != CF_SEND_PDU_NO_BUF_AVAIL_ERROR)
+            {
+                txn->flags.rx.send_imm_nak = false;
+            }
+        }
         else
         {
             /* don't care about any other cases */
@@ -1055,10 +1387,6 @@ void CF_CFDP_R_Tick(CF_Transaction_t *txn, int *cont /* unused */)
                     CF_CFDP_ArmAckTimer(txn);
                 }
             }
-            else
-            {
-                CF_Timer_Tick(&txn->ack_timer);
-            }
         }
     }
     else
@@ -1068,9 +1396,5 @@ void CF_CFDP_R_Tick(CF_Transaction_t *txn, int *cont /* unused */)
             CF_CFDP_R_SendInactivityEvent(txn);
             CF_CFDP_R1_Reset(txn);
         }
-        else
-        {
-            CF_Timer_Tick(&txn->inactivity_timer);
-        }
     }
 }
@@ -42,6 +42,18 @@ typedef struct
     CF_Logical_PduNak_t *nak; /**< \brief Current NAK PDU contents */
 } CF_GapComputeArgs_t;
 
+/**
+ * @brief Argument for CRC digest of newly received file data
+ *
+ * This is used in conjunction with CF_CFDP_R2_DigestGap
+ */
+typedef struct
+{
+    CF_Transaction_t *                    txn; /**< \brief Current transaction being processed */
+    const CF_Logical_PduFileDataHeader_t *fd;  /**< \brief File data PDU being received */
+    uint32                                digested; /**< \brief Number of bytes folded into the CRC */
+} CF_DigestGapArgs_t;
+
 /************************************************************************/
 /** @brief R1 receive PDU processing.
  *
@@ -177,8 +189,82 @@ CFE_Status_t CF_CFDP_R_CheckCrc(CF_Transaction_t *txn, uint32 expected_crc);
  */
 void CF_CFDP_R2_Complete(CF_Transaction_t *txn, int ok_to_send_nak);
 
+/************************************************************************/
+/** @brief Get a free write-behind buffer from the transaction's channel.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       txn must not be NULL. The buffer goes back to the channel when
+ *       the transaction is reset.
+ *
+ * @param txn  Pointer to the transaction object
+ *
+ * @returns Pointer to an empty write-behind buffer
+ * @retval  NULL if the channel has none free
+ */
+CF_WriteBehind_t *CF_CFDP_R_GetWriteBehind(CF_Transaction_t *txn);
+
+/************************************************************************/
+/** @brief Get a free bitmap from the transaction's channel and attach it.
+ *
+ * @par Description
+ *       The bitmap is attached to the transaction chunk list, with each bit
+ *       tracking granule bytes of the file. If the file size is known, only
+ *       as much of the bitmap as the file needs is used.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       txn must not be NULL. granule must not be 0. The bitmap goes back
+ *       to the channel when the transaction is reset.
+ *
+ * @param txn      Pointer to the transaction object
+ * @param granule  Number of bytes tracked by each bit
+ *
+ * @returns Pointer to the attached bitmap
+ * @retval  NULL if the channel has none free
+ */
+CF_RecvBitmap_t *CF_CFDP_R2_GetBitmap(CF_Transaction_t *txn, uint32 granule);
+
+/************************************************************************/
+/** @brief Write data to the transaction's file at the given offset.
+ *
+ * @par Description
+ *       Skips the seek if the file is already at the offset. On error,
+ *       sends an event and sets the transaction status.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       txn must not be NULL, data must not be NULL.
+ *
+ * @param txn    Pointer to the transaction object
+ * @param offset Position in file to write to
+ * @param data   Data to write
+ * @param len    Number of bytes to write
+ *
+ * @retval CFE_SUCCESS on success. CF_ERROR on error.
+ */
+CFE_Status_t CF_CFDP_R_WriteFile(CF_Transaction_t *txn, CF_FileSize_t offset, const void *data, uint32 len);
+
+/************************************************************************/
+/** @brief Write out any file data held in the transaction's write-behind buffer.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       txn must not be NULL. Does nothing if the transaction has no
+ *       write-behind buffer or it is empty. The buffer is empty afterwards
+ *       even if the write failed.
+ *
+ * @param txn  Pointer to the transaction object
+ *
+ * @retval CFE_SUCCESS on success. CF_ERROR on error.
+ */
+CFE_Status_t CF_CFDP_R_FlushWriteBehind(CF_Transaction_t *txn);
+
 /************************************************************************/
 /** @brief Process a filedata PDU on a transaction.
+ *
+ * @par Description
+ *       The data is gathered in the transaction's write-behind buffer if
+ *       it follows on from (or lands inside) the data already there, and
+ *       the buffer is written out when full. Data that leaves a gap causes
+ *       the buffer to be written out first. With no write-behind buffer the
+ *       data is written directly to the file.
  *
  * @par Assumptions, External Events, and Notes:
  *       txn must not be NULL.
@@ -290,25 +376,69 @@ void CF_CFDP_R2_SubstateRecvFileData(CF_Transaction_t *txn, CF_Logical_PduBuffer
  */
 void CF_CFDP_R2_GapCompute(const CF_ChunkList_t *chunks, const CF_Chunk_t *chunk, void *opaque);
 
+/************************************************************************/
+/** @brief Fold newly received file data into the R2 CRC.
+ *
+ * @par Description
+ *       Called for each part of a received file data PDU not already in
+ *       the chunk list, so each byte of the file is digested only once
+ *       no matter how many times it is received. Checksum types that need
+ *       the data in order skip anything received out of order.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       chunk must not be NULL, opaque must not be NULL.
+ *
+ * @param chunks Not used, required for compatibility with CF_ChunkList_ComputeUncovered
+ * @param chunk  Pointer to the part of the file data not yet received
+ * @param opaque Pointer to a CF_DigestGapArgs_t object (passed via CF_ChunkList_ComputeUncovered)
+ */
+void CF_CFDP_R2_DigestGap(const CF_ChunkList_t *chunks, const CF_Chunk_t *chunk, void *opaque);
+
 /************************************************************************/
 /** @brief Send a NAK PDU for R2.
  *
  * @par Description
  *       NAK PDU is sent when there are gaps in the received data. The
  *       chunks class tracks this and generates the NAK PDU by calculating
- *       gaps internally and calling CF_CFDP_R2_GapCompute(). There is a special
+ *       gaps internally and calling CF_CFDP_R2_GapCompute(). When the gaps
+ *       do not fit in one NAK PDU, more are sent, each scoped to start where
+ *       the previous one ended. If no buffer is available for the next one,
+ *       the next call continues from there. There is a special
  *       case where if a metadata PDU has not been received, then a NAK
  *       packet will be sent to request another.
  *
  * @par Assumptions, External Events, and Notes:
  *       txn must not be NULL.
  *
- * @retval CFE_SUCCESS on success. CF_ERROR on error.
+ * @retval CFE_SUCCESS on success. CF_ERROR on error, or if there are gaps left to NAK.
  *
  * @param txn  Pointer to the transaction object
  */
 CFE_Status_t CF_CFDP_R_SubstateSendNak(CF_Transaction_t *txn);
 
+/************************************************************************/
+/** @brief Send a NAK PDU for the gaps left by file data arriving ahead.
+ *
+ * @par Description
+ *       Used in immediate NAK mode, from the tick after file data arrives
+ *       past the furthest received so far. Requests the gaps from the end of the
+ *       previous immediate NAK up to scope_end, and sets that as the
+ *       scope of the NAK PDU. The gaps in it are not requested again
+ *       by the next immediate NAK, but still are by the regular NAK.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       txn must not be NULL. scope_end must be past the end of the
+ *       previous immediate NAK.
+ *
+ * @retval CFE_SUCCESS if the NAK PDU was sent.
+ * @retval CF_SEND_PDU_NO_BUF_AVAIL_ERROR if no buffer was available, so it can be tried again.
+ * @retval CF_ERROR if there are no gaps to request.
+ *
+ * @param txn       Pointer to the transaction object
+ * @param scope_end End offset of the gaps to request
+ */
+CFE_Status_t CF_CFDP_R2_SendImmediateNak(CF_Transaction_t *txn, CF_FileSize_t scope_end);
+
 /************************************************************************/
 /** @brief Calculate up to the configured amount of bytes of CRC.
  *
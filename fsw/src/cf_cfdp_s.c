@@ -100,6 +100,146 @@ void CF_CFDP_S2_SubstateSendEof(CF_Transaction_t *txn)
     /* move this transaction off Q_PEND */
     CF_DequeueTransaction(txn);
     CF_InsertSortPrio(txn, CF_QueueIdx_TXW);
+
+    /* the inactivity timer only counts while waiting on the receiver */
+    CF_CFDP_ArmInactTimer(txn);
+
+    /* tick processing sends the EOF */
+    CF_InsertTransactionTick(&CF_AppData.engine.channels[txn->chan_num], txn);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp_s.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CF_ReadAhead_t *CF_CFDP_S_GetReadAhead(CF_Transaction_t *txn)
+{
+    CF_CListNode_t *node = CF_CList_Pop(&CF_AppData.engine.channels[txn->chan_num].read_ahead_free);
+    CF_ReadAhead_t *ra   = NULL;
+
+    if (node)
+    {
+        ra      = container_of(node, CF_ReadAhead_t, cl_node);
+        ra->len = 0; /* nothing cached for this transaction yet */
+    }
+
+    return ra;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp_s.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CF_CFDP_S_ReadFile(CF_Transaction_t *txn, CF_FileSize_t foffs, void *buf, uint32 len)
+{
+    bool success = true;
+    int  status;
+
+    if (txn->state_data.send.cached_pos != foffs)
+    {
+        status = CF_WrappedSeekTo(txn->fd, foffs);
+        if (status != CFE_SUCCESS)
+        {
+            CFE_EVS_SendEvent(CF_CFDP_S_SEEK_FD_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "CF S%d(%lu:%lu): error seeking to offset %llu, got %ld",
+                              (txn->state == CF_TxnState_S2), (unsigned long)txn->history->src_eid,
+                              (unsigned long)txn->history->seq_num, (unsigned long long)foffs, (long)status);
+            ++CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.fault.file_seek;
+            success = false;
+        }
+        else
+        {
+            txn->state_data.send.cached_pos = foffs;
+        }
+    }
+
+    if (success)
+    {
+        status = CF_WrappedRead(txn->fd, buf, len);
+        if (status != len)
+        {
+            CFE_EVS_SendEvent(CF_CFDP_S_READ_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "CF S%d(%lu:%lu): error reading bytes: expected %ld, got %ld",
+                              (txn->state == CF_TxnState_S2), (unsigned long)txn->history->src_eid,
+                              (unsigned long)txn->history->seq_num, (long)len, (long)status);
+            ++CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.fault.file_read;
+            success = false;
+        }
+        else
+        {
+            txn->state_data.send.cached_pos += status;
+        }
+    }
+
+    return success;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp_s.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CF_CFDP_S_ReadCached(CF_Transaction_t *txn, CF_FileSize_t foffs, void *buf, uint32 len)
+{
+    CF_ReadAhead_t *ra      = txn->state_data.send.read_ahead;
+    uint8 *         dest    = buf;
+    bool            success = true;
+    bool            hit     = true;
+    CF_FileSize_t   start;
+    uint32          count;
+
+    while (success && (len > 0))
+    {
+        if ((foffs < ra->offset) || (foffs >= (ra->offset + ra->len)))
+        {
+            /* refill with the aligned block holding foffs, or up to the end of the file */
+            hit   = false;
+            start = foffs & ~((CF_FileSize_t)CF_SEND_READ_AHEAD_SIZE - 1);
+            count = CF_SEND_READ_AHEAD_SIZE;
+            if (count > (txn->fsize - start))
+            {
+                count = txn->fsize - start;
+            }
+
+            ra->len = 0; /* in case the read fails */
+            success = CF_CFDP_S_ReadFile(txn, start, ra->data, count);
+            if (success)
+            {
+                ra->offset = start;
+                ra->len    = count;
+            }
+        }
+
+        if (success)
+        {
+            count = (ra->offset + ra->len) - foffs;
+            if (count > len)
+            {
+                count = len;
+            }
+
+            memcpy(dest, &ra->data[foffs - ra->offset], count);
+            dest += count;
+            foffs += count;
+            len -= count;
+        }
+    }
+
+    if (hit)
+    {
+        ++CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.sent.read_ahead_hit;
+    }
+    else
+    {
+        ++CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.sent.read_ahead_miss;
+    }
+
+    return success;
 }
 
 /*----------------------------------------------------------------
@@ -108,13 +248,12 @@ void CF_CFDP_S2_SubstateSendEof(CF_Transaction_t *txn)
  * See description in cf_cfdp_s.h for argument/return detail
  *
  *-----------------------------------------------------------------*/
-CFE_Status_t CF_CFDP_S_SendFileData(CF_Transaction_t *txn, uint32 foffs, uint32 bytes_to_read, uint8 calc_crc)
+CFE_Status_t CF_CFDP_S_SendFileData(CF_Transaction_t *txn, CF_FileSize_t foffs, CF_FileSize_t bytes_to_read,
+                                    uint8 calc_crc)
 {
     bool                            success = true;
-    int                             status  = 0;
     CFE_Status_t                    ret     = CF_ERROR;
-    CF_Logical_PduBuffer_t *        ph      = CF_CFDP_ConstructPduHeader(txn, 0, CF_AppData.config_table->local_eid,
-                                                            txn->history->peer_eid, 0, txn->history->seq_num, 1);
+    CF_Logical_PduBuffer_t *        ph      = CF_CFDP_ConstructFileDataHeader(txn, 1);
     CF_Logical_PduFileDataHeader_t *fd;
     size_t                          actual_bytes;
     void *                          data_ptr;
@@ -162,40 +301,32 @@ CFE_Status_t CF_CFDP_S_SendFileData(CF_Transaction_t *txn, uint32 foffs, uint32
         fd->data_len = actual_bytes;
         fd->data_ptr = data_ptr;
 
-        if (txn->state_data.send.cached_pos != foffs)
+        if (!txn->state_data.send.read_ahead)
         {
-            status = CF_WrappedLseek(txn->fd, foffs, OS_SEEK_SET);
-            if (status != foffs)
-            {
-                CFE_EVS_SendEvent(CF_CFDP_S_SEEK_FD_ERR_EID, CFE_EVS_EventType_ERROR,
-                                  "CF S%d(%lu:%lu): error seeking to offset %ld, got %ld",
-                                  (txn->state == CF_TxnState_S2), (unsigned long)txn->history->src_eid,
-                                  (unsigned long)txn->history->seq_num, (long)foffs, (long)status);
-                ++CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.fault.file_seek;
-                success = false;
-            }
+            /* try to get a read-ahead buffer, if there are none free this reads directly from the file */
+            txn->state_data.send.read_ahead = CF_CFDP_S_GetReadAhead(txn);
         }
 
-        if (success)
+        if (txn->state_data.send.read_ahead && ((foffs + actual_bytes) <= txn->fsize))
         {
-            status = CF_WrappedRead(txn->fd, data_ptr, actual_bytes);
-            if (status != actual_bytes)
-            {
-                CFE_EVS_SendEvent(CF_CFDP_S_READ_ERR_EID, CFE_EVS_EventType_ERROR,
-                                  "CF S%d(%lu:%lu): error reading bytes: expected %ld, got %ld",
-                                  (txn->state == CF_TxnState_S2), (unsigned long)txn->history->src_eid,
-                                  (unsigned long)txn->history->seq_num, (long)actual_bytes, (long)status);
-                ++CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.fault.file_read;
-                success = false;
-            }
+            success = CF_CFDP_S_ReadCached(txn, foffs, data_ptr, actual_bytes);
+        }
+        else
+        {
+            success = CF_CFDP_S_ReadFile(txn, foffs, data_ptr, actual_bytes);
         }
 
         if (success)
         {
-            txn->state_data.send.cached_pos += status;
             CF_CFDP_SendFd(txn, ph); /* CF_CFDP_SendFd only returns CFE_SUCCESS */
 
             CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.sent.file_data_bytes += actual_bytes;
+            if (!calc_crc)
+            {
+                /* only the first pass over the file goes into the CRC, the rest is resent on request */
+                CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.sent.retransmit_bytes += actual_bytes;
+            }
+            txn->file_data_bytes += actual_bytes;
             CF_Assert((foffs + actual_bytes) <= txn->fsize); /* sanity check */
             if (calc_crc)
             {
@@ -249,6 +380,8 @@ void CF_CFDP_S_SubstateSendFileData(CF_Transaction_t *txn)
 CFE_Status_t CF_CFDP_S_CheckAndRespondNak(CF_Transaction_t *txn)
 {
     const CF_Chunk_t *chunk;
+    CF_ChunkOffset_t  offset;
+    CF_ChunkSize_t    size;
     CFE_Status_t      sret;
     CFE_Status_t      ret = CFE_SUCCESS;
 
@@ -271,14 +404,20 @@ CFE_Status_t CF_CFDP_S_CheckAndRespondNak(CF_Transaction_t *txn)
     }
     else
     {
-        /* Get first chunk and process if available */
+        /* Get first chunk and process if available. The list is in offset order with overlapping
+         * and adjacent requests already merged, so the file is read front to back. Requests close
+         * enough to share a PDU with the first go in it too, with the data between them, rather
+         * than each in a short PDU of its own */
         chunk = CF_ChunkList_GetFirstChunk(&txn->chunks->chunks);
         if (chunk != NULL)
         {
-            ret = CF_CFDP_S_SendFileData(txn, chunk->offset, chunk->size, 0);
+            offset = chunk->offset;
+            size   = CF_ChunkList_CoalesceFirst(&txn->chunks->chunks,
+                                                CF_AppData.config_table->outgoing_file_chunk_size);
+            ret    = CF_CFDP_S_SendFileData(txn, offset, size, 0);
             if (ret > 0)
             {
-                CF_ChunkList_RemoveFromFirst(&txn->chunks->chunks, ret);
+                CF_ChunkList_RemoveBelow(&txn->chunks->chunks, offset + ret);
                 ret = 1; /* processed nak, so caller doesn't send file data */
             }
             else if (ret < 0)
@@ -330,30 +469,30 @@ void CF_CFDP_S_SubstateSendMetadata(CF_Transaction_t *txn)
 {
     CFE_Status_t sret;
     int32        ret;
-    int          status  = 0;
+    os_fstat_t   fstat;
     bool         success = true;
 
     if (!OS_ObjectIdDefined(txn->fd))
     {
-        if (OS_FileOpenCheck(txn->history->fnames.src_filename) == OS_SUCCESS)
+        if (OS_FileOpenCheck(txn->fnames.src_filename) == OS_SUCCESS)
         {
             CFE_EVS_SendEvent(CF_CFDP_S_ALREADY_OPEN_ERR_EID, CFE_EVS_EventType_ERROR,
                               "CF S%d(%lu:%lu): file %s already open", (txn->state == CF_TxnState_S2),
                               (unsigned long)txn->history->src_eid, (unsigned long)txn->history->seq_num,
-                              txn->history->fnames.src_filename);
+                              txn->fnames.src_filename);
             ++CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.fault.file_open;
             success = false;
         }
 
         if (success)
         {
-            ret = CF_WrappedOpenCreate(&txn->fd, txn->history->fnames.src_filename, OS_FILE_FLAG_NONE, OS_READ_ONLY);
+            ret = CF_WrappedOpenCreate(&txn->fd, txn->fnames.src_filename, OS_FILE_FLAG_NONE, OS_READ_ONLY);
             if (ret < 0)
             {
                 CFE_EVS_SendEvent(CF_CFDP_S_OPEN_ERR_EID, CFE_EVS_EventType_ERROR,
                                   "CF S%d(%lu:%lu): failed to open file %s, error=%ld", (txn->state == CF_TxnState_S2),
                                   (unsigned long)txn->history->src_eid, (unsigned long)txn->history->seq_num,
-                                  txn->history->fnames.src_filename, (long)ret);
+                                  txn->fnames.src_filename, (long)ret);
                 ++CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.fault.file_open;
                 txn->fd = OS_OBJECT_ID_UNDEFINED; /* just in case */
                 success = false;
@@ -362,14 +501,14 @@ void CF_CFDP_S_SubstateSendMetadata(CF_Transaction_t *txn)
 
         if (success)
         {
-            status = CF_WrappedLseek(txn->fd, 0, OS_SEEK_END);
-            if (status < 0)
+            /* OS_lseek() cannot report a size past 2 GiB, so get it from the file system */
+            ret = OS_stat(txn->fnames.src_filename, &fstat);
+            if (ret != OS_SUCCESS)
             {
                 CFE_EVS_SendEvent(CF_CFDP_S_SEEK_END_ERR_EID, CFE_EVS_EventType_ERROR,
-                                  "CF S%d(%lu:%lu): failed to seek end file %s, error=%ld",
+                                  "CF S%d(%lu:%lu): failed to get size of file %s, error=%ld",
                                   (txn->state == CF_TxnState_S2), (unsigned long)txn->history->src_eid,
-                                  (unsigned long)txn->history->seq_num, txn->history->fnames.src_filename,
-                                  (long)status);
+                                  (unsigned long)txn->history->seq_num, txn->fnames.src_filename, (long)ret);
                 ++CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.fault.file_seek;
                 success = false;
             }
@@ -377,19 +516,9 @@ void CF_CFDP_S_SubstateSendMetadata(CF_Transaction_t *txn)
 
         if (success)
         {
-            txn->fsize = status;
-
-            status = CF_WrappedLseek(txn->fd, 0, OS_SEEK_SET);
-            if (status != 0)
-            {
-                CFE_EVS_SendEvent(CF_CFDP_S_SEEK_BEG_ERR_EID, CFE_EVS_EventType_ERROR,
-                                  "CF S%d(%lu:%lu): failed to seek begin file %s, got %ld",
-                                  (txn->state == CF_TxnState_S2), (unsigned long)txn->history->src_eid,
-                                  (unsigned long)txn->history->seq_num, txn->history->fnames.src_filename,
-                                  (long)status);
-                ++CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.fault.file_seek;
-                success = false;
-            }
+            /* only files too big for 32-bit offsets are sent in large file mode */
+            txn->fsize                = OS_FILESTAT_SIZE(fstat);
+            txn->flags.com.large_file = (txn->fsize > UINT32_MAX);
         }
     }
 
@@ -408,6 +537,7 @@ void CF_CFDP_S_SubstateSendMetadata(CF_Transaction_t *txn)
         {
             /* once metadata is sent, switch to filedata mode */
             txn->state_data.send.sub_state = CF_TxSubState_FILEDATA;
+            CF_CFDP_InitFileDataHeader(txn);
         }
         /* if sret==CF_SEND_PDU_NO_BUF_AVAIL_ERROR, then try to send md again next cycle */
     }
@@ -418,8 +548,7 @@ void CF_CFDP_S_SubstateSendMetadata(CF_Transaction_t *txn)
         CF_CFDP_S_Reset(txn);
     }
 
-    /* don't need CF_CRC_Start() since taken care of by reset_cfdp() */
-    /*CF_CRC_Start(&txn->crc);*/
+    /* don't need CF_CRC_Start() since taken care of by CF_CFDP_InitTxnTxFile() */
 }
 
 /*----------------------------------------------------------------
@@ -708,8 +837,6 @@ void CF_CFDP_S_Tick(CF_Transaction_t *txn, int *cont /* unused */)
         }
         else
         {
-            CF_Timer_Tick(&txn->inactivity_timer);
-
             if (txn->flags.com.ack_timer_armed)
             {
                 if (CF_Timer_Expired(&txn->ack_timer))
@@ -749,10 +876,6 @@ void CF_CFDP_S_Tick(CF_Transaction_t *txn, int *cont /* unused */)
                         }
                     }
                 }
-                else
-                {
-                    CF_Timer_Tick(&txn->ack_timer);
-                }
             }
 
             if (!early_exit && txn->state_data.send.sub_state == CF_TxSubState_SEND_FIN_ACK)
@@ -158,11 +158,66 @@ void CF_CFDP_S1_SubstateSendEof(CF_Transaction_t *txn);
 void CF_CFDP_S2_SubstateSendEof(CF_Transaction_t *txn);
 
 /************************************************************************/
-/** @brief Helper function to populate the PDU with file data and send it.
+/** @brief Get a free read-ahead buffer from the transaction's channel.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       txn must not be NULL. The buffer goes back to the channel when
+ *       the transaction is reset.
+ *
+ * @param txn  Pointer to the transaction object
+ *
+ * @returns Pointer to an empty read-ahead buffer
+ * @retval  NULL if the channel has none free
+ */
+CF_ReadAhead_t *CF_CFDP_S_GetReadAhead(CF_Transaction_t *txn);
+
+/************************************************************************/
+/** @brief Read file data directly from the file.
  *
  * @par Description
  *       This function checks the file offset cache and if the desired
  *       location is where the file offset is, it can skip a seek() call.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       txn must not be NULL, buf must not be NULL.
+ *
+ * @param txn   Pointer to the transaction object
+ * @param foffs Position in file to read from
+ * @param buf   Buffer to read into
+ * @param len   Number of bytes to read
+ *
+ * @returns true if all bytes were read, false on error
+ */
+bool CF_CFDP_S_ReadFile(CF_Transaction_t *txn, CF_FileSize_t foffs, void *buf, uint32 len);
+
+/************************************************************************/
+/** @brief Read file data through the transaction's read-ahead buffer.
+ *
+ * @par Description
+ *       Bytes already in the buffer are copied from it. Otherwise the
+ *       buffer is refilled with the CF_SEND_READ_AHEAD_SIZE aligned block
+ *       of the file holding them. Counts a read-ahead hit if no refill was
+ *       needed, or a miss if it was.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       txn must not be NULL and must have a read-ahead buffer, buf must
+ *       not be NULL. foffs + len must not be past the end of the file.
+ *
+ * @param txn   Pointer to the transaction object
+ * @param foffs Position in file to read from
+ * @param buf   Buffer to read into
+ * @param len   Number of bytes to read
+ *
+ * @returns true if all bytes were read, false on error
+ */
+bool CF_CFDP_S_ReadCached(CF_Transaction_t *txn, CF_FileSize_t foffs, void *buf, uint32 len);
+
+/************************************************************************/
+/** @brief Helper function to populate the PDU with file data and send it.
+ *
+ * @par Description
+ *       The file data is read through the transaction's read-ahead buffer,
+ *       or directly from the file if it has none.
  *       The file is read into the filedata PDU and then the PDU is sent.
  *
  * @par Assumptions, External Events, and Notes:
@@ -177,7 +232,8 @@ void CF_CFDP_S2_SubstateSendEof(CF_Transaction_t *txn);
  * @param calc_crc Enable CRC/Checksum calculation
  *
  */
-CFE_Status_t CF_CFDP_S_SendFileData(CF_Transaction_t *txn, uint32 foffs, uint32 bytes_to_read, uint8 calc_crc);
+CFE_Status_t CF_CFDP_S_SendFileData(CF_Transaction_t *txn, CF_FileSize_t foffs, CF_FileSize_t bytes_to_read,
+                                    uint8 calc_crc);
 
 /************************************************************************/
 /** @brief Standard state function to send the next file data PDU for active transaction.
@@ -21,11 +21,15 @@
  * @file
  *
  * This is the interface to the CFE Software Bus for CF transmit/recv.
- * Specifically this implements 3 functions used by the CFDP engine:
+ * Specifically this implements 4 functions used by the CFDP engine:
  *  - CF_CFDP_MsgOutGet() - gets a buffer prior to transmitting
  *  - CF_CFDP_Send() - sends the buffer from CF_CFDP_MsgOutGet
+ *  - CF_CFDP_ReleaseOutput() - gives back the buffers not used in a channel cycle
  *  - CF_CFDP_ReceiveMessage() - gets a received message
  *
+ * Plus the entry point of the optional per-channel receive child task,
+ * CF_CFDP_RxTaskMain(), which feeds CF_CFDP_ReceiveMessage() from a ring.
+ *
  * These functions were originally part of the CFDP engine itself
  * but were split into a separate file, both to improve testability
  * as well as to (potentially) allow interfaces to message/packet services
@@ -52,6 +56,140 @@
 #include <string.h>
 #include "cf_assert.h"
 
+/*
+ * The receive ring is shared by the channel receive task and the engine
+ * without a lock, so the slot contents must be visible to the other side
+ * before the index that hands the slot over.
+ */
+#if defined(__GNUC__)
+#define CF_RX_RING_BARRIER() __sync_synchronize()
+#elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) && !defined(__STDC_NO_ATOMICS__)
+#include <stdatomic.h>
+#define CF_RX_RING_BARRIER() atomic_thread_fence(memory_order_seq_cst)
+#else
+#define CF_RX_RING_BARRIER() /* assume a single core that does not reorder memory accesses */
+#endif
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp_sbintf.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_CFDP_RefillOutputTokens(CF_Channel_t *chan)
+{
+    const int          chan_num = (chan - CF_AppData.engine.channels);
+    uint32             rate     = CF_AppData.config_table->chan[chan_num].max_outgoing_bytes_per_second;
+    CFE_TIME_SysTime_t now      = CFE_TIME_GetTime();
+    CFE_TIME_SysTime_t elapsed;
+    uint64             fill;
+
+    if (!rate)
+    {
+        /* unlimited, start clean if a limit is set later */
+        chan->out_tokens = 0;
+        chan->out_frac   = 0;
+    }
+    else if (CFE_TIME_Compare(now, chan->out_fill_time) == CFE_TIME_A_GT_B)
+    {
+        elapsed = CFE_TIME_Subtract(now, chan->out_fill_time);
+        if (elapsed.Seconds)
+        {
+            fill           = rate;
+            chan->out_frac = 0;
+        }
+        else
+        {
+            /* keep the fraction so slow rates at a high wakeup frequency are not truncated to nothing */
+            fill           = ((uint64)rate * CFE_TIME_Sub2MicroSecs(elapsed.Subseconds)) + chan->out_frac;
+            chan->out_frac = fill % 1000000;
+            fill /= 1000000;
+        }
+
+        /* the rate may be any uint32, but more than the tokens can count is as good as unlimited */
+        if (fill > (INT32_MAX - CF_MAX_PDU_SIZE))
+        {
+            fill = INT32_MAX - CF_MAX_PDU_SIZE;
+        }
+
+        if (chan->out_tokens > CF_MAX_PDU_SIZE)
+        {
+            chan->out_tokens = CF_MAX_PDU_SIZE;
+        }
+        chan->out_tokens += (int32)fill;
+    }
+
+    /* a time jump backwards just restarts the interval from now */
+    chan->out_fill_time = now;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Takes up to want pipe credits, and a buffer for each, into the channel
+ * output batch.  Returns the status of the last credit taken, so when the
+ * batch is still empty the caller can tell a full pipe from no buffers.
+ *
+ *-----------------------------------------------------------------*/
+static int32 CF_CFDP_ReserveOutput(CF_Channel_t *chan, uint32 want)
+{
+    CF_OutputBatch_t *batch     = &chan->out_batch;
+    int32             os_status = OS_SUCCESS;
+    CFE_SB_Buffer_t * bufptr;
+
+    while (batch->count < want)
+    {
+        if (OS_ObjectIdDefined(chan->sem_id))
+        {
+            os_status = OS_CountSemTimedWait(chan->sem_id, 0);
+            if (os_status != OS_SUCCESS)
+            {
+                break;
+            }
+        }
+
+        bufptr = CFE_SB_AllocateMessageBuffer(offsetof(CF_PduTlmMsg_t, ph) + CF_MAX_PDU_SIZE +
+                                              CF_PDU_ENCAPSULATION_EXTRA_TRAILING_BYTES);
+        if (!bufptr)
+        {
+            /* the credit is of no use without a buffer */
+            if (OS_ObjectIdDefined(chan->sem_id))
+            {
+                OS_CountSemGive(chan->sem_id);
+            }
+            break;
+        }
+
+        batch->bufs[batch->count] = bufptr;
+        ++batch->count;
+    }
+
+    return os_status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Puts an output buffer that was handed out but not sent back in the
+ * batch.  It still holds its pipe credit, and the batch has room for it
+ * since it was taken from there.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_CFDP_UnuseOutput(CF_Channel_t *chan)
+{
+    CF_OutputBatch_t *batch = &chan->out_batch;
+
+    if (chan->out.msg)
+    {
+        CF_Assert(batch->count < CF_OUTPUT_BATCH_PER_CHAN);
+        batch->bufs[batch->count] = chan->out.msg;
+        ++batch->count;
+        chan->out.msg = NULL;
+    }
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -62,82 +200,130 @@ CF_Logical_PduBuffer_t *CF_CFDP_MsgOutGet(const CF_Transaction_t *txn, bool sile
 {
     /* if channel is frozen, do not take message */
     CF_Channel_t *          chan    = CF_AppData.engine.channels + txn->chan_num;
+    CF_OutputBatch_t *      batch   = &chan->out_batch;
+    uint32                  max_out = CF_AppData.config_table->chan[txn->chan_num].max_outgoing_messages_per_wakeup;
     bool                    success = true;
     CF_Logical_PduBuffer_t *ret;
+    uint32                  want;
     int32                   os_status;
 
     /* this function should not be called more than once before the message
      * is sent, so if there's already an outgoing message allocated
-     * then drop and get a new one (not likely) */
+     * then put it back with the others and start over (not likely) */
     ret = NULL;
-    if (CF_AppData.engine.out.msg)
+    CF_CFDP_UnuseOutput(chan);
+
+    if (max_out && (chan->outgoing_counter == max_out))
     {
-        CFE_SB_ReleaseMessageBuffer(CF_AppData.engine.out.msg);
-        CF_AppData.engine.out.msg = NULL;
+        /* no more messages this wakeup allowed */
+        chan->cur = txn; /* remember where we were for next time */
+        success   = false;
     }
 
-    if (CF_AppData.config_table->chan[txn->chan_num].max_outgoing_messages_per_wakeup &&
-        (CF_AppData.engine.outgoing_counter ==
-         CF_AppData.config_table->chan[txn->chan_num].max_outgoing_messages_per_wakeup))
+    if (CF_AppData.config_table->chan[txn->chan_num].max_outgoing_bytes_per_second && (chan->out_tokens <= 0))
     {
-        /* no more messages this wakeup allowed */
+        /* byte rate used up until tokens are refilled, the next PDU may take it negative */
         chan->cur = txn; /* remember where we were for next time */
         success   = false;
     }
 
     if (success && !CF_AppData.hk.Payload.channel_hk[txn->chan_num].frozen && !txn->flags.com.suspended)
     {
-        /* first, check if there's room in the pipe for the message we want to build */
-        if (OS_ObjectIdDefined(chan->sem_id))
+        /* first, make sure there is a buffer with room in the pipe for the message we want to build */
+        if (!batch->count && !batch->blocked)
         {
-            os_status = OS_CountSemTimedWait(chan->sem_id, 0);
-        }
-        else
-        {
-            os_status = OS_SUCCESS;
-        }
+            /* only as many as this cycle has shown it can use: one at first, then
+             * twice the last refill, so what goes back unused is never more
+             * than the buffers already handed out.  No more than the message limit
+             * allows, nor more full size PDUs than the byte rate allows */
+            want = batch->want;
+            if (want == 0)
+            {
+                want = 1;
+            }
+            if (max_out && (want > (max_out - chan->outgoing_counter)))
+            {
+                want = max_out - chan->outgoing_counter;
+            }
+            if (CF_AppData.config_table->chan[txn->chan_num].max_outgoing_bytes_per_second &&
+                (want > (((uint32)chan->out_tokens + CF_MAX_PDU_SIZE - 1) / CF_MAX_PDU_SIZE)))
+            {
+                want = ((uint32)chan->out_tokens + CF_MAX_PDU_SIZE - 1) / CF_MAX_PDU_SIZE;
+            }
 
-        /* Allocate message buffer on success */
-        if (os_status == OS_SUCCESS)
-        {
-            CF_AppData.engine.out.msg = CFE_SB_AllocateMessageBuffer(offsetof(CF_PduTlmMsg_t, ph) + CF_MAX_PDU_SIZE +
-                                                                     CF_PDU_ENCAPSULATION_EXTRA_TRAILING_BYTES);
+            batch->want = (want < (CF_OUTPUT_BATCH_PER_CHAN / 2)) ? (want * 2) : CF_OUTPUT_BATCH_PER_CHAN;
+
+            os_status = CF_CFDP_ReserveOutput(chan, want);
+            if (!batch->count)
+            {
+                batch->blocked = true;
+                if (!silent && (os_status == OS_SUCCESS))
+                {
+                    CFE_EVS_SendEvent(CF_CFDP_NO_MSG_ERR_EID, CFE_EVS_EventType_ERROR,
+                                      "CF: no output message buffer available");
+                }
+            }
         }
 
-        if (!CF_AppData.engine.out.msg)
+        if (!batch->count)
         {
             chan->cur = txn; /* remember where we were for next time */
-            if (!silent && (os_status == OS_SUCCESS))
-            {
-                CFE_EVS_SendEvent(CF_CFDP_NO_MSG_ERR_EID, CFE_EVS_EventType_ERROR,
-                                  "CF: no output message buffer available");
-            }
-            success = false;
+            success   = false;
         }
 
         if (success)
         {
-            CFE_MSG_Init(&CF_AppData.engine.out.msg->Msg,
+            --batch->count;
+            chan->out.msg = batch->bufs[batch->count];
+
+            CFE_MSG_Init(&chan->out.msg->Msg,
                          CFE_SB_ValueToMsgId(CF_AppData.config_table->chan[txn->chan_num].mid_output),
                          offsetof(CF_PduTlmMsg_t, ph));
-            ++CF_AppData.engine.outgoing_counter; /* even if max_outgoing_messages_per_wakeup is 0 (unlimited), it's ok
-                                                    to inc this */
+            ++chan->outgoing_counter; /* even if max_outgoing_messages_per_wakeup is 0 (unlimited), it's ok to inc this */
 
             /* prepare for encoding - the "tx_pdudata" is what serves as the temporary holding area for content */
-            ret = &CF_AppData.engine.out.tx_pdudata;
+            ret = &chan->out.tx_pdudata;
         }
     }
 
     /* if returning a buffer, then reset the encoder state to point to the beginning of the encapsulation msg */
     if (success && ret != NULL)
     {
-        CF_CFDP_EncodeStart(&CF_AppData.engine.out.encode, CF_AppData.engine.out.msg, ret, offsetof(CF_PduTlmMsg_t, ph),
+        CF_CFDP_EncodeStart(&chan->out.encode, chan->out.msg, ret, offsetof(CF_PduTlmMsg_t, ph),
                             offsetof(CF_PduTlmMsg_t, ph) + CF_MAX_PDU_SIZE);
     }
 
     return ret;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp_sbintf.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_CFDP_ReleaseOutput(CF_Channel_t *chan)
+{
+    CF_OutputBatch_t *batch = &chan->out_batch;
+
+    CF_CFDP_UnuseOutput(chan);
+    while (batch->count)
+    {
+        --batch->count;
+        CFE_SB_ReleaseMessageBuffer(batch->bufs[batch->count]);
+        batch->bufs[batch->count] = NULL;
+
+        if (OS_ObjectIdDefined(chan->sem_id))
+        {
+            OS_CountSemGive(chan->sem_id);
+        }
+    }
+
+    /* next cycle starts over from one */
+    batch->want    = 0;
+    batch->blocked = false;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -146,9 +332,11 @@ CF_Logical_PduBuffer_t *CF_CFDP_MsgOutGet(const CF_Transaction_t *txn, bool sile
  *-----------------------------------------------------------------*/
 void CF_CFDP_Send(uint8 chan_num, const CF_Logical_PduBuffer_t *ph)
 {
+    CF_Channel_t * chan;
     CFE_MSG_Size_t sb_msgsize;
 
     CF_Assert(chan_num < CF_NUM_CHANNELS);
+    chan = &CF_AppData.engine.channels[chan_num];
 
     /* now handle the SB encapsulation - this should reflect the
      * length of the entire message, including encapsulation */
@@ -157,13 +345,96 @@ void CF_CFDP_Send(uint8 chan_num, const CF_Logical_PduBuffer_t *ph)
     sb_msgsize += ph->pdu_header.data_encoded_length;
     sb_msgsize += CF_PDU_ENCAPSULATION_EXTRA_TRAILING_BYTES;
 
-    CFE_MSG_SetSize(&CF_AppData.engine.out.msg->Msg, sb_msgsize);
-    CFE_MSG_SetMsgTime(&CF_AppData.engine.out.msg->Msg, CFE_TIME_GetTime());
-    CFE_SB_TransmitBuffer(CF_AppData.engine.out.msg, true);
+    CFE_MSG_SetSize(&chan->out.msg->Msg, sb_msgsize);
+    CFE_MSG_SetMsgTime(&chan->out.msg->Msg, CFE_TIME_GetTime());
+    CFE_SB_TransmitBuffer(chan->out.msg, true);
 
     ++CF_AppData.hk.Payload.channel_hk[chan_num].counters.sent.pdu;
 
-    CF_AppData.engine.out.msg = NULL;
+    if (CF_AppData.config_table->chan[chan_num].max_outgoing_bytes_per_second)
+    {
+        chan->out_tokens -= ph->pdu_header.header_encoded_length + ph->pdu_header.data_encoded_length;
+    }
+
+    chan->out.msg = NULL;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Attaches the decoder to the PDU in a received message, past its
+ * command or telemetry header and without any fixed trailing bytes.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_CFDP_DecodeMsgStart(CF_DecoderState_t *pdec, const CFE_SB_Buffer_t *bufptr, CF_Logical_PduBuffer_t *ph,
+                                   CFE_MSG_Size_t msg_size, CFE_MSG_Type_t msg_type)
+{
+    if (msg_size > CF_PDU_ENCAPSULATION_EXTRA_TRAILING_BYTES)
+    {
+        /* Ignore/subtract any fixed trailing bytes */
+        msg_size -= CF_PDU_ENCAPSULATION_EXTRA_TRAILING_BYTES;
+    }
+    else
+    {
+        /* bad message size - not supposed to happen */
+        msg_size = 0;
+    }
+    if (msg_type == CFE_MSG_Type_Tlm)
+    {
+        CF_CFDP_DecodeStart(pdec, bufptr, ph, offsetof(CF_PduTlmMsg_t, ph), msg_size);
+    }
+    else
+    {
+        CF_CFDP_DecodeStart(pdec, bufptr, ph, offsetof(CF_PduCmdMsg_t, ph), msg_size);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Adds what the receive task counted since the last call to the
+ * housekeeping counters.  The task keeps running totals and never
+ * writes housekeeping, so a counter reset cannot lose or undo its counts.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_CFDP_CountRxRing(CF_RxRing_t *ring, CF_HkRecv_t *recv)
+{
+    uint32 total;
+
+    total = ring->pdu;
+    recv->pdu += total - ring->pdu_seen;
+    ring->pdu_seen = total;
+
+    total = ring->error;
+    recv->error += total - ring->error_seen;
+    ring->error_seen = total;
+
+    total = ring->overflow;
+    recv->ring_overflow += total - ring->overflow_seen;
+    ring->overflow_seen = total;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Returns the transaction for a PDU from the ring.  The receive task
+ * already looked it up, but the engine may have started or finished
+ * transactions since, so the lookup is repeated unless the one found
+ * is still indexed under the same ID.
+ *
+ *-----------------------------------------------------------------*/
+static CF_Transaction_t *CF_CFDP_RxRingTxn(CF_Channel_t *chan, CF_Transaction_t *txn, const CF_Logical_PduBuffer_t *ph)
+{
+    if ((txn == NULL) || (txn->hash_head == NULL) || (txn->history->src_eid != ph->pdu_header.source_eid) ||
+        (txn->history->seq_num != ph->pdu_header.sequence_num))
+    {
+        txn = CF_FindTransactionBySequenceNumber(chan, ph->pdu_header.sequence_num, ph->pdu_header.source_eid);
+    }
+
+    return txn;
 }
 
 /*----------------------------------------------------------------
@@ -174,51 +445,83 @@ void CF_CFDP_Send(uint8 chan_num, const CF_Logical_PduBuffer_t *ph)
  *-----------------------------------------------------------------*/
 void CF_CFDP_ReceiveMessage(CF_Channel_t *chan)
 {
-    CF_Transaction_t *txn; /* initialized below */
+    CF_Transaction_t *txn   = NULL;
     uint32            count = 0;
     int32             status;
     const int         chan_num = (chan - CF_AppData.engine.channels);
     CFE_SB_Buffer_t * bufptr;
     CFE_MSG_Size_t    msg_size;
     CFE_MSG_Type_t    msg_type = CFE_MSG_Type_Invalid;
+    CF_HkRecv_t *     recv     = &CF_AppData.hk.Payload.channel_hk[chan_num].counters.recv;
 
-    CF_Logical_PduBuffer_t *ph;
+    CF_Logical_PduBuffer_t *ph = &chan->in.rx_pdudata;
     CF_Transaction_t        t_finack;
+    CF_RxRing_t *           ring = NULL;
+    CF_RxRingSlot_t *       slot;
+    uint32                  occupancy;
+    bool                    valid;
 
-    for (; count < CF_AppData.config_table->chan[chan_num].rx_max_messages_per_wakeup; ++count)
+    if (CFE_RESOURCEID_TEST_DEFINED(chan->rx_task_id))
     {
-        status = CFE_SB_ReceiveBuffer(&bufptr, chan->pipe, CFE_SB_POLL);
-        if (status != CFE_SUCCESS)
-        {
-            break; /* no more messages */
-        }
+        /* the receive task has already taken the messages off the pipe */
+        ring      = &chan->rx_ring;
+        occupancy = ring->head - ring->tail;
 
-        ph = &CF_AppData.engine.in.rx_pdudata;
-        CFE_ES_PerfLogEntry(CF_PERF_ID_PDURCVD(chan_num));
-        CFE_MSG_GetSize(&bufptr->Msg, &msg_size);
-        CFE_MSG_GetType(&bufptr->Msg, &msg_type);
-        if (msg_size > CF_PDU_ENCAPSULATION_EXTRA_TRAILING_BYTES)
-        {
-            /* Ignore/subtract any fixed trailing bytes */
-            msg_size -= CF_PDU_ENCAPSULATION_EXTRA_TRAILING_BYTES;
-        }
-        else
+        recv->ring_occupancy = occupancy;
+        if (occupancy > recv->ring_high_water)
         {
-            /* bad message size - not supposed to happen */
-            msg_size = 0;
+            recv->ring_high_water = occupancy;
         }
-        if (msg_type == CFE_MSG_Type_Tlm)
+
+        CF_CFDP_CountRxRing(ring, recv);
+    }
+
+    for (; count < CF_AppData.config_table->chan[chan_num].rx_max_messages_per_wakeup; ++count)
+    {
+        if (ring != NULL)
         {
-            CF_CFDP_DecodeStart(&CF_AppData.engine.in.decode, bufptr, ph, offsetof(CF_PduTlmMsg_t, ph), msg_size);
+            if (ring->head == ring->tail)
+            {
+                break; /* no more messages */
+            }
+
+            /* the receive task only queues PDUs whose header decoded, so pick up from there */
+            CFE_ES_PerfLogEntry(CF_PERF_ID_PDURCVD(chan_num));
+            CF_RX_RING_BARRIER();
+            slot = &ring->slots[ring->tail & (CF_RX_RING_DEPTH_PER_CHAN - 1)];
+
+            memset(ph, 0, sizeof(*ph));
+            chan->in.decode = slot->decode;
+            ph->pdec        = &chan->in.decode;
+            ph->pdu_header  = slot->pdu_header;
+            ph->fdirective  = slot->fdirective;
+
+            txn   = CF_CFDP_RxRingTxn(chan, slot->txn, ph);
+            valid = true;
         }
         else
         {
-            CF_CFDP_DecodeStart(&CF_AppData.engine.in.decode, bufptr, ph, offsetof(CF_PduCmdMsg_t, ph), msg_size);
+            status = CFE_SB_ReceiveBuffer(&bufptr, chan->pipe, CFE_SB_POLL);
+            if (status != CFE_SUCCESS)
+            {
+                break; /* no more messages */
+            }
+
+            CFE_ES_PerfLogEntry(CF_PERF_ID_PDURCVD(chan_num));
+            CFE_MSG_GetSize(&bufptr->Msg, &msg_size);
+            CFE_MSG_GetType(&bufptr->Msg, &msg_type);
+            CF_CFDP_DecodeMsgStart(&chan->in.decode, bufptr, ph, msg_size, msg_type);
+
+            valid = !CF_CFDP_RecvPh(chan_num, ph);
+            if (valid)
+            {
+                /* got a valid PDU -- look it up by sequence number */
+                txn = CF_FindTransactionBySequenceNumber(chan, ph->pdu_header.sequence_num, ph->pdu_header.source_eid);
+            }
         }
-        if (!CF_CFDP_RecvPh(chan_num, ph))
+
+        if (valid)
         {
-            /* got a valid PDU -- look it up by sequence number */
-            txn = CF_FindTransactionBySequenceNumber(chan, ph->pdu_header.sequence_num, ph->pdu_header.source_eid);
             if (txn)
             {
                 /* found one! Send it to the transaction state processor */
@@ -254,21 +557,22 @@ void CF_CFDP_ReceiveMessage(CF_Channel_t *chan)
                         /* NOTE: recv and recv_spurious will both be incremented */
                         ++CF_AppData.hk.Payload.channel_hk[chan_num].counters.recv.spurious;
                     }
-
-                    CFE_ES_PerfLogExit(CF_PERF_ID_PDURCVD(chan_num));
-                    continue;
                 }
-
-                /* if no match found, then it must be the case that we would be the destination entity id, so verify it
-                 */
-                if (ph->pdu_header.destination_eid == CF_AppData.config_table->local_eid)
+                else if (ph->pdu_header.destination_eid == CF_AppData.config_table->local_eid)
                 {
-                    /* we didn't find a match, so assign it to a transaction */
-                    if (CF_AppData.hk.Payload.channel_hk[chan_num].q_size[CF_QueueIdx_RX] == CF_MAX_SIMULTANEOUS_RX)
+                    /* no match found, and we are the destination entity id, so assign it to a transaction */
+                    /* txn is still NULL from the lookup above */
+                    if (CF_AppData.hk.Payload.channel_hk[chan_num].q_size[CF_QueueIdx_RX] != CF_MAX_SIMULTANEOUS_RX)
+                    {
+                        /* the table may size the pool below the worst case, so this can run out */
+                        txn = CF_FindUnusedTransaction(chan);
+                    }
+
+                    if (txn == NULL)
                     {
                         CFE_EVS_SendEvent(
                             CF_CFDP_RX_DROPPED_ERR_EID, CFE_EVS_EventType_ERROR,
-                            "CF: dropping packet from %lu transaction number 0x%08lx due max RX transactions reached",
+                            "CF: dropping packet from %lu transaction number 0x%08lx due to no free RX transaction",
                             (unsigned long)ph->pdu_header.source_eid, (unsigned long)ph->pdu_header.sequence_num);
 
                         /* NOTE: as there is no transaction (txn) associated with this, there is no known channel,
@@ -276,8 +580,6 @@ void CF_CFDP_ReceiveMessage(CF_Channel_t *chan)
                     }
                     else
                     {
-                        txn = CF_FindUnusedTransaction(chan);
-                        CF_Assert(txn);
                         txn->history->dir = CF_Direction_RX;
 
                         /* set default FIN status */
@@ -299,5 +601,100 @@ void CF_CFDP_ReceiveMessage(CF_Channel_t *chan)
         }
 
         CFE_ES_PerfLogExit(CF_PERF_ID_PDURCVD(chan_num));
+
+        if (ring != NULL)
+        {
+            /* done with the slot, give it back to the receive task */
+            CF_RX_RING_BARRIER();
+            ++ring->tail;
+        }
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_cfdp_sbintf.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_CFDP_RxTaskMain(void)
+{
+    CF_Channel_t *   chan = NULL;
+    CF_RxRing_t *    ring;
+    CF_RxRingSlot_t *slot;
+    CFE_ES_TaskId_t  task_id;
+    CFE_SB_Buffer_t *bufptr;
+    CFE_MSG_Size_t   msg_size;
+    CFE_MSG_Type_t   msg_type;
+    int              chan_num;
+    int              i;
+
+    CFE_ES_GetTaskID(&task_id);
+
+    /* the engine stores the task id when CFE_ES_CreateChildTask() returns,
+     * which may be after this task has started, so allow it some time */
+    for (i = 0; chan == NULL && i < CF_STARTUP_SEM_MAX_RETRIES; ++i)
+    {
+        for (chan_num = 0; chan_num < CF_NUM_CHANNELS; ++chan_num)
+        {
+            if (CFE_RESOURCEID_TEST_EQUAL(CF_AppData.engine.channels[chan_num].rx_task_id, task_id))
+            {
+                chan = &CF_AppData.engine.channels[chan_num];
+                break;
+            }
+        }
+
+        if (chan == NULL)
+        {
+            OS_TaskDelay(CF_STARTUP_SEM_TASK_DELAY);
+        }
+    }
+
+    if (chan != NULL)
+    {
+        ring = &chan->rx_ring;
+
+        /* runs until the engine deletes this task, or the pipe */
+        while (CFE_SB_ReceiveBuffer(&bufptr, chan->pipe, CFE_SB_PEND_FOREVER) == CFE_SUCCESS)
+        {
+            CFE_MSG_GetSize(&bufptr->Msg, &msg_size);
+            CFE_MSG_GetType(&bufptr->Msg, &msg_type);
+
+            CF_RX_RING_BARRIER();
+            if ((ring->head - ring->tail) >= CF_RX_RING_DEPTH_PER_CHAN || msg_size > sizeof(slot->msg.bytes))
+            {
+                ++ring->overflow;
+            }
+            else
+            {
+                /* decode the header in place, so the slot is only handed over if it holds a usable PDU */
+                slot = &ring->slots[ring->head & (CF_RX_RING_DEPTH_PER_CHAN - 1)];
+                memcpy(slot->msg.bytes, bufptr, msg_size);
+                CF_CFDP_DecodeMsgStart(&slot->decode, &slot->msg.sb, &ring->ph, msg_size, msg_type);
+
+                if (CF_CFDP_DecodePh(&ring->ph) != CFE_SUCCESS)
+                {
+                    ++ring->error;
+                }
+                else
+                {
+                    slot->pdu_header = ring->ph.pdu_header;
+                    slot->fdirective = ring->ph.fdirective;
+
+                    /* the engine changes the index as transactions start and finish */
+                    OS_MutSemTake(chan->index_mutex);
+                    slot->txn = CF_FindTransactionBySequenceNumber(chan, slot->pdu_header.sequence_num,
+                                                                   slot->pdu_header.source_eid);
+                    OS_MutSemGive(chan->index_mutex);
+
+                    ++ring->pdu;
+
+                    CF_RX_RING_BARRIER();
+                    ++ring->head;
+                }
+            }
+        }
     }
+
+    CFE_ES_ExitChildTask();
 }
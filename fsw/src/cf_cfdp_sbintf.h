@@ -63,16 +63,39 @@ typedef struct CF_PduTlmMsg
     CF_CFDP_PduHeader_t       ph;  /**< \brief Beginning of CFDP headers */
 } CF_PduTlmMsg_t;
 
+/************************************************************************/
+/** @brief Refill the output byte rate tokens of a channel.
+ *
+ * @par Description
+ *       When the channel has a max_outgoing_bytes_per_second limit, this adds the
+ *       bytes allowed for the CFE time elapsed since the last refill, at most one
+ *       second worth.  Unused tokens beyond one PDU are not carried over, so the
+ *       output of each engine cycle stays close to the rate instead of bursting
+ *       after a quiet period.  A refill is capped so the signed token count
+ *       cannot overflow, even for rates of 2^31 bytes per second and up.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       chan must not be NULL.
+ *
+ * @param chan     Pointer to the channel
+ */
+void CF_CFDP_RefillOutputTokens(CF_Channel_t *chan);
+
 /************************************************************************/
 /** @brief Obtain a message buffer to construct a PDU inside.
  *
  * @par Description
  *       This performs the handshaking via semaphore with the consumer
- *       of the PDU. If the semaphore can be obtained, a software bus
- *       buffer is obtained and it is returned. If the semaphore is
- *       unavailable, then the current transaction is remembered for next
- *       engine cycle. If silent is true, then the event message is not
- *       printed in the case of no buffer available.
+ *       of the PDU. Buffers are handed out from the channel output batch,
+ *       which is refilled when empty by taking semaphore credits and a
+ *       software bus buffer for each: one the first time in a cycle, then
+ *       twice as many as the last refill, bounded by the message limit
+ *       and the byte rate tokens left. If no credit or buffer can be obtained, then the
+ *       current transaction is remembered for next engine cycle, and the
+ *       channel does not try again until then. The same happens when the
+ *       channel has used up its output byte rate tokens. If silent is true,
+ *       then the event message is not printed in the case of no buffer
+ *       available.
  *
  * @par Assumptions, External Events, and Notes:
  *       txn must not be NULL.
@@ -85,6 +108,21 @@ typedef struct CF_PduTlmMsg
  */
 CF_Logical_PduBuffer_t *CF_CFDP_MsgOutGet(const CF_Transaction_t *txn, bool silent);
 
+/************************************************************************/
+/** @brief Give back the output buffers a channel did not use this cycle.
+ *
+ * @par Description
+ *       Releases the buffers left in the channel output batch, and one
+ *       handed out but not sent, and gives back their semaphore credits, so the next cycle starts again from
+ *       a batch of one.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       chan must not be NULL. Called at the end of each channel cycle.
+ *
+ * @param chan     Pointer to the channel
+ */
+void CF_CFDP_ReleaseOutput(CF_Channel_t *chan);
+
 /************************************************************************/
 /** @brief Sends the current output buffer via the software bus.
  *
@@ -108,4 +146,24 @@ void CF_CFDP_Send(uint8 chan_num, const CF_Logical_PduBuffer_t *ph);
  */
 void CF_CFDP_ReceiveMessage(CF_Channel_t *chan);
 
+/************************************************************************/
+/** @brief Entry point of the receive child task of a channel.
+ *
+ * @par Description
+ *       Blocks on the channel PDU input pipe, copies each message into
+ *       the channel receive ring, decodes its PDU header there and looks up
+ *       its transaction, for CF_CFDP_ReceiveMessage() to process on the
+ *       next engine cycle. Messages that find the ring full, or that do not
+ *       fit a ring slot, are dropped and counted as ring overflow; PDUs
+ *       whose header does not decode are dropped and counted as errors.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       Started by CF_CFDP_InitEngine() for channels with rx_task_enabled
+ *       set in the configuration table. It finds its channel by its task id.
+ *       The lookup holds the channel index mutex, and the counts are kept in
+ *       the ring for the engine to add to housekeeping.
+ *
+ */
+void CF_CFDP_RxTaskMain(void);
+
 #endif /* !CF_CFDP_SBINTF_H */
@@ -38,6 +38,7 @@
 #include "cf_msg.h"
 #include "cf_clist.h"
 #include "cf_chunk.h"
+#include "cf_names.h"
 #include "cf_timer.h"
 #include "cf_crc.h"
 #include "cf_codec.h"
@@ -172,7 +173,7 @@ typedef enum
  */
 typedef struct CF_History
 {
-    CF_TxnFilenames_t   fnames;   /**< \brief file names associated with this history entry */
+    CF_NameRef_t        names;    /**< \brief file names in the channel name arena, 0 while active or if dropped */
     CF_CListNode_t      cl_node;  /**< \brief for connection to a CList */
     CF_Direction_t      dir;      /**< \brief direction of this history entry */
     CF_TxnStatus_t      txn_stat; /**< \brief final status of operation */
@@ -224,6 +225,17 @@ typedef struct CF_Poll
     bool          timer_set;
 } CF_Poll_t;
 
+/**
+ * @brief Read-ahead cache of file data for a send transaction
+ */
+typedef struct CF_ReadAhead
+{
+    CF_CListNode_t cl_node; /**< \brief node in the channel free list while not in use */
+    CF_FileSize_t  offset;  /**< \brief file offset of data[0] */
+    uint32         len;     /**< \brief number of valid bytes in data, 0 if nothing cached */
+    uint8          data[CF_SEND_READ_AHEAD_SIZE];
+} CF_ReadAhead_t;
+
 /**
  * @brief Data specific to a class 2 send file transaction
  */
@@ -239,19 +251,51 @@ typedef struct CF_TxS2_Data
 typedef struct CF_TxState_Data
 {
     CF_TxSubState_t sub_state;
-    uint32          cached_pos;
+    CF_FileSize_t   cached_pos;
+    CF_ReadAhead_t *read_ahead; /**< \brief file data cache, NULL if none was free */
+
+    CF_EncodedHeader_t fd_header; /**< \brief file data PDU header, encoded when metadata is sent */
 
     CF_TxS2_Data_t s2;
 } CF_TxState_Data_t;
 
+/**
+ * @brief Write-behind buffer of file data for a receive transaction
+ */
+typedef struct CF_WriteBehind
+{
+    CF_CListNode_t cl_node; /**< \brief node in the channel free list while not in use */
+    CF_FileSize_t  offset;  /**< \brief file offset of data[0] */
+    uint32         len;     /**< \brief number of bytes in data not yet written, 0 if none */
+    uint8          data[CF_RECV_WRITE_BEHIND_SIZE];
+} CF_WriteBehind_t;
+
+/**
+ * @brief Bitmap of the file data received by a class 2 receive transaction
+ *
+ * Attached to the transaction chunk list, see CF_ChunkList_AttachBitmap().
+ */
+typedef struct CF_RecvBitmap
+{
+    CF_CListNode_t cl_node; /**< \brief node in the channel free list while not in use */
+    uint32         words[CF_RECV_BITMAP_SIZE / sizeof(uint32)];
+    uint32         summary[CF_CHUNK_BITMAP_SUMMARY_WORDS(CF_RECV_BITMAP_SIZE / sizeof(uint32))];
+} CF_RecvBitmap_t;
+
 /**
  * @brief Data specific to a class 2 receive file transaction
  */
 typedef struct CF_RxS2_Data
 {
     uint32                    eof_crc;
-    uint32                    eof_size;
-    uint32                    rx_crc_calc_bytes;
+    CF_FileSize_t             eof_size;
+    CF_FileSize_t             rx_crc_calc_bytes;
+    CF_FileSize_t             rx_crc_inline_bytes; /**< \brief bytes folded into the CRC as file data arrived */
+    CF_FileSize_t             rx_frontier;         /**< \brief end of the furthest file data received */
+    CF_FileSize_t             imm_nak_end;         /**< \brief scope end of the last immediate NAK, 0 if none */
+    CF_Timer_Ticks_t          imm_nak_tick;        /**< \brief channel timer tick of the last immediate NAK */
+    CF_FileSize_t             imm_nak_scope;       /**< \brief scope end of the immediate NAK waiting to be sent */
+    CF_FileSize_t             nak_cursor;          /**< \brief scope start of the next NAK PDU in a NAK cycle */
     CF_CFDP_FinDeliveryCode_t dc;
     CF_CFDP_FinFileStatus_t   fs;
     uint8                     eof_cc; /**< \brief remember the cc in the received EOF PDU to echo in eof-ack */
@@ -263,8 +307,10 @@ typedef struct CF_RxS2_Data
  */
 typedef struct CF_RxState_Data
 {
-    CF_RxSubState_t sub_state;
-    uint32          cached_pos;
+    CF_RxSubState_t   sub_state;
+    CF_FileSize_t     cached_pos;
+    CF_WriteBehind_t *write_behind; /**< \brief file data not yet written, NULL if none was free */
+    CF_RecvBitmap_t * bitmap;       /**< \brief file data received, NULL if not in use or none was free */
 
     CF_RxS2_Data_t r2;
 } CF_RxState_Data_t;
@@ -279,6 +325,7 @@ typedef struct CF_Flags_Common
     bool  suspended;
     bool  canceled;
     bool  crc_calc;
+    bool  large_file; /**< \brief file sizes and offsets in PDUs are 64 bits */
 } CF_Flags_Common_t;
 
 /**
@@ -296,6 +343,7 @@ typedef struct CF_Flags_Rx
     bool inactivity_fired; /**< \brief used for r2 */
     bool complete;         /**< \brief r2 */
     bool fd_nak_sent;      /**< \brief latches that at least one NAK has been sent for file data */
+    bool send_imm_nak;     /**< \brief an immediate NAK up to imm_nak_scope is waiting for the tick */
 } CF_Flags_Rx_t;
 
 /**
@@ -337,14 +385,14 @@ typedef struct CF_Transaction
 {
     CF_TxnState_t state; /**< \brief each engine is commanded to do something, which is the overall state */
 
-    CF_History_t *     history;          /**< \brief weird, holds active filenames and possibly other info */
+    CF_History_t *     history;          /**< \brief status kept after the transaction, see CF_History_t */
     CF_ChunkWrapper_t *chunks;           /**< \brief for gap tracking, only used on class 2 */
     CF_Timer_t         inactivity_timer; /**< \brief set to the overall inactivity timer of a remote */
     CF_Timer_t         ack_timer;        /**< \brief called ack_timer, but is also nak_timer */
 
-    uint32    fsize; /**< \brief lseek() should be 64-bit on 64-bit system, but osal limits to 32-bit */
-    uint32    foffs; /**< \brief offset into file for next read */
-    osal_id_t fd;
+    CF_FileSize_t fsize; /**< \brief file size, past 4 GiB only in large file mode, see flags.com.large_file */
+    CF_FileSize_t foffs; /**< \brief offset into file for next read */
+    osal_id_t     fd;
 
     CF_Crc_t crc;
 
@@ -354,8 +402,20 @@ typedef struct CF_Transaction
 
     CF_CListNode_t cl_node;
 
+    CF_CListNode_t   hash_node; /**< \brief node in the channel (src_eid, seq_num) lookup index */
+    CF_CListNode_t **hash_head; /**< \brief index bucket holding hash_node, NULL if not indexed */
+
+    CF_CListNode_t   tick_node; /**< \brief node in the channel tick list */
+    CF_CListNode_t **tick_head; /**< \brief tick list holding tick_node, NULL if nothing to do on tick */
+
     CF_Playback_t *pb; /**< \brief NULL if transaction does not belong to a playback */
 
+    CF_TxnFilenames_t fnames; /**< \brief file names, stored in the history when the transaction is done */
+
+    CFE_TIME_SysTime_t start_time;      /**< \brief when the transaction became active, for EOT throughput */
+    CF_FileSize_t      file_data_bytes; /**< \brief file data bytes sent or received, for EOT throughput */
+    uint8              drr_deficit;     /**< \brief PDUs left in this transaction's round-robin turn */
+
     CF_StateData_t state_data;
 
     /**
@@ -381,39 +441,92 @@ typedef enum
 } CF_TickType_t;
 
 /**
- * @brief Channel state object
+ * @brief Size of each receive ring slot
  *
- * This keeps the state of CF channels
+ * Room for either SB header, a PDU of CF_MAX_PDU_SIZE and any trailing bytes.
+ */
+#define CF_RX_RING_SLOT_SIZE                                                                   \
+    (sizeof(CFE_MSG_CommandHeader_t) + sizeof(CFE_MSG_TelemetryHeader_t) + CF_MAX_PDU_SIZE + \
+     CF_PDU_ENCAPSULATION_EXTRA_TRAILING_BYTES)
+
+/**
+ * @brief A copy of one received SB message
+ */
+typedef union CF_RxRingMsg
+{
+    CFE_SB_Buffer_t sb;                          /**< \brief the message, as it was on the input pipe */
+    uint8           bytes[CF_RX_RING_SLOT_SIZE]; /**< \brief storage for the whole message */
+} CF_RxRingMsg_t;
+
+/**
+ * @brief A received PDU with its header decoded, waiting for the engine
  *
- * Each CF channel has a separate transaction list, PDU throttle, playback,
- * and poll state, as well as separate addresses on the underlying message
- * transport (e.g. SB).
+ * The engine may start or finish transactions after the receive task looks
+ * one up, so it only uses txn if that still matches the PDU header.
  */
-typedef struct CF_Channel
+typedef struct CF_RxRingSlot
 {
-    CF_CListNode_t *qs[CF_QueueIdx_NUM];
-    CF_CListNode_t *cs[CF_Direction_NUM];
+    CF_RxRingMsg_t                      msg;        /**< \brief the message holding the PDU */
+    CF_DecoderState_t                   decode;     /**< \brief decoder positioned just past the headers */
+    CF_Logical_PduHeader_t              pdu_header; /**< \brief the decoded PDU header */
+    CF_Logical_PduFileDirectiveHeader_t fdirective; /**< \brief the decoded directive code, if any */
+    CF_Transaction_t *                  txn;        /**< \brief transaction found by the receive task, or NULL */
+} CF_RxRingSlot_t;
 
-    CFE_SB_PipeId_t pipe;
+/**
+ * @brief Hands received PDUs from the channel receive task to the engine
+ *
+ * Single producer, single consumer, no lock: only the receive task writes
+ * head and only the engine writes tail. Both count up without limit, and
+ * (head - tail) is the number of filled slots.
+ *
+ * The counters are the same way: the receive task only writes its totals,
+ * and the engine only writes how much of them it has already added to
+ * housekeeping, so a housekeeping reset never races with the task.
+ */
+typedef struct CF_RxRing
+{
+    volatile uint32 head; /**< \brief count of slots filled by the receive task */
+    volatile uint32 tail; /**< \brief count of slots processed by the engine */
 
-    uint32 num_cmd_tx;
+    volatile uint32 pdu;      /**< \brief PDUs the receive task decoded and queued */
+    volatile uint32 error;    /**< \brief PDUs the receive task dropped on a header decode error */
+    volatile uint32 overflow; /**< \brief PDUs the receive task dropped on a full ring or oversize message */
 
-    CF_Playback_t playback[CF_MAX_COMMANDED_PLAYBACK_DIRECTORIES_PER_CHAN];
+    uint32 pdu_seen;      /**< \brief part of pdu already counted in housekeeping */
+    uint32 error_seen;    /**< \brief part of error already counted in housekeeping */
+    uint32 overflow_seen; /**< \brief part of overflow already counted in housekeeping */
 
-    /* For polling directories, the configuration data is in a table. */
-    CF_Poll_t poll[CF_MAX_POLLING_DIR_PER_CHAN];
+    CF_Logical_PduBuffer_t ph; /**< \brief header decode scratch of the receive task */
 
-    osal_id_t sem_id; /**< \brief semaphore id for output pipe */
+    CF_RxRingSlot_t slots[CF_RX_RING_DEPTH_PER_CHAN];
+} CF_RxRing_t;
 
-    const CF_Transaction_t *cur; /**< \brief current transaction during channel cycle */
+/**
+ * @brief Number of transaction priority levels, one for each value of a uint8
+ */
+#define CF_NUM_PRIORITIES (256)
 
-    uint8 tick_type;
-} CF_Channel_t;
+/**
+ * @brief Priority index over one of the priority sorted queues
+ *
+ * The queue itself stays a single list in priority order, so everything
+ * that walks it is unaffected. The transactions of each priority level
+ * form a FIFO run on that list, and this records the last transaction of
+ * each run, plus a bitmap of the levels that have one. A transaction is
+ * inserted after the last one of the nearest level at or above its own,
+ * see CF_InsertSortPrio(), without walking the queue.
+ */
+typedef struct CF_PrioIndex
+{
+    CF_CListNode_t *tail[CF_NUM_PRIORITIES];          /**< \brief last transaction of each level, NULL if none */
+    uint32          nonempty[CF_NUM_PRIORITIES / 32]; /**< \brief bit set for each level with a transaction */
+} CF_PrioIndex_t;
 
 /**
- * @brief CF engine output state
+ * @brief CF channel output state
  *
- * Keeps the state of the current output PDU in the CF engine
+ * Keeps the state of the output PDU under construction on a channel
  */
 typedef struct CF_Output
 {
@@ -423,9 +536,9 @@ typedef struct CF_Output
 } CF_Output_t;
 
 /**
- * @brief CF engine input state
+ * @brief CF channel input state
  *
- * Keeps the state of the current input PDU in the CF engine
+ * Keeps the state of the input PDU being processed on a channel
  */
 typedef struct CF_Input
 {
@@ -434,6 +547,105 @@ typedef struct CF_Input
     CF_Logical_PduBuffer_t rx_pdudata; /**< \brief Rx PDU logical values */
 } CF_Input_t;
 
+/**
+ * @brief Output buffers reserved by a channel
+ *
+ * Each buffer holds one credit of the channel output semaphore, when the
+ * channel has one.  Both go back at the end of the channel cycle unless the
+ * buffer was sent.
+ */
+typedef struct CF_OutputBatch
+{
+    CFE_SB_Buffer_t *bufs[CF_OUTPUT_BATCH_PER_CHAN]; /**< \brief reserved buffers, the last one is handed out first */
+    uint8            count;                          /**< \brief number of entries in bufs */
+    uint8            want;    /**< \brief how many the next refill takes, 0 for 1, doubles with each refill */
+    bool             blocked; /**< \brief no credit or buffer was available, so stop asking until the next cycle */
+} CF_OutputBatch_t;
+
+/**
+ * @brief Channel state object
+ *
+ * This keeps the state of CF channels
+ *
+ * Each CF channel has a separate transaction list, PDU throttle, playback,
+ * and poll state, as well as separate addresses on the underlying message
+ * transport (e.g. SB).
+ */
+typedef struct CF_Channel
+{
+    CF_CListNode_t *qs[CF_QueueIdx_NUM];
+    CF_CListNode_t *cs[CF_Direction_NUM];
+    CF_CListNode_t *read_ahead_free;   /**< \brief free send read-ahead buffers */
+    CF_CListNode_t *write_behind_free; /**< \brief free receive write-behind buffers */
+    CF_CListNode_t *recv_bitmap_free;  /**< \brief free receive bitmaps */
+
+    /** \brief active transactions indexed by (src_eid, seq_num), see CF_FindTransactionBySequenceNumber() */
+    CF_CListNode_t *txn_hash[CF_NUM_TRANSACTION_HASH_BUCKETS_PER_CHAN];
+
+    /** \brief transactions with a timer expired or output pending, see CF_InsertTransactionTick() */
+    CF_CListNode_t *tick_list[CF_Direction_NUM];
+
+    CF_PrioIndex_t pend_prio; /**< \brief priority index over the PEND queue */
+    CF_PrioIndex_t txw_prio;  /**< \brief priority index over the TXW queue */
+
+    CF_TimerWheel_t timer_wheel; /**< \brief runs all the timers of this channel */
+
+    CF_NameArena_t name_arena; /**< \brief file names of the entries on the history queue */
+
+    CF_Transaction_t *transactions;     /**< \brief transaction pool, carved from the engine pool arena */
+    CF_History_t *    histories;        /**< \brief history pool, carved from the engine pool arena */
+    uint16            num_transactions; /**< \brief number of entries in transactions */
+    uint16            num_histories;    /**< \brief number of entries in histories */
+
+    CF_ChunkPool_t chunk_pool; /**< \brief chunk memory of the gap lists, carved from the engine pool arena */
+
+    CFE_SB_PipeId_t pipe;
+
+    CFE_ES_TaskId_t rx_task_id;  /**< \brief receive child task, undefined if the engine reads the pipe itself */
+    CF_RxRing_t     rx_ring;     /**< \brief PDUs received by the receive child task */
+    osal_id_t       index_mutex; /**< \brief guards txn_hash against the receive task, undefined if there is none */
+
+    CFE_ES_TaskId_t worker_task_id;  /**< \brief worker child task, undefined if the main task cycles the channel */
+    osal_id_t       worker_wake_sem; /**< \brief given by the main task to start a cycle in the worker task */
+    osal_id_t       worker_done_sem; /**< \brief given by the worker task when the cycle is done */
+
+    uint32 num_cmd_tx;
+
+    CF_Playback_t playback[CF_MAX_COMMANDED_PLAYBACK_DIRECTORIES_PER_CHAN];
+
+    /* For polling directories, the configuration data is in a table. */
+    CF_Poll_t poll[CF_MAX_POLLING_DIR_PER_CHAN];
+
+    osal_id_t        sem_id;    /**< \brief semaphore id for output pipe */
+    CF_OutputBatch_t out_batch; /**< \brief output buffers reserved for this cycle */
+    CF_Output_t      out;       /**< \brief output PDU under construction */
+    CF_Input_t       in;        /**< \brief input PDU being processed */
+
+    uint32 outgoing_counter; /**< \brief PDUs started this engine cycle */
+
+    int32              out_tokens;    /**< \brief PDU bytes that may still be sent, goes negative by up to one PDU */
+    uint32             out_frac;      /**< \brief fraction of a token carried to the next refill, in millionths */
+    CFE_TIME_SysTime_t out_fill_time; /**< \brief time of the last refill of out_tokens */
+
+    const CF_Transaction_t *cur; /**< \brief current transaction during channel cycle */
+
+    uint8 tick_type;
+} CF_Channel_t;
+
+/**
+ * @brief Pool arena size needed for the compile-time default capacity of every channel
+ *
+ * This is the footprint of the transaction, history and chunk pools when every channel
+ * uses CF_NUM_TRANSACTIONS_PER_CHANNEL, CF_NUM_HISTORIES_PER_CHANNEL and its default
+ * chunks per transaction.  Each channel also needs up to one more block of chunks to
+ * round its chunk pool up, a flag byte per block, and alignment padding for five pools.
+ */
+#define CF_POOL_ARENA_DEFAULT_SIZE                                                                          \
+    ((CF_NUM_TRANSACTIONS * (sizeof(CF_Transaction_t) + (CF_Direction_NUM * sizeof(CF_ChunkWrapper_t)))) + \
+     (CF_NUM_HISTORIES * sizeof(CF_History_t)) + (CF_NUM_CHUNKS_ALL_CHANNELS * sizeof(CF_Chunk_t)) +        \
+     (CF_NUM_CHUNKS_ALL_CHANNELS / CF_CHUNK_BLOCK_SIZE) +                                                   \
+     (CF_NUM_CHANNELS * ((CF_CHUNK_BLOCK_SIZE * sizeof(CF_Chunk_t)) + 1 + (5 * sizeof(uint64)))))
+
 /**
  * @brief An engine represents a pairing to a local EID
  *
@@ -441,21 +653,25 @@ typedef struct CF_Input
  */
 typedef struct CF_Engine
 {
-    CF_TransactionSeq_t seq_num; /* \brief keep track of the next sequence number to use for sends */
+    CF_TransactionSeq_t seq_num;   /* \brief keep track of the next sequence number to use for sends */
+    osal_id_t           seq_mutex; /**< \brief guards seq_num while worker tasks run, undefined if there are none */
 
-    CF_Output_t out;
-    CF_Input_t  in;
+    CF_Channel_t channels[CF_NUM_CHANNELS];
 
-    /* NOTE: could have separate array of transactions as part of channel? */
-    CF_Transaction_t transactions[CF_NUM_TRANSACTIONS];
-    CF_History_t     histories[CF_NUM_HISTORIES];
-    CF_Channel_t     channels[CF_NUM_CHANNELS];
+    /**
+     * \brief backing store of the transaction, history and chunk pools of all channels
+     *
+     * Each channel takes its pools from here at CF_CFDP_InitEngine(), sized by its
+     * configuration table entry.  Declared as uint64 so every pool is suitably aligned.
+     */
+    uint64 pool_arena[(CF_POOL_ARENA_SIZE + sizeof(uint64) - 1) / sizeof(uint64)];
+    size_t pool_arena_used; /**< \brief bytes of pool_arena already given to a channel */
 
-    CF_ChunkWrapper_t chunks[CF_NUM_TRANSACTIONS * CF_Direction_NUM];
-    CF_Chunk_t        chunk_mem[CF_NUM_CHUNKS_ALL_CHANNELS];
+    CF_ReadAhead_t   read_ahead[CF_NUM_CHANNELS * CF_NUM_SEND_READ_AHEAD_BUFFERS_PER_CHAN];
+    CF_WriteBehind_t write_behind[CF_NUM_CHANNELS * CF_NUM_RECV_WRITE_BEHIND_BUFFERS_PER_CHAN];
+    CF_RecvBitmap_t  recv_bitmap[CF_NUM_CHANNELS * CF_NUM_RECV_BITMAPS_PER_CHAN];
 
-    uint32 outgoing_counter;
-    bool  enabled;
+    bool enabled;
 } CF_Engine_t;
 
 #endif
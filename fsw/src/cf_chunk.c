@@ -36,6 +36,566 @@
 #include "cf_assert.h"
 #include "cf_chunk.h"
 
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * File offset of the start of a bitmap bit, saturated at the largest offset.
+ *
+ *-----------------------------------------------------------------*/
+static CF_ChunkOffset_t CF_Chunks_BitOffset(const CF_ChunkBitmap_t *bitmap, CF_ChunkIdx_t bit)
+{
+    CF_ChunkOffset_t ret = UINT64_MAX;
+
+    if (bit < (UINT64_MAX / bitmap->granule))
+    {
+        ret = bit * bitmap->granule;
+    }
+
+    return ret;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Index of the lowest set bit of a nonzero word.
+ *
+ *-----------------------------------------------------------------*/
+static CF_ChunkIdx_t CF_Chunks_LowestBit(uint32 value)
+{
+    CF_ChunkIdx_t ret = 0;
+
+    if (!(value & 0xFFFF))
+    {
+        value >>= 16;
+        ret += 16;
+    }
+    if (!(value & 0xFF))
+    {
+        value >>= 8;
+        ret += 8;
+    }
+    if (!(value & 0xF))
+    {
+        value >>= 4;
+        ret += 4;
+    }
+    if (!(value & 0x3))
+    {
+        value >>= 2;
+        ret += 2;
+    }
+    if (!(value & 0x1))
+    {
+        ret += 1;
+    }
+
+    return ret;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Finds the first bit at or after the given one that is set (or clear)
+ * in a map of num_bits bits, returning num_bits if there is none.
+ *
+ *-----------------------------------------------------------------*/
+static CF_ChunkIdx_t CF_Chunks_FindInMap(const uint32 *map, CF_ChunkIdx_t bit, CF_ChunkIdx_t num_bits, bool set)
+{
+    CF_ChunkIdx_t word;
+    CF_ChunkIdx_t ret = num_bits;
+    uint32        value;
+
+    for (word = bit / CF_CHUNK_BITMAP_WORD_BITS; (word * CF_CHUNK_BITMAP_WORD_BITS) < num_bits; ++word)
+    {
+        value = set ? map[word] : ~map[word];
+        value &= UINT32_MAX << (bit % CF_CHUNK_BITMAP_WORD_BITS);
+        if (value)
+        {
+            /* the bits past num_bits in the last word are clear, which a search for clear may find */
+            ret = CF_Chunk_MIN((word * CF_CHUNK_BITMAP_WORD_BITS) + CF_Chunks_LowestBit(value), num_bits);
+            break;
+        }
+
+        bit = (word + 1) * CF_CHUNK_BITMAP_WORD_BITS;
+    }
+
+    return ret;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Sets bits [first, last) and updates the run summaries, a word at a time.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_Chunks_SetBits(CF_ChunkBitmap_t *bitmap, CF_ChunkIdx_t first, CF_ChunkIdx_t last)
+{
+    CF_ChunkIdx_t word;
+    CF_ChunkIdx_t end;
+    uint32        sum_bit;
+
+    while (first < last)
+    {
+        word = first / CF_CHUNK_BITMAP_WORD_BITS;
+        end  = CF_Chunk_MIN(last, (word + 1) * CF_CHUNK_BITMAP_WORD_BITS);
+
+        bitmap->words[word] |= (UINT32_MAX >> (CF_CHUNK_BITMAP_WORD_BITS - (end - first)))
+                               << (first % CF_CHUNK_BITMAP_WORD_BITS);
+
+        sum_bit = (uint32)1 << (word % CF_CHUNK_BITMAP_WORD_BITS);
+        bitmap->any[word / CF_CHUNK_BITMAP_WORD_BITS] |= sum_bit;
+        if (bitmap->words[word] == UINT32_MAX)
+        {
+            bitmap->full[word / CF_CHUNK_BITMAP_WORD_BITS] |= sum_bit;
+        }
+
+        first = end;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Finds the first bit at or after the given one that is set (or clear),
+ * returning the number of bits in the bitmap if there is none. Words that
+ * cannot hold such a bit are skipped using the summary.
+ *
+ *-----------------------------------------------------------------*/
+static CF_ChunkIdx_t CF_Chunks_FindBit(const CF_ChunkBitmap_t *bitmap, CF_ChunkIdx_t bit, bool set)
+{
+    const uint32 *summary = set ? bitmap->any : bitmap->full;
+    CF_ChunkIdx_t word    = bit / CF_CHUNK_BITMAP_WORD_BITS;
+    CF_ChunkIdx_t ret     = bitmap->num_words * CF_CHUNK_BITMAP_WORD_BITS;
+    uint32        value;
+
+    while (word < bitmap->num_words)
+    {
+        value = set ? bitmap->words[word] : ~bitmap->words[word];
+        value &= UINT32_MAX << (bit % CF_CHUNK_BITMAP_WORD_BITS);
+        if (value)
+        {
+            ret = (word * CF_CHUNK_BITMAP_WORD_BITS) + CF_Chunks_LowestBit(value);
+            break;
+        }
+
+        /* the next word that may hold the bit is the next one whose "any" bit is set, or "full" bit is clear */
+        word = CF_Chunks_FindInMap(summary, word + 1, bitmap->num_words, set);
+        bit  = word * CF_CHUNK_BITMAP_WORD_BITS;
+    }
+
+    return ret;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Calls compute_gap_fn for up to max_gaps of the pending gaps from *p that
+ * start before end, clipped to [offset, end), adding their sizes to *bytes
+ * and moving *p past them. Returns the number reported.
+ *
+ *-----------------------------------------------------------------*/
+static uint32 CF_Chunks_ListPending(const CF_ChunkList_t *chunks, CF_ChunkIdx_t *p, CF_ChunkOffset_t offset,
+                                    CF_ChunkOffset_t end, uint32 max_gaps, CF_ChunkList_ComputeGapFn_t compute_gap_fn,
+                                    void *opaque, CF_ChunkSize_t *bytes)
+{
+    const CF_ChunkPending_t *pending = &chunks->pending;
+    CF_ChunkOffset_t         hole_end;
+    uint32                   ret = 0;
+    CF_Chunk_t               gap;
+
+    while ((*p < pending->count) && (pending->holes[*p].offset < end) && (ret < max_gaps))
+    {
+        gap.offset = CF_Chunk_MAX(pending->holes[*p].offset, offset);
+        hole_end   = CF_Chunk_MIN(pending->holes[*p].offset + pending->holes[*p].size, end);
+        if (hole_end > gap.offset)
+        {
+            gap.size = hole_end - gap.offset;
+            if (compute_gap_fn)
+            {
+                compute_gap_fn(chunks, &gap, opaque);
+            }
+            *bytes += gap.size;
+            ++ret;
+        }
+        ++*p;
+    }
+
+    return ret;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Calls compute_gap_fn for up to max_gaps parts of [offset, end) that no
+ * chunk in the array covers, or that are pending, in offset order, adding
+ * their sizes to *bytes. Only the chunks that overlap the range are
+ * visited. Returns the number of parts.
+ *
+ *-----------------------------------------------------------------*/
+static uint32 CF_Chunks_ListUncovered(const CF_ChunkList_t *chunks, CF_ChunkOffset_t offset, CF_ChunkOffset_t end,
+                                      uint32 max_gaps, CF_ChunkList_ComputeGapFn_t compute_gap_fn, void *opaque,
+                                      CF_ChunkSize_t *bytes)
+{
+    const CF_Chunk_t range = {offset, end - offset};
+    CF_ChunkOffset_t pos   = offset;
+    CF_ChunkOffset_t next_off;
+    CF_ChunkIdx_t    i   = CF_Chunks_FindInsertPosition(chunks, &range);
+    CF_ChunkIdx_t    p   = 0;
+    uint32           ret = 0;
+    CF_Chunk_t       gap;
+
+    /* the chunk before the insert position starts before the range, but may extend into it */
+    if (i > 0)
+    {
+        pos = CF_Chunk_MAX(pos, chunks->chunks[i - 1].offset + chunks->chunks[i - 1].size);
+    }
+
+    while ((pos < end) && (ret < max_gaps))
+    {
+        next_off = ((i < chunks->count) && (chunks->chunks[i].offset < end)) ? chunks->chunks[i].offset : end;
+
+        if (next_off > pos)
+        {
+            /* pending gaps lie within chunks, so those before this gap end before it */
+            ret += CF_Chunks_ListPending(chunks, &p, offset, pos, max_gaps - ret, compute_gap_fn, opaque, bytes);
+            if (ret < max_gaps)
+            {
+                gap.offset = pos;
+                gap.size   = next_off - pos;
+                if (compute_gap_fn)
+                {
+                    compute_gap_fn(chunks, &gap, opaque);
+                }
+                *bytes += gap.size;
+                ++ret;
+            }
+        }
+
+        if (next_off == end)
+        {
+            break;
+        }
+
+        pos = CF_Chunk_MAX(pos, chunks->chunks[i].offset + chunks->chunks[i].size);
+        ++i;
+    }
+
+    ret += CF_Chunks_ListPending(chunks, &p, offset, end, max_gaps - ret, compute_gap_fn, opaque, bytes);
+
+    return ret;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * As CF_Chunks_ListUncovered(), for a list with a bitmap attached: walks
+ * the runs of clear bits in the range, and looks in the chunk array only
+ * within those.
+ *
+ *-----------------------------------------------------------------*/
+static uint32 CF_Chunks_BitmapUncovered(const CF_ChunkList_t *chunks, CF_ChunkOffset_t offset, CF_ChunkOffset_t end,
+                                        uint32 max_gaps, CF_ChunkList_ComputeGapFn_t compute_gap_fn, void *opaque,
+                                        CF_ChunkSize_t *bytes)
+{
+    const CF_ChunkBitmap_t *bitmap   = &chunks->bitmap;
+    const CF_ChunkIdx_t     num_bits = bitmap->num_words * CF_CHUNK_BITMAP_WORD_BITS;
+    CF_ChunkIdx_t           bit      = CF_Chunk_MIN(offset / bitmap->granule, num_bits);
+    CF_ChunkIdx_t           next_set;
+    CF_ChunkOffset_t        run_start;
+    CF_ChunkOffset_t        run_end;
+    uint32                  ret = 0;
+
+    while ((offset < end) && (ret < max_gaps))
+    {
+        bit       = CF_Chunks_FindBit(bitmap, bit, false);
+        run_start = CF_Chunk_MAX(offset, CF_Chunks_BitOffset(bitmap, bit));
+        if (run_start >= end)
+        {
+            break;
+        }
+
+        /* past the end of the bitmap, only the chunk array knows what is there */
+        next_set = (bit < num_bits) ? CF_Chunks_FindBit(bitmap, bit, true) : num_bits;
+        run_end  = (next_set < num_bits) ? CF_Chunks_BitOffset(bitmap, next_set) : end;
+        if (run_end > end)
+        {
+            run_end = end;
+        }
+
+        ret += CF_Chunks_ListUncovered(chunks, run_start, run_end, max_gaps - ret, compute_gap_fn, opaque, bytes);
+
+        offset = run_end;
+        bit    = next_set;
+    }
+
+    return ret;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Adds [offset, end) to the chunk array, if not empty.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_Chunks_AddRange(CF_ChunkList_t *chunks, CF_ChunkOffset_t offset, CF_ChunkOffset_t end)
+{
+    const CF_Chunk_t chunk = {offset, end - offset};
+
+    if (end > offset)
+    {
+        CF_Chunks_Insert(chunks, CF_Chunks_FindInsertPosition(chunks, &chunk), &chunk);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Moves the entry at i of the gap index up the heap to where it belongs.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_Chunks_GapIndexUp(CF_ChunkGapIndex_t *index, CF_ChunkIdx_t i)
+{
+    CF_Chunk_t    entry = index->heap[i];
+    CF_ChunkIdx_t parent;
+
+    while (i > 0)
+    {
+        parent = (i - 1) / 2;
+        if (index->heap[parent].size <= entry.size)
+        {
+            break;
+        }
+        index->heap[i] = index->heap[parent];
+        i              = parent;
+    }
+    index->heap[i] = entry;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Removes the top entry of the gap index.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_Chunks_GapIndexPop(CF_ChunkGapIndex_t *index)
+{
+    CF_Chunk_t    entry;
+    CF_ChunkIdx_t i = 0;
+    CF_ChunkIdx_t child;
+
+    --index->count;
+    entry = index->heap[index->count];
+
+    for (child = 1; child < index->count; child = (2 * i) + 1)
+    {
+        if (((child + 1) < index->count) && (index->heap[child + 1].size < index->heap[child].size))
+        {
+            ++child;
+        }
+        if (entry.size <= index->heap[child].size)
+        {
+            break;
+        }
+        index->heap[i] = index->heap[child];
+        i              = child;
+    }
+    index->heap[i] = entry;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Builds the gap index from the list: the smallest gaps, sorted, which is
+ * also a heap. If any are left out, the largest kept is the new limit.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_Chunks_GapIndexBuild(CF_ChunkList_t *chunks)
+{
+    CF_ChunkGapIndex_t *index = &chunks->gaps;
+    CF_ChunkIdx_t       i;
+    CF_ChunkIdx_t       j;
+    CF_Chunk_t          gap;
+    bool                left_out = false;
+
+    index->count = 0;
+    for (i = 1; i < chunks->count; ++i)
+    {
+        gap.offset = chunks->chunks[i - 1].offset + chunks->chunks[i - 1].size;
+        gap.size   = chunks->chunks[i].offset - gap.offset;
+
+        if ((index->count == CF_CHUNK_GAP_INDEX_SIZE) && (gap.size >= index->heap[index->count - 1].size))
+        {
+            left_out = true;
+            continue;
+        }
+
+        /* when the index is full the largest entry is replaced */
+        if (index->count < CF_CHUNK_GAP_INDEX_SIZE)
+        {
+            ++index->count;
+        }
+        else
+        {
+            left_out = true;
+        }
+
+        for (j = index->count - 1; (j > 0) && (index->heap[j - 1].size > gap.size); --j)
+        {
+            index->heap[j] = index->heap[j - 1];
+        }
+        index->heap[j] = gap;
+    }
+
+    index->limit = left_out ? index->heap[index->count - 1].size : ~(CF_ChunkOffset_t)0;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Adds the gap before chunk i to the gap index, if the index is built and
+ * the gap is one it must hold. If there is no room, the index is left to
+ * be built again when next needed.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_Chunks_GapIndexAdd(CF_ChunkList_t *chunks, CF_ChunkIdx_t i)
+{
+    CF_ChunkGapIndex_t *index = &chunks->gaps;
+    CF_Chunk_t          gap;
+
+    if (index->limit && (i > 0) && (i < chunks->count))
+    {
+        /* a chunk that overlaps the one before it is about to be combined with it, so has no gap */
+        gap.offset = chunks->chunks[i - 1].offset + chunks->chunks[i - 1].size;
+        if ((chunks->chunks[i].offset > gap.offset) && ((chunks->chunks[i].offset - gap.offset) < index->limit))
+        {
+            gap.size = chunks->chunks[i].offset - gap.offset;
+            if (index->count < CF_CHUNK_GAP_INDEX_SIZE)
+            {
+                index->heap[index->count] = gap;
+                CF_Chunks_GapIndexUp(index, index->count);
+                ++index->count;
+            }
+            else
+            {
+                index->limit = 0;
+            }
+        }
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Returns the index of the chunk after the given gap, or 0 if the gap is
+ * no longer between two chunks of the list.
+ *
+ *-----------------------------------------------------------------*/
+static CF_ChunkIdx_t CF_Chunks_FindGap(const CF_ChunkList_t *chunks, const CF_Chunk_t *gap)
+{
+    const CF_Chunk_t next = {gap->offset + gap->size, 0};
+    CF_ChunkIdx_t    i    = CF_Chunks_FindInsertPosition(chunks, &next);
+
+    if ((i == 0) || (i >= chunks->count) || (chunks->chunks[i].offset != next.offset) ||
+        ((chunks->chunks[i - 1].offset + chunks->chunks[i - 1].size) != gap->offset))
+    {
+        i = 0;
+    }
+
+    return i;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Records a gap merged in to make room as pending. There must be room.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_Chunks_AddPending(CF_ChunkList_t *chunks, const CF_Chunk_t *gap)
+{
+    CF_ChunkPending_t *pending = &chunks->pending;
+    CF_ChunkIdx_t      p;
+
+    CF_Assert(pending->count < CF_CHUNK_PENDING_MAX);
+
+    for (p = pending->count; (p > 0) && (pending->holes[p - 1].offset > gap->offset); --p)
+    {
+        pending->holes[p] = pending->holes[p - 1];
+    }
+    pending->holes[p] = *gap;
+    ++pending->count;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Takes [offset, end) out of the pending gaps. A gap left in two pieces
+ * stays whole if there is no room for the second, which only means part
+ * of it is requested again.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_Chunks_ClearPending(CF_ChunkList_t *chunks, CF_ChunkOffset_t offset, CF_ChunkOffset_t end)
+{
+    CF_ChunkPending_t *pending = &chunks->pending;
+    CF_Chunk_t *       hole;
+    CF_ChunkOffset_t   hole_end;
+    CF_ChunkIdx_t      p = 0;
+
+    while ((p < pending->count) && (pending->holes[p].offset < end))
+    {
+        hole     = &pending->holes[p];
+        hole_end = hole->offset + hole->size;
+
+        if (hole_end <= offset)
+        {
+            ++p;
+        }
+        else if ((offset <= hole->offset) && (hole_end <= end))
+        {
+            memmove(hole, hole + 1, sizeof(*hole) * (pending->count - 1 - p));
+            --pending->count;
+        }
+        else if (offset <= hole->offset)
+        {
+            hole->offset = end;
+            hole->size   = hole_end - end;
+            ++p;
+        }
+        else if ((hole_end <= end) || (pending->count < CF_CHUNK_PENDING_MAX))
+        {
+            hole->size = offset - hole->offset;
+            if (hole_end > end)
+            {
+                memmove(hole + 2, hole + 1, sizeof(*hole) * (pending->count - 1 - p));
+                hole[1].offset = end;
+                hole[1].size   = hole_end - end;
+                ++pending->count;
+                ++p;
+            }
+            ++p;
+        }
+        else
+        {
+            ++p;
+        }
+    }
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -90,6 +650,13 @@ void CF_Chunks_InsertChunk(CF_ChunkList_t *chunks, CF_ChunkIdx_t index_before, c
     memcpy(&chunks->chunks[index_before], chunk, sizeof(*chunk));
 
     ++chunks->count;
+    if (chunks->count > chunks->hwm)
+    {
+        chunks->hwm = chunks->count;
+    }
+
+    CF_Chunks_GapIndexAdd(chunks, index_before);
+    CF_Chunks_GapIndexAdd(chunks, index_before + 1);
 }
 
 /*----------------------------------------------------------------
@@ -98,7 +665,7 @@ void CF_Chunks_InsertChunk(CF_ChunkList_t *chunks, CF_ChunkIdx_t index_before, c
  * See description in cf_chunk.h for argument/return detail
  *
  *-----------------------------------------------------------------*/
-CF_ChunkIdx_t CF_Chunks_FindInsertPosition(CF_ChunkList_t *chunks, const CF_Chunk_t *chunk)
+CF_ChunkIdx_t CF_Chunks_FindInsertPosition(const CF_ChunkList_t *chunks, const CF_Chunk_t *chunk)
 {
     CF_ChunkIdx_t first = 0;
     CF_ChunkIdx_t i;
@@ -154,6 +721,7 @@ int CF_Chunks_CombinePrevious(CF_ChunkList_t *chunks, CF_ChunkIdx_t i, const CF_
             {
                 /* Combine with previous chunk */
                 prev->size = chunk_end - prev->offset;
+                CF_Chunks_GapIndexAdd(chunks, i);
             }
             ret = 1;
         }
@@ -199,6 +767,8 @@ CFE_Status_t CF_Chunks_CombineNext(CF_ChunkList_t *chunks, CF_ChunkIdx_t i, cons
 
         /* Erase the rest of the combined chunks (if any) */
         CF_Chunks_EraseRange(chunks, i + 1, combined_i);
+        CF_Chunks_GapIndexAdd(chunks, i);
+        CF_Chunks_GapIndexAdd(chunks, i + 1);
         ret = 1;
     }
 
@@ -227,6 +797,209 @@ CF_ChunkIdx_t CF_Chunks_FindSmallestSize(const CF_ChunkList_t *chunks)
     return smallest;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_chunk.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CF_ChunkIdx_t CF_Chunks_FindClosestPair(CF_ChunkList_t *chunks)
+{
+    CF_ChunkGapIndex_t *index   = &chunks->gaps;
+    CF_ChunkIdx_t       closest = 0;
+
+    if (!index->limit || !index->count)
+    {
+        CF_Chunks_GapIndexBuild(chunks);
+    }
+
+    /* a freshly built index holds no stale entries, so this ends */
+    while (index->count && !closest)
+    {
+        closest = CF_Chunks_FindGap(chunks, &index->heap[0]);
+        if (!closest)
+        {
+            CF_Chunks_GapIndexPop(index);
+            if (!index->count)
+            {
+                CF_Chunks_GapIndexBuild(chunks);
+            }
+        }
+    }
+
+    return closest;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Makes room for a chunk in a full list without losing any range: the
+ * chunk is merged into whichever neighbor is closest, unless two existing
+ * chunks are closer still, in which case those two are merged and the
+ * chunk goes in on its own.  i is the insert position of the chunk, which
+ * combines with neither neighbor.  The space merged in is put in *gap.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_Chunks_MergeClosest(CF_ChunkList_t *chunks, CF_ChunkIdx_t i, const CF_Chunk_t *chunk, CF_Chunk_t *gap)
+{
+    const CF_ChunkOffset_t none      = ~(CF_ChunkOffset_t)0;
+    const CF_ChunkOffset_t chunk_end = chunk->offset + chunk->size;
+    const CF_ChunkIdx_t    pair_i    = CF_Chunks_FindClosestPair(chunks);
+    CF_ChunkOffset_t       prev_space;
+    CF_ChunkOffset_t       next_space;
+    CF_ChunkOffset_t       pair_space;
+    CF_Chunk_t *           prev;
+    CF_Chunk_t *           next;
+
+    prev       = (i > 0) ? &chunks->chunks[i - 1] : NULL;
+    next       = (i < chunks->count) ? &chunks->chunks[i] : NULL;
+    prev_space = prev ? (chunk->offset - (prev->offset + prev->size)) : none;
+    next_space = next ? (next->offset - chunk_end) : none;
+    pair_space = pair_i ? (chunks->chunks[pair_i].offset -
+                           (chunks->chunks[pair_i - 1].offset + chunks->chunks[pair_i - 1].size))
+                        : none;
+
+    if ((pair_space < prev_space) && (pair_space < next_space))
+    {
+        prev        = &chunks->chunks[pair_i - 1];
+        gap->offset = prev->offset + prev->size;
+        gap->size   = pair_space;
+        prev->size  = (chunks->chunks[pair_i].offset + chunks->chunks[pair_i].size) - prev->offset;
+        CF_Chunks_EraseChunk(chunks, pair_i);
+        CF_Chunks_InsertChunk(chunks, CF_Chunks_FindInsertPosition(chunks, chunk), chunk);
+    }
+    else if (prev_space <= next_space)
+    {
+        gap->offset = prev->offset + prev->size;
+        gap->size   = prev_space;
+        prev->size  = chunk_end - prev->offset;
+        CF_Chunks_GapIndexAdd(chunks, i);
+    }
+    else
+    {
+        gap->offset  = chunk_end;
+        gap->size    = next_space;
+        next->size   = (next->offset + next->size) - chunk->offset;
+        next->offset = chunk->offset;
+        CF_Chunks_GapIndexAdd(chunks, i);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Marks n blocks of the pool from first as held by a list, or as free.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_ChunkPool_Mark(CF_ChunkPool_t *pool, CF_ChunkIdx_t first, CF_ChunkIdx_t n, uint8 used)
+{
+    CF_ChunkIdx_t i;
+
+    for (i = first; i < (first + n); ++i)
+    {
+        CF_Assert(pool->used[i] != used);
+        pool->used[i] = used;
+    }
+
+    if (used)
+    {
+        pool->free_blocks -= n;
+    }
+    else
+    {
+        pool->free_blocks += n;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Returns the first block of the lowest run of n free blocks, or
+ * num_blocks if there is none.
+ *
+ *-----------------------------------------------------------------*/
+static CF_ChunkIdx_t CF_ChunkPool_FindRun(const CF_ChunkPool_t *pool, CF_ChunkIdx_t n)
+{
+    CF_ChunkIdx_t first = 0;
+    CF_ChunkIdx_t i     = 0;
+
+    if (pool->free_blocks >= n)
+    {
+        for (i = 0; (i < pool->num_blocks) && ((i - first) < n); ++i)
+        {
+            if (pool->used[i])
+            {
+                first = i + 1;
+            }
+        }
+    }
+
+    return ((i - first) >= n) ? first : pool->num_blocks;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Gives a list taken from a pool room for at least one more chunk, in the
+ * block after its own if that is free, or else in a longer run it moves
+ * to.  Returns false if the list is at its cap or the pool has no room.
+ *
+ *-----------------------------------------------------------------*/
+static bool CF_Chunks_Grow(CF_ChunkList_t *chunks)
+{
+    CF_ChunkPool_t *pool  = chunks->pool;
+    CF_ChunkIdx_t   first = 0;
+    CF_ChunkIdx_t   held;
+    CF_ChunkIdx_t   to;
+    bool            ret = false;
+
+    if ((pool != NULL) && (chunks->max_chunks < chunks->cap))
+    {
+        held = (chunks->max_chunks + pool->block_size - 1) / pool->block_size;
+        if (held)
+        {
+            first = (chunks->chunks - pool->mem) / pool->block_size;
+        }
+
+        if (held && ((first + held) < pool->num_blocks) && !pool->used[first + held])
+        {
+            CF_ChunkPool_Mark(pool, first + held, 1, 1);
+            ret = true;
+        }
+        else
+        {
+            /* the old run is still held, so the new one cannot overlap it */
+            to = CF_ChunkPool_FindRun(pool, held + 1);
+            if (to < pool->num_blocks)
+            {
+                CF_ChunkPool_Mark(pool, to, held + 1, 1);
+                if (held)
+                {
+                    memcpy(&pool->mem[to * pool->block_size], chunks->chunks, sizeof(*chunks->chunks) * chunks->count);
+                    CF_ChunkPool_Mark(pool, first, held, 0);
+                }
+                chunks->chunks = &pool->mem[to * pool->block_size];
+                ret            = true;
+            }
+        }
+
+        if (ret)
+        {
+            chunks->max_chunks = (held + 1) * pool->block_size;
+            if (chunks->max_chunks > chunks->cap)
+            {
+                chunks->max_chunks = chunks->cap;
+            }
+        }
+    }
+
+    return ret;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -237,6 +1010,7 @@ void CF_Chunks_Insert(CF_ChunkList_t *chunks, CF_ChunkIdx_t i, const CF_Chunk_t
 {
     CF_ChunkIdx_t smallest_i;
     CF_Chunk_t *  smallest_c;
+    CF_Chunk_t    gap;
     int           n = CF_Chunks_CombineNext(chunks, i, chunk);
     int           combined;
 
@@ -253,19 +1027,39 @@ void CF_Chunks_Insert(CF_ChunkList_t *chunks, CF_ChunkIdx_t i, const CF_Chunk_t
         combined = CF_Chunks_CombinePrevious(chunks, i, chunk);
         if (!combined)
         {
-            if (chunks->count < chunks->max_chunks)
+            if ((chunks->count < chunks->max_chunks) || CF_Chunks_Grow(chunks))
             {
                 CF_Chunks_InsertChunk(chunks, i, chunk);
             }
+            else if (!chunks->max_chunks)
+            {
+                /* the pool had nothing to give, so there is nowhere to keep it */
+                ++chunks->drops;
+            }
+            else if (chunks->cover_gaps || (chunks->pending.count < CF_CHUNK_PENDING_MAX))
+            {
+                CF_Chunks_MergeClosest(chunks, i, chunk, &gap);
+                if (!chunks->cover_gaps)
+                {
+                    CF_Chunks_AddPending(chunks, &gap);
+                }
+                ++chunks->merges;
+            }
             else
             {
                 smallest_i = CF_Chunks_FindSmallestSize(chunks);
                 smallest_c = &chunks->chunks[smallest_i];
                 if (smallest_c->size < chunk->size)
                 {
+                    /* what was pending within it is simply part of the gap it leaves */
+                    CF_Chunks_ClearPending(chunks, smallest_c->offset, smallest_c->offset + smallest_c->size);
                     CF_Chunks_EraseChunk(chunks, smallest_i);
+                    CF_Chunks_GapIndexAdd(chunks, smallest_i);
                     CF_Chunks_InsertChunk(chunks, CF_Chunks_FindInsertPosition(chunks, chunk), chunk);
                 }
+
+                /* either the smallest chunk or the new one is lost */
+                ++chunks->drops;
             }
         }
     }
@@ -279,15 +1073,57 @@ void CF_Chunks_Insert(CF_ChunkList_t *chunks, CF_ChunkIdx_t i, const CF_Chunk_t
  *-----------------------------------------------------------------*/
 void CF_ChunkListAdd(CF_ChunkList_t *chunks, CF_ChunkOffset_t offset, CF_ChunkSize_t size)
 {
-    const CF_Chunk_t    chunk = {offset, size};
-    const CF_ChunkIdx_t i     = CF_Chunks_FindInsertPosition(chunks, &chunk);
+    const CF_Chunk_t  chunk    = {offset, size};
+    CF_ChunkBitmap_t *bitmap   = &chunks->bitmap;
+    CF_ChunkIdx_t     num_bits = bitmap->num_words * CF_CHUNK_BITMAP_WORD_BITS;
+    CF_ChunkIdx_t     first    = 0;
+    CF_ChunkIdx_t     last     = 0;
 
-    /* PTFO: files won't be so big we need to gracefully handle overflow,
-     * and in that case the user should change everything in chunks
-     * to use 64-bit numbers */
+    /* offsets are 64 bits, so no file can get near enough to the end to overflow */
     CF_Assert((offset + size) >= offset);
 
-    CF_Chunks_Insert(chunks, i, &chunk);
+    CF_Chunks_ClearPending(chunks, offset, offset + size);
+
+    if (bitmap->words)
+    {
+        /* the granules the chunk covers from start to end, within the bitmap */
+        first = CF_Chunk_MIN((offset / bitmap->granule) + ((offset % bitmap->granule) != 0), num_bits);
+        last  = CF_Chunk_MIN((offset + size) / bitmap->granule, num_bits);
+    }
+
+    if (first < last)
+    {
+        /* only the ends that do not fill a granule go into the array */
+        CF_Chunks_SetBits(bitmap, first, last);
+        CF_Chunks_AddRange(chunks, offset, first * bitmap->granule);
+        CF_Chunks_AddRange(chunks, last * bitmap->granule, offset + size);
+    }
+    else
+    {
+        CF_Chunks_Insert(chunks, CF_Chunks_FindInsertPosition(chunks, &chunk), &chunk);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_chunk.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_ChunkList_AttachBitmap(CF_ChunkList_t *chunks, uint32 *words, uint32 num_words, uint32 *summary,
+                               CF_ChunkSize_t granule)
+{
+    CF_Assert(num_words > 0);
+    CF_Assert(granule > 0);
+
+    memset(words, 0, sizeof(*words) * num_words);
+    memset(summary, 0, sizeof(*summary) * CF_CHUNK_BITMAP_SUMMARY_WORDS(num_words));
+
+    chunks->bitmap.words     = words;
+    chunks->bitmap.num_words = num_words;
+    chunks->bitmap.full      = summary;
+    chunks->bitmap.any       = summary + (CF_CHUNK_BITMAP_SUMMARY_WORDS(num_words) / 2);
+    chunks->bitmap.granule   = granule;
 }
 
 /*----------------------------------------------------------------
@@ -327,6 +1163,59 @@ const CF_Chunk_t *CF_ChunkList_GetFirstChunk(const CF_ChunkList_t *chunks)
     return chunks->count ? &chunks->chunks[0] : NULL;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_chunk.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CF_ChunkSize_t CF_ChunkList_CoalesceFirst(const CF_ChunkList_t *chunks, CF_ChunkSize_t max_size)
+{
+    CF_ChunkOffset_t start = 0;
+    CF_ChunkOffset_t end   = 0;
+    CF_ChunkIdx_t    i;
+
+    if (chunks->count)
+    {
+        start = chunks->chunks[0].offset;
+        end   = start + chunks->chunks[0].size;
+
+        for (i = 1; (i < chunks->count) && ((end - start) < max_size); ++i)
+        {
+            if ((chunks->chunks[i].offset - start) >= max_size)
+            {
+                break;
+            }
+            end = chunks->chunks[i].offset + chunks->chunks[i].size;
+        }
+    }
+
+    return end - start;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_chunk.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_ChunkList_RemoveBelow(CF_ChunkList_t *chunks, CF_ChunkOffset_t offset)
+{
+    CF_ChunkIdx_t i = 0;
+
+    while ((i < chunks->count) && ((chunks->chunks[i].offset + chunks->chunks[i].size) <= offset))
+    {
+        ++i;
+    }
+    CF_Chunks_EraseRange(chunks, 0, i);
+
+    if (chunks->count && (chunks->chunks[0].offset < offset))
+    {
+        chunks->chunks[0].size -= offset - chunks->chunks[0].offset;
+        chunks->chunks[0].offset = offset;
+    }
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -338,9 +1227,50 @@ void CF_ChunkListInit(CF_ChunkList_t *chunks, CF_ChunkIdx_t max_chunks, CF_Chunk
     CF_Assert(max_chunks > 0);
     chunks->max_chunks = max_chunks;
     chunks->chunks     = chunks_mem;
+    chunks->cover_gaps = false;
+    chunks->pool       = NULL;
+    chunks->cap        = max_chunks;
+    CF_ChunkListReset(chunks);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_chunk.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_ChunkListInitPool(CF_ChunkList_t *chunks, CF_ChunkPool_t *pool, CF_ChunkIdx_t cap)
+{
+    CF_Assert(cap > 0);
+    chunks->max_chunks = 0;
+    chunks->chunks     = NULL;
+    chunks->cover_gaps = false;
+    chunks->pool       = pool;
+    chunks->cap        = cap;
     CF_ChunkListReset(chunks);
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_chunk.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_ChunkPool_Init(CF_ChunkPool_t *pool, CF_Chunk_t *mem, uint8 *used, CF_ChunkIdx_t num_blocks,
+                       CF_ChunkIdx_t block_size)
+{
+    CF_Assert(num_blocks > 0);
+    CF_Assert(block_size > 0);
+
+    memset(used, 0, num_blocks);
+
+    pool->mem         = mem;
+    pool->used        = used;
+    pool->num_blocks  = num_blocks;
+    pool->block_size  = block_size;
+    pool->free_blocks = num_blocks;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -349,8 +1279,32 @@ void CF_ChunkListInit(CF_ChunkList_t *chunks, CF_ChunkIdx_t max_chunks, CF_Chunk
  *-----------------------------------------------------------------*/
 void CF_ChunkListReset(CF_ChunkList_t *chunks)
 {
-    chunks->count = 0;
-    memset(chunks->chunks, 0, sizeof(*chunks->chunks) * chunks->max_chunks);
+    CF_ChunkPool_t *pool = chunks->pool;
+
+    chunks->count         = 0;
+    chunks->hwm           = 0;
+    chunks->merges        = 0;
+    chunks->drops         = 0;
+    chunks->gaps.count    = 0;
+    chunks->gaps.limit    = 0;
+    chunks->pending.count = 0;
+
+    if (pool != NULL)
+    {
+        /* the array goes back to the pool, and grows again from nothing */
+        if (chunks->max_chunks)
+        {
+            CF_ChunkPool_Mark(pool, (chunks->chunks - pool->mem) / pool->block_size,
+                              (chunks->max_chunks + pool->block_size - 1) / pool->block_size, 0);
+        }
+        chunks->chunks     = NULL;
+        chunks->max_chunks = 0;
+    }
+    else
+    {
+        memset(chunks->chunks, 0, sizeof(*chunks->chunks) * chunks->max_chunks);
+    }
+    memset(&chunks->bitmap, 0, sizeof(chunks->bitmap));
 }
 
 /*----------------------------------------------------------------
@@ -362,63 +1316,43 @@ void CF_ChunkListReset(CF_ChunkList_t *chunks)
 uint32 CF_ChunkList_ComputeGaps(const CF_ChunkList_t *chunks, CF_ChunkIdx_t max_gaps, CF_ChunkSize_t total,
                                 CF_ChunkOffset_t start, CF_ChunkList_ComputeGapFn_t compute_gap_fn, void *opaque)
 {
-    uint32           ret = 0;
-    CF_ChunkIdx_t    i   = 0;
-    CF_ChunkOffset_t next_off;
-    CF_ChunkOffset_t gap_start;
-    CF_Chunk_t       chunk;
+    uint32         ret   = 0;
+    CF_ChunkSize_t bytes = 0;
 
     CF_Assert(total); /* does it make sense to have a 0 byte file? */
     CF_Assert(start < total);
 
-    /* simple case: there is no chunk data, which means there is a single gap of the entire size */
-    if (!chunks->count)
+    if (chunks->bitmap.words)
     {
-        chunk.offset = 0;
-        chunk.size   = total;
-        if (compute_gap_fn)
-        {
-            compute_gap_fn(chunks, &chunk, opaque);
-        }
-        ret = 1;
+        ret = CF_Chunks_BitmapUncovered(chunks, start, total, max_gaps, compute_gap_fn, opaque, &bytes);
     }
     else
     {
-        /* Handle initial gap if needed */
-        if (start < chunks->chunks[0].offset)
-        {
-            chunk.offset = start;
-            chunk.size   = chunks->chunks[0].offset - start;
-            if (compute_gap_fn)
-            {
-                compute_gap_fn(chunks, &chunk, opaque);
-            }
-            ret = 1;
-        }
+        ret = CF_Chunks_ListUncovered(chunks, start, total, max_gaps, compute_gap_fn, opaque, &bytes);
+    }
 
-        while ((ret < max_gaps) && (i < chunks->count))
-        {
-            next_off  = (i == (chunks->count - 1)) ? total : chunks->chunks[i + 1].offset;
-            gap_start = (chunks->chunks[i].offset + chunks->chunks[i].size);
+    return ret;
+}
 
-            chunk.offset = (gap_start > start) ? gap_start : start;
-            chunk.size   = (next_off - chunk.offset);
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_chunk.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CF_ChunkSize_t CF_ChunkList_ComputeUncovered(const CF_ChunkList_t *chunks, CF_ChunkOffset_t offset,
+                                             CF_ChunkSize_t size, CF_ChunkList_ComputeGapFn_t compute_gap_fn,
+                                             void *opaque)
+{
+    CF_ChunkSize_t ret = 0;
 
-            if (gap_start >= total)
-            {
-                break;
-            }
-            else if (start < next_off)
-            {
-                /* Only report if gap finishes after start */
-                if (compute_gap_fn)
-                {
-                    compute_gap_fn(chunks, &chunk, opaque);
-                }
-                ++ret;
-            }
-            ++i;
-        }
+    if (chunks->bitmap.words)
+    {
+        CF_Chunks_BitmapUncovered(chunks, offset, offset + size, UINT32_MAX, compute_gap_fn, opaque, &ret);
+    }
+    else
+    {
+        CF_Chunks_ListUncovered(chunks, offset, offset + size, UINT32_MAX, compute_gap_fn, opaque, &ret);
     }
 
     return ret;
@@ -29,8 +29,8 @@
 #include "cfe.h"
 
 typedef uint32 CF_ChunkIdx_t;
-typedef uint32 CF_ChunkOffset_t;
-typedef uint32 CF_ChunkSize_t;
+typedef uint64 CF_ChunkOffset_t;
+typedef uint64 CF_ChunkSize_t;
 
 /**
  * @brief Pairs an offset with a size to identify a specific piece of a file
@@ -41,16 +41,123 @@ typedef struct CF_Chunk
     CF_ChunkSize_t   size;   /**< \brief The size of the chunk */
 } CF_Chunk_t;
 
+/**
+ * @brief Number of bits in each word of a chunk list bitmap
+ */
+#define CF_CHUNK_BITMAP_WORD_BITS (32)
+
+/**
+ * @brief Number of summary words needed for a bitmap of num_words words
+ *
+ * One bit per bitmap word in each of the two summaries, see CF_ChunkBitmap_t.
+ */
+#define CF_CHUNK_BITMAP_SUMMARY_WORDS(num_words) \
+    (2 * (((num_words) + CF_CHUNK_BITMAP_WORD_BITS - 1) / CF_CHUNK_BITMAP_WORD_BITS))
+
+/**
+ * @brief Optional bitmap of whole granules, see CF_ChunkList_AttachBitmap()
+ *
+ * Bit n is set once all of [n * granule, (n + 1) * granule) has been added.
+ * The two summaries hold one bit per word of the bitmap, so a search skips
+ * a whole summary word, 32 bitmap words, of runs it is not looking for.
+ */
+typedef struct CF_ChunkBitmap
+{
+    uint32 *       words;     /**< \brief bit storage, NULL if no bitmap is attached */
+    uint32         num_words; /**< \brief number of words in use */
+    uint32 *       full;      /**< \brief bit w set when words[w] is all ones */
+    uint32 *       any;       /**< \brief bit w set when words[w] is not all zeros */
+    CF_ChunkSize_t granule;   /**< \brief number of bytes tracked by each bit */
+} CF_ChunkBitmap_t;
+
+/**
+ * @brief Number of gaps kept in the closest gap index of a chunk list
+ */
+#define CF_CHUNK_GAP_INDEX_SIZE (8)
+
+/**
+ * @brief Number of merged-in gaps a chunk list can hold as pending
+ */
+#define CF_CHUNK_PENDING_MAX (8)
+
+/**
+ * @brief The smallest gaps between the chunks of a list that has filled up
+ *
+ * A min-heap by size of up to CF_CHUNK_GAP_INDEX_SIZE gaps, each given as
+ * the range between two neighboring chunks. It is built from the list the
+ * first time a full list needs its closest pair, and kept up as chunks
+ * change after that. A gap that changes leaves a stale entry, skipped when
+ * it reaches the top. Every gap left out is at least limit in size, so the
+ * top entry still in the list is always the smallest gap. The index is
+ * built again when it runs out of entries or of room.
+ */
+typedef struct CF_ChunkGapIndex
+{
+    CF_Chunk_t       heap[CF_CHUNK_GAP_INDEX_SIZE]; /**< \brief the gaps, as a min-heap by size */
+    CF_ChunkIdx_t    count;                         /**< \brief number of entries in the heap */
+    CF_ChunkOffset_t limit;                         /**< \brief gaps left out are this big or bigger, 0 if not built */
+} CF_ChunkGapIndex_t;
+
+/**
+ * @brief Gaps between chunks that were merged in to make room, see CF_ChunkList_t
+ *
+ * Each lies within one chunk of the list, and they are ordered by offset.
+ */
+typedef struct CF_ChunkPending
+{
+    CF_Chunk_t    holes[CF_CHUNK_PENDING_MAX]; /**< \brief the gaps, lowest offset first */
+    CF_ChunkIdx_t count;                       /**< \brief number of entries in holes */
+} CF_ChunkPending_t;
+
+/**
+ * @brief Blocks of chunks shared by the lists that grow on demand
+ *
+ * Each list takes a contiguous run of blocks, and moves to a longer run
+ * when it needs another block that is not free right after its own.
+ */
+typedef struct CF_ChunkPool
+{
+    CF_Chunk_t *  mem;         /**< \brief block storage, num_blocks * block_size chunks */
+    uint8 *       used;        /**< \brief nonzero for each block held by a list */
+    CF_ChunkIdx_t num_blocks;  /**< \brief number of blocks in the pool */
+    CF_ChunkIdx_t block_size;  /**< \brief number of chunks in each block */
+    CF_ChunkIdx_t free_blocks; /**< \brief number of blocks not held by any list */
+} CF_ChunkPool_t;
+
 /**
  * @brief A list of CF_Chunk_t pairs
  *
  * This list is ordered by chunk offset, from lowest to highest
+ *
+ * When the array is full and a chunk that combines with none is added,
+ * the two closest chunks, one of which may be the new one, are merged into
+ * one to make room, taking in the space between them. Nothing in any chunk
+ * is lost. What happens to the space taken in depends on cover_gaps:
+ *  - If set, it is covered from then on. This suits a list of ranges that
+ *    must all be acted on, like requested retransmissions.
+ *  - If not, it is kept as pending, and is still reported as a gap and as
+ *    uncovered until it is added, so this suits a list of ranges already
+ *    received. Once CF_CHUNK_PENDING_MAX gaps are pending, the smallest
+ *    chunk, which may be the new one, is dropped instead, and so becomes a
+ *    gap that is requested again.
+ *
+ * A list given a pool is only full once it has cap chunks, or the pool
+ * has no run of blocks long enough to grow into.
  */
 typedef struct CF_ChunkList
 {
-    CF_ChunkIdx_t count;      /**< \brief number of chunks currently in the array */
-    CF_ChunkIdx_t max_chunks; /**< \brief maximum number of chunks allowed in the list (allocation size) */
-    CF_Chunk_t *  chunks;     /**< \brief chunk list array */
+    CF_ChunkIdx_t      count;      /**< \brief number of chunks currently in the array */
+    CF_ChunkIdx_t      max_chunks; /**< \brief number of chunks the array has room for (allocation size) */
+    CF_ChunkIdx_t      hwm;        /**< \brief highest count reached since the list was last reset */
+    CF_Chunk_t *       chunks;     /**< \brief chunk list array */
+    CF_ChunkBitmap_t   bitmap;     /**< \brief whole granules added, when a bitmap is attached */
+    bool               cover_gaps; /**< \brief the space merged in to make room counts as covered */
+    uint32             merges;     /**< \brief chunks merged to make room since the list was last reset */
+    uint32             drops;      /**< \brief chunks dropped to make room since the list was last reset */
+    CF_ChunkPool_t *   pool;       /**< \brief pool the array is taken from, NULL for a fixed array */
+    CF_ChunkIdx_t      cap;        /**< \brief most chunks the array may grow to, when taken from a pool */
+    CF_ChunkGapIndex_t gaps;       /**< \brief smallest gaps between chunks, once the array has filled up */
+    CF_ChunkPending_t  pending;    /**< \brief gaps merged in to make room but not added since */
 } CF_ChunkList_t;
 
 /**
@@ -81,8 +188,31 @@ static inline CF_ChunkOffset_t CF_Chunk_MAX(CF_ChunkOffset_t a, CF_ChunkOffset_t
     }
 }
 
+/**
+ * @brief Selects the smaller of the two passed-in offsets
+ *
+ * @param a First chunk offset
+ * @param b Second chunk offset
+ * @return the smaller CF_ChunkOffset_t value
+ */
+static inline CF_ChunkOffset_t CF_Chunk_MIN(CF_ChunkOffset_t a, CF_ChunkOffset_t b)
+{
+    if (a < b)
+    {
+        return a;
+    }
+    else
+    {
+        return b;
+    }
+}
+
 /************************************************************************/
 /** @brief Initialize a CF_ChunkList_t structure.
+ *
+ * @par Description
+ *       The space merged in when the list is full is kept as pending,
+ *       until cover_gaps is set.
  *
  * @par Assumptions, External Events, and Notes:
  *       chunks must not be NULL. chunks_mem must not be NULL.
@@ -93,8 +223,38 @@ static inline CF_ChunkOffset_t CF_Chunk_MAX(CF_ChunkOffset_t a, CF_ChunkOffset_t
  */
 void CF_ChunkListInit(CF_ChunkList_t *chunks, CF_ChunkIdx_t max_chunks, CF_Chunk_t *chunks_mem);
 
+/************************************************************************/
+/** @brief Attach a bitmap to track whole granules of a chunk list.
+ *
+ * @par Description
+ *       From then on, the whole granules of each added range are marked
+ *       in the bitmap, in constant time for a range of one granule, and
+ *       only the bytes of partly covered granules go into the chunk
+ *       array. So if each range fills a granule, as with file data from
+ *       a sender using fixed size PDUs, the array never fills up and
+ *       nothing is forgotten. Granules beyond the end of the bitmap are
+ *       tracked in the chunk array as before. Gaps are computed from the
+ *       union of the two.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       chunks must not be NULL. words and summary must not be NULL, and
+ *       must remain valid until the list is reset, which detaches the
+ *       bitmap. Ranges already in the list stay in the chunk array.
+ *
+ * @param chunks    Pointer to CF_ChunkList_t object
+ * @param words     Bitmap storage, cleared by this call
+ * @param num_words Number of words in the bitmap, must be at least 1
+ * @param summary   Run summary storage of CF_CHUNK_BITMAP_SUMMARY_WORDS(num_words) words, cleared by this call
+ * @param granule   Number of bytes tracked by each bit, must be at least 1
+ */
+void CF_ChunkList_AttachBitmap(CF_ChunkList_t *chunks, uint32 *words, uint32 num_words, uint32 *summary,
+                               CF_ChunkSize_t granule);
+
 /************************************************************************/
 /** @brief Public function to add a chunk.
+ *
+ * @par Description
+ *       Any pending gap the chunk overlaps is no longer pending there.
  *
  * @par Assumptions, External Events, and Notes:
  *       chunks must not be NULL.
@@ -105,12 +265,47 @@ void CF_ChunkListInit(CF_ChunkList_t *chunks, CF_ChunkIdx_t max_chunks, CF_Chunk
  */
 void CF_ChunkListAdd(CF_ChunkList_t *chunks, CF_ChunkOffset_t offset, CF_ChunkSize_t size);
 
+/************************************************************************/
+/** @brief Initialize a CF_ChunkList_t structure that grows from a pool.
+ *
+ * @par Description
+ *       The list starts with no chunk memory, takes blocks from the pool
+ *       as chunks are added, and gives them all back when reset.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       chunks must not be NULL. pool must not be NULL. cap must be greater
+ *       than 0.
+ *
+ * @param chunks       Pointer to CF_ChunkList_t object to initialize
+ * @param pool         Pool to take chunk memory from
+ * @param cap          Most chunks the list may hold
+ */
+void CF_ChunkListInitPool(CF_ChunkList_t *chunks, CF_ChunkPool_t *pool, CF_ChunkIdx_t cap);
+
+/************************************************************************/
+/** @brief Initialize a pool of chunk blocks.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       pool, mem and used must not be NULL. num_blocks and block_size must
+ *       be greater than 0.
+ *
+ * @param pool         Pointer to CF_ChunkPool_t object to initialize
+ * @param mem          Storage for num_blocks * block_size chunks
+ * @param used         Storage for num_blocks flags
+ * @param num_blocks   Number of blocks in the pool
+ * @param block_size   Number of chunks in each block
+ */
+void CF_ChunkPool_Init(CF_ChunkPool_t *pool, CF_Chunk_t *mem, uint8 *used, CF_ChunkIdx_t num_blocks,
+                       CF_ChunkIdx_t block_size);
+
 /************************************************************************/
 /** @brief Resets a chunks structure.
  *
  * All chunks are removed from the list, but the max_chunks and chunk memory
- * pointers are retained.  This returns the chunk list to the same state as
- * it was after the initial call to CF_ChunkListInit().
+ * pointers and cover_gaps are retained.  This returns the chunk list to
+ * the same state as it was after the initial call to CF_ChunkListInit(), so
+ * any bitmap is detached and the counters are cleared.  A list that grows
+ * from a pool gives its blocks back.
  *
  * @par Assumptions, External Events, and Notes:
  *       chunks must not be NULL.
@@ -156,20 +351,58 @@ void CF_ChunkList_RemoveFromFirst(CF_ChunkList_t *chunks, CF_ChunkSize_t size);
  */
 const CF_Chunk_t *CF_ChunkList_GetFirstChunk(const CF_ChunkList_t *chunks);
 
+/************************************************************************/
+/** @brief Get the size of the range that covers the first chunks together.
+ *
+ * @par Description
+ *       The range starts at the first chunk, and takes in each following
+ *       chunk that starts within max_size of it, until the range is at
+ *       least max_size. It may extend past max_size, to the end of the last
+ *       chunk taken in. Any space between those chunks is part of the
+ *       range.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       chunks must not be NULL.
+ *
+ * @param chunks   Pointer to CF_ChunkList_t object
+ * @param max_size Size beyond which no more chunks are taken in
+ *
+ * @returns Size of the range from the start of the first chunk
+ * @retval  0 if the list is empty
+ */
+CF_ChunkSize_t CF_ChunkList_CoalesceFirst(const CF_ChunkList_t *chunks, CF_ChunkSize_t max_size);
+
+/************************************************************************/
+/** @brief Remove everything before an offset from the list.
+ *
+ * @par Description
+ *       Chunks that end at or before the offset are removed, and a chunk
+ *       that spans it is trimmed to start there.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       chunks must not be NULL.
+ *
+ * @param chunks   Pointer to CF_ChunkList_t object
+ * @param offset   Offset where the list is to start
+ */
+void CF_ChunkList_RemoveBelow(CF_ChunkList_t *chunks, CF_ChunkOffset_t offset);
+
 /************************************************************************/
 /** @brief Compute gaps between chunks, and call a callback for each.
  *
  * @par Description
  *       This function walks over all chunks and computes the gaps between.
  *       It can exit early if the calculated gap start is larger than the
- *       desired total.
+ *       desired total. Only the gaps within [start, total) are reported,
+ *       clipped to that range. Pending gaps are reported along with the
+ *       others, in offset order.
  *
  * @par Assumptions, External Events, and Notes:
  *       chunks must not be NULL. compute_gap_fn is a valid function address.
  *
  * @param chunks         Pointer to CF_ChunkList_t object
  * @param max_gaps       Maximum number of gaps to compute
- * @param total          Size of the entire file
+ * @param total          Size of the entire file, or end offset for gap computation
  * @param start          Beginning offset for gap computation
  * @param compute_gap_fn Callback function to be invoked for each gap
  * @param opaque         Opaque pointer to pass through to callback function
@@ -179,6 +412,32 @@ const CF_Chunk_t *CF_ChunkList_GetFirstChunk(const CF_ChunkList_t *chunks);
 uint32 CF_ChunkList_ComputeGaps(const CF_ChunkList_t *chunks, CF_ChunkIdx_t max_gaps, CF_ChunkSize_t total,
                                 CF_ChunkOffset_t start, CF_ChunkList_ComputeGapFn_t compute_gap_fn, void *opaque);
 
+/************************************************************************/
+/** @brief Compute the parts of a range not yet covered by the chunks.
+ *
+ * @par Description
+ *       Calls the callback, in ascending order, for each part of the range
+ *       [offset, offset + size) that no chunk covers. Used before adding
+ *       the range to the list, this identifies the bytes that are new.
+ *       Only the chunks that overlap the range are visited. Pending gaps
+ *       are not covered.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       chunks must not be NULL. compute_gap_fn may be NULL if only the
+ *       count of uncovered bytes is needed.
+ *
+ * @param chunks         Pointer to CF_ChunkList_t object
+ * @param offset         Start of the range
+ * @param size           Size of the range
+ * @param compute_gap_fn Callback function to be invoked for each uncovered part
+ * @param opaque         Opaque pointer to pass through to callback function
+ *
+ * @returns The number of bytes in the range not covered by any chunk.
+ */
+CF_ChunkSize_t CF_ChunkList_ComputeUncovered(const CF_ChunkList_t *chunks, CF_ChunkOffset_t offset,
+                                             CF_ChunkSize_t size, CF_ChunkList_ComputeGapFn_t compute_gap_fn,
+                                             void *opaque);
+
 /************************************************************************/
 /** @brief Erase a range of chunks.
  *
@@ -244,7 +503,7 @@ void CF_Chunks_InsertChunk(CF_ChunkList_t *chunks, CF_ChunkIdx_t index_before, c
  * @returns an index to the first chunk that is greater than or equal to the requested's offset.
  *
  */
-CF_ChunkIdx_t CF_Chunks_FindInsertPosition(CF_ChunkList_t *chunks, const CF_Chunk_t *chunk);
+CF_ChunkIdx_t CF_Chunks_FindInsertPosition(const CF_ChunkList_t *chunks, const CF_Chunk_t *chunk);
 
 /************************************************************************/
 /** @brief Possibly combines the given chunk with the previous chunk.
@@ -294,12 +553,33 @@ CFE_Status_t CF_Chunks_CombineNext(CF_ChunkList_t *chunks, CF_ChunkIdx_t i, cons
  */
 CF_ChunkIdx_t CF_Chunks_FindSmallestSize(const CF_ChunkList_t *chunks);
 
+/************************************************************************/
+/** @brief Finds the two neighboring chunks with the least space between them.
+ *
+ * @par Description
+ *       The pair is taken from the gap index of the list, which this builds
+ *       on first use, and again whenever it has run out, so only that takes
+ *       a pass over the list. See CF_ChunkGapIndex_t.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       chunks must not be NULL.
+ *
+ * @param chunks       Pointer to CF_ChunkList_t object
+ *
+ * @returns The index of the second chunk of the closest pair.
+ * @retval  0 if the chunk list has fewer than two chunks
+ *
+ */
+CF_ChunkIdx_t CF_Chunks_FindClosestPair(CF_ChunkList_t *chunks);
+
 /************************************************************************/
 /** @brief Insert a chunk.
  *
  * @par Description
  *       Inserts the chunk at the specified location. May combine with
- *       an existing chunk if contiguous.
+ *       an existing chunk if contiguous.  If the list is full and cannot
+ *       grow, room is made as described for CF_ChunkList_t, and the merges
+ *       or drops counter is incremented.
  *
  * @par Assumptions, External Events, and Notes:
  *       chunks must not be NULL, chunk must not be NULL.
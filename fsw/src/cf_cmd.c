@@ -36,6 +36,7 @@
 
 #include "cf_cfdp.h"
 #include "cf_cmd.h"
+#include "cf_dump.h"
 
 #include <string.h>
 
@@ -337,7 +338,8 @@ CF_Transaction_t *CF_FindTransactionBySequenceNumberAllChannels(CF_TransactionSe
      * Even though these tuples are unique to a channel, they should be unique
      * across the entire system. Meaning, it isn't correct to have the same
      * EID re-using a TSN in the same system. So, in order to locate the transaction
-     * to suspend, we need to search across all channels for it. */
+     * to suspend, we need to search across all channels for it. Each channel keeps its
+     * own (eid, tsn) index, so this is one bucket lookup per channel. */
     for (i = 0; i < CF_NUM_CHANNELS; ++i)
     {
         ret = CF_FindTransactionBySequenceNumber(CF_AppData.engine.channels + i, ts, eid);
@@ -406,6 +408,8 @@ int32 CF_TsnChanAction(const CF_Transaction_Payload_t *data, const char *cmdstr,
  *-----------------------------------------------------------------*/
 void CF_DoSuspRes_Txn(CF_Transaction_t *txn, CF_ChanAction_SuspResArg_t *context)
 {
+    CF_TimerWheel_t *wheel;
+
     CF_Assert(txn);
     if (txn->flags.com.suspended == context->action)
     {
@@ -413,7 +417,23 @@ void CF_DoSuspRes_Txn(CF_Transaction_t *txn, CF_ChanAction_SuspResArg_t *context
     }
     else
     {
+        wheel                    = &CF_AppData.engine.channels[txn->chan_num].timer_wheel;
         txn->flags.com.suspended = context->action;
+
+        /* timers stand still while suspended, so a long suspension does not count against the peer */
+        if (txn->flags.com.suspended)
+        {
+            CF_Timer_Pause(wheel, &txn->ack_timer);
+            CF_Timer_Pause(wheel, &txn->inactivity_timer);
+        }
+        else
+        {
+            CF_Timer_Resume(wheel, &txn->ack_timer);
+            CF_Timer_Resume(wheel, &txn->inactivity_timer);
+
+            /* tick processing skips suspended transactions, so let it catch up on anything left pending */
+            CF_InsertTransactionTick(&CF_AppData.engine.channels[txn->chan_num], txn);
+        }
     }
 }
 
@@ -814,126 +834,27 @@ CFE_Status_t CF_WriteQueueCmd(const CF_WriteQueueCmd_t *msg)
 {
     const CF_WriteQueue_Payload_t *wq = &msg->Payload;
 
-    CF_Channel_t *chan    = &CF_AppData.engine.channels[wq->chan];
-    osal_id_t     fd      = OS_OBJECT_ID_UNDEFINED;
-    bool          success = true;
-    int32         ret;
-
     /* check the commands for validity */
     if (wq->chan >= CF_NUM_CHANNELS)
     {
         CFE_EVS_SendEvent(CF_CMD_WQ_CHAN_ERR_EID, CFE_EVS_EventType_ERROR, "CF: write queue invalid channel arg");
         ++CF_AppData.hk.Payload.counters.err;
-        success = false;
     }
     /* only invalid combination is up direction, pending queue */
-    else if ((wq->type == CF_Type_up) && (wq->queue == CF_Queue_pend))
+    else if (((wq->type == CF_Type_up) && (wq->queue == CF_Queue_pend)) || (wq->format >= CF_QueueFormat_num))
     {
         CFE_EVS_SendEvent(CF_CMD_WQ_ARGS_ERR_EID, CFE_EVS_EventType_ERROR,
                           "CF: write queue invalid command parameters");
         ++CF_AppData.hk.Payload.counters.err;
-        success = false;
-    }
-    else
-    {
-        /* PTFO: queues can be large. may want to split this work up across the state machine and take several wakeups
-         * to complete */
-        ret = CF_WrappedOpenCreate(&fd, wq->filename, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_WRITE_ONLY);
-        if (ret < 0)
-        {
-            CFE_EVS_SendEvent(CF_CMD_WQ_OPEN_ERR_EID, CFE_EVS_EventType_ERROR, "CF: write queue failed to open file %s",
-                              wq->filename);
-            ++CF_AppData.hk.Payload.counters.err;
-            success = false;
-        }
-    }
-
-    /* if type is type_up, or all types */
-    if (success && ((wq->type == CF_Type_all) || (wq->type == CF_Type_up)))
-    {
-        /* process uplink queue data */
-        if ((wq->queue == CF_Queue_all) || (wq->queue == CF_Queue_active))
-        {
-            ret = CF_WriteTxnQueueDataToFile(fd, chan, CF_QueueIdx_RX);
-            if (ret)
-            {
-                CFE_EVS_SendEvent(CF_CMD_WQ_WRITEQ_RX_ERR_EID, CFE_EVS_EventType_ERROR,
-                                  "CF: write queue failed to write CF_QueueIdx_RX data");
-                CF_WrappedClose(fd);
-                ++CF_AppData.hk.Payload.counters.err;
-                success = false;
-            }
-        }
-
-        if (success && ((wq->queue == CF_Queue_all) || (wq->queue == CF_Queue_history)))
-        {
-            ret = CF_WriteHistoryQueueDataToFile(fd, chan, CF_Direction_RX);
-            if (ret)
-            {
-                CFE_EVS_SendEvent(CF_CMD_WQ_WRITEHIST_RX_ERR_EID, CFE_EVS_EventType_ERROR,
-                                  "CF: write queue failed to write history RX data");
-                CF_WrappedClose(fd);
-                ++CF_AppData.hk.Payload.counters.err;
-                success = false;
-            }
-        }
     }
-
-    /* if type is type_down, or all types */
-    if (success && ((wq->type == CF_Type_all) || (wq->type == CF_Type_down)))
+    /* the file is written over the following wakeups, see CF_Dump_Cycle() */
+    else if (CF_Dump_Start(wq) != CFE_SUCCESS)
     {
-        /* process downlink queue data */
-        if ((wq->queue == CF_Queue_all) || (wq->queue == CF_Queue_active))
-        {
-            int              i;
-            static const int qs[2] = {CF_QueueIdx_TXA, CF_QueueIdx_TXW};
-            for (i = 0; i < 2; ++i)
-            {
-                ret = CF_WriteTxnQueueDataToFile(fd, chan, qs[i]);
-                if (ret)
-                {
-                    CFE_EVS_SendEvent(CF_CMD_WQ_WRITEQ_TX_ERR_EID, CFE_EVS_EventType_ERROR,
-                                      "CF: write queue failed to write q index %d", qs[i]);
-                    CF_WrappedClose(fd);
-                    ++CF_AppData.hk.Payload.counters.err;
-                    success = false;
-                    break;
-                }
-            }
-        }
-
-        if (success && ((wq->queue == CF_Queue_all) || (wq->queue == CF_Queue_pend)))
-        {
-            /* write pending queue */
-            ret = CF_WriteTxnQueueDataToFile(fd, chan, CF_QueueIdx_PEND);
-            if (ret)
-            {
-                CFE_EVS_SendEvent(CF_CMD_WQ_WRITEQ_PEND_ERR_EID, CFE_EVS_EventType_ERROR,
-                                  "CF: write queue failed to write pending queue");
-                CF_WrappedClose(fd);
-                ++CF_AppData.hk.Payload.counters.err;
-                success = false;
-            }
-        }
-
-        if (success && ((wq->queue == CF_Queue_all) || (wq->queue == CF_Queue_history)))
-        {
-            /* write history queue */
-            ret = CF_WriteHistoryQueueDataToFile(fd, chan, CF_Direction_TX);
-            if (ret)
-            {
-                CFE_EVS_SendEvent(CF_CMD_WQ_WRITEHIST_TX_ERR_EID, CFE_EVS_EventType_ERROR,
-                                  "CF: write queue failed to write CF_QueueIdx_TX data");
-                CF_WrappedClose(fd);
-                ++CF_AppData.hk.Payload.counters.err;
-                success = false;
-            }
-        }
+        ++CF_AppData.hk.Payload.counters.err;
     }
-
-    if (success)
+    else
     {
-        CFE_EVS_SendEvent(CF_CMD_WQ_INF_EID, CFE_EVS_EventType_INFORMATION, "CF: write queue successful");
+        CFE_EVS_SendEvent(CF_CMD_WQ_INF_EID, CFE_EVS_EventType_INFORMATION, "CF: write queue started");
         ++CF_AppData.hk.Payload.counters.cmd;
     }
 
@@ -946,7 +867,7 @@ CFE_Status_t CF_WriteQueueCmd(const CF_WriteQueueCmd_t *msg)
  * See description in cf_cmd.h for argument/return detail
  *
  *-----------------------------------------------------------------*/
-CF_ChanAction_Status_t CF_ValidateChunkSizeCmd(CF_ChunkSize_t val, uint8 chan_num /* ignored */)
+CF_ChanAction_Status_t CF_ValidateChunkSizeCmd(uint32 val, uint8 chan_num /* ignored */)
 {
     CF_ChanAction_Status_t ret = CF_ChanAction_Status_SUCCESS;
     if (val > sizeof(CF_CFDP_PduFileDataContent_t))
@@ -1041,6 +962,10 @@ void CF_GetSetParamCmd(bool is_set, CF_GetSet_ValueID_t param_id, uint32 value,
             item.size = sizeof(config->chan[chan_num].max_outgoing_messages_per_wakeup);
             item.fn   = CF_ValidateMaxOutgoingCmd;
             break;
+        case CF_GetSet_ValueID_chan_max_outgoing_bytes_per_second:
+            item.ptr  = &config->chan[chan_num].max_outgoing_bytes_per_second;
+            item.size = sizeof(config->chan[chan_num].max_outgoing_bytes_per_second);
+            break;
         default:
             break;
     };
@@ -1243,6 +1168,7 @@ CFE_Status_t CF_WakeupCmd(const CF_WakeupCmd_t *msg)
 {
     CFE_ES_PerfLogEntry(CF_PERF_ID_CYCLE_ENG);
     CF_CFDP_CycleEngine();
+    CF_Dump_Cycle();
     CFE_ES_PerfLogExit(CF_PERF_ID_CYCLE_ENG);
 
     return CFE_SUCCESS;
@@ -282,6 +282,10 @@ int32 CF_TsnChanAction(const CF_Transaction_Payload_t *data, const char *cmdstr,
 
 /************************************************************************/
 /** @brief Set the suspended bit in a transaction.
+ *
+ * @par Description
+ *       The transaction's timers are paused while it is suspended, and
+ *       carry on with the time they had left when it is resumed.
  *
  * @par Assumptions, External Events, and Notes:
  *       txn must not be NULL. context must not be NULL.
@@ -524,7 +528,7 @@ CFE_Status_t CF_WriteQueueCmd(const CF_WriteQueueCmd_t *msg);
  * @retval CF_ChanAction_Status_ERROR if failed (val is greater than max PDU)
  *
  */
-CF_ChanAction_Status_t CF_ValidateChunkSizeCmd(CF_ChunkSize_t val, uint8 chan_num);
+CF_ChanAction_Status_t CF_ValidateChunkSizeCmd(uint32 val, uint8 chan_num);
 
 /************************************************************************/
 /** @brief Checks if the value is within allowable range as outgoing packets per wakeup
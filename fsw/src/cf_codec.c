@@ -362,6 +362,35 @@ void CF_EncodeIntegerInSize(CF_EncoderState_t *state, uint64 value, uint8 encode
     }
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_codec.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_CFDP_EncodeFileSize(CF_EncoderState_t *state, CF_FileSize_t *plsize)
+{
+    CF_CFDP_uint32_t *pesize32;
+    CF_CFDP_uint64_t *pesize64;
+
+    if (state->codec_state.large_file)
+    {
+        pesize64 = CF_ENCODE_FIXED_CHUNK(state, CF_CFDP_uint64_t);
+        if (pesize64 != NULL)
+        {
+            CF_Codec_Store_uint64(pesize64, *plsize);
+        }
+    }
+    else
+    {
+        pesize32 = CF_ENCODE_FIXED_CHUNK(state, CF_CFDP_uint32_t);
+        if (pesize32 != NULL)
+        {
+            CF_Codec_Store_uint32(pesize32, *plsize);
+        }
+    }
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -380,6 +409,10 @@ void CF_CFDP_EncodeHeaderWithoutSize(CF_EncoderState_t *state, CF_Logical_PduHea
         FSV(peh->flags, CF_CFDP_PduHeader_FLAGS_DIR, plh->direction);
         FSV(peh->flags, CF_CFDP_PduHeader_FLAGS_TYPE, plh->pdu_type);
         FSV(peh->flags, CF_CFDP_PduHeader_FLAGS_MODE, plh->txm_mode);
+        FSV(peh->flags, CF_CFDP_PduHeader_FLAGS_LARGEFILE, plh->large_flag);
+
+        /* FSS fields in the rest of the PDU follow the large file flag */
+        state->codec_state.large_file = plh->large_flag;
 
         /* The eid+tsn lengths are encoded as -1 */
         CF_Codec_Store_uint8(&(peh->eid_tsn_lengths), 0);
@@ -398,6 +431,46 @@ void CF_CFDP_EncodeHeaderWithoutSize(CF_EncoderState_t *state, CF_Logical_PduHea
     }
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_codec.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_CFDP_EncodeHeaderTemplate(CF_EncodedHeader_t *tmpl, const CF_Logical_PduHeader_t *plh)
+{
+    CF_EncoderState_t state;
+
+    state.base = tmpl->bytes;
+    CF_CFDP_CodecReset(&state.codec_state, sizeof(tmpl->bytes));
+
+    tmpl->hdr = *plh;
+    memset(tmpl->bytes, 0, sizeof(tmpl->bytes));
+    CF_CFDP_EncodeHeaderWithoutSize(&state, &tmpl->hdr);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_codec.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_CFDP_EncodeHeaderFromTemplate(CF_EncoderState_t *state, CF_Logical_PduHeader_t *plh,
+                                      const CF_EncodedHeader_t *tmpl)
+{
+    uint8 *dest;
+
+    /* the template always starts a PDU, so its encoded length is also the position after it */
+    dest = CF_CFDP_DoEncodeChunk(state, tmpl->hdr.header_encoded_length);
+    if (dest != NULL)
+    {
+        memcpy(dest, tmpl->bytes, tmpl->hdr.header_encoded_length);
+        *plh = tmpl->hdr;
+
+        state->codec_state.large_file = plh->large_flag;
+    }
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -522,14 +595,8 @@ void CF_CFDP_EncodeTLV(CF_EncoderState_t *state, CF_Logical_Tlv_t *pltlv)
  *-----------------------------------------------------------------*/
 void CF_CFDP_EncodeSegmentRequest(CF_EncoderState_t *state, CF_Logical_SegmentRequest_t *plseg)
 {
-    CF_CFDP_SegmentRequest_t *sr; /* for encoding fixed sized fields */
-
-    sr = CF_ENCODE_FIXED_CHUNK(state, CF_CFDP_SegmentRequest_t);
-    if (sr != NULL)
-    {
-        CF_Codec_Store_uint32(&(sr->offset_start), plseg->offset_start);
-        CF_Codec_Store_uint32(&(sr->offset_end), plseg->offset_end);
-    }
+    CF_CFDP_EncodeFileSize(state, &plseg->offset_start);
+    CF_CFDP_EncodeFileSize(state, &plseg->offset_end);
 }
 
 /*----------------------------------------------------------------
@@ -580,7 +647,7 @@ void CF_CFDP_EncodeMd(CF_EncoderState_t *state, CF_Logical_PduMd_t *plmd)
         CF_Codec_Store_uint8(&(md->segmentation_control), 0);
         FSV(md->segmentation_control, CF_CFDP_PduMd_CLOSURE_REQUESTED, plmd->close_req);
         FSV(md->segmentation_control, CF_CFDP_PduMd_CHECKSUM_TYPE, plmd->checksum_type);
-        CF_Codec_Store_uint32(&(md->size), plmd->size);
+        CF_CFDP_EncodeFileSize(state, &plmd->size);
 
         /* Add in LV for src/dest */
         CF_CFDP_EncodeLV(state, &plmd->source_filename);
@@ -596,8 +663,7 @@ void CF_CFDP_EncodeMd(CF_EncoderState_t *state, CF_Logical_PduMd_t *plmd)
  *-----------------------------------------------------------------*/
 void CF_CFDP_EncodeFileDataHeader(CF_EncoderState_t *state, bool with_meta, CF_Logical_PduFileDataHeader_t *plfd)
 {
-    CF_CFDP_PduFileDataHeader_t *fd;
-    CF_CFDP_uint8_t *            optional_fields;
+    CF_CFDP_uint8_t *optional_fields;
 
     /* in this packet, the optional fields actually come first */
     if (with_meta)
@@ -618,11 +684,7 @@ void CF_CFDP_EncodeFileDataHeader(CF_EncoderState_t *state, bool with_meta, CF_L
         CF_CFDP_EncodeAllSegments(state, &plfd->segment_list);
     }
 
-    fd = CF_ENCODE_FIXED_CHUNK(state, CF_CFDP_PduFileDataHeader_t);
-    if (fd != NULL)
-    {
-        CF_Codec_Store_uint32(&(fd->offset), plfd->offset);
-    }
+    CF_CFDP_EncodeFileSize(state, &plfd->offset);
 }
 
 /*----------------------------------------------------------------
@@ -641,7 +703,7 @@ void CF_CFDP_EncodeEof(CF_EncoderState_t *state, CF_Logical_PduEof_t *pleof)
         CF_Codec_Store_uint8(&(eof->cc), 0);
         FSV(eof->cc, CF_CFDP_PduEof_FLAGS_CC, pleof->cc);
         CF_Codec_Store_uint32(&(eof->crc), pleof->crc);
-        CF_Codec_Store_uint32(&(eof->size), pleof->size);
+        CF_CFDP_EncodeFileSize(state, &pleof->size);
 
         CF_CFDP_EncodeAllTlv(state, &pleof->tlv_list);
     }
@@ -700,16 +762,10 @@ void CF_CFDP_EncodeAck(CF_EncoderState_t *state, CF_Logical_PduAck_t *plack)
  *-----------------------------------------------------------------*/
 void CF_CFDP_EncodeNak(CF_EncoderState_t *state, CF_Logical_PduNak_t *plnak)
 {
-    CF_CFDP_PduNak_t *nak; /* for encoding fixed sized fields */
+    CF_CFDP_EncodeFileSize(state, &plnak->scope_start);
+    CF_CFDP_EncodeFileSize(state, &plnak->scope_end);
 
-    nak = CF_ENCODE_FIXED_CHUNK(state, CF_CFDP_PduNak_t);
-    if (nak != NULL)
-    {
-        CF_Codec_Store_uint32(&(nak->scope_start), plnak->scope_start);
-        CF_Codec_Store_uint32(&(nak->scope_end), plnak->scope_end);
-
-        CF_CFDP_EncodeAllSegments(state, &plnak->segment_list);
-    }
+    CF_CFDP_EncodeAllSegments(state, &plnak->segment_list);
 }
 
 /*----------------------------------------------------------------
@@ -757,6 +813,37 @@ uint64 CF_DecodeIntegerInSize(CF_DecoderState_t *state, uint8 decode_size)
     return temp_val;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_codec.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_CFDP_DecodeFileSize(CF_DecoderState_t *state, CF_FileSize_t *plsize)
+{
+    const CF_CFDP_uint32_t *pesize32;
+    const CF_CFDP_uint64_t *pesize64;
+    uint32                  size32;
+
+    if (state->codec_state.large_file)
+    {
+        pesize64 = CF_DECODE_FIXED_CHUNK(state, CF_CFDP_uint64_t);
+        if (pesize64 != NULL)
+        {
+            CF_Codec_Load_uint64(plsize, pesize64);
+        }
+    }
+    else
+    {
+        pesize32 = CF_DECODE_FIXED_CHUNK(state, CF_CFDP_uint32_t);
+        if (pesize32 != NULL)
+        {
+            CF_Codec_Load_uint32(&size32, pesize32);
+            *plsize = size32;
+        }
+    }
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -779,6 +866,9 @@ CFE_Status_t CF_CFDP_DecodeHeader(CF_DecoderState_t *state, CF_Logical_PduHeader
         plh->crc_flag   = FGV(peh->flags, CF_CFDP_PduHeader_FLAGS_CRC);
         plh->large_flag = FGV(peh->flags, CF_CFDP_PduHeader_FLAGS_LARGEFILE);
 
+        /* FSS fields in the rest of the PDU follow the large file flag */
+        state->codec_state.large_file = plh->large_flag;
+
         /* The eid+tsn lengths are encoded as -1 */
         plh->eid_length     = FGV(peh->eid_tsn_lengths, CF_CFDP_PduHeader_LENGTHS_ENTITY) + 1;
         plh->txn_seq_length = FGV(peh->eid_tsn_lengths, CF_CFDP_PduHeader_LENGTHS_TRANSACTION_SEQUENCE) + 1;
@@ -880,14 +970,8 @@ void CF_CFDP_DecodeTLV(CF_DecoderState_t *state, CF_Logical_Tlv_t *pltlv)
  *-----------------------------------------------------------------*/
 void CF_CFDP_DecodeSegmentRequest(CF_DecoderState_t *state, CF_Logical_SegmentRequest_t *plseg)
 {
-    const CF_CFDP_SegmentRequest_t *sr; /* for decoding fixed sized fields */
-
-    sr = CF_DECODE_FIXED_CHUNK(state, CF_CFDP_SegmentRequest_t);
-    if (sr != NULL)
-    {
-        CF_Codec_Load_uint32(&(plseg->offset_start), &(sr->offset_start));
-        CF_Codec_Load_uint32(&(plseg->offset_end), &(sr->offset_end));
-    }
+    CF_CFDP_DecodeFileSize(state, &plseg->offset_start);
+    CF_CFDP_DecodeFileSize(state, &plseg->offset_end);
 }
 
 /*----------------------------------------------------------------
@@ -905,7 +989,7 @@ void CF_CFDP_DecodeMd(CF_DecoderState_t *state, CF_Logical_PduMd_t *plmd)
     {
         plmd->close_req     = FGV(md->segmentation_control, CF_CFDP_PduMd_CLOSURE_REQUESTED);
         plmd->checksum_type = FGV(md->segmentation_control, CF_CFDP_PduMd_CHECKSUM_TYPE);
-        CF_Codec_Load_uint32(&(plmd->size), &(md->size));
+        CF_CFDP_DecodeFileSize(state, &plmd->size);
 
         /* Add in LV for src/dest */
         CF_CFDP_DecodeLV(state, &plmd->source_filename);
@@ -921,9 +1005,8 @@ void CF_CFDP_DecodeMd(CF_DecoderState_t *state, CF_Logical_PduMd_t *plmd)
  *-----------------------------------------------------------------*/
 void CF_CFDP_DecodeFileDataHeader(CF_DecoderState_t *state, bool with_meta, CF_Logical_PduFileDataHeader_t *plfd)
 {
-    const CF_CFDP_PduFileDataHeader_t *fd;
-    const CF_CFDP_uint8_t *            optional_fields;
-    uint8                              field_count;
+    const CF_CFDP_uint8_t *optional_fields;
+    uint8                  field_count;
 
     plfd->continuation_state        = 0;
     plfd->segment_list.num_segments = 0;
@@ -965,11 +1048,9 @@ void CF_CFDP_DecodeFileDataHeader(CF_DecoderState_t *state, bool with_meta, CF_L
         }
     }
 
-    fd = CF_DECODE_FIXED_CHUNK(state, CF_CFDP_PduFileDataHeader_t);
-    if (fd != NULL)
+    CF_CFDP_DecodeFileSize(state, &plfd->offset);
+    if (CF_CODEC_IS_OK(state))
     {
-        CF_Codec_Load_uint32(&(plfd->offset), &(fd->offset));
-
         plfd->data_len = CF_CODEC_GET_REMAIN(state);
         plfd->data_ptr = CF_CFDP_DoDecodeChunk(state, plfd->data_len);
     }
@@ -1007,7 +1088,7 @@ void CF_CFDP_DecodeEof(CF_DecoderState_t *state, CF_Logical_PduEof_t *pleof)
     {
         pleof->cc = FGV(eof->cc, CF_CFDP_PduEof_FLAGS_CC);
         CF_Codec_Load_uint32(&(pleof->crc), &(eof->crc));
-        CF_Codec_Load_uint32(&(pleof->size), &(eof->size));
+        CF_CFDP_DecodeFileSize(state, &pleof->size);
 
         CF_CFDP_DecodeAllTlv(state, &pleof->tlv_list, CF_PDU_MAX_TLV);
     }
@@ -1063,14 +1144,10 @@ void CF_CFDP_DecodeAck(CF_DecoderState_t *state, CF_Logical_PduAck_t *plack)
  *-----------------------------------------------------------------*/
 void CF_CFDP_DecodeNak(CF_DecoderState_t *state, CF_Logical_PduNak_t *plnak)
 {
-    const CF_CFDP_PduNak_t *nak; /* for encoding fixed sized fields */
-
-    nak = CF_DECODE_FIXED_CHUNK(state, CF_CFDP_PduNak_t);
-    if (nak != NULL)
+    CF_CFDP_DecodeFileSize(state, &plnak->scope_start);
+    CF_CFDP_DecodeFileSize(state, &plnak->scope_end);
+    if (CF_CODEC_IS_OK(state))
     {
-        CF_Codec_Load_uint32(&(plnak->scope_start), &(nak->scope_start));
-        CF_Codec_Load_uint32(&(plnak->scope_end), &(nak->scope_end));
-
         CF_CFDP_DecodeAllSegments(state, &plnak->segment_list, CF_PDU_MAX_SEGMENTS);
     }
 }
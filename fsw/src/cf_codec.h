@@ -40,6 +40,7 @@ typedef struct CF_CodecState
     bool   is_valid;    /**< \brief whether decode is valid or not.  Set false on end of decode or error condition. */
     size_t next_offset; /**< \brief Offset of next byte to encode/decode, current position in PDU */
     size_t max_size;    /**< \brief Maximum number of bytes in the PDU */
+    bool   large_file;  /**< \brief File size/offset fields are 64 bits, per the PDU header large file flag */
 } CF_CodecState_t;
 
 /**
@@ -64,6 +65,19 @@ typedef struct CF_DecoderState
     const uint8 *   base;        /**< \brief Pointer to start of encoded PDU data */
 } CF_DecoderState_t;
 
+/**
+ * @brief A PDU base header encoded ahead of time
+ *
+ * Holds a logical PDU header along with its encoded form, so that a series of PDUs
+ * sharing the same header fields can be started by copying instead of re-encoding.
+ * The total length field is left as zero, it is always set by CF_CFDP_EncodeHeaderFinalSize().
+ */
+typedef struct CF_EncodedHeader
+{
+    CF_Logical_PduHeader_t hdr;                            /**< \brief Logical header that was encoded */
+    uint8                  bytes[CF_CFDP_MAX_HEADER_SIZE]; /**< \brief hdr.header_encoded_length bytes are valid */
+} CF_EncodedHeader_t;
+
 /*********************************************************************************
  *
  *   GENERAL UTILITY FUNCTIONS
@@ -145,6 +159,7 @@ static inline void CF_CFDP_CodecReset(CF_CodecState_t *state, size_t max_size)
     state->is_valid    = true;
     state->next_offset = 0;
     state->max_size    = max_size;
+    state->large_file  = false;
 }
 
 /************************************************************************/
@@ -346,6 +361,40 @@ void CF_EncodeIntegerInSize(CF_EncoderState_t *state, uint64 value, uint8 encode
  */
 uint64 CF_DecodeIntegerInSize(CF_DecoderState_t *state, uint8 decode_size);
 
+/************************************************************************/
+/**
+ * @brief Encodes a file size sensitive (FSS) value
+ *
+ * File sizes and offsets are encoded in 4 octets, or in 8 octets if the
+ * PDU header was encoded with the large file flag set.
+ *
+ * @sa CF_CFDP_DecodeFileSize() for the inverse operation
+ *
+ * If the encoder is in an error state, nothing is encoded, and the state of the
+ * encoder is not changed.
+ *
+ * @param state  Encoder state object
+ * @param plsize Pointer to file size or offset to encode
+ */
+void CF_CFDP_EncodeFileSize(CF_EncoderState_t *state, CF_FileSize_t *plsize);
+
+/************************************************************************/
+/**
+ * @brief Decodes a file size sensitive (FSS) value
+ *
+ * File sizes and offsets are decoded from 4 octets, or from 8 octets if the
+ * PDU header was decoded with the large file flag set.
+ *
+ * @sa CF_CFDP_EncodeFileSize() for the inverse operation
+ *
+ * If the decoder is in an error state, nothing is decoded, and the output
+ * is not changed.
+ *
+ * @param state  Decoder state object
+ * @param plsize Pointer to file size or offset output
+ */
+void CF_CFDP_DecodeFileSize(CF_DecoderState_t *state, CF_FileSize_t *plsize);
+
 /*********************************************************************************
  *
  *   ENCODE API
@@ -377,6 +426,37 @@ uint64 CF_DecodeIntegerInSize(CF_DecoderState_t *state, uint8 decode_size);
  */
 void CF_CFDP_EncodeHeaderWithoutSize(CF_EncoderState_t *state, CF_Logical_PduHeader_t *plh);
 
+/************************************************************************/
+/**
+ * @brief Encodes a CFDP PDU base header block into a template for later reuse
+ *
+ * The header is encoded exactly as CF_CFDP_EncodeHeaderWithoutSize() would encode it
+ * at the start of a PDU, and saved along with the logical header.
+ *
+ * @sa CF_CFDP_EncodeHeaderFromTemplate() for starting a PDU from the template
+ *
+ * @param tmpl   Template to fill in
+ * @param plh    Pointer to logical PDU header data
+ */
+void CF_CFDP_EncodeHeaderTemplate(CF_EncodedHeader_t *tmpl, const CF_Logical_PduHeader_t *plh);
+
+/************************************************************************/
+/**
+ * @brief Encodes a CFDP PDU base header block by copying a template
+ *
+ * Equivalent to setting the logical header to the one in the template and calling
+ * CF_CFDP_EncodeHeaderWithoutSize(), but without encoding any of the fields again.
+ *
+ * If the encoder is in an error state, nothing is encoded, and the state of the
+ * encoder is not changed.
+ *
+ * @param state  Encoder state object
+ * @param plh    Pointer to logical PDU header data, set from the template
+ * @param tmpl   Template previously filled by CF_CFDP_EncodeHeaderTemplate()
+ */
+void CF_CFDP_EncodeHeaderFromTemplate(CF_EncoderState_t *state, CF_Logical_PduHeader_t *plh,
+                                      const CF_EncodedHeader_t *tmpl);
+
 /************************************************************************/
 /**
  * @brief Updates an already-encoded PDU base header block with the final PDU size
@@ -33,16 +33,192 @@
 #include "cf_crc.h"
 #include <string.h>
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+#if defined(__SSE4_2__)
+#include <nmmintrin.h>
+#define CF_CRC_HAVE_CRC32C_INSN
+#endif
+
+#if defined(__ARM_FEATURE_CRC32) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#include <arm_acle.h>
+#define CF_CRC_HAVE_CRC32_INSN
+#define CF_CRC_HAVE_CRC32C_INSN
+#endif
+
+/**
+ * @brief Reflected polynomials of the CRC checksum types
+ */
+#define CF_CRC_POLY_CRC32  0xEDB88320
+#define CF_CRC_POLY_CRC32C 0x82F63B78
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static inline uint32 CF_CRC_LoadWord(const uint8 *data)
+{
+    return ((uint32)data[0] << 24) | ((uint32)data[1] << 16) | ((uint32)data[2] << 8) | (uint32)data[3];
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
  * See description in cf_crc.h for argument/return detail
  *
  *-----------------------------------------------------------------*/
-void CF_CRC_Start(CF_Crc_t *crc)
+uint32 CF_CRC_SumWords_Generic(const uint8 *data, size_t nwords)
 {
-    memset(crc, 0, sizeof(*crc));
+    /* sum each byte lane separately and weight them at the end. As everything is
+     * modulo 2^32 and the weights are powers of 2, the lane sums can wrap freely */
+    uint32 s0 = 0;
+    uint32 s1 = 0;
+    uint32 s2 = 0;
+    uint32 s3 = 0;
+
+    for (; nwords >= 4; nwords -= 4, data += 16)
+    {
+        s0 += (uint32)data[0] + data[4] + data[8] + data[12];
+        s1 += (uint32)data[1] + data[5] + data[9] + data[13];
+        s2 += (uint32)data[2] + data[6] + data[10] + data[14];
+        s3 += (uint32)data[3] + data[7] + data[11] + data[15];
+    }
+
+    for (; nwords > 0; --nwords, data += 4)
+    {
+        s0 += data[0];
+        s1 += data[1];
+        s2 += data[2];
+        s3 += data[3];
+    }
+
+    return (s0 << 24) + (s1 << 16) + (s2 << 8) + s3;
+}
+
+#if defined(__AVX2__)
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static uint32 CF_CRC_SumWords_AVX2(const uint8 *data, size_t nwords)
+{
+    const __m256i bswap = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12, 3, 2, 1, 0, 7, 6,
+                                           5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+    __m256i       acc   = _mm256_setzero_si256();
+    __m128i       half;
+    uint32        lanes[4];
+
+    for (; nwords >= 8; nwords -= 8, data += 32)
+    {
+        acc = _mm256_add_epi32(
+            acc, _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i *)(const void *)data), bswap));
+    }
+
+    half = _mm_add_epi32(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+    _mm_storeu_si128((__m128i *)(void *)lanes, half);
+
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3] + CF_CRC_SumWords_Generic(data, nwords);
+}
+#endif
+
+#if defined(__SSE2__)
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static uint32 CF_CRC_SumWords_SSE2(const uint8 *data, size_t nwords)
+{
+    /* SSE2 has no byte shuffle, so the even and odd byte lanes of each word are
+     * accumulated in separate 16-bit fields. Each field can take 256 additions
+     * of a byte before it could carry into its neighbor, so fold them out before then */
+    const __m128i mask = _mm_set1_epi32(0x00FF00FF);
+    __m128i       acc_even;
+    __m128i       acc_odd;
+    __m128i       v;
+    uint32        even[4];
+    uint32        odd[4];
+    uint32        s0 = 0;
+    uint32        s1 = 0;
+    uint32        s2 = 0;
+    uint32        s3 = 0;
+    size_t        blocks;
+    int           i;
+
+    while (nwords >= 4)
+    {
+        acc_even = _mm_setzero_si128();
+        acc_odd  = _mm_setzero_si128();
+
+        for (blocks = 0; (blocks < 256) && (nwords >= 4); ++blocks, nwords -= 4, data += 16)
+        {
+            v        = _mm_loadu_si128((const __m128i *)(const void *)data);
+            acc_even = _mm_add_epi32(acc_even, _mm_and_si128(v, mask));
+            acc_odd  = _mm_add_epi32(acc_odd, _mm_and_si128(_mm_srli_epi32(v, 8), mask));
+        }
+
+        _mm_storeu_si128((__m128i *)(void *)even, acc_even);
+        _mm_storeu_si128((__m128i *)(void *)odd, acc_odd);
+
+        /* in memory order, byte 0 of each word is the most significant */
+        for (i = 0; i < 4; ++i)
+        {
+            s0 += even[i] & 0xFFFF;
+            s2 += even[i] >> 16;
+            s1 += odd[i] & 0xFFFF;
+            s3 += odd[i] >> 16;
+        }
+    }
+
+    return (s0 << 24) + (s1 << 16) + (s2 << 8) + s3 + CF_CRC_SumWords_Generic(data, nwords);
+}
+#endif
+
+#if defined(__ARM_NEON)
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static uint32 CF_CRC_SumWords_NEON(const uint8 *data, size_t nwords)
+{
+    uint32x4_t acc = vdupq_n_u32(0);
+    uint32     lanes[4];
+
+    for (; nwords >= 4; nwords -= 4, data += 16)
+    {
+        acc = vaddq_u32(acc, vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(data))));
+    }
+
+    vst1q_u32(lanes, acc);
+
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3] + CF_CRC_SumWords_Generic(data, nwords);
 }
+#endif
+
+/**
+ * @brief Word summing kernels built for this target, best first
+ */
+static const CF_CRC_Kernel_t CF_CRC_KERNELS[] = {
+#if defined(__AVX2__)
+    {"avx2", CF_CRC_SumWords_AVX2},
+#endif
+#if defined(__SSE2__)
+    {"sse2", CF_CRC_SumWords_SSE2},
+#endif
+#if defined(__ARM_NEON)
+    {"neon", CF_CRC_SumWords_NEON},
+#endif
+    {"generic", CF_CRC_SumWords_Generic},
+};
 
 /*----------------------------------------------------------------
  *
@@ -50,14 +226,32 @@ void CF_CRC_Start(CF_Crc_t *crc)
  * See description in cf_crc.h for argument/return detail
  *
  *-----------------------------------------------------------------*/
-void CF_CRC_Digest(CF_Crc_t *crc, const uint8 *data, size_t len)
+const CF_CRC_Kernel_t *CF_CRC_GetKernel(uint32 idx)
+{
+    const CF_CRC_Kernel_t *ret = NULL;
+
+    if (idx < (sizeof(CF_CRC_KERNELS) / sizeof(CF_CRC_KERNELS[0])))
+    {
+        ret = &CF_CRC_KERNELS[idx];
+    }
+
+    return ret;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_CRC_Digest_Modular(CF_Crc_t *crc, const uint8 *data, size_t len)
 {
-    size_t i = 0;
+    size_t nwords;
 
-    for (; i < len; ++i)
+    /* finish off any word left partial by the last call */
+    for (; (len > 0) && (crc->index != 0); --len, ++data)
     {
         crc->working <<= 8;
-        crc->working |= data[i];
+        crc->working |= *data;
 
         ++crc->index;
 
@@ -67,15 +261,66 @@ void CF_CRC_Digest(CF_Crc_t *crc, const uint8 *data, size_t len)
             crc->index = 0;
         }
     }
+
+    /* now on a word boundary in the stream, so whole words can be summed directly */
+    nwords = len / 4;
+    if (nwords > 0)
+    {
+        crc->result += CF_CRC_KERNELS[0].sum_words(data, nwords);
+
+        /* the working register always holds the last 4 bytes digested */
+        crc->working = CF_CRC_LoadWord(&data[(nwords - 1) * 4]);
+
+        data += nwords * 4;
+        len -= nwords * 4;
+    }
+
+    /* leftover bytes start the next partial word */
+    for (; len > 0; --len, ++data)
+    {
+        crc->working <<= 8;
+        crc->working |= *data;
+        ++crc->index;
+    }
 }
 
 /*----------------------------------------------------------------
  *
- * Application-scope internal function
- * See description in cf_crc.h for argument/return detail
+ * Internal helper routine only, not part of API.
  *
  *-----------------------------------------------------------------*/
-void CF_CRC_Finalize(CF_Crc_t *crc)
+static void CF_CRC_DigestAt_Modular(CF_Crc_t *crc, uint64 offset, const uint8 *data, size_t len)
+{
+    size_t nwords;
+
+    /* bytes up to the next word boundary, most significant first */
+    for (; (len > 0) && ((offset & 3) != 0); --len, ++data, ++offset)
+    {
+        crc->result += (uint32)*data << (8 * (3 - (offset & 3)));
+    }
+
+    nwords = len / 4;
+    if (nwords > 0)
+    {
+        crc->result += CF_CRC_KERNELS[0].sum_words(data, nwords);
+
+        data += nwords * 4;
+        len -= nwords * 4;
+    }
+
+    /* a partial word at the end, the missing bytes are covered by a later call (or are padding) */
+    for (offset = 0; offset < len; ++offset)
+    {
+        crc->result += (uint32)data[offset] << (8 * (3 - offset));
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_CRC_Finalize_Modular(CF_Crc_t *crc)
 {
     if (crc->index)
     {
@@ -88,3 +333,310 @@ void CF_CRC_Finalize(CF_Crc_t *crc)
         crc->working = 0;
     }
 }
+
+/**
+ * @brief Slicing-by-8 lookup tables for the CRC checksum types, built by CF_CRC_Init()
+ */
+static uint32 CF_CRC_TABLE_CRC32[8][256];
+static uint32 CF_CRC_TABLE_CRC32C[8][256];
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_CRC_BuildTable(uint32 table[8][256], uint32 poly)
+{
+    uint32 c;
+    int    n;
+    int    k;
+
+    for (n = 0; n < 256; ++n)
+    {
+        c = n;
+        for (k = 0; k < 8; ++k)
+        {
+            c = (c & 1) ? ((c >> 1) ^ poly) : (c >> 1);
+        }
+        table[0][n] = c;
+    }
+
+    /* table k advances the register by k more zero bytes, so 8 bytes can be folded at once */
+    for (n = 0; n < 256; ++n)
+    {
+        c = table[0][n];
+        for (k = 1; k < 8; ++k)
+        {
+            c           = table[0][c & 0xFF] ^ (c >> 8);
+            table[k][n] = c;
+        }
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_crc.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_CRC_Init(void)
+{
+    CF_CRC_BuildTable(CF_CRC_TABLE_CRC32, CF_CRC_POLY_CRC32);
+    CF_CRC_BuildTable(CF_CRC_TABLE_CRC32C, CF_CRC_POLY_CRC32C);
+}
+
+#if !defined(CF_CRC_HAVE_CRC32_INSN) || !defined(CF_CRC_HAVE_CRC32C_INSN)
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static uint32 CF_CRC_Update_Slice8(const uint32 table[8][256], uint32 reg, const uint8 *data, size_t len)
+{
+    uint32 lo;
+    uint32 hi;
+
+    for (; len >= 8; len -= 8, data += 8)
+    {
+        /* the register is reflected, so the stream is consumed little-endian */
+        lo  = reg ^ ((uint32)data[0] | ((uint32)data[1] << 8) | ((uint32)data[2] << 16) | ((uint32)data[3] << 24));
+        hi  = (uint32)data[4] | ((uint32)data[5] << 8) | ((uint32)data[6] << 16) | ((uint32)data[7] << 24);
+        reg = table[7][lo & 0xFF] ^ table[6][(lo >> 8) & 0xFF] ^ table[5][(lo >> 16) & 0xFF] ^ table[4][lo >> 24] ^
+              table[3][hi & 0xFF] ^ table[2][(hi >> 8) & 0xFF] ^ table[1][(hi >> 16) & 0xFF] ^ table[0][hi >> 24];
+    }
+
+    for (; len > 0; --len, ++data)
+    {
+        reg = table[0][(reg ^ *data) & 0xFF] ^ (reg >> 8);
+    }
+
+    return reg;
+}
+#endif
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_CRC_Digest_CRC32(CF_Crc_t *crc, const uint8 *data, size_t len)
+{
+#if defined(CF_CRC_HAVE_CRC32_INSN)
+    uint64 v;
+
+    for (; len >= 8; len -= 8, data += 8)
+    {
+        memcpy(&v, data, sizeof(v));
+        crc->working = __crc32d(crc->working, v);
+    }
+
+    for (; len > 0; --len, ++data)
+    {
+        crc->working = __crc32b(crc->working, *data);
+    }
+#else
+    crc->working = CF_CRC_Update_Slice8(CF_CRC_TABLE_CRC32, crc->working, data, len);
+#endif
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_CRC_Digest_CRC32C(CF_Crc_t *crc, const uint8 *data, size_t len)
+{
+#if defined(CF_CRC_HAVE_CRC32C_INSN) && defined(__ARM_FEATURE_CRC32)
+    uint64 v;
+
+    for (; len >= 8; len -= 8, data += 8)
+    {
+        memcpy(&v, data, sizeof(v));
+        crc->working = __crc32cd(crc->working, v);
+    }
+
+    for (; len > 0; --len, ++data)
+    {
+        crc->working = __crc32cb(crc->working, *data);
+    }
+#elif defined(CF_CRC_HAVE_CRC32C_INSN) && defined(__x86_64__)
+    uint64 v;
+    uint64 reg = crc->working;
+
+    for (; len >= 8; len -= 8, data += 8)
+    {
+        memcpy(&v, data, sizeof(v));
+        reg = _mm_crc32_u64(reg, v);
+    }
+
+    crc->working = (uint32)reg;
+    for (; len > 0; --len, ++data)
+    {
+        crc->working = _mm_crc32_u8(crc->working, *data);
+    }
+#elif defined(CF_CRC_HAVE_CRC32C_INSN)
+    uint32 v;
+
+    for (; len >= 4; len -= 4, data += 4)
+    {
+        memcpy(&v, data, sizeof(v));
+        crc->working = _mm_crc32_u32(crc->working, v);
+    }
+
+    for (; len > 0; --len, ++data)
+    {
+        crc->working = _mm_crc32_u8(crc->working, *data);
+    }
+#else
+    crc->working = CF_CRC_Update_Slice8(CF_CRC_TABLE_CRC32C, crc->working, data, len);
+#endif
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_CRC_Finalize_Reflected(CF_Crc_t *crc)
+{
+    /* the register is left as is, so more data can still be digested after this */
+    crc->result = ~crc->working;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_CRC_Digest_Null(CF_Crc_t *crc, const uint8 *data, size_t len)
+{
+    /* the null checksum is always 0, nothing to do */
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_CRC_DigestAt_Null(CF_Crc_t *crc, uint64 offset, const uint8 *data, size_t len)
+{
+    /* the null checksum is always 0, nothing to do */
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_CRC_Finalize_Null(CF_Crc_t *crc)
+{
+    crc->result = 0;
+}
+
+/**
+ * @brief Digest engine for a checksum type
+ */
+typedef struct CF_CRC_Engine
+{
+    uint32 init; /**< \brief initial value of the working register */
+    void (*digest)(CF_Crc_t *crc, const uint8 *data, size_t len);
+    void (*digest_at)(CF_Crc_t *crc, uint64 offset, const uint8 *data, size_t len); /**< \brief NULL if in order only */
+    void (*finalize)(CF_Crc_t *crc);
+} CF_CRC_Engine_t;
+
+/**
+ * @brief Digest engines, indexed by checksum type. Unsupported types are left NULL.
+ */
+static const CF_CRC_Engine_t CF_CRC_ENGINES[CF_CRC_MAX_CHECKSUM_TYPES] = {
+    [CF_CFDP_ChecksumType_MODULAR] = {0, CF_CRC_Digest_Modular, CF_CRC_DigestAt_Modular, CF_CRC_Finalize_Modular},
+    [CF_CFDP_ChecksumType_CRC32C]  = {0xFFFFFFFF, CF_CRC_Digest_CRC32C, NULL, CF_CRC_Finalize_Reflected},
+    [CF_CFDP_ChecksumType_CRC32]   = {0xFFFFFFFF, CF_CRC_Digest_CRC32, NULL, CF_CRC_Finalize_Reflected},
+    [CF_CFDP_ChecksumType_NULL]    = {0, CF_CRC_Digest_Null, CF_CRC_DigestAt_Null, CF_CRC_Finalize_Null},
+};
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_crc.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CF_CRC_IsSupported(uint8 type)
+{
+    return (type < CF_CRC_MAX_CHECKSUM_TYPES) && (CF_CRC_ENGINES[type].digest != NULL);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_crc.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_CRC_Start(CF_Crc_t *crc, uint8 type)
+{
+    memset(crc, 0, sizeof(*crc));
+    crc->type = type;
+
+    if (CF_CRC_IsSupported(type))
+    {
+        crc->working = CF_CRC_ENGINES[type].init;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_crc.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_CRC_Digest(CF_Crc_t *crc, const uint8 *data, size_t len)
+{
+    if (CF_CRC_IsSupported(crc->type))
+    {
+        CF_CRC_ENGINES[crc->type].digest(crc, data, len);
+    }
+
+    crc->length += len;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_crc.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CF_CRC_DigestAt(CF_Crc_t *crc, uint64 offset, const uint8 *data, size_t len)
+{
+    bool ret = false;
+
+    if (!CF_CRC_IsSupported(crc->type))
+    {
+        /* nothing can be digested */
+    }
+    else if (CF_CRC_ENGINES[crc->type].digest_at != NULL)
+    {
+        CF_CRC_ENGINES[crc->type].digest_at(crc, offset, data, len);
+        ret = true;
+    }
+    else if (offset == crc->length)
+    {
+        /* the engine can only take data in stream order, and this is next */
+        CF_CRC_Digest(crc, data, len);
+        ret = true;
+    }
+
+    return ret;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_crc.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_CRC_Finalize(CF_Crc_t *crc)
+{
+    if (CF_CRC_IsSupported(crc->type))
+    {
+        CF_CRC_ENGINES[crc->type].finalize(crc);
+    }
+}
@@ -27,26 +27,77 @@
 #define CF_CRC_H
 
 #include "cfe.h"
+#include "cf_cfdp_pdu.h"
+
+/**
+ * @brief Number of checksum type values, the metadata PDU field is 4 bits
+ */
+#define CF_CRC_MAX_CHECKSUM_TYPES 16
 
 /**
  * @brief CRC state object
  */
 typedef struct CF_Crc
 {
-    uint32 working;
+    uint32 working; /**< \brief partial word of the modular checksum, or the CRC shift register */
     uint32 result;
+    uint64 length; /**< \brief number of bytes digested in stream order */
     uint8  index;
+    uint8  type; /**< \brief checksum type, see CF_CFDP_ChecksumType_t */
 } CF_Crc_t;
 
+/**
+ * @brief Function to sum big-endian 32-bit words, modulo 2^32
+ *
+ * @param data   Pointer to the first word, no alignment required
+ * @param nwords Number of whole 4-byte words to sum
+ *
+ * @returns Sum of all the words
+ */
+typedef uint32 (*CF_CRC_SumWordsFn_t)(const uint8 *data, size_t nwords);
+
+/**
+ * @brief Word summing kernel descriptor
+ *
+ * CF_CRC_Digest() uses the first kernel available for the target. The
+ * others are only exposed so they can be verified and benchmarked.
+ */
+typedef struct CF_CRC_Kernel
+{
+    const char         *name;      /**< \brief short name of the kernel, for reporting */
+    CF_CRC_SumWordsFn_t sum_words; /**< \brief the kernel itself */
+} CF_CRC_Kernel_t;
+
+/************************************************************************/
+/** @brief Build the CRC lookup tables.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       Must be called before any CRC type is digested.  The tables are
+ *       only read after this, so it is called once at app init, before
+ *       any channel worker task exists to digest concurrently.
+ */
+void CF_CRC_Init(void);
+
+/************************************************************************/
+/** @brief Check if a checksum type has a digest engine.
+ *
+ * @param type  Checksum type, see CF_CFDP_ChecksumType_t
+ *
+ * @returns true if the type can be digested, false otherwise
+ */
+bool CF_CRC_IsSupported(uint8 type);
+
 /************************************************************************/
 /** @brief Start a CRC streamable digest.
  *
  * @par Assumptions, External Events, and Notes:
- *       crc must not be NULL.
+ *       crc must not be NULL. If the type is not supported, see
+ *       CF_CRC_IsSupported(), the digest does nothing and the result is 0.
  *
- * @param crc  CRC object to operate on
+ * @param crc   CRC object to operate on
+ * @param type  Checksum type to compute, see CF_CFDP_ChecksumType_t
  */
-void CF_CRC_Start(CF_Crc_t *crc);
+void CF_CRC_Start(CF_Crc_t *crc, uint8 type);
 
 /************************************************************************/
 /** @brief Digest a chunk for CRC calculation.
@@ -54,6 +105,9 @@ void CF_CRC_Start(CF_Crc_t *crc);
  * @par Description
  *       Does the CRC calculation, and stores an index into the given
  *       4-byte word in case the input was not evenly divisible for 4.
+ *       Bytes completing a partial word from a previous call are handled
+ *       one at a time, then all whole words are summed by the word kernel,
+ *       and any remaining bytes are left in the working register.
  *
  * @par Assumptions, External Events, and Notes:
  *       crc must not be NULL.
@@ -65,12 +119,41 @@ void CF_CRC_Start(CF_Crc_t *crc);
  */
 void CF_CRC_Digest(CF_Crc_t *crc, const uint8 *data, size_t len);
 
+/************************************************************************/
+/** @brief Digest a chunk at a given offset in the stream.
+ *
+ * @par Description
+ *       The modular checksum is a sum of the stream's 4-byte words, so data
+ *       can be folded in at any stream offset, in any order, as long as each
+ *       byte is digested exactly once. Each byte is weighted by its position
+ *       within its word, so only the low 2 bits of the offset matter.
+ *       Bytes never digested count as zero, the same as the padding
+ *       CF_CRC_Finalize() applies to a partial last word. The null checksum
+ *       also takes any order. The CRC types can only take data in stream
+ *       order, so the data is only digested if it starts where the last
+ *       digest ended.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       crc must not be NULL. For the modular checksum, do not mix with
+ *       CF_CRC_Digest() on the same object, as this bypasses the working
+ *       register.
+ *
+ * @param crc    CRC object to operate on
+ * @param offset Offset of data[0] within the stream
+ * @param data   Pointer to data to digest
+ * @param len    Length of data to digest
+ *
+ * @returns true if the data was digested, false if it was not
+ */
+bool CF_CRC_DigestAt(CF_Crc_t *crc, uint64 offset, const uint8 *data, size_t len);
+
 /************************************************************************/
 /** @brief Finalize a CRC calculation.
  *
  * @par Description
- *       Checks the index and if it isn't 0, does the final calculations
- *       on the bytes in the shift register. After this call is made, the
+ *       For the modular checksum, checks the index and if it isn't 0, does
+ *       the final calculations on the bytes in the shift register. For the
+ *       CRC types, applies the final inversion. After this call is made, the
  *       result field of the structure holds the result.
  *
  * @par Assumptions, External Events, and Notes:
@@ -81,4 +164,31 @@ void CF_CRC_Digest(CF_Crc_t *crc, const uint8 *data, size_t len);
  */
 void CF_CRC_Finalize(CF_Crc_t *crc);
 
+/************************************************************************/
+/** @brief Get a word summing kernel built for this target.
+ *
+ * @par Description
+ *       Kernels are ordered best first. Index 0 is the one used by
+ *       CF_CRC_Digest(), and the portable kernel is always the last one.
+ *
+ * @param idx  Index of the kernel to get
+ *
+ * @returns Pointer to the kernel descriptor
+ * @retval  NULL if idx is past the last kernel
+ */
+const CF_CRC_Kernel_t *CF_CRC_GetKernel(uint32 idx);
+
+/************************************************************************/
+/** @brief Portable word summing kernel.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       data must not be NULL if nwords is not 0.
+ *
+ * @param data   Pointer to the first word, no alignment required
+ * @param nwords Number of whole 4-byte words to sum
+ *
+ * @returns Sum of all the big-endian words, modulo 2^32
+ */
+uint32 CF_CRC_SumWords_Generic(const uint8 *data, size_t nwords);
+
 #endif /* !CF_CRC_H */
@@ -0,0 +1,334 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,447-1, and identified as “CFS CFDP (CF)
+ * Application version 3.0.0”
+ *
+ * Copyright (c) 2019 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ *  The CF Application queue file writer logic file
+ *
+ *  The write queue command only starts the file.  The entries are formatted
+ *  into one large buffer a bounded number at a time each wakeup, and the
+ *  buffer is written out whenever it may not hold the next entry.
+ */
+
+#include <string.h>
+#include "cfe.h"
+#include "cf_verify.h"
+#include "cf_app.h"
+#include "cf_events.h"
+#include "cf_utils.h"
+#include "cf_dump.h"
+#include "cf_assert.h"
+
+/* the most one entry can add to the buffer, in either format */
+#define CF_DUMP_MAX_ENTRY_SIZE ((CF_FILENAME_MAX_LEN * 2) + 128)
+
+/**
+ * @brief The queue list behind each CF_DumpStep_t
+ */
+typedef struct CF_DumpStepInfo
+{
+    CF_QueueIdx_t  queue;   /**< \brief queue holding the entries */
+    CF_Direction_t dir;     /**< \brief history entries to write, CF_Direction_NUM for a transaction queue */
+    uint16         err_eid; /**< \brief event sent if writing the list fails */
+    const char *   name;    /**< \brief name of the list for the event */
+} CF_DumpStepInfo_t;
+
+static const CF_DumpStepInfo_t CF_DUMP_STEPS[CF_DumpStep_NUM] = {
+    {CF_QueueIdx_RX, CF_Direction_NUM, CF_CMD_WQ_WRITEQ_RX_ERR_EID, "active RX"},
+    {CF_QueueIdx_HIST, CF_Direction_RX, CF_CMD_WQ_WRITEHIST_RX_ERR_EID, "RX history"},
+    {CF_QueueIdx_TXA, CF_Direction_NUM, CF_CMD_WQ_WRITEQ_TX_ERR_EID, "active TX"},
+    {CF_QueueIdx_TXW, CF_Direction_NUM, CF_CMD_WQ_WRITEQ_TX_ERR_EID, "waiting TX"},
+    {CF_QueueIdx_PEND, CF_Direction_NUM, CF_CMD_WQ_WRITEQ_PEND_ERR_EID, "pending TX"},
+    {CF_QueueIdx_HIST, CF_Direction_TX, CF_CMD_WQ_WRITEHIST_TX_ERR_EID, "TX history"},
+};
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_dump.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CF_Dump_Start(const CF_WriteQueue_Payload_t *wq)
+{
+    CF_Dump_t *  dump = &CF_AppData.dump;
+    CFE_Status_t ret  = CFE_SUCCESS;
+    bool         up   = (wq->type == CF_Type_all) || (wq->type == CF_Type_up);
+    bool         down = (wq->type == CF_Type_all) || (wq->type == CF_Type_down);
+
+    if (dump->busy)
+    {
+        CFE_EVS_SendEvent(CF_CMD_WQ_BUSY_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "CF: write queue already writing a file, try again once it is done");
+        ret = CF_ERROR;
+    }
+    else if (CF_WrappedOpenCreate(&dump->fd, wq->filename, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE,
+                                  OS_WRITE_ONLY) < 0)
+    {
+        CFE_EVS_SendEvent(CF_CMD_WQ_OPEN_ERR_EID, CFE_EVS_EventType_ERROR, "CF: write queue failed to open file %s",
+                          wq->filename);
+        ret = CF_ERROR;
+    }
+    else
+    {
+        dump->busy      = true;
+        dump->chan_num  = wq->chan;
+        dump->format    = wq->format;
+        dump->num_steps = 0;
+        dump->step      = 0;
+        dump->started   = false;
+        dump->next      = NULL;
+        dump->entries   = 0;
+        dump->buf_len   = 0;
+
+        if (up && ((wq->queue == CF_Queue_all) || (wq->queue == CF_Queue_active)))
+        {
+            dump->steps[dump->num_steps++] = CF_DumpStep_RX_ACTIVE;
+        }
+        if (up && ((wq->queue == CF_Queue_all) || (wq->queue == CF_Queue_history)))
+        {
+            dump->steps[dump->num_steps++] = CF_DumpStep_RX_HISTORY;
+        }
+        if (down && ((wq->queue == CF_Queue_all) || (wq->queue == CF_Queue_active)))
+        {
+            dump->steps[dump->num_steps++] = CF_DumpStep_TX_ACTIVE;
+            dump->steps[dump->num_steps++] = CF_DumpStep_TX_WAIT;
+        }
+        if (down && ((wq->queue == CF_Queue_all) || (wq->queue == CF_Queue_pend)))
+        {
+            dump->steps[dump->num_steps++] = CF_DumpStep_TX_PEND;
+        }
+        if (down && ((wq->queue == CF_Queue_all) || (wq->queue == CF_Queue_history)))
+        {
+            dump->steps[dump->num_steps++] = CF_DumpStep_TX_HISTORY;
+        }
+    }
+
+    return ret;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Writes out whatever is in the buffer.
+ *
+ *-----------------------------------------------------------------*/
+static CFE_Status_t CF_Dump_Flush(CF_Dump_t *dump)
+{
+    CFE_Status_t ret = CFE_SUCCESS;
+    CFE_Status_t written;
+
+    if (dump->buf_len != 0)
+    {
+        written = CF_WrappedWrite(dump->fd, dump->buf, dump->buf_len);
+        if (written != dump->buf_len)
+        {
+            CFE_EVS_SendEvent(CF_CMD_WHIST_WRITE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "CF: writing queue file failed, expected %ld got %ld", (long)dump->buf_len,
+                              (long)written);
+            ret = CF_ERROR;
+        }
+
+        dump->buf_len = 0;
+    }
+
+    return ret;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Adds one entry to the buffer in the format of the file, writing out the
+ * buffer first if the entry may not fit.
+ *
+ *-----------------------------------------------------------------*/
+static CFE_Status_t CF_Dump_Entry(CF_Dump_t *dump, CF_QueueIdx_t queue, const CF_History_t *history,
+                                  const CF_TxnFilenames_t *fnames)
+{
+    static const char *CF_DSTR[] = {"RX", "TX"}; /* conversion of CF_Direction_t to string */
+
+    CF_QueueRecord_t rec;
+    CFE_Status_t     ret = CFE_SUCCESS;
+    int              len;
+
+    CF_Assert(history->dir < CF_Direction_NUM);
+
+    if ((sizeof(dump->buf) - dump->buf_len) < CF_DUMP_MAX_ENTRY_SIZE)
+    {
+        ret = CF_Dump_Flush(dump);
+    }
+
+    if (ret == CFE_SUCCESS)
+    {
+        if (dump->format == CF_QueueFormat_binary)
+        {
+            memset(&rec, 0, sizeof(rec));
+            rec.src_eid  = history->src_eid;
+            rec.seq_num  = history->seq_num;
+            rec.peer_eid = history->peer_eid;
+            rec.dir      = history->dir;
+            rec.txn_stat = history->txn_stat;
+            rec.queue    = queue;
+            strncpy(rec.src_filename, fnames->src_filename, sizeof(rec.src_filename) - 1);
+            strncpy(rec.dst_filename, fnames->dst_filename, sizeof(rec.dst_filename) - 1);
+
+            memcpy(&dump->buf[dump->buf_len], &rec, sizeof(rec));
+            dump->buf_len += sizeof(rec);
+        }
+        else
+        {
+            /* SAD: No need to check snprintf return; the buffer always has room for the longest entry */
+            len = snprintf((char *)&dump->buf[dump->buf_len], sizeof(dump->buf) - dump->buf_len,
+                           "SEQ (%lu, %lu)\tDIR: %s\tPEER %lu\tSTAT: %d\tSRC: %s\tDST: %s\n",
+                           (unsigned long)history->src_eid, (unsigned long)history->seq_num, CF_DSTR[history->dir],
+                           (unsigned long)history->peer_eid, (int)history->txn_stat, fnames->src_filename,
+                           fnames->dst_filename);
+            dump->buf_len += len;
+        }
+
+        ++dump->entries;
+    }
+
+    return ret;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Writes the entry for one node of the list being written, if it has one.
+ *
+ *-----------------------------------------------------------------*/
+static CFE_Status_t CF_Dump_Visit(CF_Dump_t *dump, const CF_DumpStepInfo_t *info, CF_CListNode_t *node)
+{
+    const CF_History_t *    history;
+    const CF_Transaction_t *txn;
+    CF_TxnFilenames_t       fnames;
+    CFE_Status_t            ret = CFE_SUCCESS;
+
+    if (info->dir == CF_Direction_NUM)
+    {
+        txn = container_of(node, CF_Transaction_t, cl_node);
+        ret = CF_Dump_Entry(dump, info->queue, txn->history, &txn->fnames);
+    }
+    else
+    {
+        /* if the history entry is for the other direction, it only counts against the budget */
+        history = container_of(node, CF_History_t, cl_node);
+        if (history->dir == info->dir)
+        {
+            CF_Names_Get(&CF_AppData.engine.channels[dump->chan_num].name_arena, history->names, &fnames);
+            ret = CF_Dump_Entry(dump, info->queue, history, &fnames);
+        }
+    }
+
+    return ret;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_Dump_Close(CF_Dump_t *dump)
+{
+    CF_WrappedClose(dump->fd);
+    dump->fd      = OS_OBJECT_ID_UNDEFINED;
+    dump->busy    = false;
+    dump->started = false;
+    dump->next    = NULL;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_dump.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_Dump_Cycle(void)
+{
+    CF_Dump_t *              dump   = &CF_AppData.dump;
+    const CF_DumpStepInfo_t *info   = NULL;
+    CF_CListNode_t **        head   = NULL;
+    CF_CListNode_t *         node   = NULL;
+    uint32                   budget = CF_QUEUE_FILE_ENTRIES_PER_WAKEUP;
+    CFE_Status_t             status = CFE_SUCCESS;
+
+    if (dump->busy)
+    {
+        while ((status == CFE_SUCCESS) && (dump->step < dump->num_steps))
+        {
+            info = &CF_DUMP_STEPS[dump->steps[dump->step]];
+            head = &CF_AppData.engine.channels[dump->chan_num].qs[info->queue];
+
+            if (!dump->started)
+            {
+                dump->next    = *head;
+                dump->started = true;
+            }
+
+            /* resume at the saved entry, so each wakeup costs only the entries it visits */
+            while ((status == CFE_SUCCESS) && (dump->next != NULL) && (budget != 0))
+            {
+                node = dump->next;
+
+                /* the list is circular, so it ends where it comes back around to the head */
+                dump->next = (node->next != *head) ? node->next : NULL;
+                --budget;
+
+                status = CF_Dump_Visit(dump, info, node);
+            }
+
+            if (dump->next != NULL)
+            {
+                /* out of budget or failed, the rest of this list waits */
+                break;
+            }
+
+            if (status == CFE_SUCCESS)
+            {
+                /* every entry of this list was visited */
+                ++dump->step;
+                dump->started = false;
+            }
+        }
+
+        if ((status == CFE_SUCCESS) && (dump->step == dump->num_steps))
+        {
+            status = CF_Dump_Flush(dump);
+        }
+
+        if (status != CFE_SUCCESS)
+        {
+            CF_Assert(info != NULL);
+            CFE_EVS_SendEvent(info->err_eid, CFE_EVS_EventType_ERROR, "CF: write queue failed to write %s entries",
+                              info->name);
+            ++CF_AppData.hk.Payload.counters.err;
+            CF_Dump_Close(dump);
+        }
+        else if (dump->step == dump->num_steps)
+        {
+            CFE_EVS_SendEvent(CF_CMD_WQ_DONE_INF_EID, CFE_EVS_EventType_INFORMATION,
+                              "CF: write queue complete, %lu entries written", (unsigned long)dump->entries);
+            CF_Dump_Close(dump);
+        }
+    }
+}
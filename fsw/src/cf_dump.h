@@ -0,0 +1,101 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,447-1, and identified as “CFS CFDP (CF)
+ * Application version 3.0.0”
+ *
+ * Copyright (c) 2019 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ *  The CF Application queue file writer header file
+ */
+
+#ifndef CF_DUMP_H
+#define CF_DUMP_H
+
+#include "cfe.h"
+#include "cf_msg.h"
+#include "cf_platform_cfg.h"
+#include "cf_clist.h"
+
+/**
+ * @brief The queue lists a queue file can hold, in the order they are written
+ */
+typedef enum
+{
+    CF_DumpStep_RX_ACTIVE  = 0, /**< \brief active RX transactions */
+    CF_DumpStep_RX_HISTORY = 1, /**< \brief RX history entries */
+    CF_DumpStep_TX_ACTIVE  = 2, /**< \brief active TX transactions */
+    CF_DumpStep_TX_WAIT    = 3, /**< \brief TX transactions done sending file data */
+    CF_DumpStep_TX_PEND    = 4, /**< \brief pending TX transactions */
+    CF_DumpStep_TX_HISTORY = 5, /**< \brief TX history entries */
+    CF_DumpStep_NUM        = 6
+} CF_DumpStep_t;
+
+/**
+ * @brief State of the queue file being written, if any
+ *
+ * Each wakeup visits up to CF_QUEUE_FILE_ENTRIES_PER_WAKEUP entries,
+ * starting where the last one left off in the current list.  The position
+ * is the next entry to visit, and CF_Dump_Unlink() moves it on to the
+ * following entry when that one leaves its list in between.  So every entry
+ * in the list the whole time is written once, as is any added to the end
+ * before the list is finished; the file is not a snapshot of one instant.
+ */
+typedef struct CF_Dump
+{
+    osal_id_t       fd;                             /**< \brief the queue file, open while busy */
+    bool            busy;                           /**< \brief set while a queue file is being written */
+    uint8           chan_num;                       /**< \brief channel whose queues are written */
+    uint8           format;                         /**< \brief CF_QueueFormat_t of the file */
+    uint8           num_steps;                      /**< \brief number of lists in steps */
+    uint8           step;                           /**< \brief index in steps of the list being written */
+    uint8           steps[CF_DumpStep_NUM];         /**< \brief CF_DumpStep_t of each list to write, in order */
+    bool            started;                        /**< \brief set once the current list has been started */
+    CF_CListNode_t *next;                           /**< \brief next entry of the current list, NULL past its end */
+    uint32          entries;                        /**< \brief entries written so far */
+    uint32          buf_len;                        /**< \brief bytes in buf not yet written */
+    uint8           buf[CF_QUEUE_FILE_BUFFER_SIZE]; /**< \brief output buffer */
+} CF_Dump_t;
+
+/************************************************************************/
+/** @brief Start writing a queue file.
+ *
+ * @par Description
+ *       Opens the file and works out the lists to write.  The entries are
+ *       written by CF_Dump_Cycle() over the following wakeups.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       wq must not be NULL, and its channel, queue, type and format must
+ *       already be checked.  Sends an event on failure.
+ *
+ * @param wq  Pointer to the write queue command payload
+ *
+ * @retval CFE_SUCCESS if the file is being written
+ * @retval CF_ERROR if another file is still being written or the file could not be opened
+ */
+CFE_Status_t CF_Dump_Start(const CF_WriteQueue_Payload_t *wq);
+
+/************************************************************************/
+/** @brief Write the next part of the queue file, if one is being written.
+ *
+ * @par Description
+ *       Called once per wakeup.  Closes the file and sends
+ *       CF_CMD_WQ_DONE_INF_EID once every list has been written.
+ */
+void CF_Dump_Cycle(void);
+
+#endif /* !CF_DUMP_H */
@@ -65,15 +65,22 @@
  */
 #define CF_PDU_MAX_SEGMENTS (CF_NAK_MAX_SEGMENTS)
 
+/**
+ * @brief Maximum number of segment requests in a single large file PDU
+ *
+ * With 64-bit offsets each segment request takes twice the space, so only
+ * half as many fit in a PDU of the same size.
+ */
+#define CF_PDU_MAX_SEGMENTS_LARGE (CF_PDU_MAX_SEGMENTS / 2)
+
 /**
  * @brief Type for logical file size/offset value
  *
- * The CFDP protocol permits use of 64-bit values for file size/offsets
- * Although the CF application only supports 32-bit legacy file size
- * type at this point, the logical structures should use this type in
- * case future support for large files is added.
+ * The CFDP protocol permits use of 64-bit values for file size/offsets.
+ * These are always held as 64 bits here, and only encoded in 64 bits
+ * when the large file flag is set in the PDU header.
  */
-typedef uint32 CF_FileSize_t;
+typedef uint64 CF_FileSize_t;
 
 /*
  * Note that by exploding the bit-fields into separate members, this will make the
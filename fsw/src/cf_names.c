@@ -0,0 +1,355 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,447-1, and identified as “CFS CFDP (CF)
+ * Application version 3.0.0”
+ *
+ * Copyright (c) 2019 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ *  The CF Application filename arena logic file
+ *
+ *  History entries outlive their transactions by a long way, but only need
+ *  their filenames for queue reports.  Rather than two full path buffers per
+ *  entry, the names are kept here: directory prefixes once each, and the
+ *  rest packed into a ring in the order the entries are kept.
+ */
+
+#include <string.h>
+#include "cfe.h"
+#include "cf_verify.h"
+#include "cf_names.h"
+#include "cf_app.h"
+#include "cf_assert.h"
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static CF_NameRecord_t *CF_Names_Record(const CF_NameArena_t *arena, uint32 offset)
+{
+    return (CF_NameRecord_t *)((uint8 *)arena->buf + offset);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Splits a name into a shared directory and the rest.  Returns 1 + the
+ * directory index with a reference taken, or 0 if the name is kept whole.
+ * Sets *missed if the name has a directory but no entry was free for it.
+ *
+ *-----------------------------------------------------------------*/
+static uint8 CF_Names_InternDir(CF_NameArena_t *arena, const char *name, const char **rest, size_t *rest_len,
+                                bool *missed)
+{
+    size_t len  = OS_strnlen(name, CF_FILENAME_MAX_LEN);
+    size_t dlen = len;
+    int    free_idx;
+    int    i;
+    uint8  ret = 0;
+
+    /* the directory is everything before the last slash, if there is one past the start */
+    while ((dlen > 0) && (name[dlen - 1] != '/'))
+    {
+        --dlen;
+    }
+
+    if (dlen > 1)
+    {
+        --dlen;
+        free_idx = -1;
+        for (i = 0; i < CF_NAME_DIRS_PER_CHAN; ++i)
+        {
+            if ((arena->dirs[i].len == dlen) && !memcmp(arena->dirs[i].path, name, dlen))
+            {
+                ret = i + 1;
+                break;
+            }
+
+            if ((free_idx < 0) && (arena->dirs[i].refs == 0))
+            {
+                free_idx = i;
+            }
+        }
+
+        if ((ret == 0) && (free_idx >= 0))
+        {
+            memcpy(arena->dirs[free_idx].path, name, dlen);
+            arena->dirs[free_idx].path[dlen] = 0;
+            arena->dirs[free_idx].len        = dlen;
+            ret                              = free_idx + 1;
+        }
+
+        *missed = (ret == 0);
+    }
+    else
+    {
+        *missed = false;
+    }
+
+    if (ret != 0)
+    {
+        ++arena->dirs[ret - 1].refs;
+        *rest     = &name[dlen + 1];
+        *rest_len = len - (dlen + 1);
+    }
+    else
+    {
+        *rest     = name;
+        *rest_len = len;
+    }
+
+    return ret;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_Names_ReleaseDir(CF_NameArena_t *arena, uint8 dir)
+{
+    if (dir != 0)
+    {
+        CF_Assert(arena->dirs[dir - 1].refs > 0);
+        --arena->dirs[dir - 1].refs;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Takes size bytes at the head of the ring.  Returns false if they are
+ * not free in one piece.
+ *
+ *-----------------------------------------------------------------*/
+static bool CF_Names_Alloc(CF_NameArena_t *arena, uint32 size, uint32 *offset)
+{
+    CF_NameRecord_t *filler;
+    uint32           end = sizeof(arena->buf);
+    uint32           skip;
+    bool             ret = true;
+
+    if (arena->used == 0)
+    {
+        /* start over at the beginning while nothing is held */
+        arena->head = 0;
+        arena->tail = 0;
+    }
+
+    if ((arena->used != 0) && (arena->head <= arena->tail))
+    {
+        /* wrapped, so only the space up to the tail is free */
+        ret = (size <= (arena->tail - arena->head));
+    }
+    else if (size > (end - arena->head))
+    {
+        ret = (size <= arena->tail);
+        if (ret)
+        {
+            /* the end is too short, so pass it over and wrap */
+            skip = end - arena->head;
+            if (skip >= sizeof(CF_NameRecord_t))
+            {
+                filler       = CF_Names_Record(arena, arena->head);
+                filler->size = skip;
+                filler->live = 0;
+            }
+            arena->used += skip;
+            arena->head = 0;
+        }
+    }
+
+    if (ret)
+    {
+        *offset = arena->head;
+        arena->head += size;
+        arena->used += size;
+        if (arena->head == end)
+        {
+            arena->head = 0;
+        }
+    }
+
+    return ret;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Gives back the released records at the tail of the ring.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_Names_Reclaim(CF_NameArena_t *arena)
+{
+    const CF_NameRecord_t *rec;
+    uint32                 end = sizeof(arena->buf);
+    uint32                 size;
+
+    while (arena->used != 0)
+    {
+        if ((end - arena->tail) < sizeof(CF_NameRecord_t))
+        {
+            /* too short for a record, so this was passed over on a wrap */
+            size = end - arena->tail;
+        }
+        else
+        {
+            rec = CF_Names_Record(arena, arena->tail);
+            if (rec->live)
+            {
+                break;
+            }
+            size = rec->size;
+        }
+
+        arena->tail += size;
+        arena->used -= size;
+        if (arena->tail == end)
+        {
+            arena->tail = 0;
+        }
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_names.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CF_Names_Store(CF_NameArena_t *arena, const CF_TxnFilenames_t *fnames, CF_NameRef_t *ref)
+{
+    CF_NameRecord_t *rec;
+    const char *     src;
+    const char *     dst;
+    size_t           src_len;
+    size_t           dst_len;
+    uint8            src_dir;
+    uint8            dst_dir;
+    bool             src_missed;
+    bool             dst_missed;
+    uint32           size;
+    uint32           offset;
+    char *           p;
+    CFE_Status_t     ret = CFE_SUCCESS;
+
+    src_dir = CF_Names_InternDir(arena, fnames->src_filename, &src, &src_len, &src_missed);
+    dst_dir = CF_Names_InternDir(arena, fnames->dst_filename, &dst, &dst_len, &dst_missed);
+
+    /* both names NUL terminated, padded to keep the next header aligned */
+    size = sizeof(CF_NameRecord_t) + src_len + dst_len + 2;
+    size = (size + 1) & ~1;
+
+    if (!CF_Names_Alloc(arena, size, &offset))
+    {
+        CF_Names_ReleaseDir(arena, src_dir);
+        CF_Names_ReleaseDir(arena, dst_dir);
+        *ref = 0;
+        ret  = CF_ERROR;
+    }
+    else
+    {
+        rec          = CF_Names_Record(arena, offset);
+        rec->size    = size;
+        rec->live    = 1;
+        rec->src_dir = src_dir;
+        rec->dst_dir = dst_dir;
+        rec->spare   = 0;
+
+        p = (char *)(rec + 1);
+        memcpy(p, src, src_len);
+        p[src_len] = 0;
+        p += src_len + 1;
+        memcpy(p, dst, dst_len);
+        p[dst_len] = 0;
+
+        *ref = offset + 1;
+
+        /* only counted here, as a store that did not fit is tried again once room is made */
+        arena->dir_misses += src_missed + dst_missed;
+    }
+
+    return ret;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_names.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_Names_Release(CF_NameArena_t *arena, CF_NameRef_t ref)
+{
+    CF_NameRecord_t *rec;
+
+    if (ref != 0)
+    {
+        rec = CF_Names_Record(arena, ref - 1);
+        CF_Assert(rec->live);
+
+        rec->live = 0;
+        CF_Names_ReleaseDir(arena, rec->src_dir);
+        CF_Names_ReleaseDir(arena, rec->dst_dir);
+        CF_Names_Reclaim(arena);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_Names_Join(const CF_NameArena_t *arena, uint8 dir, const char *rest, char *buf)
+{
+    if (dir != 0)
+    {
+        snprintf(buf, CF_FILENAME_MAX_LEN, "%s/%s", arena->dirs[dir - 1].path, rest);
+    }
+    else
+    {
+        snprintf(buf, CF_FILENAME_MAX_LEN, "%s", rest);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_names.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_Names_Get(const CF_NameArena_t *arena, CF_NameRef_t ref, CF_TxnFilenames_t *fnames)
+{
+    const CF_NameRecord_t *rec;
+    const char *           src;
+
+    if (ref == 0)
+    {
+        fnames->src_filename[0] = 0;
+        fnames->dst_filename[0] = 0;
+    }
+    else
+    {
+        rec = CF_Names_Record(arena, ref - 1);
+        src = (const char *)(rec + 1);
+        CF_Names_Join(arena, rec->src_dir, src, fnames->src_filename);
+        CF_Names_Join(arena, rec->dst_dir, src + strlen(src) + 1, fnames->dst_filename);
+    }
+}
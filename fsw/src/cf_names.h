@@ -0,0 +1,126 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,447-1, and identified as “CFS CFDP (CF)
+ * Application version 3.0.0”
+ *
+ * Copyright (c) 2019 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ *  The CF Application filename arena header file
+ */
+
+#ifndef CF_NAMES_H
+#define CF_NAMES_H
+
+#include "cfe.h"
+#include "cf_extern_typedefs.h"
+#include "cf_platform_cfg.h"
+
+/**
+ * @brief Reference to a stored filename pair, 0 if nothing is stored
+ *
+ * This is one more than the offset of the pair's record in the arena.
+ */
+typedef uint32 CF_NameRef_t;
+
+/**
+ * @brief A directory prefix shared by the stored filenames
+ */
+typedef struct CF_NameDir
+{
+    uint16 refs;                      /**< \brief number of stored filenames using this prefix */
+    uint16 len;                       /**< \brief length of path, 0 if this entry was never used */
+    char   path[CF_FILENAME_MAX_LEN]; /**< \brief the directory, without the trailing slash */
+} CF_NameDir_t;
+
+/**
+ * @brief Header of a filename pair record in the arena
+ *
+ * The source and then the destination name follow the header, each NUL
+ * terminated and without its directory prefix when it has one.
+ */
+typedef struct CF_NameRecord
+{
+    uint16 size;    /**< \brief bytes in this record, header and padding included */
+    uint8  live;    /**< \brief nonzero until the record is released */
+    uint8  src_dir; /**< \brief 1 + index in dirs of the source directory, 0 if none */
+    uint8  dst_dir; /**< \brief 1 + index in dirs of the destination directory, 0 if none */
+    uint8  spare;
+} CF_NameRecord_t;
+
+/**
+ * @brief Compact store of filename pairs
+ *
+ * Records are written in a ring, and released ones are reclaimed once they
+ * reach the oldest end.  Callers store in the order they expect to release,
+ * so the space comes back in order.  An all-zero arena is empty.
+ */
+typedef struct CF_NameArena
+{
+    uint16       buf[CF_NAME_ARENA_SIZE / 2]; /**< \brief record storage, uint16 to align the headers */
+    uint32       head;                        /**< \brief byte offset where the next record goes */
+    uint32       tail;                        /**< \brief byte offset of the oldest record not yet reclaimed */
+    uint32       used;                        /**< \brief bytes from tail to head, released records included */
+    uint32       dir_misses;                  /**< \brief names stored whole because every directory was in use */
+    CF_NameDir_t dirs[CF_NAME_DIRS_PER_CHAN]; /**< \brief shared directory prefixes */
+} CF_NameArena_t;
+
+/************************************************************************/
+/** @brief Store a filename pair in the arena.
+ *
+ * @par Description
+ *       The directory part of each name is shared with every other stored
+ *       name in the same directory, as long as a directory entry is free.
+ *       Otherwise the name is stored whole, and counted in dir_misses once
+ *       the pair is stored.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       arena, fnames and ref must not be NULL.
+ *
+ * @param arena  Pointer to the arena
+ * @param fnames Filenames to store
+ * @param ref    Output reference to the stored pair, 0 if it was not stored
+ *
+ * @retval CFE_SUCCESS if the pair was stored
+ * @retval CF_ERROR if there is no room until older pairs are released
+ */
+CFE_Status_t CF_Names_Store(CF_NameArena_t *arena, const CF_TxnFilenames_t *fnames, CF_NameRef_t *ref);
+
+/************************************************************************/
+/** @brief Release a filename pair stored in the arena.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       arena must not be NULL.  A ref of 0 is ignored.
+ *
+ * @param arena  Pointer to the arena
+ * @param ref    Reference returned by CF_Names_Store()
+ */
+void CF_Names_Release(CF_NameArena_t *arena, CF_NameRef_t ref);
+
+/************************************************************************/
+/** @brief Get a filename pair stored in the arena.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       arena and fnames must not be NULL.  A ref of 0 gives empty names.
+ *
+ * @param arena  Pointer to the arena
+ * @param ref    Reference returned by CF_Names_Store()
+ * @param fnames Output buffer for the full names
+ */
+void CF_Names_Get(const CF_NameArena_t *arena, CF_NameRef_t ref, CF_TxnFilenames_t *fnames);
+
+#endif /* !CF_NAMES_H */
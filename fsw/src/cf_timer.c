@@ -22,10 +22,12 @@
  *
  *  The CF Application timer source file
  *
- *  A timer in CF is really just a structure that holds a counter that
- *  indicates the timer expired when it reaches 0. The goal is that
- *  any timer is driven by the scheduler ticks. There is no reason
+ *  Timers in CF are driven by the scheduler ticks. There is no reason
  *  we need any finer grained resolution than this for CF.
+ *
+ *  Running timers are held in a hierarchical timer wheel, so a tick
+ *  costs time in proportion to the timers that expire on it, not to
+ *  the timers that are running.
  */
 
 #include "cfe.h"
@@ -45,15 +47,75 @@ uint32 CF_Timer_Sec2Ticks(CF_Timer_Seconds_t sec)
     return sec * CF_AppData.config_table->ticks_per_second;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_Timer_Insert(CF_TimerWheel_t *wheel, CF_Timer_t *timer)
+{
+    CF_Timer_Ticks_t delta = timer->expire - wheel->now;
+    CF_Timer_Ticks_t when  = timer->expire;
+    int              level = 0;
+
+    /* past the reach of the wheel, so wait in the farthest slot and get placed again from there */
+    if (delta >= (1UL << (CF_TIMER_WHEEL_SLOT_BITS * CF_TIMER_WHEEL_LEVELS)))
+    {
+        when  = wheel->now + (1UL << (CF_TIMER_WHEEL_SLOT_BITS * CF_TIMER_WHEEL_LEVELS)) - 1;
+        delta = when - wheel->now;
+    }
+
+    while ((delta >> (CF_TIMER_WHEEL_SLOT_BITS * (level + 1))) != 0)
+    {
+        ++level;
+    }
+
+    timer->slot =
+        &wheel->slots[level][(when >> (CF_TIMER_WHEEL_SLOT_BITS * level)) & (CF_TIMER_WHEEL_SLOTS - 1)];
+    CF_CList_InitNode(&timer->cl_node);
+    CF_CList_InsertBack(timer->slot, &timer->cl_node);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_timer.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_Timer_InitRelSec(CF_TimerWheel_t *wheel, CF_Timer_t *timer, CF_Timer_Seconds_t rel_sec,
+                         CF_Timer_ExpireFn_t fn)
+{
+    CF_Timer_Ticks_t ticks = CF_Timer_Sec2Ticks(rel_sec);
+
+    CF_Timer_Stop(timer);
+
+    timer->fn     = fn;
+    timer->expire = wheel->now + ticks;
+
+    if (ticks)
+    {
+        CF_Timer_Insert(wheel, timer);
+    }
+    else if (fn)
+    {
+        fn(timer);
+    }
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
  * See description in cf_timer.h for argument/return detail
  *
  *-----------------------------------------------------------------*/
-void CF_Timer_InitRelSec(CF_Timer_t *txn, uint32 rel_sec)
+void CF_Timer_Stop(CF_Timer_t *timer)
 {
-    txn->tick = CF_Timer_Sec2Ticks(rel_sec);
+    if (timer->slot)
+    {
+        CF_CList_Remove(timer->slot, &timer->cl_node);
+        timer->slot = NULL;
+    }
+    timer->paused = 0;
 }
 
 /*----------------------------------------------------------------
@@ -62,9 +124,15 @@ void CF_Timer_InitRelSec(CF_Timer_t *txn, uint32 rel_sec)
  * See description in cf_timer.h for argument/return detail
  *
  *-----------------------------------------------------------------*/
-bool CF_Timer_Expired(const CF_Timer_t *txn)
+void CF_Timer_Pause(CF_TimerWheel_t *wheel, CF_Timer_t *timer)
 {
-    return !txn->tick;
+    if (timer->slot)
+    {
+        /* a running timer expires after now, so this is never 0 */
+        timer->paused = timer->expire - wheel->now;
+        CF_CList_Remove(timer->slot, &timer->cl_node);
+        timer->slot = NULL;
+    }
 }
 
 /*----------------------------------------------------------------
@@ -73,8 +141,68 @@ bool CF_Timer_Expired(const CF_Timer_t *txn)
  * See description in cf_timer.h for argument/return detail
  *
  *-----------------------------------------------------------------*/
-void CF_Timer_Tick(CF_Timer_t *txn)
+void CF_Timer_Resume(CF_TimerWheel_t *wheel, CF_Timer_t *timer)
 {
-    CF_Assert(txn->tick);
-    --txn->tick;
+    if (timer->paused)
+    {
+        timer->expire = wheel->now + timer->paused;
+        timer->paused = 0;
+        CF_Timer_Insert(wheel, timer);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_timer.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CF_Timer_Expired(const CF_Timer_t *timer)
+{
+    return !timer->slot && !timer->paused;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_timer.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_Timer_Tick(CF_TimerWheel_t *wheel)
+{
+    CF_CListNode_t **slot;
+    CF_CListNode_t * node;
+    CF_Timer_t *     timer;
+    int              level = 0;
+
+    ++wheel->now;
+
+    /* find the highest level whose current slot starts on this tick */
+    while ((level + 1) < CF_TIMER_WHEEL_LEVELS &&
+           (wheel->now & ((1UL << (CF_TIMER_WHEEL_SLOT_BITS * (level + 1))) - 1)) == 0)
+    {
+        ++level;
+    }
+
+    /* move those timers down, highest first so each level is sorted before it is moved itself */
+    for (; level > 0; --level)
+    {
+        slot = &wheel->slots[level][(wheel->now >> (CF_TIMER_WHEEL_SLOT_BITS * level)) & (CF_TIMER_WHEEL_SLOTS - 1)];
+        while ((node = CF_CList_Pop(slot)))
+        {
+            CF_Timer_Insert(wheel, container_of(node, CF_Timer_t, cl_node));
+        }
+    }
+
+    /* an expire function may start or stop other timers, so take them off one at a time */
+    slot = &wheel->slots[0][wheel->now & (CF_TIMER_WHEEL_SLOTS - 1)];
+    while ((node = CF_CList_Pop(slot)))
+    {
+        timer       = container_of(node, CF_Timer_t, cl_node);
+        timer->slot = NULL;
+        if (timer->fn)
+        {
+            timer->fn(timer);
+        }
+    }
 }
@@ -27,6 +27,26 @@
 #define CF_TIMER_H
 
 #include "cfe.h"
+#include "cf_clist.h"
+
+/**
+ * @brief Number of bits of the tick count handled by each level of the timer wheel
+ */
+#define CF_TIMER_WHEEL_SLOT_BITS (6)
+
+/**
+ * @brief Number of slots in each level of the timer wheel
+ */
+#define CF_TIMER_WHEEL_SLOTS (1 << CF_TIMER_WHEEL_SLOT_BITS)
+
+/**
+ * @brief Number of levels in the timer wheel
+ *
+ * Timers up to CF_TIMER_WHEEL_SLOTS ^ CF_TIMER_WHEEL_LEVELS ticks out are
+ * placed directly. Longer timers wait in the top level and are placed
+ * again as they get closer.
+ */
+#define CF_TIMER_WHEEL_LEVELS (4)
 
 /**
  * @brief Type for a timer tick count
@@ -42,48 +62,138 @@ typedef uint32 CF_Timer_Ticks_t;
  */
 typedef uint32 CF_Timer_Seconds_t;
 
+struct CF_Timer;
+
+/**
+ * @brief Function called when a timer expires
+ *
+ * @param timer Timer that expired
+ */
+typedef void (*CF_Timer_ExpireFn_t)(struct CF_Timer *timer);
+
 /**
  * @brief Basic CF timer object
+ *
+ * A timer is running while it is held in a timer wheel. A paused timer
+ * is off the wheel but keeps the ticks it had left. A timer that is
+ * neither (including one that was never started) is expired.
  */
 typedef struct CF_Timer
 {
-    CF_Timer_Ticks_t tick; /**< \brief expires when reaches 0 */
+    CF_CListNode_t      cl_node; /**< \brief node in a timer wheel slot while running */
+    CF_CListNode_t **   slot;    /**< \brief timer wheel slot holding this timer, NULL if not running */
+    CF_Timer_Ticks_t    expire;  /**< \brief timer wheel time at which this expires */
+    CF_Timer_Ticks_t    paused;  /**< \brief ticks left while paused, 0 if not paused */
+    CF_Timer_ExpireFn_t fn;      /**< \brief called when this expires, may be NULL */
 } CF_Timer_t;
 
+/**
+ * @brief Hierarchical timer wheel
+ *
+ * Level 0 has one slot per tick. Each slot of a higher level covers a
+ * whole turn of the level below it, and its timers are moved down when
+ * that turn starts. So each tick only touches the timers that expire on
+ * it, plus (now and then) the timers being moved down.
+ */
+typedef struct CF_TimerWheel
+{
+    CF_Timer_Ticks_t now; /**< \brief number of ticks so far */
+    CF_CListNode_t * slots[CF_TIMER_WHEEL_LEVELS][CF_TIMER_WHEEL_SLOTS];
+} CF_TimerWheel_t;
+
 /************************************************************************/
-/** @brief Initialize a timer with a relative number of seconds.
+/** @brief Start a timer with a relative number of seconds.
+ *
+ * @par Description
+ *       If the timer is already running it is restarted. A timer of
+ *       0 seconds expires right away, and fn is called before this returns.
  *
  * @par Assumptions, External Events, and Notes:
- *       txn must not be NULL.
+ *       wheel must not be NULL. timer must not be NULL.
  *
- * @param txn         Timer object to initialize
+ * @param wheel     Timer wheel to run the timer on
+ * @param timer     Timer object to initialize
  * @param rel_sec   Relative number of seconds
+ * @param fn        Function to call when the timer expires, may be NULL
  */
-void CF_Timer_InitRelSec(CF_Timer_t *txn, CF_Timer_Seconds_t rel_sec);
+void CF_Timer_InitRelSec(CF_TimerWheel_t *wheel, CF_Timer_t *timer, CF_Timer_Seconds_t rel_sec,
+                         CF_Timer_ExpireFn_t fn);
+
+/************************************************************************/
+/** @brief Stop a timer.
+ *
+ * @par Description
+ *       The timer is taken off its timer wheel, and will read as expired
+ *       without its expire function being called.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       timer must not be NULL. A paused timer is stopped as well. Does
+ *       nothing if the timer is already expired.
+ *
+ * @param timer     Timer object to stop
+ */
+void CF_Timer_Stop(CF_Timer_t *timer);
+
+/************************************************************************/
+/** @brief Pause a timer.
+ *
+ * @par Description
+ *       The timer is taken off its timer wheel with the ticks it has left
+ *       saved, so it neither counts down nor reads as expired until it is
+ *       resumed.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       wheel must not be NULL. timer must not be NULL. Does nothing if
+ *       the timer is not running.
+ *
+ * @param wheel     Timer wheel the timer is running on
+ * @param timer     Timer object to pause
+ */
+void CF_Timer_Pause(CF_TimerWheel_t *wheel, CF_Timer_t *timer);
+
+/************************************************************************/
+/** @brief Resume a paused timer.
+ *
+ * @par Description
+ *       The timer goes back on the timer wheel with the ticks it had left
+ *       when it was paused.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       wheel must not be NULL. timer must not be NULL. Does nothing if
+ *       the timer is not paused.
+ *
+ * @param wheel     Timer wheel to run the timer on
+ * @param timer     Timer object to resume
+ */
+void CF_Timer_Resume(CF_TimerWheel_t *wheel, CF_Timer_t *timer);
 
 /************************************************************************/
 /** @brief Check if a timer has expired.
  *
  * @par Assumptions, External Events, and Notes:
- *       txn must not be NULL.
+ *       timer must not be NULL.
  *
- * @param txn         Timer object to check
+ * @param timer     Timer object to check
  *
  * @returns status code indicating whether timer has expired
  * @retval 1 if expired
  * @retval 0 if not expired
  */
-bool CF_Timer_Expired(const CF_Timer_t *txn);
+bool CF_Timer_Expired(const CF_Timer_t *timer);
 
 /************************************************************************/
-/** @brief Notify a timer object a tick has occurred.
+/** @brief Notify a timer wheel a tick has occurred.
+ *
+ * @par Description
+ *       Every timer on the wheel that expires on this tick is taken off
+ *       the wheel and its expire function is called.
  *
  * @par Assumptions, External Events, and Notes:
- *       txn must not be NULL.
+ *       wheel must not be NULL.
  *
- * @param txn         Timer object to tick
+ * @param wheel     Timer wheel to tick
  */
-void CF_Timer_Tick(CF_Timer_t *txn);
+void CF_Timer_Tick(CF_TimerWheel_t *wheel);
 
 /************************************************************************/
 /** @brief Converts seconds into scheduler ticks.
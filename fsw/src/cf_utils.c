@@ -34,6 +34,21 @@
 
 #include "cf_assert.h"
 
+/* largest seek made in one OS_lseek() call, which takes a signed 32-bit offset */
+#define CF_SEEK_STEP_SIZE (0x40000000)
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static void CF_ReleaseHistoryNames(CF_Channel_t *chan, CF_History_t *history)
+{
+    CF_Names_Release(&chan->name_arena, history->names);
+    history->names = 0;
+    CF_AppData.hk.Payload.channel_hk[chan - CF_AppData.engine.channels].name_arena_used = chan->name_arena.used;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -42,9 +57,11 @@
  *-----------------------------------------------------------------*/
 CF_Transaction_t *CF_FindUnusedTransaction(CF_Channel_t *chan)
 {
-    CF_CListNode_t *  node;
-    CF_Transaction_t *txn;
-    int               q_index; /* initialized below in if */
+    CF_CListNode_t *     node;
+    CF_Transaction_t *   txn;
+    CF_HkChannel_Data_t *hk;
+    int                  q_index; /* initialized below in if */
+    int                  in_use;
 
     CF_Assert(chan);
 
@@ -68,10 +85,25 @@ CF_Transaction_t *CF_FindUnusedTransaction(CF_Channel_t *chan)
         }
 
         txn->history      = container_of(chan->qs[q_index], CF_History_t, cl_node);
+        CF_ReleaseHistoryNames(chan, txn->history);
         txn->history->dir = CF_Direction_NUM; /* start with no direction */
+        txn->start_time   = CFE_TIME_GetTime();
 
         CF_CList_Remove_Ex(chan, q_index, &txn->history->cl_node);
 
+        /* pool high-water marks, anything not on a free queue is in use */
+        hk     = &CF_AppData.hk.Payload.channel_hk[txn->chan_num];
+        in_use = chan->num_transactions - hk->q_size[CF_QueueIdx_FREE];
+        if (in_use > hk->txn_hwm)
+        {
+            hk->txn_hwm = in_use;
+        }
+        in_use = chan->num_histories - hk->q_size[CF_QueueIdx_HIST_FREE];
+        if (in_use > hk->hist_hwm)
+        {
+            hk->hist_hwm = in_use;
+        }
+
         return txn;
     }
     else
@@ -88,10 +120,34 @@ CF_Transaction_t *CF_FindUnusedTransaction(CF_Channel_t *chan)
  *-----------------------------------------------------------------*/
 void CF_ResetHistory(CF_Channel_t *chan, CF_History_t *history)
 {
+    CF_ReleaseHistoryNames(chan, history);
     CF_CList_Remove_Ex(chan, CF_QueueIdx_HIST, &history->cl_node);
     CF_CList_InsertBack_Ex(chan, CF_QueueIdx_HIST_FREE, &history->cl_node);
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_utils.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_StoreHistoryNames(CF_Channel_t *chan, CF_History_t *history, const CF_TxnFilenames_t *fnames)
+{
+    CF_HkChannel_Data_t *hk     = &CF_AppData.hk.Payload.channel_hk[chan - CF_AppData.engine.channels];
+    uint32               misses = chan->name_arena.dir_misses;
+
+    /* the oldest names are at the tail of the arena, so recycling the oldest entries makes room */
+    while ((CF_Names_Store(&chan->name_arena, fnames, &history->names) != CFE_SUCCESS) &&
+           (chan->qs[CF_QueueIdx_HIST] != NULL))
+    {
+        CF_ResetHistory(chan, container_of(chan->qs[CF_QueueIdx_HIST], CF_History_t, cl_node));
+        ++hk->name_evictions;
+    }
+
+    hk->name_arena_used = chan->name_arena.used;
+    hk->name_dir_misses += chan->name_arena.dir_misses - misses;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -101,33 +157,34 @@ void CF_ResetHistory(CF_Channel_t *chan, CF_History_t *history)
 void CF_FreeTransaction(CF_Transaction_t *txn)
 {
     uint8 chan = txn->chan_num;
+    CF_RemoveTransactionIndex(txn);
+    CF_RemoveTransactionTick(txn);
+    CF_Timer_Stop(&txn->ack_timer);
+    CF_Timer_Stop(&txn->inactivity_timer);
     memset(txn, 0, sizeof(*txn));
     txn->flags.com.q_index = CF_QueueIdx_FREE;
     txn->fd                = OS_OBJECT_ID_UNDEFINED;
     txn->chan_num          = chan;
     txn->state             = CF_TxnState_IDLE; /* NOTE: this is redundant as long as CF_TxnState_IDLE == 0 */
     CF_CList_InitNode(&txn->cl_node);
+    CF_CList_InitNode(&txn->hash_node);
+    CF_CList_InitNode(&txn->tick_node);
     CF_CList_InsertBack_Ex(&CF_AppData.engine.channels[chan], CF_QueueIdx_FREE, &txn->cl_node);
 }
 
 /*----------------------------------------------------------------
  *
- * Application-scope internal function
- * See description in cf_utils.h for argument/return detail
+ * Internal helper routine only, not part of API.
  *
  *-----------------------------------------------------------------*/
-CFE_Status_t CF_FindTransactionBySequenceNumber_Impl(CF_CListNode_t *node, CF_Traverse_TransSeqArg_t *context)
+static inline CF_CListNode_t **CF_TransactionIndexBucket(CF_Channel_t *chan, CF_TransactionSeq_t seq_num,
+                                                         CF_EntityId_t src_eid)
 {
-    CF_Transaction_t *txn = container_of(node, CF_Transaction_t, cl_node);
-    CFE_Status_t      ret = 0;
+    /* sequence numbers from one entity are mostly sequential, so they land in consecutive
+     * buckets; the multiply spreads out transactions from different entities */
+    uint32 hash = (uint32)seq_num ^ ((uint32)src_eid * 0x9E3779B1);
 
-    if ((txn->history->src_eid == context->src_eid) && (txn->history->seq_num == context->transaction_sequence_number))
-    {
-        context->txn = txn;
-        ret          = 1; /* exit early */
-    }
-
-    return ret;
+    return &chan->txn_hash[hash & (CF_NUM_TRANSACTION_HASH_BUCKETS_PER_CHAN - 1)];
 }
 
 /*----------------------------------------------------------------
@@ -136,31 +193,25 @@ CFE_Status_t CF_FindTransactionBySequenceNumber_Impl(CF_CListNode_t *node, CF_Tr
  * See description in cf_utils.h for argument/return detail
  *
  *-----------------------------------------------------------------*/
-CF_Transaction_t *CF_FindTransactionBySequenceNumber(CF_Channel_t *      chan,
-                                                     CF_TransactionSeq_t transaction_sequence_number,
-                                                     CF_EntityId_t       src_eid)
+void CF_InsertTransactionIndex(CF_Channel_t *chan, CF_Transaction_t *txn)
 {
-    /* need to find transaction by sequence number. It will either be the active transaction (front of Q_PEND),
-     * or on Q_TX or Q_RX. Once a transaction moves to history, then it's done.
-     *
-     * Let's put CF_QueueIdx_RX up front, because most RX packets will be file data PDUs */
-    CF_Traverse_TransSeqArg_t ctx    = {transaction_sequence_number, src_eid, NULL};
-    CF_CListNode_t *          ptrs[] = {chan->qs[CF_QueueIdx_RX], chan->qs[CF_QueueIdx_PEND], chan->qs[CF_QueueIdx_TXA],
-                              chan->qs[CF_QueueIdx_TXW]};
-    int                       i;
-    CF_Transaction_t *        ret = NULL;
-
-    for (i = 0; i < (sizeof(ptrs) / sizeof(ptrs[0])); ++i)
+    CF_Assert(txn->history);
+
+    CF_RemoveTransactionIndex(txn);
+
+    /* the receive task looks transactions up while the engine runs */
+    if (OS_ObjectIdDefined(chan->index_mutex))
     {
-        CF_CList_Traverse(ptrs[i], (CF_CListFn_t)CF_FindTransactionBySequenceNumber_Impl, &ctx);
-        if (ctx.txn)
-        {
-            ret = ctx.txn;
-            break;
-        }
+        OS_MutSemTake(chan->index_mutex);
     }
 
-    return ret;
+    txn->hash_head = CF_TransactionIndexBucket(chan, txn->history->seq_num, txn->history->src_eid);
+    CF_CList_InsertBack(txn->hash_head, &txn->hash_node);
+
+    if (OS_ObjectIdDefined(chan->index_mutex))
+    {
+        OS_MutSemGive(chan->index_mutex);
+    }
 }
 
 /*----------------------------------------------------------------
@@ -169,48 +220,25 @@ CF_Transaction_t *CF_FindTransactionBySequenceNumber(CF_Channel_t *      chan,
  * See description in cf_utils.h for argument/return detail
  *
  *-----------------------------------------------------------------*/
-CFE_Status_t CF_WriteHistoryEntryToFile(osal_id_t fd, const CF_History_t *history)
+void CF_RemoveTransactionIndex(CF_Transaction_t *txn)
 {
-    static const char *CF_DSTR[] = {"RX", "TX"}; /* conversion of CF_Direction_t to string */
+    osal_id_t index_mutex = CF_AppData.engine.channels[txn->chan_num].index_mutex;
 
-    int          i;
-    CFE_Status_t ret;
-    size_t       len;
-    char         linebuf[(CF_FILENAME_MAX_LEN * 2) + 128]; /* buffer for line data */
-
-    for (i = 0; i < 3; ++i)
+    if (txn->hash_head)
     {
-        switch (i)
+        if (OS_ObjectIdDefined(index_mutex))
         {
-            case 0:
-                CF_Assert(history->dir < CF_Direction_NUM);
-                /* SAD: No need to check snprintf return; buffer size is sufficient for the formatted output */
-                snprintf(linebuf, sizeof(linebuf), "SEQ (%lu, %lu)\tDIR: %s\tPEER %lu\tSTAT: %d\t",
-                         (unsigned long)history->src_eid, (unsigned long)history->seq_num, CF_DSTR[history->dir],
-                         (unsigned long)history->peer_eid, (int)history->txn_stat);
-                break;
-            case 1:
-                /* SAD: No need to check snprintf return; buffer size is sufficient for the formatted output */
-                snprintf(linebuf, sizeof(linebuf), "SRC: %s\t", history->fnames.src_filename);
-                break;
-            case 2:
-            default:
-                /* SAD: No need to check snprintf return; buffer size is sufficient for the formatted output */
-                snprintf(linebuf, sizeof(linebuf), "DST: %s\n", history->fnames.dst_filename);
-                break;
+            OS_MutSemTake(index_mutex);
         }
 
-        len = OS_strnlen(linebuf, (CF_FILENAME_MAX_LEN * 2) + 128);
-        ret = CF_WrappedWrite(fd, linebuf, len);
-        if (ret != len)
+        CF_CList_Remove(txn->hash_head, &txn->hash_node);
+        txn->hash_head = NULL;
+
+        if (OS_ObjectIdDefined(index_mutex))
         {
-            CFE_EVS_SendEvent(CF_CMD_WHIST_WRITE_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "CF: writing queue file failed, expected %ld got %ld", (long)len, (long)ret);
-            return CF_ERROR;
+            OS_MutSemGive(index_mutex);
         }
     }
-
-    return CFE_SUCCESS;
 }
 
 /*----------------------------------------------------------------
@@ -219,25 +247,30 @@ CFE_Status_t CF_WriteHistoryEntryToFile(osal_id_t fd, const CF_History_t *histor
  * See description in cf_utils.h for argument/return detail
  *
  *-----------------------------------------------------------------*/
-CF_CListTraverse_Status_t CF_Traverse_WriteHistoryQueueEntryToFile(CF_CListNode_t *node, void *arg)
+void CF_InsertTransactionTick(CF_Channel_t *chan, CF_Transaction_t *txn)
 {
-    CF_Traverse_WriteHistoryFileArg_t *context = arg;
-    CF_History_t *                     history = container_of(node, CF_History_t, cl_node);
+    bool is_sender = (txn->state == CF_TxnState_S1) || (txn->state == CF_TxnState_S2);
 
-    /* if filter_dir is CF_Direction_NUM, this means both directions (all match) */
-    if (context->filter_dir == CF_Direction_NUM || history->dir == context->filter_dir)
+    if (!txn->tick_head)
     {
-        if (CF_WriteHistoryEntryToFile(context->fd, history) < 0)
-        {
-            /* failed */
-            context->error = true;
-            return CF_CLIST_EXIT;
-        }
-
-        ++context->counter;
+        txn->tick_head = &chan->tick_list[is_sender ? CF_Direction_TX : CF_Direction_RX];
+        CF_CList_InsertBack(txn->tick_head, &txn->tick_node);
     }
+}
 
-    return CF_CLIST_CONT;
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_utils.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_RemoveTransactionTick(CF_Transaction_t *txn)
+{
+    if (txn->tick_head)
+    {
+        CF_CList_Remove(txn->tick_head, &txn->tick_node);
+        txn->tick_head = NULL;
+    }
 }
 
 /*----------------------------------------------------------------
@@ -246,20 +279,18 @@ CF_CListTraverse_Status_t CF_Traverse_WriteHistoryQueueEntryToFile(CF_CListNode_
  * See description in cf_utils.h for argument/return detail
  *
  *-----------------------------------------------------------------*/
-CF_CListTraverse_Status_t CF_Traverse_WriteTxnQueueEntryToFile(CF_CListNode_t *node, void *arg)
+CFE_Status_t CF_FindTransactionBySequenceNumber_Impl(CF_CListNode_t *node, CF_Traverse_TransSeqArg_t *context)
 {
-    CF_Traverse_WriteTxnFileArg_t *context = arg;
-    CF_Transaction_t *             txn     = container_of(node, CF_Transaction_t, cl_node);
+    CF_Transaction_t *txn = container_of(node, CF_Transaction_t, hash_node);
+    CFE_Status_t      ret = 0;
 
-    if (CF_WriteHistoryEntryToFile(context->fd, txn->history) < 0)
+    if ((txn->history->src_eid == context->src_eid) && (txn->history->seq_num == context->transaction_sequence_number))
     {
-        /* failed */
-        context->error = true;
-        return CF_CLIST_EXIT;
+        context->txn = txn;
+        ret          = 1; /* exit early */
     }
 
-    ++context->counter;
-    return CF_CLIST_CONT;
+    return ret;
 }
 
 /*----------------------------------------------------------------
@@ -268,59 +299,109 @@ CF_CListTraverse_Status_t CF_Traverse_WriteTxnQueueEntryToFile(CF_CListNode_t *n
  * See description in cf_utils.h for argument/return detail
  *
  *-----------------------------------------------------------------*/
-CFE_Status_t CF_WriteTxnQueueDataToFile(osal_id_t fd, CF_Channel_t *chan, CF_QueueIdx_t queue)
+CF_Transaction_t *CF_FindTransactionBySequenceNumber(CF_Channel_t *      chan,
+                                                     CF_TransactionSeq_t transaction_sequence_number,
+                                                     CF_EntityId_t       src_eid)
 {
-    CF_Traverse_WriteTxnFileArg_t arg;
+    /* need to find transaction by sequence number. It will either be the active transaction (front of Q_PEND),
+     * or on Q_TX or Q_RX. Once a transaction moves to history, then it's done.
+     *
+     * All of those are in the channel's index while active, so only the one bucket needs to be checked */
+    CF_Traverse_TransSeqArg_t ctx = {transaction_sequence_number, src_eid, NULL};
 
-    arg.fd      = fd;
-    arg.error   = false;
-    arg.counter = 0;
+    CF_CList_Traverse(*CF_TransactionIndexBucket(chan, transaction_sequence_number, src_eid),
+                      (CF_CListFn_t)CF_FindTransactionBySequenceNumber_Impl, &ctx);
 
-    CF_CList_Traverse(chan->qs[queue], CF_Traverse_WriteTxnQueueEntryToFile, &arg);
-    return arg.error;
+    return ctx.txn;
 }
 
 /*----------------------------------------------------------------
  *
- * Application-scope internal function
- * See description in cf_utils.h for argument/return detail
+ * Internal helper routine only, not part of API.
  *
  *-----------------------------------------------------------------*/
-CFE_Status_t CF_WriteHistoryQueueDataToFile(osal_id_t fd, CF_Channel_t *chan, CF_Direction_t dir)
+static CF_PrioIndex_t *CF_GetPrioIndex(CF_Channel_t *chan, CF_QueueIdx_t queue)
 {
-    CF_Traverse_WriteHistoryFileArg_t arg;
+    CF_PrioIndex_t *pi;
 
-    arg.fd         = fd;
-    arg.filter_dir = dir;
-    arg.error      = false;
-    arg.counter    = 0;
+    switch (queue)
+    {
+        case CF_QueueIdx_PEND:
+            pi = &chan->pend_prio;
+            break;
+        case CF_QueueIdx_TXW:
+            pi = &chan->txw_prio;
+            break;
+        default:
+            pi = NULL;
+            break;
+    }
 
-    CF_CList_Traverse(chan->qs[CF_QueueIdx_HIST], CF_Traverse_WriteHistoryQueueEntryToFile, &arg);
-    return arg.error;
+    return pi;
 }
 
 /*----------------------------------------------------------------
  *
- * Application-scope internal function
- * See description in cf_utils.h for argument/return detail
+ * Internal helper routine only, not part of API.
+ *
+ *-----------------------------------------------------------------*/
+static uint8 CF_PrioIndex_HighestBit(uint32 word)
+{
+    uint8 bit = 0;
+
+    /* word must be nonzero, narrow down by halves */
+    if (word & 0xFFFF0000)
+    {
+        word >>= 16;
+        bit += 16;
+    }
+    if (word & 0xFF00)
+    {
+        word >>= 8;
+        bit += 8;
+    }
+    if (word & 0xF0)
+    {
+        word >>= 4;
+        bit += 4;
+    }
+    if (word & 0xC)
+    {
+        word >>= 2;
+        bit += 2;
+    }
+    if (word & 0x2)
+    {
+        bit += 1;
+    }
+
+    return bit;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
  *
  *-----------------------------------------------------------------*/
-CF_CListTraverse_Status_t CF_PrioSearch(CF_CListNode_t *node, void *context)
+static CF_CListNode_t *CF_PrioIndex_FindAtOrAbove(const CF_PrioIndex_t *pi, uint8 priority)
 {
-    CF_Transaction_t *         txn = container_of(node, CF_Transaction_t, cl_node);
-    CF_Traverse_PriorityArg_t *arg = (CF_Traverse_PriorityArg_t *)context;
+    CF_CListNode_t *ret  = NULL;
+    int             idx  = priority / 32;
+    uint32          word = pi->nonempty[idx] & ((2U << (priority % 32)) - 1); /* this level and higher ones */
 
-    if (txn->priority <= arg->priority)
+    /* higher priority is a lower value, so look downward for the nearest level in use */
+    while (!word && idx > 0)
     {
-        /* found it!
-         *
-         * the current transaction's prio is less than desired (higher)
-         */
-        arg->txn = txn;
-        return CF_CLIST_EXIT;
+        --idx;
+        word = pi->nonempty[idx];
     }
 
-    return CF_CLIST_CONT;
+    if (word)
+    {
+        ret = pi->tail[(idx * 32) + CF_PrioIndex_HighestBit(word)];
+    }
+
+    return ret;
 }
 
 /*----------------------------------------------------------------
@@ -331,39 +412,58 @@ CF_CListTraverse_Status_t CF_PrioSearch(CF_CListNode_t *node, void *context)
  *-----------------------------------------------------------------*/
 void CF_InsertSortPrio(CF_Transaction_t *txn, CF_QueueIdx_t queue)
 {
-    bool           insert_back = false;
-    CF_Channel_t *chan        = &CF_AppData.engine.channels[txn->chan_num];
+    CF_Channel_t *  chan = &CF_AppData.engine.channels[txn->chan_num];
+    CF_PrioIndex_t *pi   = CF_GetPrioIndex(chan, queue);
+    CF_CListNode_t *after;
 
     CF_Assert(txn->chan_num < CF_NUM_CHANNELS);
     CF_Assert(txn->state != CF_TxnState_IDLE);
+    CF_Assert(pi);
 
-    /* look for proper position on PEND queue for this transaction.
-     * This is a simple priority sort. */
-
-    if (!chan->qs[queue])
+    after = CF_PrioIndex_FindAtOrAbove(pi, txn->priority);
+    if (after)
     {
-        /* list is empty, so just insert */
-        insert_back = true;
+        CF_CList_InsertAfter_Ex(chan, queue, after, &txn->cl_node);
     }
     else
     {
-        CF_Traverse_PriorityArg_t arg = {NULL, txn->priority};
-        CF_CList_Traverse_R(chan->qs[queue], CF_PrioSearch, &arg);
-        if (arg.txn)
+        /* nothing on the queue is as important, so this goes first */
+        CF_CList_InsertFront_Ex(chan, queue, &txn->cl_node);
+    }
+
+    pi->tail[txn->priority] = &txn->cl_node;
+    pi->nonempty[txn->priority / 32] |= 1U << (txn->priority % 32);
+
+    txn->flags.com.q_index = queue;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_utils.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CF_RemoveTransactionPrio(CF_Transaction_t *txn)
+{
+    CF_Channel_t *  chan = &CF_AppData.engine.channels[txn->chan_num];
+    CF_PrioIndex_t *pi   = CF_GetPrioIndex(chan, txn->flags.com.q_index);
+    CF_CListNode_t *prev;
+
+    if (pi && pi->tail[txn->priority] == &txn->cl_node)
+    {
+        /* the one before it ends the run now, unless this one was the whole run */
+        prev = txn->cl_node.prev;
+        if ((chan->qs[txn->flags.com.q_index] != &txn->cl_node) &&
+            (container_of(prev, CF_Transaction_t, cl_node)->priority == txn->priority))
         {
-            CF_CList_InsertAfter_Ex(chan, queue, &arg.txn->cl_node, &txn->cl_node);
+            pi->tail[txn->priority] = prev;
         }
         else
         {
-            insert_back = true;
+            pi->tail[txn->priority] = NULL;
+            pi->nonempty[txn->priority / 32] &= ~(1U << (txn->priority % 32));
         }
     }
-
-    if (insert_back)
-    {
-        CF_CList_InsertBack_Ex(chan, queue, &txn->cl_node);
-    }
-    txn->flags.com.q_index = queue;
 }
 
 /*----------------------------------------------------------------
@@ -496,6 +596,42 @@ CFE_Status_t CF_WrappedLseek(osal_id_t fd, off_t offset, int mode)
     return ret;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in cf_utils.h for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CF_WrappedSeekTo(osal_id_t fd, CF_FileSize_t offset)
+{
+    CF_FileSize_t pos  = 0;
+    CF_FileSize_t step;
+    int           mode = OS_SEEK_SET;
+    CFE_Status_t  status;
+    CFE_Status_t  ret = CFE_SUCCESS;
+
+    do
+    {
+        step = offset - pos;
+        if (step > CF_SEEK_STEP_SIZE)
+        {
+            step = CF_SEEK_STEP_SIZE;
+        }
+        pos += step;
+
+        /* past 2 GiB the position returned is truncated, but its low bits still show it got there */
+        status = CF_WrappedLseek(fd, step, mode);
+        if ((uint32)status != (uint32)pos)
+        {
+            ret = (status < 0) ? status : CF_ERROR;
+        }
+
+        mode = OS_SEEK_CUR;
+    } while ((ret == CFE_SUCCESS) && (pos < offset));
+
+    return ret;
+}
+
 /*----------------------------------------------------------------
  *
  * Function: CF_TxnStatus_IsError
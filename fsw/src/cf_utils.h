@@ -43,42 +43,6 @@ typedef struct CF_Traverse_TransSeqArg
     CF_Transaction_t *  txn; /**< \brief output transaction pointer */
 } CF_Traverse_TransSeqArg_t;
 
-/**
- * @brief Argument structure for use with CF_Traverse_WriteHistoryQueueEntryToFile()
- *
- * This is used for writing status files.  It contains a designated
- * file descriptor for output and counters.
- *
- * When traversing history, the list contains all entries, and may need additional
- * filtering for direction (TX/RX) depending on what information the user has requested.
- */
-typedef struct CF_Traverse_WriteHistoryFileArg
-{
-    osal_id_t      fd;
-    CF_Direction_t filter_dir;
-
-    bool   error;   /**< \brief Will be set to true if any write failed */
-    uint32 counter; /**< \brief Total number of entries written */
-} CF_Traverse_WriteHistoryFileArg_t;
-
-/**
- * @brief Argument structure for use with CF_Traverse_WriteTxnQueueEntryToFile()
- *
- * This is used for writing status files.  It contains a designated
- * file descriptor for output and counters.
- *
- * When traversing transactions, the entire list is written to the file.
- * No additional filtering is necessary, because the queues themselves are
- * limited in what they contain (therefore "pre-filtered" to some degree).
- */
-typedef struct CF_Traverse_WriteTxnFileArg
-{
-    osal_id_t fd;
-
-    bool   error;   /**< \brief Will be set to true if any write failed */
-    uint32 counter; /**< \brief Total number of entries written */
-} CF_Traverse_WriteTxnFileArg_t;
-
 /**
  * @brief Callback function type for use with CF_TraverseAllTransactions()
  *
@@ -99,16 +63,31 @@ typedef struct CF_TraverseAll_Arg
     int32                           counter; /**< \brief Running tally of all nodes traversed from all lists */
 } CF_TraverseAll_Arg_t;
 
-/**
- * @brief Argument structure for use with CF_CList_Traverse_R()
+/************************************************************************/
+/** @brief Removes a transaction from the priority index of its queue.
  *
- * This is for searching for transactions of a specific priority
+ * @par Description
+ *       Keeps the index of a priority sorted queue in step when a
+ *       transaction leaves it. Must be called while the transaction
+ *       is still on the queue.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       txn must not be NULL. Does nothing if the transaction is not on a
+ *       priority sorted queue.
+ *
+ * @param txn  Pointer to the transaction object
  */
-typedef struct CF_Traverse_PriorityArg
+void CF_RemoveTransactionPrio(CF_Transaction_t *txn);
+
+/* called before a node leaves a channel queue, so a queue file
+ * being written resumes from the entry after it instead */
+static inline void CF_Dump_Unlink(const CF_CListNode_t *head, const CF_CListNode_t *node)
 {
-    CF_Transaction_t *txn; /**< \brief OUT: holds value of transaction with which to call CF_CList_InsertAfter on */
-    uint8             priority; /**< \brief seeking this priority */
-} CF_Traverse_PriorityArg_t;
+    if (CF_AppData.dump.next == node)
+    {
+        CF_AppData.dump.next = (node->next != head) ? node->next : NULL;
+    }
+}
 
 /* free a transaction from the queue it's on.
  * NOTE: this leaves the transaction in a bad state,
@@ -122,6 +101,8 @@ typedef struct CF_Traverse_PriorityArg
 static inline void CF_DequeueTransaction(CF_Transaction_t *txn)
 {
     CF_Assert(txn && (txn->chan_num < CF_NUM_CHANNELS));
+    CF_RemoveTransactionPrio(txn);
+    CF_Dump_Unlink(CF_AppData.engine.channels[txn->chan_num].qs[txn->flags.com.q_index], &txn->cl_node);
     CF_CList_Remove(&CF_AppData.engine.channels[txn->chan_num].qs[txn->flags.com.q_index], &txn->cl_node);
     CF_Assert(CF_AppData.hk.Payload.channel_hk[txn->chan_num].q_size[txn->flags.com.q_index]); /* sanity check */
     --CF_AppData.hk.Payload.channel_hk[txn->chan_num].q_size[txn->flags.com.q_index];
@@ -130,6 +111,8 @@ static inline void CF_DequeueTransaction(CF_Transaction_t *txn)
 static inline void CF_MoveTransaction(CF_Transaction_t *txn, CF_QueueIdx_t queue)
 {
     CF_Assert(txn && (txn->chan_num < CF_NUM_CHANNELS));
+    CF_RemoveTransactionPrio(txn);
+    CF_Dump_Unlink(CF_AppData.engine.channels[txn->chan_num].qs[txn->flags.com.q_index], &txn->cl_node);
     CF_CList_Remove(&CF_AppData.engine.channels[txn->chan_num].qs[txn->flags.com.q_index], &txn->cl_node);
     CF_Assert(CF_AppData.hk.Payload.channel_hk[txn->chan_num].q_size[txn->flags.com.q_index]); /* sanity check */
     --CF_AppData.hk.Payload.channel_hk[txn->chan_num].q_size[txn->flags.com.q_index];
@@ -140,6 +123,7 @@ static inline void CF_MoveTransaction(CF_Transaction_t *txn, CF_QueueIdx_t queue
 
 static inline void CF_CList_Remove_Ex(CF_Channel_t *chan, CF_QueueIdx_t queueidx, CF_CListNode_t *node)
 {
+    CF_Dump_Unlink(chan->qs[queueidx], node);
     CF_CList_Remove(&chan->qs[queueidx], node);
     CF_Assert(CF_AppData.hk.Payload.channel_hk[chan - CF_AppData.engine.channels].q_size[queueidx]); /* sanity check */
     --CF_AppData.hk.Payload.channel_hk[chan - CF_AppData.engine.channels].q_size[queueidx];
@@ -152,6 +136,12 @@ static inline void CF_CList_InsertAfter_Ex(CF_Channel_t *chan, CF_QueueIdx_t que
     ++CF_AppData.hk.Payload.channel_hk[chan - CF_AppData.engine.channels].q_size[queueidx];
 }
 
+static inline void CF_CList_InsertFront_Ex(CF_Channel_t *chan, CF_QueueIdx_t queueidx, CF_CListNode_t *node)
+{
+    CF_CList_InsertFront(&chan->qs[queueidx], node);
+    ++CF_AppData.hk.Payload.channel_hk[chan - CF_AppData.engine.channels].q_size[queueidx];
+}
+
 static inline void CF_CList_InsertBack_Ex(CF_Channel_t *chan, CF_QueueIdx_t queueidx, CF_CListNode_t *node)
 {
     CF_CList_InsertBack(&chan->qs[queueidx], node);
@@ -186,6 +176,24 @@ CF_Transaction_t *CF_FindUnusedTransaction(CF_Channel_t *chan);
  */
 void CF_ResetHistory(CF_Channel_t *chan, CF_History_t *history);
 
+/************************************************************************/
+/** @brief Keeps the file names of a finished transaction with its history.
+ *
+ * @par Description
+ *       The names go in the channel name arena.  While they do not fit, the
+ *       oldest entries on CF_QueueIdx_HIST are recycled to make room.  If the
+ *       history queue runs out first, the entry is kept without names.
+ *
+ * @par Assumptions, External Events, and Notes:
+ *       chan must not be NULL. history must not be NULL. fnames must not be NULL.
+ *       history must not be on CF_QueueIdx_HIST yet.
+ *
+ * @param chan Pointer to the CF channel
+ * @param history Pointer to the history entry
+ * @param fnames File names of the transaction
+ */
+void CF_StoreHistoryNames(CF_Channel_t *chan, CF_History_t *history, const CF_TxnFilenames_t *fnames);
+
 /************************************************************************/
 /** @brief Frees and resets a transaction and returns it for later use.
  *
@@ -197,103 +205,110 @@ void CF_ResetHistory(CF_Channel_t *chan, CF_History_t *history);
 void CF_FreeTransaction(CF_Transaction_t *txn);
 
 /************************************************************************/
-/** @brief Finds an active transaction by sequence number.
+/** @brief Adds a transaction to its channel's sequence number lookup index.
  *
  * @par Description
- *       This function traverses the active rx, pending, txa, and txw
- *       transaction and looks for the requested transaction.
+ *       The transaction is indexed by the (src_eid, seq_num) tuple currently
+ *       in its history. This must be called whenever those values are assigned.
+ *       If the transaction is already indexed, it is first removed, so calling
+ *       this again after the tuple changes is safe.
  *
  * @par Assumptions, External Events, and Notes:
- *       chan must not be NULL.
+ *       chan must not be NULL. txn must not be NULL, and txn->history must be set.
  *
  * @param chan Pointer to the CF channel
- * @param transaction_sequence_number  Sequence number to find
- * @param src_eid                      Entity ID associated with sequence number
- *
- * @returns Pointer to the given transaction if found
- * @retval  NULL if the transaction is not found
+ * @param txn  Pointer to the transaction object
  */
-CF_Transaction_t *CF_FindTransactionBySequenceNumber(CF_Channel_t *      chan,
-                                                     CF_TransactionSeq_t transaction_sequence_number,
-                                                     CF_EntityId_t       src_eid);
+void CF_InsertTransactionIndex(CF_Channel_t *chan, CF_Transaction_t *txn);
 
 /************************************************************************/
-/** @brief List traversal function to check if the desired sequence number matches.
+/** @brief Removes a transaction from its channel's sequence number lookup index.
  *
  * @par Assumptions, External Events, and Notes:
- *       context must not be NULL. node must not be NULL.
- *
- * @param node         Pointer to node currently being traversed
- * @param context   Pointer to state object passed through from initial call
- *
- * @retval 1 when it's found, which terminates list traversal
- * @retval 0 when it isn't found, which causes list traversal to continue
+ *       txn must not be NULL. Does nothing if the transaction is not indexed.
  *
+ * @param txn  Pointer to the transaction object
  */
-CFE_Status_t CF_FindTransactionBySequenceNumber_Impl(CF_CListNode_t *node, CF_Traverse_TransSeqArg_t *context);
+void CF_RemoveTransactionIndex(CF_Transaction_t *txn);
 
 /************************************************************************/
-/** @brief Write a single history to a file.
+/** @brief Adds a transaction to its channel's tick list.
  *
- * This creates a human-readable/string representation of the information in the
- * history object, and writes that string to the indicated file.
- *
- * This implements the common code between writing the history queue and transaction
- * queue to a file, as both ultimately store the same information in a CF_History_t
- * object, but have a different method to get to it.
+ * @par Description
+ *       Only the transactions on the tick list are looked at by
+ *       CF_CFDP_TickTransactions(). This must be called whenever one of the
+ *       transaction's timers expires, or it has something to send from tick
+ *       processing. Senders go on the TX list and receivers on the RX list.
+ *       Does nothing if the transaction is already on the tick list.
  *
  * @par Assumptions, External Events, and Notes:
- *       fd should be a valid file descriptor, open for writing.
+ *       chan must not be NULL. txn must not be NULL.
  *
- * @param fd Open File descriptor to write to
- * @param history  Pointer to CF history object to write
+ * @param chan Pointer to the CF channel
+ * @param txn  Pointer to the transaction object
+ */
+void CF_InsertTransactionTick(CF_Channel_t *chan, CF_Transaction_t *txn);
+
+/************************************************************************/
+/** @brief Removes a transaction from its channel's tick list.
  *
- * @retval CFE_SUCCESS on success
- * @retval CF_ERROR on error
+ * @par Assumptions, External Events, and Notes:
+ *       txn must not be NULL. Does nothing if the transaction is not on the tick list.
+ *
+ * @param txn  Pointer to the transaction object
  */
-CFE_Status_t CF_WriteHistoryEntryToFile(osal_id_t fd, const CF_History_t *history);
+void CF_RemoveTransactionTick(CF_Transaction_t *txn);
 
 /************************************************************************/
-/** @brief Write a transaction-based queue's transaction history to a file.
+/** @brief Finds an active transaction by sequence number.
+ *
+ * @par Description
+ *       This function looks up the requested transaction in the channel's
+ *       (src_eid, seq_num) index, which holds the active rx, pending, txa,
+ *       and txw transactions. Only the matching hash bucket is searched.
  *
  * @par Assumptions, External Events, and Notes:
  *       chan must not be NULL.
  *
- * @param fd Open File descriptor to write to
- * @param chan  Pointer to associated CF channel object
- * @param queue  Queue Index to write
+ * @param chan Pointer to the CF channel
+ * @param transaction_sequence_number  Sequence number to find
+ * @param src_eid                      Entity ID associated with sequence number
  *
- * @retval 0 on success
- * @retval 1 on error
+ * @returns Pointer to the given transaction if found
+ * @retval  NULL if the transaction is not found
  */
-CFE_Status_t CF_WriteTxnQueueDataToFile(osal_id_t fd, CF_Channel_t *chan, CF_QueueIdx_t queue);
+CF_Transaction_t *CF_FindTransactionBySequenceNumber(CF_Channel_t *      chan,
+                                                     CF_TransactionSeq_t transaction_sequence_number,
+                                                     CF_EntityId_t       src_eid);
 
 /************************************************************************/
-/** @brief Write a history-based queue's entries to a file.
+/** @brief List traversal function to check if the desired sequence number matches.
  *
  * @par Assumptions, External Events, and Notes:
- *       chan must not be NULL.
+ *       context must not be NULL. node must not be NULL.
  *
- * @param fd  Open File descriptor to write to
- * @param chan   Pointer to associated CF channel object
- * @param dir Direction to match/filter
+ * @param node         Pointer to node currently being traversed
+ * @param context   Pointer to state object passed through from initial call
+ *
+ * @retval 1 when it's found, which terminates list traversal
+ * @retval 0 when it isn't found, which causes list traversal to continue
  *
- * @retval 0 on success
- * @retval 1 on error
  */
-CFE_Status_t CF_WriteHistoryQueueDataToFile(osal_id_t fd, CF_Channel_t *chan, CF_Direction_t dir);
+CFE_Status_t CF_FindTransactionBySequenceNumber_Impl(CF_CListNode_t *node, CF_Traverse_TransSeqArg_t *context);
 
 /************************************************************************/
 /** @brief Insert a transaction into a priority sorted transaction queue.
  *
  * @par Description
- *       This function works by walking the queue in reverse to find a
- *       transaction with a higher priority than the given transaction.
- *       The given transaction is then inserted after that one, since it
- *       would be the next lower priority.
+ *       The transaction goes after the last one on the queue with the
+ *       same or higher priority (lower or equal value), so the queue
+ *       stays in priority order and FIFO within each priority. That
+ *       position is found from the queue's priority index rather than
+ *       by walking the queue. If there is none, it goes on the front.
  *
  * @par Assumptions, External Events, and Notes:
- *       txn must not be NULL.
+ *       txn must not be NULL. queue must be CF_QueueIdx_PEND or
+ *       CF_QueueIdx_TXW, the queues with a priority index.
  *
  * @param txn  Pointer to the transaction object
  * @param queue  Index of queue to insert into
@@ -344,58 +359,6 @@ int32 CF_TraverseAllTransactions_All_Channels(CF_TraverseAllTransactions_fn_t fn
  */
 CF_CListTraverse_Status_t CF_TraverseAllTransactions_Impl(CF_CListNode_t *node, void *arg);
 
-/************************************************************************/
-/** @brief Writes a human readable representation of a history queue entry to a file
- *
- * This function is a wrapper around CF_WriteHistoryEntryToFile() that can be used with
- * CF_Traverse() to write history queue entries to the file.
- *
- * This also implements a direction filter, so only matching entries are actually written
- * to the file.
- *
- * @par Assumptions, External Events, and Notes:
- *       node must not be NULL. arg must not be NULL.
- *
- * @param node   Node being currently traversed
- * @param arg Pointer to CF_Traverse_WriteHistoryFileArg_t indicating the file information
- *
- * @retval CF_CLIST_CONT if everything is going well
- * @retval CF_CLIST_EXIT if a write error occurred, which means traversal should stop
- */
-CF_CListTraverse_Status_t CF_Traverse_WriteHistoryQueueEntryToFile(CF_CListNode_t *node, void *arg);
-
-/************************************************************************/
-/** @brief Writes a human readable representation of a transaction history entry to a file
- *
- * This function is a wrapper around CF_WriteHistoryEntryToFile() that can be used with
- * CF_Traverse() to write transaction queue entries to the file.
- *
- * @par Assumptions, External Events, and Notes:
- *       node must not be NULL. arg must not be NULL.
- *
- * @param node   Node being currently traversed
- * @param arg Pointer to CF_Traverse_WriteTxnFileArg_t indicating the file information
- *
- * @retval CF_CLIST_CONT if everything is going well
- * @retval CF_CLIST_EXIT if a write error occurred, which means traversal should stop
- */
-CF_CListTraverse_Status_t CF_Traverse_WriteTxnQueueEntryToFile(CF_CListNode_t *node, void *arg);
-
-/************************************************************************/
-/** @brief Searches for the first transaction with a lower priority than given.
- *
- * @par Assumptions, External Events, and Notes:
- *       node must not be NULL. context must not be NULL.
- *
- * @param node    Node being currently traversed
- * @param context Pointer to CF_Traverse_PriorityArg_t object indicating the priority to search for
- *
- * @retval CF_CLIST_EXIT when it's found, which terminates list traversal
- * @retval CF_CLIST_CONT when it isn't found, which causes list traversal to continue
- *
- */
-CF_CListTraverse_Status_t CF_PrioSearch(CF_CListNode_t *node, void *context);
-
 /************************************************************************/
 /** @brief Wrap the filesystem open call with a perf counter.
  *
@@ -474,6 +437,23 @@ CFE_Status_t CF_WrappedWrite(osal_id_t fd, const void *buf, size_t write_size);
  */
 CFE_Status_t CF_WrappedLseek(osal_id_t fd, off_t offset, int mode);
 
+/************************************************************************/
+/** @brief Seek to a file offset, including one past the range of OS_lseek().
+ *
+ * @par Description
+ *       OS_lseek() takes and returns 32-bit positions, so large file offsets
+ *       are reached with a seek from the start followed by relative seeks,
+ *       each checked against the position expected.
+ *
+ * @param fd         File to seek
+ * @param offset     Offset from the start of the file
+ *
+ * @retval CFE_SUCCESS if the file is now at offset
+ * @retval CF_ERROR if a seek ended anywhere else
+ * @returns Error code from OSAL if a seek failed
+ */
+CFE_Status_t CF_WrappedSeekTo(osal_id_t fd, CF_FileSize_t offset);
+
 /************************************************************************/
 /** @brief Converts the internal transaction status to a CFDP condition code
  *
@@ -43,6 +43,71 @@
 #error refactor code for 32 bit CF_NUM_HISTORIES
 #endif
 
+#if (CF_NUM_TRANSACTION_HASH_BUCKETS_PER_CHAN == 0) || \
+    ((CF_NUM_TRANSACTION_HASH_BUCKETS_PER_CHAN & (CF_NUM_TRANSACTION_HASH_BUCKETS_PER_CHAN - 1)) != 0)
+#error CF_NUM_TRANSACTION_HASH_BUCKETS_PER_CHAN must be a power of two
+#endif
+
+#if CF_NUM_SEND_READ_AHEAD_BUFFERS_PER_CHAN == 0
+#error Must have at least one send read-ahead buffer per channel.
+#endif
+
+#if (CF_SEND_READ_AHEAD_SIZE == 0) || ((CF_SEND_READ_AHEAD_SIZE & (CF_SEND_READ_AHEAD_SIZE - 1)) != 0)
+#error CF_SEND_READ_AHEAD_SIZE must be a power of two
+#endif
+
+#if CF_NUM_RECV_WRITE_BEHIND_BUFFERS_PER_CHAN == 0
+#error Must have at least one receive write-behind buffer per channel.
+#endif
+
+#if CF_RECV_WRITE_BEHIND_SIZE < CF_MAX_PDU_SIZE
+#error CF_RECV_WRITE_BEHIND_SIZE must be at least CF_MAX_PDU_SIZE
+#endif
+
+#if CF_NUM_RECV_BITMAPS_PER_CHAN == 0
+#error Must have at least one receive bitmap per channel.
+#endif
+
+#if (CF_RECV_BITMAP_SIZE == 0) || ((CF_RECV_BITMAP_SIZE % 4) != 0)
+#error CF_RECV_BITMAP_SIZE must be a nonzero multiple of 4
+#endif
+
+#if (CF_RX_RING_DEPTH_PER_CHAN == 0) || ((CF_RX_RING_DEPTH_PER_CHAN & (CF_RX_RING_DEPTH_PER_CHAN - 1)) != 0)
+#error CF_RX_RING_DEPTH_PER_CHAN must be a power of two
+#endif
+
+#if CF_RX_RING_DEPTH_PER_CHAN > 32768
+#error CF_RX_RING_DEPTH_PER_CHAN must fit the 16 bit ring occupancy counters
+#endif
+
+#if (CF_TX_DRR_MAX_QUANTUM == 0) || (CF_TX_DRR_MAX_QUANTUM > 255)
+#error CF_TX_DRR_MAX_QUANTUM must be from 1 to 255
+#endif
+
+#if (CF_OUTPUT_BATCH_PER_CHAN == 0) || (CF_OUTPUT_BATCH_PER_CHAN > 255)
+#error CF_OUTPUT_BATCH_PER_CHAN must be from 1 to 255
+#endif
+
+#if (CF_NAME_ARENA_SIZE < 256) || ((CF_NAME_ARENA_SIZE % 2) != 0)
+#error CF_NAME_ARENA_SIZE must be an even number of at least 256
+#endif
+
+#if (CF_NAME_DIRS_PER_CHAN == 0) || (CF_NAME_DIRS_PER_CHAN > 254)
+#error CF_NAME_DIRS_PER_CHAN must be from 1 to 254
+#endif
+
+#if CF_QUEUE_FILE_BUFFER_SIZE < ((CFE_MISSION_MAX_PATH_LEN * 2) + 128)
+#error CF_QUEUE_FILE_BUFFER_SIZE must hold at least one queue file entry
+#endif
+
+#if CF_QUEUE_FILE_ENTRIES_PER_WAKEUP < 1
+#error CF_QUEUE_FILE_ENTRIES_PER_WAKEUP must be at least 1
+#endif
+
+#if CF_CHUNK_BLOCK_SIZE < 1
+#error CF_CHUNK_BLOCK_SIZE must be at least 1
+#endif
+
 #if (CF_PERF_ID_PDURCVD(CF_NUM_CHANNELS - 1) >= CF_PERF_ID_PDUSENT(0))
 #error Collision between CF_PERF_ID_PDURCVD and CF_PERF_ID_PDUSENT given number of channels
 #endif
@@ -58,7 +58,20 @@ CF_ConfigTable_t CF_config_table = {
           }},
          "",            /* throttle sem, empty string means no throttle */
          1,             /* dequeue enable flag (1 = enabled) */
-         .move_dir = "" /* If not empty, will attempt move instead of delete on TX file complete */
+         .move_dir                      = "",  /* If not empty, attempt move instead of delete on TX file complete */
+         .checksum_type                 = 0,   /* checksum type for sent files (0 = modular) */
+         .rx_task_enabled               = 0,   /* receive child task enable flag (1 = enabled) */
+         .rx_bitmap_enabled             = 0,   /* receive bitmap enable flag (1 = enabled) */
+         .max_outgoing_bytes_per_second = 0,   /* output byte rate limit (0 = unlimited) */
+         .tx_drr_enabled                = 0,   /* round-robin send scheduling enable flag (1 = enabled) */
+         .max_active_tx                 = 4,   /* concurrently active send transactions when round-robin */
+         .max_transactions              = 0,   /* transaction pool size (0 = compile-time default) */
+         .max_histories                 = 0,   /* history pool size (0 = compile-time default) */
+         .rx_max_chunks                 = 0,   /* chunk pool share per receive transaction (0 = compile-time default) */
+         .tx_max_chunks                 = 0,   /* chunk pool share per send transaction (0 = compile-time default) */
+         .worker_task_enabled           = 0,   /* worker child task enable flag (1 = enabled) */
+         .rx_immediate_nak_ticks        = 0,   /* min wakeups between immediate class 2 NAKs (0 = disabled) */
+         .txn_max_chunks                = 1024 /* most chunks one transaction may take from the pool (0 = no cap) */
      },
      {        /* channel 1 */
       5,      /* max number of outgoing messages per wakeup */
@@ -77,7 +90,20 @@ CF_ConfigTable_t CF_config_table = {
        }},
       "", /* throttle sem, empty string means no throttle */
       1,  /* dequeue enable flag (1 = enabled) */
-      .move_dir = ""}},
+      .move_dir                      = "",
+      .checksum_type                 = 0,
+      .rx_task_enabled               = 0,
+      .rx_bitmap_enabled             = 0,
+      .max_outgoing_bytes_per_second = 0,
+      .tx_drr_enabled                = 0,
+      .max_active_tx                 = 4,
+      .max_transactions              = 0,
+      .max_histories                 = 0,
+      .rx_max_chunks                 = 0,
+      .tx_max_chunks                 = 0,
+      .worker_task_enabled           = 0,
+      .rx_immediate_nak_ticks        = 0,
+      .txn_max_chunks                = 1024}},
     480,       /* outgoing_file_chunk_size */
     "/cf/tmp", /* temporary file directory */
     "/cf/fail", /* Stores failed tx file for "polling directory" */
@@ -157,12 +157,17 @@ CF_ConfigTable_t table;
 /* CF_ValidateConfigTable tests specific functions */
 void cf_config_table_tests_set_table_to_nominal(void)
 {
+    /* channel values of zero select the compile-time defaults, which are nominal */
+    memset(&table, 0, sizeof(table));
+
     /* all values for table.ticks_per_second nominal except 0 */
     table.ticks_per_second = Any_uint32_Except(0);
     /* all values (except 0) & 3ff == 0 are nominal (1024 byte aligned) */
     table.rx_crc_calc_bytes_per_wakeup = Any_uint32_Except(0) << 10;
     /* all values less than sizeof(CF_CFDP_PduFileDataContent_t) are nominal */
     table.outgoing_file_chunk_size = Any_uint16_LessThan(sizeof(CF_CFDP_PduFileDataContent_t));
+    /* all channel checksum types nominal */
+    UT_SetDefaultReturnValue(UT_KEY(CF_CRC_IsSupported), true);
 }
 
 void Setup_cf_config_table_tests(void)
@@ -241,6 +246,60 @@ void Test_CF_ValidateConfigTable_FailBecauseOutgoingFileChunkSmallerThanDataArra
     UtAssert_INT32_EQ(result, CFE_STATUS_VALIDATION_FAILURE);
 }
 
+void Test_CF_ValidateConfigTable_FailBecauseChecksumTypeUnsupported(void)
+{
+    /* Arrange */
+    CF_ConfigTable_t *arg_table = &table;
+    int32             result;
+
+    arg_table->ticks_per_second             = 1;
+    arg_table->rx_crc_calc_bytes_per_wakeup = 0x0400; /* 1024 aligned */
+    arg_table->outgoing_file_chunk_size     = sizeof(CF_CFDP_PduFileDataContent_t);
+    UT_SetDeferredRetcode(UT_KEY(CF_CRC_IsSupported), 1, false);
+
+    /* Act */
+    result = CF_ValidateConfigTable(arg_table);
+
+    /* Assert */
+    UtAssert_INT32_EQ(result, CFE_STATUS_VALIDATION_FAILURE);
+    UT_CF_AssertEventID(CF_INIT_CHECKSUM_TYPE_ERR_EID);
+}
+
+void Test_CF_ValidateConfigTable_FailBecauseChannelPoolsInvalid(void)
+{
+    /* Arrange */
+    CF_ConfigTable_t *arg_table = &table;
+
+    arg_table->ticks_per_second             = 1;
+    arg_table->rx_crc_calc_bytes_per_wakeup = 0x0400; /* 1024 aligned */
+    arg_table->outgoing_file_chunk_size     = sizeof(CF_CFDP_PduFileDataContent_t);
+
+    /* fewer histories than transactions */
+    arg_table->chan[CF_NUM_CHANNELS - 1].max_transactions = 10;
+    arg_table->chan[CF_NUM_CHANNELS - 1].max_histories    = 9;
+    UtAssert_INT32_EQ(CF_ValidateConfigTable(arg_table), CFE_STATUS_VALIDATION_FAILURE);
+    UT_CF_AssertEventID(CF_INIT_POOL_CFG_ERR_EID);
+
+    /* just as many is enough, as is the default history count */
+    arg_table->chan[CF_NUM_CHANNELS - 1].max_histories = 10;
+    UtAssert_INT32_EQ(CF_ValidateConfigTable(arg_table), CFE_SUCCESS);
+    arg_table->chan[CF_NUM_CHANNELS - 1].max_histories = 0;
+    UtAssert_INT32_EQ(CF_ValidateConfigTable(arg_table), CFE_SUCCESS);
+
+    /* more active sends allowed than there are transactions */
+    arg_table->chan[CF_NUM_CHANNELS - 1].max_active_tx = 11;
+    UtAssert_INT32_EQ(CF_ValidateConfigTable(arg_table), CFE_STATUS_VALIDATION_FAILURE);
+    arg_table->chan[CF_NUM_CHANNELS - 1].max_active_tx = 10;
+    UtAssert_INT32_EQ(CF_ValidateConfigTable(arg_table), CFE_SUCCESS);
+
+    /* flags other than 0 or 1 */
+    arg_table->chan[0].worker_task_enabled = 2;
+    UtAssert_INT32_EQ(CF_ValidateConfigTable(arg_table), CFE_STATUS_VALIDATION_FAILURE);
+    arg_table->chan[0].worker_task_enabled = 0;
+    arg_table->chan[0].tx_drr_enabled      = 2;
+    UtAssert_INT32_EQ(CF_ValidateConfigTable(arg_table), CFE_STATUS_VALIDATION_FAILURE);
+}
+
 void Test_CF_ValidateConfigTable_Success(void)
 {
     /* Arrange */
@@ -446,6 +505,7 @@ void Test_CF_AppInit_Success(void)
 
     /* Assert */
     UtAssert_STUB_COUNT(CFE_MSG_Init, 1);
+    UtAssert_STUB_COUNT(CF_CRC_Init, 1);
 }
 
 /*******************************************************************************
@@ -582,6 +642,10 @@ void add_CF_ValidateConfigTable_tests(void)
     UtTest_Add(Test_CF_ValidateConfigTable_FailBecauseOutgoingFileChunkSmallerThanDataArray,
                Setup_cf_config_table_tests, CF_App_Tests_Teardown,
                "Test_CF_ValidateConfigTable_FailBecauseOutgoingFileChunkSmallerThanDataArray");
+    UtTest_Add(Test_CF_ValidateConfigTable_FailBecauseChecksumTypeUnsupported, Setup_cf_config_table_tests,
+               CF_App_Tests_Teardown, "Test_CF_ValidateConfigTable_FailBecauseChecksumTypeUnsupported");
+    UtTest_Add(Test_CF_ValidateConfigTable_FailBecauseChannelPoolsInvalid, Setup_cf_config_table_tests,
+               CF_App_Tests_Teardown, "Test_CF_ValidateConfigTable_FailBecauseChannelPoolsInvalid");
     UtTest_Add(Test_CF_ValidateConfigTable_Success, Setup_cf_config_table_tests, CF_App_Tests_Teardown,
                "Test_CF_ValidateConfigTable_Success");
 }
@@ -176,14 +176,18 @@ void Test_CF_CFDP_R_Tick(void)
     /* Test case for:
      * void CF_CFDP_R_Tick(CF_Transaction_t *txn, int *cont);
      */
-    CF_Transaction_t *txn;
-    CF_ConfigTable_t *config;
-    int               cont;
+    CF_Transaction_t *      txn;
+    CF_ConfigTable_t *      config;
+    CF_Logical_PduBuffer_t *ph;
+    CF_ChunkWrapper_t       chunks;
+    int                     cont;
+
+    memset(&chunks, 0, sizeof(chunks));
 
-    /* nominal, not in R2 state - just ticks */
+    /* nominal, not in R2 state - nothing expired */
     UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, &txn, NULL);
     UtAssert_VOIDCALL(CF_CFDP_R_Tick(txn, &cont));
-    UtAssert_STUB_COUNT(CF_Timer_Tick, 1);
+    UtAssert_STUB_COUNT(CF_CFDP_ResetTransaction, 0);
 
     /* not in R2 state, timer expired */
     UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, &txn, NULL);
@@ -195,7 +199,7 @@ void Test_CF_CFDP_R_Tick(void)
     UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, &txn, NULL);
     txn->state = CF_TxnState_R2;
     UtAssert_VOIDCALL(CF_CFDP_R_Tick(txn, &cont));
-    UtAssert_STUB_COUNT(CF_Timer_Tick, 2);
+    UtAssert_BOOL_FALSE(txn->flags.rx.inactivity_fired);
 
     /* in R2 state, timer expired */
     UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, &txn, NULL);
@@ -257,13 +261,59 @@ void Test_CF_CFDP_R_Tick(void)
     UtAssert_VOIDCALL(CF_CFDP_R_Tick(txn, &cont));
     UtAssert_BOOL_TRUE(txn->flags.rx.send_fin);
 
+    /* in R2 state, send_imm_nak set, sends the NAK up to the waiting scope */
+    UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_TX, &ph, NULL, NULL, &txn, NULL);
+    UT_ResetState(UT_KEY(CF_CFDP_SendNak));
+    UT_SetDeferredRetcode(UT_KEY(CF_ChunkList_ComputeGaps), 1, 1);
+    txn->chunks                               = &chunks;
+    txn->state                                = CF_TxnState_R2;
+    txn->flags.rx.send_imm_nak                = true;
+    txn->flags.rx.inactivity_fired            = true;
+    txn->state_data.receive.r2.imm_nak_scope  = 300;
+    UtAssert_VOIDCALL(CF_CFDP_R_Tick(txn, &cont));
+    UtAssert_BOOL_FALSE(txn->flags.rx.send_imm_nak);
+    UtAssert_STUB_COUNT(CF_CFDP_SendNak, 1);
+    UtAssert_UINT32_EQ(ph->int_header.nak.scope_end, 300);
+    UtAssert_UINT32_EQ(txn->state_data.receive.r2.imm_nak_end, 300);
+
+    /* same as above, but no buffer: kept for the next tick, where the tick list resumes */
+    UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, &txn, NULL);
+    txn->chunks                              = &chunks;
+    txn->state                               = CF_TxnState_R2;
+    txn->flags.rx.send_imm_nak               = true;
+    txn->flags.rx.inactivity_fired           = true;
+    txn->state_data.receive.r2.imm_nak_scope = 300;
+    UtAssert_VOIDCALL(CF_CFDP_R_Tick(txn, &cont));
+    UtAssert_BOOL_TRUE(txn->flags.rx.send_imm_nak);
+    UtAssert_ZERO(txn->state_data.receive.r2.imm_nak_end);
+
+    /* no gaps left to request, nothing to send */
+    UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, NULL, &txn, NULL);
+    txn->chunks                    = &chunks;
+    txn->state                     = CF_TxnState_R2;
+    txn->flags.rx.send_imm_nak     = true;
+    txn->flags.rx.inactivity_fired = true;
+    UtAssert_VOIDCALL(CF_CFDP_R_Tick(txn, &cont));
+    UtAssert_BOOL_FALSE(txn->flags.rx.send_imm_nak);
+    UtAssert_STUB_COUNT(CF_CFDP_SendNak, 1);
+
+    /* once the EOF is in it is dropped, the regular NAK covers it */
+    UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, NULL, &txn, NULL);
+    txn->state                     = CF_TxnState_R2;
+    txn->flags.rx.send_imm_nak     = true;
+    txn->flags.rx.eof_recv         = true;
+    txn->flags.rx.inactivity_fired = true;
+    UtAssert_VOIDCALL(CF_CFDP_R_Tick(txn, &cont));
+    UtAssert_BOOL_FALSE(txn->flags.rx.send_imm_nak);
+    UtAssert_STUB_COUNT(CF_CFDP_SendNak, 1);
+
     /* in R2 state, ack_timer_armed set */
     UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, NULL, &txn, NULL);
     txn->state                     = CF_TxnState_R2;
     txn->flags.com.ack_timer_armed = true;
     txn->flags.rx.inactivity_fired = true;
     UtAssert_VOIDCALL(CF_CFDP_R_Tick(txn, &cont));
-    UtAssert_STUB_COUNT(CF_Timer_Tick, 3);
+    UtAssert_STUB_COUNT(CF_CFDP_ArmAckTimer, 0);
 
     /* in R2 state, ack_timer_armed set, timer expires */
     UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, NULL, &txn, NULL);
@@ -322,6 +372,7 @@ void Test_CF_CFDP_R_Cancel(void)
      * void CF_CFDP_R_Cancel(CF_Transaction_t *txn);
      */
     CF_Transaction_t *txn;
+    CF_WriteBehind_t  wb;
 
     /* nominal, calls reset */
     UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_RX, NULL, NULL, NULL, &txn, NULL);
@@ -340,6 +391,16 @@ void Test_CF_CFDP_R_Cancel(void)
     txn->state_data.receive.sub_state = CF_RxSubState_WAIT_FOR_FIN_ACK;
     UtAssert_VOIDCALL(CF_CFDP_R_Cancel(txn));
     UtAssert_STUB_COUNT(CF_CFDP_ResetTransaction, 2);
+
+    /* buffered file data is written out */
+    UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_RX, NULL, NULL, NULL, &txn, NULL);
+    memset(&wb, 0, sizeof(wb));
+    wb.len                               = 10;
+    txn->state_data.receive.write_behind = &wb;
+    UT_SetDefaultReturnValue(UT_KEY(CF_WrappedWrite), 10);
+    UtAssert_VOIDCALL(CF_CFDP_R_Cancel(txn));
+    UtAssert_STUB_COUNT(CF_WrappedWrite, 1);
+    UtAssert_ZERO(wb.len);
 }
 
 void Test_CF_CFDP_R_Init(void)
@@ -544,6 +605,8 @@ void Test_CF_CFDP_R_ProcessFd(void)
     CF_Transaction_t *              txn;
     CF_Logical_PduBuffer_t *        ph;
     CF_Logical_PduFileDataHeader_t *fd;
+    CF_WriteBehind_t                wb;
+    uint8                           data[100];
 
     /* nominal */
     UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, &txn, NULL);
@@ -553,7 +616,8 @@ void Test_CF_CFDP_R_ProcessFd(void)
     UtAssert_INT32_EQ(CF_CFDP_R_ProcessFd(txn, ph), 0);
     UtAssert_UINT32_EQ(txn->state_data.receive.cached_pos, 100);
     UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.recv.file_data_bytes, 100);
-    UtAssert_STUB_COUNT(CF_WrappedLseek, 0);
+    UtAssert_UINT32_EQ(txn->file_data_bytes, 100);
+    UtAssert_STUB_COUNT(CF_WrappedSeekTo, 0);
     UtAssert_STUB_COUNT(CF_WrappedWrite, 1);
 
     /* call again, but for something at a different offset */
@@ -561,14 +625,22 @@ void Test_CF_CFDP_R_ProcessFd(void)
     fd           = &ph->int_header.fd;
     fd->data_len = 100;
     fd->offset   = 200;
-    UT_SetDefaultReturnValue(UT_KEY(CF_WrappedLseek), fd->offset);
     UtAssert_INT32_EQ(CF_CFDP_R_ProcessFd(txn, ph), 0);
     UtAssert_UINT32_EQ(txn->state_data.receive.cached_pos, 300);
     UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.recv.file_data_bytes, 200);
-    UtAssert_STUB_COUNT(CF_WrappedLseek, 1);
+    UtAssert_STUB_COUNT(CF_WrappedSeekTo, 1);
     UtAssert_STUB_COUNT(CF_WrappedWrite, 2);
     UtAssert_UINT32_EQ(txn->state_data.receive.cached_pos, 300);
 
+    /* an offset past 4 GiB in a sparse large file */
+    UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, &txn, NULL);
+    fd           = &ph->int_header.fd;
+    fd->data_len = 100;
+    fd->offset   = 0x100000000;
+    UtAssert_INT32_EQ(CF_CFDP_R_ProcessFd(txn, ph), 0);
+    UtAssert_STUB_COUNT(CF_WrappedSeekTo, 2);
+    UtAssert_BOOL_TRUE(txn->state_data.receive.cached_pos == 0x100000064);
+
     /* call again, but with a failed write */
     UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, &txn, NULL);
     fd                                 = &ph->int_header.fd;
@@ -587,7 +659,7 @@ void Test_CF_CFDP_R_ProcessFd(void)
     fd->data_len                       = 100;
     fd->offset                         = 200;
     txn->state_data.receive.cached_pos = 300;
-    UT_SetDefaultReturnValue(UT_KEY(CF_WrappedLseek), -1);
+    UT_SetDefaultReturnValue(UT_KEY(CF_WrappedSeekTo), CF_ERROR);
     UtAssert_INT32_EQ(CF_CFDP_R_ProcessFd(txn, ph), -1);
     UtAssert_UINT32_EQ(txn->state_data.receive.cached_pos, 300);
     UT_CF_AssertEventID(CF_CFDP_R_SEEK_FD_ERR_EID);
@@ -596,6 +668,188 @@ void Test_CF_CFDP_R_ProcessFd(void)
     /* these stats should have been updated during the course of this test */
     UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].counters.fault.file_write, 1);
     UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].counters.fault.file_seek, 1);
+
+    /* with a write-behind buffer, first data is only buffered */
+    UT_ResetState(UT_KEY(CF_WrappedWrite));
+    UT_ResetState(UT_KEY(CF_WrappedSeekTo));
+    UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, &txn, NULL);
+    memset(&wb, 0, sizeof(wb));
+    txn->state_data.receive.write_behind = &wb;
+    memset(data, 0xAA, sizeof(data));
+    fd           = &ph->int_header.fd;
+    fd->data_ptr = data;
+    fd->data_len = 100;
+    fd->offset   = 1000;
+    UtAssert_INT32_EQ(CF_CFDP_R_ProcessFd(txn, ph), 0);
+    UtAssert_UINT32_EQ(wb.offset, 1000);
+    UtAssert_UINT32_EQ(wb.len, 100);
+    UtAssert_UINT32_EQ(wb.data[0], 0xAA);
+    UtAssert_STUB_COUNT(CF_WrappedWrite, 0);
+
+    /* contiguous data is appended */
+    fd->offset = 1100;
+    UtAssert_INT32_EQ(CF_CFDP_R_ProcessFd(txn, ph), 0);
+    UtAssert_UINT32_EQ(wb.len, 200);
+    UtAssert_STUB_COUNT(CF_WrappedWrite, 0);
+
+    /* out of order data inside the buffered window is merged */
+    data[0]    = 0x55;
+    fd->offset = 1050;
+    UtAssert_INT32_EQ(CF_CFDP_R_ProcessFd(txn, ph), 0);
+    UtAssert_UINT32_EQ(wb.len, 200);
+    UtAssert_UINT32_EQ(wb.data[50], 0x55);
+    UtAssert_STUB_COUNT(CF_WrappedWrite, 0);
+
+    /* a gap writes out the buffered data and starts again */
+    UT_SetDefaultReturnValue(UT_KEY(CF_WrappedWrite), 200);
+    fd->offset = 2000;
+    UtAssert_INT32_EQ(CF_CFDP_R_ProcessFd(txn, ph), 0);
+    UtAssert_UINT32_EQ(wb.offset, 2000);
+    UtAssert_UINT32_EQ(wb.len, 100);
+    UtAssert_UINT32_EQ(txn->state_data.receive.cached_pos, 1200);
+    UtAssert_STUB_COUNT(CF_WrappedWrite, 1);
+
+    /* filling the buffer writes it out */
+    UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, &txn, NULL);
+    memset(&wb, 0, sizeof(wb));
+    wb.len                               = CF_RECV_WRITE_BEHIND_SIZE - 100;
+    txn->state_data.receive.write_behind = &wb;
+    fd                                   = &ph->int_header.fd;
+    fd->data_ptr                         = data;
+    fd->data_len                         = 100;
+    fd->offset                           = CF_RECV_WRITE_BEHIND_SIZE - 100;
+    UT_SetDefaultReturnValue(UT_KEY(CF_WrappedWrite), CF_RECV_WRITE_BEHIND_SIZE);
+    UtAssert_INT32_EQ(CF_CFDP_R_ProcessFd(txn, ph), 0);
+    UtAssert_ZERO(wb.len);
+    UtAssert_UINT32_EQ(txn->state_data.receive.cached_pos, CF_RECV_WRITE_BEHIND_SIZE);
+    UtAssert_STUB_COUNT(CF_WrappedWrite, 2);
+
+    /* failure writing out the buffer */
+    UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, &txn, NULL);
+    memset(&wb, 0, sizeof(wb));
+    wb.len                               = 100;
+    txn->state_data.receive.write_behind = &wb;
+    fd                                   = &ph->int_header.fd;
+    fd->data_ptr                         = data;
+    fd->data_len                         = 100;
+    fd->offset                           = 500;
+    UT_SetDefaultReturnValue(UT_KEY(CF_WrappedWrite), -1);
+    UtAssert_INT32_EQ(CF_CFDP_R_ProcessFd(txn, ph), -1);
+    UtAssert_ZERO(wb.len);
+    UtAssert_INT32_EQ(txn->history->txn_stat, CF_TxnStatus_FILESTORE_REJECTION);
+}
+
+void Test_CF_CFDP_R_GetWriteBehind(void)
+{
+    /* Test case for:
+     * CF_WriteBehind_t *CF_CFDP_R_GetWriteBehind(CF_Transaction_t *txn);
+     */
+    CF_Transaction_t *txn;
+    CF_WriteBehind_t  wb;
+
+    /* none free */
+    UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, &txn, NULL);
+    UtAssert_NULL(CF_CFDP_R_GetWriteBehind(txn));
+
+    /* nominal */
+    UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, &txn, NULL);
+    memset(&wb, 0, sizeof(wb));
+    wb.len = 10;
+    UT_SetHandlerFunction(UT_KEY(CF_CList_Pop), UT_AltHandler_GenericPointerReturn, &wb.cl_node);
+    UtAssert_ADDRESS_EQ(CF_CFDP_R_GetWriteBehind(txn), &wb);
+    UtAssert_ZERO(wb.len);
+}
+
+typedef struct
+{
+    uint32         num_words;
+    CF_ChunkSize_t granule;
+} UT_CFDP_R_AttachBitmap_Capture_t;
+
+static void UT_CFDP_R_Handler_CaptureAttachBitmap(void *UserObj, UT_EntryKey_t FuncKey,
+                                                  const UT_StubContext_t *Context)
+{
+    UT_CFDP_R_AttachBitmap_Capture_t *capture = UserObj;
+
+    capture->num_words = UT_Hook_GetArgValueByName(Context, "num_words", uint32);
+    capture->granule   = UT_Hook_GetArgValueByName(Context, "granule", CF_ChunkSize_t);
+}
+
+void Test_CF_CFDP_R2_GetBitmap(void)
+{
+    /* Test case for:
+     * CF_RecvBitmap_t *CF_CFDP_R2_GetBitmap(CF_Transaction_t *txn, uint32 granule);
+     */
+    CF_Transaction_t *               txn;
+    CF_ChunkWrapper_t                chunks;
+    CF_RecvBitmap_t                  rb;
+    UT_CFDP_R_AttachBitmap_Capture_t capture;
+
+    memset(&chunks, 0, sizeof(chunks));
+    memset(&capture, 0, sizeof(capture));
+    UT_SetHandlerFunction(UT_KEY(CF_ChunkList_AttachBitmap), UT_CFDP_R_Handler_CaptureAttachBitmap, &capture);
+
+    /* none free */
+    UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, &txn, NULL);
+    txn->chunks = &chunks;
+    UtAssert_NULL(CF_CFDP_R2_GetBitmap(txn, 100));
+    UtAssert_STUB_COUNT(CF_ChunkList_AttachBitmap, 0);
+
+    /* nominal, file size not yet known so the whole bitmap is used */
+    UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, &txn, NULL);
+    txn->chunks = &chunks;
+    UT_SetHandlerFunction(UT_KEY(CF_CList_Pop), UT_AltHandler_GenericPointerReturn, &rb.cl_node);
+    UtAssert_ADDRESS_EQ(CF_CFDP_R2_GetBitmap(txn, 100), &rb);
+    UtAssert_STUB_COUNT(CF_ChunkList_AttachBitmap, 1);
+    UtAssert_UINT32_EQ(capture.num_words, sizeof(rb.words) / sizeof(rb.words[0]));
+    UtAssert_UINT32_EQ(capture.granule, 100);
+
+    /* metadata received, bitmap is limited to the file size */
+    UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, &txn, NULL);
+    txn->chunks           = &chunks;
+    txn->flags.rx.md_recv = true;
+    txn->fsize            = 6400;
+    UtAssert_ADDRESS_EQ(CF_CFDP_R2_GetBitmap(txn, 100), &rb);
+    UtAssert_STUB_COUNT(CF_ChunkList_AttachBitmap, 2);
+    UtAssert_UINT32_EQ(capture.num_words, 3);
+}
+
+void Test_CF_CFDP_R_FlushWriteBehind(void)
+{
+    /* Test case for:
+     * CFE_Status_t CF_CFDP_R_FlushWriteBehind(CF_Transaction_t *txn);
+     */
+    CF_Transaction_t *txn;
+    CF_WriteBehind_t  wb;
+
+    /* no buffer */
+    UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, &txn, NULL);
+    UtAssert_INT32_EQ(CF_CFDP_R_FlushWriteBehind(txn), CFE_SUCCESS);
+
+    /* empty buffer */
+    UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, &txn, NULL);
+    memset(&wb, 0, sizeof(wb));
+    txn->state_data.receive.write_behind = &wb;
+    UtAssert_INT32_EQ(CF_CFDP_R_FlushWriteBehind(txn), CFE_SUCCESS);
+    UtAssert_STUB_COUNT(CF_WrappedWrite, 0);
+
+    /* nominal */
+    wb.offset = 0;
+    wb.len    = 100;
+    UT_SetDeferredRetcode(UT_KEY(CF_WrappedWrite), 1, 100);
+    UtAssert_INT32_EQ(CF_CFDP_R_FlushWriteBehind(txn), CFE_SUCCESS);
+    UtAssert_ZERO(wb.len);
+    UtAssert_UINT32_EQ(txn->state_data.receive.cached_pos, 100);
+    UtAssert_STUB_COUNT(CF_WrappedSeekTo, 0);
+    UtAssert_STUB_COUNT(CF_WrappedWrite, 1);
+
+    /* failed write */
+    wb.offset = 100;
+    wb.len    = 100;
+    UT_SetDeferredRetcode(UT_KEY(CF_WrappedWrite), 1, -1);
+    UtAssert_INT32_EQ(CF_CFDP_R_FlushWriteBehind(txn), CF_ERROR);
+    UtAssert_ZERO(wb.len);
+    UT_CF_AssertEventID(CF_CFDP_R_WRITE_ERR_EID);
 }
 
 void Test_CF_CFDP_R_SubstateRecvEof(void)
@@ -647,6 +901,7 @@ void Test_CF_CFDP_R1_SubstateRecvEof(void)
     CF_Transaction_t *      txn;
     CF_Logical_PduBuffer_t *ph;
     CF_Logical_PduEof_t *   eof;
+    CF_WriteBehind_t        wb;
 
     /* nominal */
     UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, &txn, NULL);
@@ -672,6 +927,19 @@ void Test_CF_CFDP_R1_SubstateRecvEof(void)
     txn->crc.result = ~eof->crc;
     UtAssert_VOIDCALL(CF_CFDP_R1_SubstateRecvEof(txn, ph));
     UtAssert_BOOL_FALSE(txn->keep);
+
+    /* failure writing out buffered file data */
+    UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, &txn, NULL);
+    eof             = &ph->int_header.eof;
+    eof->crc        = 0xf007ba11;
+    txn->crc.result = eof->crc;
+    memset(&wb, 0, sizeof(wb));
+    wb.len                               = 10;
+    txn->state_data.receive.write_behind = &wb;
+    UT_SetDeferredRetcode(UT_KEY(CF_WrappedWrite), 1, -1);
+    UtAssert_VOIDCALL(CF_CFDP_R1_SubstateRecvEof(txn, ph));
+    UtAssert_BOOL_FALSE(txn->keep);
+    UT_CF_AssertEventID(CF_CFDP_R_WRITE_ERR_EID);
 }
 
 void Test_CF_CFDP_R2_SubstateRecvEof(void)
@@ -682,6 +950,7 @@ void Test_CF_CFDP_R2_SubstateRecvEof(void)
     CF_Transaction_t *      txn;
     CF_Logical_PduBuffer_t *ph;
     CF_Logical_PduEof_t *   eof;
+    CF_WriteBehind_t        wb;
 
     /* nominal */
     UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, &txn, NULL);
@@ -727,6 +996,19 @@ void Test_CF_CFDP_R2_SubstateRecvEof(void)
     txn->flags.rx.md_recv = true;
     UtAssert_VOIDCALL(CF_CFDP_R2_SubstateRecvEof(txn, ph));
     UtAssert_INT32_EQ(txn->history->txn_stat, CF_TxnStatus_FILE_SIZE_ERROR);
+
+    /* failure writing out buffered file data - this resets the transaction */
+    UT_ResetState(UT_KEY(CF_CFDP_ResetTransaction));
+    UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, &txn, NULL);
+    memset(&wb, 0, sizeof(wb));
+    wb.len                               = 10;
+    txn->state_data.receive.write_behind = &wb;
+    UT_SetDeferredRetcode(UT_KEY(CF_WrappedWrite), 1, -1);
+    UT_SetDeferredRetcode(UT_KEY(CF_TxnStatus_IsError), 1, true);
+    UtAssert_VOIDCALL(CF_CFDP_R2_SubstateRecvEof(txn, ph));
+    UtAssert_BOOL_TRUE(txn->flags.rx.eof_recv);
+    UtAssert_INT32_EQ(txn->history->txn_stat, CF_TxnStatus_FILESTORE_REJECTION);
+    UtAssert_STUB_COUNT(CF_CFDP_ResetTransaction, 1);
 }
 
 void Test_CF_CFDP_R1_SubstateRecvFileData(void)
@@ -762,11 +1044,14 @@ void Test_CF_CFDP_R2_SubstateRecvFileData(void)
      */
     CF_Transaction_t *      txn;
     CF_Logical_PduBuffer_t *ph;
+    CF_ConfigTable_t *      config;
+    CF_RecvBitmap_t         rb;
 
     /* nominal */
     UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, &txn, NULL);
     txn->state_data.receive.r2.acknak_count = 1; /* make nonzero so it can be checked */
     UtAssert_VOIDCALL(CF_CFDP_R2_SubstateRecvFileData(txn, ph));
+    UtAssert_STUB_COUNT(CF_ChunkList_ComputeUncovered, 1);
     UtAssert_STUB_COUNT(CF_ChunkListAdd, 1);
     UtAssert_ZERO(txn->state_data.receive.r2.acknak_count); /* this resets the counter */
     UtAssert_STUB_COUNT(CF_CFDP_ArmAckTimer, 1);
@@ -787,6 +1072,99 @@ void Test_CF_CFDP_R2_SubstateRecvFileData(void)
     UtAssert_STUB_COUNT(CF_CFDP_ArmAckTimer, 2);            /* does NOT increment here */
     UtAssert_ZERO(txn->state_data.receive.r2.acknak_count); /* this resets the counter */
 
+    /* with eof_recv flag, last gap filled completes the transaction */
+    UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, &txn, NULL);
+    txn->flags.rx.md_recv  = true;
+    txn->flags.rx.eof_recv = true;
+    UtAssert_VOIDCALL(CF_CFDP_R2_SubstateRecvFileData(txn, ph));
+    UtAssert_BOOL_TRUE(txn->flags.rx.complete);
+    UtAssert_STUB_COUNT(CF_CFDP_ArmAckTimer, 2); /* does NOT increment here */
+
+    /* bitmap tracking enabled, but before the metadata nothing sizes the granule */
+    UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, &txn, &config);
+    config->chan[txn->chan_num].rx_bitmap_enabled = 1;
+    txn->fsize                                    = 1000;
+    ph->int_header.fd.data_len                    = 100;
+    UT_SetDefaultReturnValue(UT_KEY(CF_WrappedWrite), 100);
+    UT_SetHandlerFunction(UT_KEY(CF_CFDP_R2_GetBitmap), UT_AltHandler_GenericPointerReturn, &rb);
+    UtAssert_VOIDCALL(CF_CFDP_R2_SubstateRecvFileData(txn, ph));
+    UtAssert_STUB_COUNT(CF_CFDP_R2_GetBitmap, 0);
+
+    /* nor does a PDU that does not start on a multiple of its length */
+    txn->flags.rx.md_recv    = true;
+    ph->int_header.fd.offset = 150;
+    UtAssert_VOIDCALL(CF_CFDP_R2_SubstateRecvFileData(txn, ph));
+    UtAssert_STUB_COUNT(CF_CFDP_R2_GetBitmap, 0);
+
+    /* the first aligned data PDU after the metadata attaches a bitmap sized by its length */
+    ph->int_header.fd.offset = 200;
+    UtAssert_VOIDCALL(CF_CFDP_R2_SubstateRecvFileData(txn, ph));
+    UtAssert_STUB_COUNT(CF_CFDP_R2_GetBitmap, 1);
+    UtAssert_ADDRESS_EQ(txn->state_data.receive.bitmap, &rb);
+
+    /* already has a bitmap, not attached again */
+    UtAssert_VOIDCALL(CF_CFDP_R2_SubstateRecvFileData(txn, ph));
+    UtAssert_STUB_COUNT(CF_CFDP_R2_GetBitmap, 1);
+
+    /* the final (possibly short) PDU of a known-size file is not used to size the granule */
+    UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, &txn, &config);
+    config->chan[txn->chan_num].rx_bitmap_enabled = 1;
+    txn->flags.rx.md_recv                         = true;
+    txn->fsize                                    = 150;
+    ph->int_header.fd.offset                      = 100;
+    ph->int_header.fd.data_len                    = 50;
+    UT_SetDefaultReturnValue(UT_KEY(CF_WrappedWrite), 50);
+    UtAssert_VOIDCALL(CF_CFDP_R2_SubstateRecvFileData(txn, ph));
+    UtAssert_STUB_COUNT(CF_CFDP_R2_GetBitmap, 1);
+
+    /* immediate NAK mode, data past the frontier NAKs the gap before it at the next tick */
+    UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, &txn, &config);
+    config->chan[txn->chan_num].rx_immediate_nak_ticks = 2;
+    ph->int_header.fd.offset                           = 100;
+    ph->int_header.fd.data_len                         = 10;
+    UT_SetDefaultReturnValue(UT_KEY(CF_WrappedWrite), 10);
+    UtAssert_VOIDCALL(CF_CFDP_R2_SubstateRecvFileData(txn, ph));
+    UtAssert_STUB_COUNT(CF_CFDP_ConstructPduHeader, 0);
+    UtAssert_BOOL_TRUE(txn->flags.rx.send_imm_nak);
+    UtAssert_UINT32_EQ(txn->state_data.receive.r2.imm_nak_scope, 100);
+    UtAssert_UINT32_EQ(txn->state_data.receive.r2.rx_frontier, 110);
+
+    /* data in order leaves no new gap */
+    txn->flags.rx.send_imm_nak = false;
+    ph->int_header.fd.offset   = 110;
+    UtAssert_VOIDCALL(CF_CFDP_R2_SubstateRecvFileData(txn, ph));
+    UtAssert_BOOL_FALSE(txn->flags.rx.send_imm_nak);
+    UtAssert_UINT32_EQ(txn->state_data.receive.r2.rx_frontier, 120);
+
+    /* a jump within the interval since the last immediate NAK waits */
+    txn->state_data.receive.r2.imm_nak_end                    = 100;
+    txn->state_data.receive.r2.imm_nak_tick                   = 5;
+    CF_AppData.engine.channels[txn->chan_num].timer_wheel.now = 6;
+    ph->int_header.fd.offset                                  = 200;
+    UtAssert_VOIDCALL(CF_CFDP_R2_SubstateRecvFileData(txn, ph));
+    UtAssert_BOOL_FALSE(txn->flags.rx.send_imm_nak);
+    UtAssert_UINT32_EQ(txn->state_data.receive.r2.rx_frontier, 210);
+
+    /* and goes once the interval has passed */
+    CF_AppData.engine.channels[txn->chan_num].timer_wheel.now = 7;
+    ph->int_header.fd.offset                                  = 300;
+    UtAssert_VOIDCALL(CF_CFDP_R2_SubstateRecvFileData(txn, ph));
+    UtAssert_BOOL_TRUE(txn->flags.rx.send_imm_nak);
+    UtAssert_UINT32_EQ(txn->state_data.receive.r2.imm_nak_scope, 300);
+
+    /* a further jump before the tick widens the waiting NAK */
+    ph->int_header.fd.offset = 350;
+    UtAssert_VOIDCALL(CF_CFDP_R2_SubstateRecvFileData(txn, ph));
+    UtAssert_UINT32_EQ(txn->state_data.receive.r2.imm_nak_scope, 350);
+
+    /* not once the EOF is in, the regular NAK covers it */
+    txn->flags.rx.send_imm_nak = false;
+    txn->flags.rx.eof_recv     = true;
+    ph->int_header.fd.offset   = 400;
+    UtAssert_VOIDCALL(CF_CFDP_R2_SubstateRecvFileData(txn, ph));
+    UtAssert_BOOL_FALSE(txn->flags.rx.send_imm_nak);
+    UtAssert_STUB_COUNT(CF_CFDP_ConstructPduHeader, 0);
+
     /* failure in CF_CFDP_RecvFd (bad packet) */
     UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, &txn, NULL);
     UT_SetDeferredRetcode(UT_KEY(CF_CFDP_RecvFd), 1, -1);
@@ -825,9 +1203,9 @@ void Test_CF_CFDP_R2_GapCompute(void)
     UtAssert_VOIDCALL(CF_CFDP_R2_GapCompute(&chunks, &chunk, &args));
     UtAssert_UINT32_EQ(nak.segment_list.num_segments, 1);
 
-    /* the offset start/end should be normalized to the scope start/end */
-    UtAssert_UINT32_EQ(nak.segment_list.segments[0].offset_start, 1000);
-    UtAssert_UINT32_EQ(nak.segment_list.segments[0].offset_end, 1100);
+    /* the offset start/end are file offsets, not relative to the scope */
+    UtAssert_UINT32_EQ(nak.segment_list.segments[0].offset_start, 11000);
+    UtAssert_UINT32_EQ(nak.segment_list.segments[0].offset_end, 11100);
 
     /* confirm that CF_PDU_MAX_SEGMENTS is not exceeded */
     nak.segment_list.num_segments = CF_PDU_MAX_SEGMENTS;
@@ -835,6 +1213,66 @@ void Test_CF_CFDP_R2_GapCompute(void)
     UtAssert_UINT32_EQ(nak.segment_list.num_segments, CF_PDU_MAX_SEGMENTS);
 }
 
+typedef struct
+{
+    CF_Crc_t *   crc;
+    uint64       offset;
+    const uint8 *data;
+    size_t       len;
+} UT_CFDP_R_DigestAt_Capture_t;
+
+static void UT_CFDP_R_Handler_CaptureDigestAt(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    UT_CFDP_R_DigestAt_Capture_t *capture = UserObj;
+
+    capture->crc    = UT_Hook_GetArgValueByName(Context, "crc", CF_Crc_t *);
+    capture->offset = UT_Hook_GetArgValueByName(Context, "offset", uint64);
+    capture->data   = UT_Hook_GetArgValueByName(Context, "data", const uint8 *);
+    capture->len    = UT_Hook_GetArgValueByName(Context, "len", size_t);
+}
+
+void Test_CF_CFDP_R2_DigestGap(void)
+{
+    /* Test case for:
+     * void CF_CFDP_R2_DigestGap(const CF_ChunkList_t *chunks, const CF_Chunk_t *chunk, void *opaque);
+     */
+    CF_ChunkList_t                 chunks;
+    CF_Chunk_t                     chunk;
+    CF_DigestGapArgs_t             args;
+    CF_Logical_PduFileDataHeader_t fd;
+    CF_Transaction_t               txn;
+    uint8                          data[20];
+    UT_CFDP_R_DigestAt_Capture_t   capture;
+
+    memset(&capture, 0, sizeof(capture));
+    memset(&chunks, 0, sizeof(chunks));
+    memset(&args, 0, sizeof(args));
+    memset(&fd, 0, sizeof(fd));
+    memset(&txn, 0, sizeof(txn));
+    args.txn    = &txn;
+    args.fd     = &fd;
+    fd.offset   = 1000;
+    fd.data_len = sizeof(data);
+    fd.data_ptr = data;
+
+    /* the gap is digested at its own file offset, from the matching place in the PDU */
+    chunk.offset = 1005;
+    chunk.size   = 10;
+    UT_SetHandlerFunction(UT_KEY(CF_CRC_DigestAt), UT_CFDP_R_Handler_CaptureDigestAt, &capture);
+    UtAssert_VOIDCALL(CF_CFDP_R2_DigestGap(&chunks, &chunk, &args));
+    UtAssert_STUB_COUNT(CF_CRC_DigestAt, 1);
+    UtAssert_ADDRESS_EQ(capture.crc, &txn.crc);
+    UtAssert_UINT32_EQ(capture.offset, 1005);
+    UtAssert_ADDRESS_EQ(capture.data, &data[5]);
+    UtAssert_UINT32_EQ(capture.len, 10);
+    UtAssert_ZERO(args.digested); /* stub did not accept it */
+
+    /* accepted by the checksum, so it counts */
+    UT_SetDeferredRetcode(UT_KEY(CF_CRC_DigestAt), 1, true);
+    UtAssert_VOIDCALL(CF_CFDP_R2_DigestGap(&chunks, &chunk, &args));
+    UtAssert_UINT32_EQ(args.digested, 10);
+}
+
 void Test_CF_CFDP_R_SubstateSendNak(void)
 {
     /* Test case for:
@@ -897,6 +1335,98 @@ void Test_CF_CFDP_R_SubstateSendNak(void)
     txn->chunks           = &chunks;
     UtAssert_INT32_EQ(CF_CFDP_R_SubstateSendNak(txn), -1);
     UtAssert_BOOL_TRUE(txn->flags.rx.fd_nak_sent); /* this flag is still set, even when it fails to send? */
+
+    /* a full NAK PDU is followed by another scoped from the end of its last segment */
+    UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_TX, &ph, NULL, NULL, &txn, NULL);
+    UT_SetDeferredRetcode(UT_KEY(CF_ChunkList_ComputeGaps), 1, CF_PDU_MAX_SEGMENTS);
+    UT_SetDeferredRetcode(UT_KEY(CF_ChunkList_ComputeGaps), 1, 1);
+    txn->flags.rx.md_recv = true;
+    txn->chunks           = &chunks;
+    txn->fsize            = 1000;
+
+    /* the stub does not fill in segments, so set where the last one ends */
+    ph->int_header.nak.segment_list.segments[CF_PDU_MAX_SEGMENTS - 1].offset_end = 500;
+    UtAssert_INT32_EQ(CF_CFDP_R_SubstateSendNak(txn), 0);
+    UtAssert_STUB_COUNT(CF_CFDP_SendNak, 6);
+    UtAssert_UINT32_EQ(ph->int_header.nak.scope_start, 500);
+    UtAssert_UINT32_EQ(ph->int_header.nak.scope_end, 1000);
+    UtAssert_ZERO(txn->state_data.receive.r2.nak_cursor);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.sent.nak_segment_requests,
+                       1 + CF_PDU_MAX_SEGMENTS + 1);
+
+    /* in large file mode a NAK PDU is full at fewer segments, here with gaps past 4 GiB */
+    UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_TX, &ph, NULL, NULL, &txn, NULL);
+    UT_SetDeferredRetcode(UT_KEY(CF_ChunkList_ComputeGaps), 1, CF_PDU_MAX_SEGMENTS_LARGE);
+    UT_SetDeferredRetcode(UT_KEY(CF_ChunkList_ComputeGaps), 1, 1);
+    txn->flags.rx.md_recv     = true;
+    txn->flags.com.large_file = true;
+    txn->chunks               = &chunks;
+    txn->fsize                = 0x200000000;
+
+    ph->int_header.nak.segment_list.segments[CF_PDU_MAX_SEGMENTS_LARGE - 1].offset_end = 0x100000500;
+    UtAssert_INT32_EQ(CF_CFDP_R_SubstateSendNak(txn), 0);
+    UtAssert_STUB_COUNT(CF_CFDP_SendNak, 8);
+    UtAssert_BOOL_TRUE(ph->int_header.nak.scope_start == 0x100000500);
+    UtAssert_BOOL_TRUE(ph->int_header.nak.scope_end == 0x200000000);
+
+    /* resuming a NAK cycle past the last gap ends it without completing the transaction */
+    UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_TX, &ph, NULL, NULL, &txn, NULL);
+    txn->flags.rx.md_recv                 = true;
+    txn->chunks                           = &chunks;
+    txn->fsize                            = 1000;
+    txn->state_data.receive.r2.nak_cursor = 500;
+    UtAssert_INT32_EQ(CF_CFDP_R_SubstateSendNak(txn), 0);
+    UtAssert_STUB_COUNT(CF_CFDP_SendNak, 8);
+    UtAssert_BOOL_FALSE(txn->flags.rx.complete);
+    UtAssert_ZERO(txn->state_data.receive.r2.nak_cursor);
+}
+
+void Test_CF_CFDP_R2_SendImmediateNak(void)
+{
+    /* Test case for:
+     * CFE_Status_t CF_CFDP_R2_SendImmediateNak(CF_Transaction_t *txn, CF_FileSize_t scope_end);
+     */
+    CF_Transaction_t *      txn;
+    CF_Logical_PduBuffer_t *ph;
+    CF_ChunkWrapper_t       chunks;
+
+    memset(&chunks, 0, sizeof(chunks));
+
+    /* no packet available */
+    UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, &txn, NULL);
+    UtAssert_INT32_EQ(CF_CFDP_R2_SendImmediateNak(txn, 100), CF_SEND_PDU_NO_BUF_AVAIL_ERROR);
+    UtAssert_STUB_COUNT(CF_CFDP_SendNak, 0);
+
+    /* no gaps in the scope, nothing sent */
+    UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_TX, &ph, NULL, NULL, &txn, NULL);
+    txn->chunks = &chunks;
+    UtAssert_INT32_EQ(CF_CFDP_R2_SendImmediateNak(txn, 100), CF_ERROR);
+    UtAssert_STUB_COUNT(CF_CFDP_SendNak, 0);
+    UtAssert_ZERO(txn->state_data.receive.r2.imm_nak_end);
+
+    /* nominal, the scope starts where the last one ended */
+    UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_TX, &ph, NULL, NULL, &txn, NULL);
+    UT_SetDeferredRetcode(UT_KEY(CF_ChunkList_ComputeGaps), 1, 2);
+    txn->chunks                                               = &chunks;
+    txn->state_data.receive.r2.imm_nak_end                    = 50;
+    CF_AppData.engine.channels[txn->chan_num].timer_wheel.now = 9;
+    UtAssert_INT32_EQ(CF_CFDP_R2_SendImmediateNak(txn, 100), CFE_SUCCESS);
+    UtAssert_STUB_COUNT(CF_CFDP_SendNak, 1);
+    UtAssert_UINT32_EQ(ph->int_header.nak.scope_start, 50);
+    UtAssert_UINT32_EQ(ph->int_header.nak.scope_end, 100);
+    UtAssert_UINT32_EQ(txn->state_data.receive.r2.imm_nak_end, 100);
+    UtAssert_UINT32_EQ(txn->state_data.receive.r2.imm_nak_tick, 9);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.sent.nak_segment_requests, 2);
+    UtAssert_BOOL_FALSE(txn->flags.rx.fd_nak_sent);
+
+    /* failure in SendNak, so the same scope is tried again next time */
+    UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_TX, &ph, NULL, NULL, &txn, NULL);
+    UT_SetDeferredRetcode(UT_KEY(CF_ChunkList_ComputeGaps), 1, 1);
+    UT_SetDeferredRetcode(UT_KEY(CF_CFDP_SendNak), 1, CF_SEND_PDU_NO_BUF_AVAIL_ERROR);
+    txn->chunks = &chunks;
+    UtAssert_INT32_EQ(CF_CFDP_R2_SendImmediateNak(txn, 100), CF_SEND_PDU_NO_BUF_AVAIL_ERROR);
+    UtAssert_STUB_COUNT(CF_CFDP_SendNak, 2);
+    UtAssert_ZERO(txn->state_data.receive.r2.imm_nak_end);
 }
 
 void Test_CF_CFDP_R2_CalcCrcChunk(void)
@@ -920,6 +1450,17 @@ void Test_CF_CFDP_R2_CalcCrcChunk(void)
     UtAssert_INT32_EQ(CF_CFDP_R2_CalcCrcChunk(txn), 0);
     UtAssert_BOOL_TRUE(txn->flags.com.crc_calc);
 
+    /* every byte was already digested inline, file is not read back */
+    UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, &txn, &config);
+    config->rx_crc_calc_bytes_per_wakeup           = 100;
+    txn->fsize                                     = 70;
+    txn->state_data.receive.r2.rx_crc_inline_bytes = 70;
+    UtAssert_INT32_EQ(CF_CFDP_R2_CalcCrcChunk(txn), 0);
+    UtAssert_BOOL_TRUE(txn->flags.com.crc_calc);
+    UtAssert_STUB_COUNT(CF_CRC_Start, 0);
+    UtAssert_STUB_COUNT(CF_WrappedRead, 0);
+    UtAssert_UINT32_EQ(txn->state_data.receive.r2.rx_crc_calc_bytes, 70);
+
     /* force a CRC mismatch */
     UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, &txn, NULL);
     txn->crc.result                    = 0xabadf00d;
@@ -951,7 +1492,6 @@ void Test_CF_CFDP_R2_CalcCrcChunk(void)
     txn->state_data.receive.cached_pos           = 20;
     config->rx_crc_calc_bytes_per_wakeup         = 100;
     txn->fsize                                   = 50;
-    UT_SetDeferredRetcode(UT_KEY(CF_WrappedLseek), 1, txn->state_data.receive.r2.rx_crc_calc_bytes);
     UT_SetDeferredRetcode(UT_KEY(CF_WrappedRead), 1, txn->fsize - txn->state_data.receive.r2.rx_crc_calc_bytes);
     UtAssert_INT32_EQ(CF_CFDP_R2_CalcCrcChunk(txn), 0);
     UtAssert_BOOL_TRUE(txn->flags.com.crc_calc);
@@ -973,7 +1513,7 @@ void Test_CF_CFDP_R2_CalcCrcChunk(void)
     txn->state_data.receive.cached_pos           = 10;
     config->rx_crc_calc_bytes_per_wakeup         = 100;
     txn->fsize                                   = 50;
-    UT_SetDeferredRetcode(UT_KEY(CF_WrappedLseek), 1, -1);
+    UT_SetDeferredRetcode(UT_KEY(CF_WrappedSeekTo), 1, CF_ERROR);
     UtAssert_INT32_EQ(CF_CFDP_R2_CalcCrcChunk(txn), -1);
     UT_CF_AssertEventID(CF_CFDP_R_SEEK_CRC_ERR_EID);
     UtAssert_BOOL_FALSE(txn->flags.com.crc_calc);
@@ -1092,6 +1632,14 @@ void Test_CF_CFDP_R2_RecvMd(void)
     UtAssert_VOIDCALL(CF_CFDP_R2_RecvMd(txn, ph));
     UT_CF_AssertEventID(CF_CFDP_R_PDU_MD_ERR_EID);
     UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.recv.error, 1);
+
+    /* CF_CFDP_RecvMd failure due to unsupported checksum type, goes to FIN */
+    UT_CFDP_R_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, &txn, NULL);
+    txn->history->txn_stat = CF_TxnStatus_UNSUPPORTED_CHECKSUM_TYPE;
+    UT_SetDeferredRetcode(UT_KEY(CF_CFDP_RecvMd), 1, CF_PDU_METADATA_ERROR);
+    UtAssert_VOIDCALL(CF_CFDP_R2_RecvMd(txn, ph));
+    UtAssert_BOOL_TRUE(txn->flags.rx.send_fin);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.recv.error, 1); /* not counted again */
 }
 
 void Test_CF_CFDP_R_SendInactivityEvent(void)
@@ -1128,6 +1676,11 @@ void UtTest_Setup(void)
     UtTest_Add(Test_CF_CFDP_R_CheckCrc, cf_cfdp_r_tests_Setup, cf_cfdp_r_tests_Teardown, "CF_CFDP_R_CheckCrc");
     UtTest_Add(Test_CF_CFDP_R2_Complete, cf_cfdp_r_tests_Setup, cf_cfdp_r_tests_Teardown, "CF_CFDP_R2_Complete");
     UtTest_Add(Test_CF_CFDP_R_ProcessFd, cf_cfdp_r_tests_Setup, cf_cfdp_r_tests_Teardown, "CF_CFDP_R_ProcessFd");
+    UtTest_Add(Test_CF_CFDP_R_GetWriteBehind, cf_cfdp_r_tests_Setup, cf_cfdp_r_tests_Teardown,
+               "CF_CFDP_R_GetWriteBehind");
+    UtTest_Add(Test_CF_CFDP_R2_GetBitmap, cf_cfdp_r_tests_Setup, cf_cfdp_r_tests_Teardown, "CF_CFDP_R2_GetBitmap");
+    UtTest_Add(Test_CF_CFDP_R_FlushWriteBehind, cf_cfdp_r_tests_Setup, cf_cfdp_r_tests_Teardown,
+               "CF_CFDP_R_FlushWriteBehind");
     UtTest_Add(Test_CF_CFDP_R_SubstateRecvEof, cf_cfdp_r_tests_Setup, cf_cfdp_r_tests_Teardown,
                "CF_CFDP_R_SubstateRecvEof");
     UtTest_Add(Test_CF_CFDP_R1_SubstateRecvEof, cf_cfdp_r_tests_Setup, cf_cfdp_r_tests_Teardown,
@@ -1139,8 +1692,11 @@ void UtTest_Setup(void)
     UtTest_Add(Test_CF_CFDP_R2_SubstateRecvFileData, cf_cfdp_r_tests_Setup, cf_cfdp_r_tests_Teardown,
                "CF_CFDP_R2_SubstateRecvFileData");
     UtTest_Add(Test_CF_CFDP_R2_GapCompute, cf_cfdp_r_tests_Setup, cf_cfdp_r_tests_Teardown, "CF_CFDP_R2_GapCompute");
+    UtTest_Add(Test_CF_CFDP_R2_DigestGap, cf_cfdp_r_tests_Setup, cf_cfdp_r_tests_Teardown, "CF_CFDP_R2_DigestGap");
     UtTest_Add(Test_CF_CFDP_R_SubstateSendNak, cf_cfdp_r_tests_Setup, cf_cfdp_r_tests_Teardown,
                "CF_CFDP_R_SubstateSendNak");
+    UtTest_Add(Test_CF_CFDP_R2_SendImmediateNak, cf_cfdp_r_tests_Setup, cf_cfdp_r_tests_Teardown,
+               "CF_CFDP_R2_SendImmediateNak");
     UtTest_Add(Test_CF_CFDP_R2_CalcCrcChunk, cf_cfdp_r_tests_Setup, cf_cfdp_r_tests_Teardown,
                "CF_CFDP_R2_CalcCrcChunk");
     UtTest_Add(Test_CF_CFDP_R2_SubstateSendFin, cf_cfdp_r_tests_Setup, cf_cfdp_r_tests_Teardown,
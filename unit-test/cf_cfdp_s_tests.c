@@ -59,6 +59,7 @@ static void UT_CFDP_S_SetupBasicTxState(CF_Logical_PduBuffer_t *pdu_buffer)
 
     /* Make it so a call to CF_CFDP_ConstructPduBuffer returns the same PDU buffer */
     UT_SetHandlerFunction(UT_KEY(CF_CFDP_ConstructPduHeader), UT_AltHandler_GenericPointerReturn, pdu_buffer);
+    UT_SetHandlerFunction(UT_KEY(CF_CFDP_ConstructFileDataHeader), UT_AltHandler_GenericPointerReturn, pdu_buffer);
 }
 
 static void UT_CFDP_S_SetupBasicTestState(UT_CF_Setup_t setup, CF_Logical_PduBuffer_t **pdu_buffer_p,
@@ -237,14 +238,13 @@ void Test_CF_CFDP_S_Tick(void)
     UT_CFDP_S_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, NULL, &txn, NULL);
     txn->state = CF_TxnState_S2;
     UtAssert_VOIDCALL(CF_CFDP_S_Tick(txn, &cont));
-    UtAssert_STUB_COUNT(CF_Timer_Tick, 1);
+    UtAssert_STUB_COUNT(CF_CFDP_ResetTransaction, 0);
 
     /* nominal, in CF_TxnState_S2, with timer expiry */
     UT_CFDP_S_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, NULL, &txn, NULL);
     UT_SetDeferredRetcode(UT_KEY(CF_Timer_Expired), 1, 1);
     txn->state = CF_TxnState_S2;
     UtAssert_VOIDCALL(CF_CFDP_S_Tick(txn, &cont));
-    UtAssert_STUB_COUNT(CF_Timer_Tick, 1);
     UT_CF_AssertEventID(CF_CFDP_S_INACT_TIMER_ERR_EID);
     UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.fault.inactivity_timer, 1);
     UtAssert_STUB_COUNT(CF_CFDP_ResetTransaction, 1);
@@ -254,7 +254,7 @@ void Test_CF_CFDP_S_Tick(void)
     txn->state                     = CF_TxnState_S2;
     txn->flags.com.ack_timer_armed = true;
     UtAssert_VOIDCALL(CF_CFDP_S_Tick(txn, &cont));
-    UtAssert_STUB_COUNT(CF_Timer_Tick, 3); /* called twice! */
+    UtAssert_STUB_COUNT(CF_CFDP_SendEof, 0);
 
     /* in CF_TxnState_S2, ack_timer_armed + expiry */
     UT_CFDP_S_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, NULL, &txn, NULL);
@@ -262,7 +262,7 @@ void Test_CF_CFDP_S_Tick(void)
     txn->state                     = CF_TxnState_S2;
     txn->flags.com.ack_timer_armed = true;
     UtAssert_VOIDCALL(CF_CFDP_S_Tick(txn, &cont));
-    UtAssert_STUB_COUNT(CF_Timer_Tick, 4);
+    UtAssert_STUB_COUNT(CF_CFDP_SendEof, 0); /* not waiting for EOF-ACK */
 
     /* in CF_TxnState_S2, ack_timer_armed + expiry + finack substate */
     UT_CFDP_S_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, NULL, &txn, &config);
@@ -399,24 +399,155 @@ void Test_CF_CFDP_S2_SubstateSendEof(void)
     UtAssert_VOIDCALL(CF_CFDP_S2_SubstateSendEof(txn));
     UtAssert_UINT32_EQ(txn->state_data.send.sub_state, CF_TxSubState_WAIT_FOR_EOF_ACK);
     UtAssert_BOOL_TRUE(txn->flags.com.ack_timer_armed);
+    UtAssert_STUB_COUNT(CF_CFDP_ArmInactTimer, 1);
+    UtAssert_STUB_COUNT(CF_InsertTransactionTick, 1);
+}
+
+void Test_CF_CFDP_S_GetReadAhead(void)
+{
+    /* Test case for:
+     * CF_ReadAhead_t *CF_CFDP_S_GetReadAhead(CF_Transaction_t *txn);
+     */
+    CF_Transaction_t *txn;
+    CF_ReadAhead_t    ra;
+
+    /* none free */
+    UT_CFDP_S_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, &txn, NULL);
+    UtAssert_NULL(CF_CFDP_S_GetReadAhead(txn));
+
+    /* nominal */
+    UT_CFDP_S_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, &txn, NULL);
+    memset(&ra, 0, sizeof(ra));
+    ra.len = 10;
+    UT_SetHandlerFunction(UT_KEY(CF_CList_Pop), UT_AltHandler_GenericPointerReturn, &ra.cl_node);
+    UtAssert_ADDRESS_EQ(CF_CFDP_S_GetReadAhead(txn), &ra);
+    UtAssert_ZERO(ra.len);
+}
+
+void Test_CF_CFDP_S_ReadFile(void)
+{
+    /* Test case for:
+     * bool CF_CFDP_S_ReadFile(CF_Transaction_t *txn, CF_FileSize_t foffs, void *buf, uint32 len);
+     */
+    CF_Transaction_t *txn;
+    uint8             buf[100];
+
+    /* nominal, no seek needed */
+    UT_CFDP_S_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, &txn, NULL);
+    UT_SetDeferredRetcode(UT_KEY(CF_WrappedRead), 1, sizeof(buf));
+    UtAssert_BOOL_TRUE(CF_CFDP_S_ReadFile(txn, 0, buf, sizeof(buf)));
+    UtAssert_UINT32_EQ(txn->state_data.send.cached_pos, sizeof(buf));
+    UtAssert_STUB_COUNT(CF_WrappedSeekTo, 0);
+
+    /* nominal, with seek */
+    UT_CFDP_S_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, &txn, NULL);
+    UT_SetDeferredRetcode(UT_KEY(CF_WrappedRead), 1, sizeof(buf));
+    UtAssert_BOOL_TRUE(CF_CFDP_S_ReadFile(txn, 50, buf, sizeof(buf)));
+    UtAssert_UINT32_EQ(txn->state_data.send.cached_pos, 50 + sizeof(buf));
+    UtAssert_STUB_COUNT(CF_WrappedSeekTo, 1);
+
+    /* nominal, seek past 4 GiB in a sparse large file */
+    UT_CFDP_S_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, &txn, NULL);
+    UT_SetDeferredRetcode(UT_KEY(CF_WrappedRead), 1, sizeof(buf));
+    UtAssert_BOOL_TRUE(CF_CFDP_S_ReadFile(txn, 0x100000000, buf, sizeof(buf)));
+    UtAssert_BOOL_TRUE(txn->state_data.send.cached_pos == (0x100000000 + sizeof(buf)));
+    UtAssert_STUB_COUNT(CF_WrappedSeekTo, 2);
+
+    /* seek failure */
+    UT_CFDP_S_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, &txn, NULL);
+    UT_SetDeferredRetcode(UT_KEY(CF_WrappedSeekTo), 1, CF_ERROR);
+    UtAssert_BOOL_FALSE(CF_CFDP_S_ReadFile(txn, 50, buf, sizeof(buf)));
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.fault.file_seek, 1);
+    UT_CF_AssertEventID(CF_CFDP_S_SEEK_FD_ERR_EID);
+
+    /* read failure */
+    UT_CFDP_S_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, &txn, NULL);
+    UT_SetDeferredRetcode(UT_KEY(CF_WrappedRead), 1, -1);
+    UtAssert_BOOL_FALSE(CF_CFDP_S_ReadFile(txn, 0, buf, sizeof(buf)));
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.fault.file_read, 1);
+    UT_CF_AssertEventID(CF_CFDP_S_READ_ERR_EID);
+}
+
+void Test_CF_CFDP_S_ReadCached(void)
+{
+    /* Test case for:
+     * bool CF_CFDP_S_ReadCached(CF_Transaction_t *txn, CF_FileSize_t foffs, void *buf, uint32 len);
+     */
+    CF_Transaction_t *txn;
+    CF_HkSent_t *     sent;
+    CF_ReadAhead_t    ra;
+    uint8             buf[200];
+
+    UT_CFDP_S_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, &txn, NULL);
+    sent = &CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.sent;
+    memset(&ra, 0, sizeof(ra));
+    txn->state_data.send.read_ahead = &ra;
+    txn->fsize                      = CF_SEND_READ_AHEAD_SIZE + 1000;
+
+    /* empty buffer, first block is read in */
+    UT_SetDeferredRetcode(UT_KEY(CF_WrappedRead), 1, CF_SEND_READ_AHEAD_SIZE);
+    UtAssert_BOOL_TRUE(CF_CFDP_S_ReadCached(txn, 100, buf, sizeof(buf)));
+    UtAssert_UINT32_EQ(ra.offset, 0);
+    UtAssert_UINT32_EQ(ra.len, CF_SEND_READ_AHEAD_SIZE);
+    UtAssert_UINT32_EQ(sent->read_ahead_miss, 1);
+    UtAssert_STUB_COUNT(CF_WrappedRead, 1);
+
+    /* already in the buffer, no read */
+    ra.data[300] = 0xAB;
+    UtAssert_BOOL_TRUE(CF_CFDP_S_ReadCached(txn, 300, buf, sizeof(buf)));
+    UtAssert_UINT32_EQ(buf[0], 0xAB);
+    UtAssert_UINT32_EQ(sent->read_ahead_hit, 1);
+    UtAssert_STUB_COUNT(CF_WrappedRead, 1);
+
+    /* crosses into the last block, which is short */
+    ra.data[CF_SEND_READ_AHEAD_SIZE - 100] = 0xCD;
+    UT_SetDeferredRetcode(UT_KEY(CF_WrappedRead), 1, 1000);
+    UtAssert_BOOL_TRUE(CF_CFDP_S_ReadCached(txn, CF_SEND_READ_AHEAD_SIZE - 100, buf, sizeof(buf)));
+    UtAssert_UINT32_EQ(buf[0], 0xCD);
+    UtAssert_UINT32_EQ(ra.offset, CF_SEND_READ_AHEAD_SIZE);
+    UtAssert_UINT32_EQ(ra.len, 1000);
+    UtAssert_UINT32_EQ(sent->read_ahead_miss, 2);
+    UtAssert_STUB_COUNT(CF_WrappedRead, 2);
+    UtAssert_STUB_COUNT(CF_WrappedSeekTo, 0);
+
+    /* going back needs a seek */
+    UT_SetDeferredRetcode(UT_KEY(CF_WrappedRead), 1, CF_SEND_READ_AHEAD_SIZE);
+    UtAssert_BOOL_TRUE(CF_CFDP_S_ReadCached(txn, 0, buf, sizeof(buf)));
+    UtAssert_UINT32_EQ(ra.offset, 0);
+    UtAssert_STUB_COUNT(CF_WrappedSeekTo, 1);
+
+    /* read failure leaves the buffer empty */
+    UT_SetDeferredRetcode(UT_KEY(CF_WrappedRead), 1, -1);
+    UtAssert_BOOL_FALSE(CF_CFDP_S_ReadCached(txn, CF_SEND_READ_AHEAD_SIZE, buf, sizeof(buf)));
+    UtAssert_ZERO(ra.len);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.fault.file_read, 1);
+
+    /* the short last block of a sparse file past 4 GiB */
+    txn->fsize = 0x100000000 + 1000;
+    UT_SetDeferredRetcode(UT_KEY(CF_WrappedRead), 1, 1000);
+    UtAssert_BOOL_TRUE(CF_CFDP_S_ReadCached(txn, 0x100000000 + 10, buf, sizeof(buf)));
+    UtAssert_BOOL_TRUE(ra.offset == 0x100000000);
+    UtAssert_UINT32_EQ(ra.len, 1000);
 }
 
 void Test_CF_CFDP_S_SendFileData(void)
 {
     /* Test case for:
-     * int32 CF_CFDP_S_SendFileData(CF_Transaction_t *txn, uint32 foffs, uint32 bytes_to_read, uint8 calc_crc);
+     * int32 CF_CFDP_S_SendFileData(CF_Transaction_t *txn, CF_FileSize_t foffs, CF_FileSize_t bytes_to_read,
+     *                              uint8 calc_crc);
      */
     CF_Transaction_t *txn;
     CF_ConfigTable_t *config;
     uint32            cumulative_read;
     uint32            read_size;
     uint32            offset;
+    CF_ReadAhead_t    ra;
 
     cumulative_read = 0;
     offset          = 0;
     read_size       = 100;
 
-    /* failure of CF_CFDP_ConstructPduHeader */
+    /* failure of CF_CFDP_ConstructFileDataHeader */
     UT_CFDP_S_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, &txn, NULL);
     UtAssert_INT32_EQ(CF_CFDP_S_SendFileData(txn, offset, read_size, true), 0);
     UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.sent.file_data_bytes, cumulative_read);
@@ -429,6 +560,8 @@ void Test_CF_CFDP_S_SendFileData(void)
     UtAssert_INT32_EQ(CF_CFDP_S_SendFileData(txn, offset, read_size, false), read_size);
     cumulative_read += read_size;
     UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.sent.file_data_bytes, cumulative_read);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.sent.retransmit_bytes, read_size);
+    UtAssert_UINT32_EQ(txn->file_data_bytes, read_size);
 
     /* nominal, larger than PDU, no CRC */
     UT_CFDP_S_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, NULL, &txn, &config);
@@ -465,7 +598,6 @@ void Test_CF_CFDP_S_SendFileData(void)
     /* require lseek */
     offset = 25;
     UT_CFDP_S_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, NULL, &txn, &config);
-    UT_SetDeferredRetcode(UT_KEY(CF_WrappedLseek), 1, offset);
     UT_SetDeferredRetcode(UT_KEY(CF_WrappedRead), 1, read_size);
     config->outgoing_file_chunk_size = read_size;
     txn->fsize                       = 300;
@@ -475,13 +607,25 @@ void Test_CF_CFDP_S_SendFileData(void)
 
     /* lseek w/failure */
     UT_CFDP_S_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, NULL, &txn, &config);
-    UT_SetDeferredRetcode(UT_KEY(CF_WrappedLseek), 1, -1);
+    UT_SetDeferredRetcode(UT_KEY(CF_WrappedSeekTo), 1, CF_ERROR);
     config->outgoing_file_chunk_size = read_size;
     txn->fsize                       = 300;
     UtAssert_INT32_EQ(CF_CFDP_S_SendFileData(txn, offset, read_size, true), -1);
     UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.sent.file_data_bytes, cumulative_read);
     UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.fault.file_seek, 1);
     UT_CF_AssertEventID(CF_CFDP_S_SEEK_FD_ERR_EID);
+
+    /* with a read-ahead buffer, the whole (short) file is read in */
+    offset = 0;
+    UT_CFDP_S_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, NULL, &txn, &config);
+    memset(&ra, 0, sizeof(ra));
+    txn->state_data.send.read_ahead  = &ra;
+    config->outgoing_file_chunk_size = read_size;
+    txn->fsize                       = 300;
+    UT_SetDeferredRetcode(UT_KEY(CF_WrappedRead), 1, 300);
+    UtAssert_INT32_EQ(CF_CFDP_S_SendFileData(txn, offset, read_size, false), read_size);
+    UtAssert_UINT32_EQ(ra.len, 300);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.sent.read_ahead_miss, 1);
 }
 
 void Test_CF_CFDP_S_SubstateSendFileData(void)
@@ -571,8 +715,11 @@ void Test_CF_CFDP_S_CheckAndRespondNak(void)
     txn->fsize                       = ut_chunk.size;
     txn->chunks                      = &chunks;
     UT_SetHandlerFunction(UT_KEY(CF_ChunkList_GetFirstChunk), UT_AltHandler_GenericPointerReturn, &ut_chunk);
+    UT_SetDefaultReturnValue(UT_KEY(CF_ChunkList_CoalesceFirst), ut_chunk.size);
     UT_SetDeferredRetcode(UT_KEY(CF_WrappedRead), 1, ut_chunk.size);
     UtAssert_INT32_EQ(CF_CFDP_S_CheckAndRespondNak(txn), 1);
+    UtAssert_STUB_COUNT(CF_ChunkList_RemoveBelow, 1);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.sent.retransmit_bytes, ut_chunk.size);
 
     /* with chunklist - failure to send file data */
     UT_CFDP_S_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, NULL, &txn, &config);
@@ -582,6 +729,7 @@ void Test_CF_CFDP_S_CheckAndRespondNak(void)
     UT_SetHandlerFunction(UT_KEY(CF_ChunkList_GetFirstChunk), UT_AltHandler_GenericPointerReturn, &ut_chunk);
     UT_SetDeferredRetcode(UT_KEY(CF_WrappedRead), 1, -1);
     UtAssert_INT32_EQ(CF_CFDP_S_CheckAndRespondNak(txn), -1);
+    UtAssert_STUB_COUNT(CF_ChunkList_RemoveBelow, 1);
 
     /* with chunklist but CF_CFDP_S_SendFileData returning 0 (nothing to send) */
     UT_CFDP_S_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, NULL, &txn, &config);
@@ -589,7 +737,7 @@ void Test_CF_CFDP_S_CheckAndRespondNak(void)
     txn->fsize                       = ut_chunk.size;
     txn->chunks                      = &chunks;
     UT_SetHandlerFunction(UT_KEY(CF_ChunkList_GetFirstChunk), UT_AltHandler_GenericPointerReturn, &ut_chunk);
-    UT_ResetState(UT_KEY(CF_CFDP_ConstructPduHeader)); /* Returns NULL by default */
+    UT_ResetState(UT_KEY(CF_CFDP_ConstructFileDataHeader)); /* Returns NULL by default */
     UtAssert_INT32_EQ(CF_CFDP_S_CheckAndRespondNak(txn), 0);
 }
 
@@ -624,6 +772,7 @@ void Test_CF_CFDP_S_SubstateSendMetadata(void)
      * void CF_CFDP_S_SubstateSendMetadata(CF_Transaction_t *txn);
      */
     CF_Transaction_t *txn;
+    os_fstat_t        fstat;
 
     /* with no setup, OS_FileOpenCheck returns SUCCESS (true) */
     UT_CFDP_S_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, NULL, &txn, NULL);
@@ -649,22 +798,14 @@ void Test_CF_CFDP_S_SubstateSendMetadata(void)
     UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.fault.file_open, 2);
     UtAssert_INT32_EQ(txn->history->txn_stat, CF_TxnStatus_FILESTORE_REJECTION);
 
-    /* first CF_WrappedLseek fails */
+    /* OS_stat fails */
     UT_CFDP_S_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, NULL, &txn, NULL);
-    UT_SetDeferredRetcode(UT_KEY(CF_WrappedLseek), 1, -1);
+    UT_SetDeferredRetcode(UT_KEY(OS_stat), 1, OS_ERROR);
     UtAssert_VOIDCALL(CF_CFDP_S_SubstateSendMetadata(txn));
     UT_CF_AssertEventID(CF_CFDP_S_SEEK_END_ERR_EID);
     UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.fault.file_seek, 1);
     UtAssert_INT32_EQ(txn->history->txn_stat, CF_TxnStatus_FILESTORE_REJECTION);
 
-    /* second CF_WrappedLseek fails */
-    UT_CFDP_S_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, NULL, &txn, NULL);
-    UT_SetDeferredRetcode(UT_KEY(CF_WrappedLseek), 2, -1);
-    UtAssert_VOIDCALL(CF_CFDP_S_SubstateSendMetadata(txn));
-    UT_CF_AssertEventID(CF_CFDP_S_SEEK_BEG_ERR_EID);
-    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[txn->chan_num].counters.fault.file_seek, 2);
-    UtAssert_INT32_EQ(txn->history->txn_stat, CF_TxnStatus_FILESTORE_REJECTION);
-
     /* CF_CFDP_SendMd fails w/ ERROR */
     UT_CFDP_S_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, NULL, &txn, NULL);
     UT_SetDeferredRetcode(UT_KEY(CF_CFDP_SendMd), 1, CF_SEND_PDU_ERROR);
@@ -679,10 +820,22 @@ void Test_CF_CFDP_S_SubstateSendMetadata(void)
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
     UtAssert_INT32_EQ(txn->history->txn_stat, CF_TxnStatus_UNDEFINED);
 
-    /* everything works */
+    /* everything works, file data header template is built once metadata is sent */
+    UT_ResetState(UT_KEY(CF_CFDP_InitFileDataHeader));
     UT_CFDP_S_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, NULL, &txn, NULL);
     UtAssert_VOIDCALL(CF_CFDP_S_SubstateSendMetadata(txn));
     UtAssert_UINT32_EQ(txn->state_data.send.sub_state, CF_TxSubState_FILEDATA);
+    UtAssert_STUB_COUNT(CF_CFDP_InitFileDataHeader, 1);
+    UtAssert_BOOL_FALSE(txn->flags.com.large_file);
+
+    /* a file past 4 GiB is sent in large file mode */
+    UT_CFDP_S_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, NULL, &txn, NULL);
+    memset(&fstat, 0, sizeof(fstat));
+    fstat.FileSize = 0x100000010;
+    UT_SetDataBuffer(UT_KEY(OS_stat), &fstat, sizeof(fstat), false);
+    UtAssert_VOIDCALL(CF_CFDP_S_SubstateSendMetadata(txn));
+    UtAssert_BOOL_TRUE(txn->fsize == 0x100000010);
+    UtAssert_BOOL_TRUE(txn->flags.com.large_file);
 }
 
 void Test_CF_CFDP_S_SubstateSendFinAck(void)
@@ -847,6 +1000,10 @@ void UtTest_Setup(void)
                "CF_CFDP_S1_SubstateSendEof");
     UtTest_Add(Test_CF_CFDP_S2_SubstateSendEof, cf_cfdp_s_tests_Setup, cf_cfdp_s_tests_Teardown,
                "CF_CFDP_S2_SubstateSendEof");
+    UtTest_Add(Test_CF_CFDP_S_GetReadAhead, cf_cfdp_s_tests_Setup, cf_cfdp_s_tests_Teardown,
+               "CF_CFDP_S_GetReadAhead");
+    UtTest_Add(Test_CF_CFDP_S_ReadFile, cf_cfdp_s_tests_Setup, cf_cfdp_s_tests_Teardown, "CF_CFDP_S_ReadFile");
+    UtTest_Add(Test_CF_CFDP_S_ReadCached, cf_cfdp_s_tests_Setup, cf_cfdp_s_tests_Teardown, "CF_CFDP_S_ReadCached");
     UtTest_Add(Test_CF_CFDP_S_SendFileData, cf_cfdp_s_tests_Setup, cf_cfdp_s_tests_Teardown, "CF_CFDP_S_SendFileData");
     UtTest_Add(Test_CF_CFDP_S_SubstateSendFileData, cf_cfdp_s_tests_Setup, cf_cfdp_s_tests_Teardown,
                "CF_CFDP_S_SubstateSendFileData");
@@ -44,6 +44,13 @@ static union
 **
 *******************************************************************************/
 
+static CF_Transaction_t *UT_CF_CapturedTxn;
+
+static void UT_AltHandler_CaptureDispatchTxn(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    UT_CF_CapturedTxn = UT_Hook_GetArgValueByName(Context, "txn", CF_Transaction_t *);
+}
+
 static void UT_CFDP_SetupBasicRxState(CF_Logical_PduBuffer_t *pdu_buffer)
 {
     static CF_DecoderState_t ut_decoder;
@@ -126,11 +133,11 @@ static void UT_CFDP_SetupBasicTestState(UT_CF_Setup_t setup, CF_Logical_PduBuffe
     {
         if (setup == UT_CF_Setup_TX)
         {
-            *pdu_buffer_p = &CF_AppData.engine.out.tx_pdudata;
+            *pdu_buffer_p = &CF_AppData.engine.channels[UT_CFDP_CHANNEL].out.tx_pdudata;
         }
         else if (setup == UT_CF_Setup_RX)
         {
-            *pdu_buffer_p = &CF_AppData.engine.in.rx_pdudata;
+            *pdu_buffer_p = &CF_AppData.engine.channels[UT_CFDP_CHANNEL].in.rx_pdudata;
         }
         else
         {
@@ -167,12 +174,12 @@ static void UT_CFDP_SetupBasicTestState(UT_CF_Setup_t setup, CF_Logical_PduBuffe
     {
         /* transmit is likely to invoke CF_CFDP_ConstructPduHeader()
             which in turn requires MsgOutGet to work */
-        UT_CFDP_SetupBasicTxState(&CF_AppData.engine.out.tx_pdudata);
+        UT_CFDP_SetupBasicTxState(&CF_AppData.engine.channels[UT_CFDP_CHANNEL].out.tx_pdudata);
     }
     else if (setup == UT_CF_Setup_RX)
     {
         /* most calls on the RX side will do some sort of decode, so set up for that. */
-        UT_CFDP_SetupBasicRxState(&CF_AppData.engine.in.rx_pdudata);
+        UT_CFDP_SetupBasicRxState(&CF_AppData.engine.channels[UT_CFDP_CHANNEL].in.rx_pdudata);
         ut_config_table.chan[UT_CFDP_CHANNEL].rx_max_messages_per_wakeup = 1;
     }
 
@@ -325,6 +332,192 @@ void Test_CF_CFDP_ReceiveMessage(void)
     ph->pdu_header.destination_eid                                         = config->local_eid;
     UtAssert_VOIDCALL(CF_CFDP_ReceiveMessage(chan));
     UT_CF_AssertEventID(CF_CFDP_RX_DROPPED_ERR_EID);
+
+    /* recv correct destination_eid but the transaction pool is empty */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_RX, &ph, &chan, NULL, &txn, &config);
+    UT_ResetState(UT_KEY(CF_FindUnusedTransaction));
+    CF_AppData.hk.Payload.channel_hk[txn->chan_num].q_size[CF_QueueIdx_RX] = 0;
+    config->local_eid                                                      = 123;
+    ph->pdu_header.destination_eid                                         = config->local_eid;
+    UtAssert_VOIDCALL(CF_CFDP_ReceiveMessage(chan));
+    UtAssert_STUB_COUNT(CF_FindUnusedTransaction, 1);
+    UT_CF_AssertEventID(CF_CFDP_RX_DROPPED_ERR_EID);
+}
+
+void Test_CF_CFDP_ReceiveMessage_Ring(void)
+{
+    /* Test case for:
+     * void CF_CFDP_ReceiveMessage(CF_Channel_t *chan);
+     * with the channel receive task running
+     */
+    CF_Channel_t *    chan;
+    CF_Transaction_t *txn;
+
+    /* ring empty, the pipe is not read */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_RX, NULL, &chan, NULL, &txn, NULL);
+    chan->rx_task_id = CFE_ES_TASKID_C(CFE_ResourceId_FromInteger(1));
+    UtAssert_VOIDCALL(CF_CFDP_ReceiveMessage(chan));
+    UtAssert_STUB_COUNT(CFE_SB_ReceiveBuffer, 0);
+    UtAssert_STUB_COUNT(CF_CFDP_DispatchRecv, 0);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].counters.recv.ring_occupancy, 0);
+
+    /* two messages waiting, only one allowed per wakeup */
+    UT_SetHandlerFunction(UT_KEY(CF_FindUnusedTransaction), UT_AltHandler_GenericPointerReturn, txn);
+    chan->rx_ring.head = 2;
+    UtAssert_VOIDCALL(CF_CFDP_ReceiveMessage(chan));
+    UtAssert_STUB_COUNT(CFE_SB_ReceiveBuffer, 0);
+    UtAssert_STUB_COUNT(CF_CFDP_DispatchRecv, 1);
+    UtAssert_UINT32_EQ(chan->rx_ring.tail, 1);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].counters.recv.ring_occupancy, 2);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].counters.recv.ring_high_water, 2);
+
+    /* the high water mark holds as the ring drains */
+    UtAssert_VOIDCALL(CF_CFDP_ReceiveMessage(chan));
+    UtAssert_STUB_COUNT(CF_CFDP_DispatchRecv, 2);
+    UtAssert_UINT32_EQ(chan->rx_ring.tail, 2);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].counters.recv.ring_occupancy, 1);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].counters.recv.ring_high_water, 2);
+
+    /* the header was decoded by the receive task, so it is not decoded again */
+    UtAssert_STUB_COUNT(CF_CFDP_RecvPh, 0);
+    UtAssert_STUB_COUNT(CF_CFDP_DecodeStart, 0);
+
+    /* a transaction the task found that is still indexed under the PDU ID is used as is */
+    UT_ResetState(UT_KEY(CF_FindUnusedTransaction));
+    UT_ResetState(UT_KEY(CF_FindTransactionBySequenceNumber));
+    txn->state                                     = CF_TxnState_R2;
+    txn->hash_head                                 = &chan->txn_hash[0];
+    txn->history->src_eid                          = 7;
+    txn->history->seq_num                          = 9;
+    chan->rx_ring.head                             = 3;
+    chan->rx_ring.slots[2].txn                     = txn;
+    chan->rx_ring.slots[2].pdu_header.source_eid   = 7;
+    chan->rx_ring.slots[2].pdu_header.sequence_num = 9;
+    UT_SetHandlerFunction(UT_KEY(CF_CFDP_DispatchRecv), UT_AltHandler_CaptureDispatchTxn, NULL);
+    UtAssert_VOIDCALL(CF_CFDP_ReceiveMessage(chan));
+    UtAssert_STUB_COUNT(CF_FindTransactionBySequenceNumber, 0);
+    UtAssert_STUB_COUNT(CF_CFDP_DispatchRecv, 3);
+    UtAssert_ADDRESS_EQ(UT_CF_CapturedTxn, txn);
+
+    /* the engine finished it since, so it is looked up again */
+    txn->hash_head         = NULL;
+    chan->rx_ring.head     = 4;
+    chan->rx_ring.slots[3] = chan->rx_ring.slots[2];
+    UtAssert_VOIDCALL(CF_CFDP_ReceiveMessage(chan));
+    UtAssert_STUB_COUNT(CF_FindTransactionBySequenceNumber, 1);
+
+    /* what the task counted is added to housekeeping, once */
+    CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].counters.recv.pdu = 0;
+    chan->rx_ring.pdu                                                    = 5;
+    chan->rx_ring.error                                                  = 2;
+    chan->rx_ring.overflow                                               = 3;
+    UtAssert_VOIDCALL(CF_CFDP_ReceiveMessage(chan));
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].counters.recv.pdu, 5);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].counters.recv.error, 2);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].counters.recv.ring_overflow, 3);
+
+    /* after a housekeeping reset only what the task counts from then on shows up */
+    memset(&CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].counters.recv, 0,
+           sizeof(CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].counters.recv));
+    chan->rx_ring.overflow = 4;
+    UtAssert_VOIDCALL(CF_CFDP_ReceiveMessage(chan));
+    UtAssert_ZERO(CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].counters.recv.pdu);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].counters.recv.ring_overflow, 1);
+}
+
+void Test_CF_CFDP_RxTaskMain(void)
+{
+    /* Test case for:
+     * void CF_CFDP_RxTaskMain(void);
+     */
+    CF_Channel_t *    chan;
+    CF_Transaction_t *txn;
+    CFE_ES_TaskId_t   task_id = CFE_ES_TASKID_C(CFE_ResourceId_FromInteger(1));
+    CFE_SB_Buffer_t * bufptr  = &UT_r_msg.sb_buf;
+    CFE_MSG_Size_t    msg_size;
+
+    /* no channel has this task, gives up after retries */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, &chan, NULL, NULL, NULL);
+    UT_SetDataBuffer(UT_KEY(CFE_ES_GetTaskID), &task_id, sizeof(task_id), false);
+    UtAssert_VOIDCALL(CF_CFDP_RxTaskMain());
+    UtAssert_STUB_COUNT(OS_TaskDelay, CF_STARTUP_SEM_MAX_RETRIES);
+    UtAssert_STUB_COUNT(CFE_SB_ReceiveBuffer, 0);
+    UtAssert_STUB_COUNT(CFE_ES_ExitChildTask, 1);
+
+    /* nominal, one message copied into the ring then the pipe fails */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, &chan, NULL, NULL, NULL);
+    chan->rx_task_id                     = task_id;
+    msg_size                             = sizeof(UT_r_msg);
+    UT_r_msg.bytes[sizeof(UT_r_msg) - 1] = 0x5a;
+    UT_SetDataBuffer(UT_KEY(CFE_ES_GetTaskID), &task_id, sizeof(task_id), false);
+    UT_SetDataBuffer(UT_KEY(CFE_SB_ReceiveBuffer), &bufptr, sizeof(bufptr), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &msg_size, sizeof(msg_size), false);
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 2, CFE_SB_PIPE_RD_ERR);
+    UtAssert_VOIDCALL(CF_CFDP_RxTaskMain());
+    UtAssert_STUB_COUNT(OS_TaskDelay, CF_STARTUP_SEM_MAX_RETRIES); /* no increment */
+    UtAssert_STUB_COUNT(CFE_SB_ReceiveBuffer, 2);
+    UtAssert_UINT32_EQ(chan->rx_ring.head, 1);
+    UtAssert_UINT32_EQ(chan->rx_ring.slots[0].msg.bytes[sizeof(UT_r_msg) - 1], 0x5a);
+    UtAssert_UINT32_EQ(chan->rx_ring.pdu, 1);
+    UtAssert_ZERO(chan->rx_ring.overflow);
+    UtAssert_STUB_COUNT(CF_CFDP_DecodePh, 1);
+    UtAssert_STUB_COUNT(CF_FindTransactionBySequenceNumber, 1);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 1);
+    UtAssert_STUB_COUNT(CFE_ES_ExitChildTask, 2);
+
+    /* the transaction the task found is kept with the PDU */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_RX, NULL, &chan, NULL, &txn, NULL);
+    chan->rx_task_id = task_id;
+    UT_SetDataBuffer(UT_KEY(CFE_ES_GetTaskID), &task_id, sizeof(task_id), false);
+    UT_SetDataBuffer(UT_KEY(CFE_SB_ReceiveBuffer), &bufptr, sizeof(bufptr), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &msg_size, sizeof(msg_size), false);
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 2, CFE_SB_PIPE_RD_ERR);
+    UT_SetHandlerFunction(UT_KEY(CF_FindTransactionBySequenceNumber), UT_AltHandler_GenericPointerReturn, txn);
+    UtAssert_VOIDCALL(CF_CFDP_RxTaskMain());
+    UtAssert_UINT32_EQ(chan->rx_ring.head, 1);
+    UtAssert_ADDRESS_EQ(chan->rx_ring.slots[0].txn, txn);
+    UT_ResetState(UT_KEY(CF_FindTransactionBySequenceNumber));
+
+    /* header does not decode, dropped and counted as an error */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, &chan, NULL, NULL, NULL);
+    chan->rx_task_id = task_id;
+    UT_SetDataBuffer(UT_KEY(CFE_ES_GetTaskID), &task_id, sizeof(task_id), false);
+    UT_SetDataBuffer(UT_KEY(CFE_SB_ReceiveBuffer), &bufptr, sizeof(bufptr), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &msg_size, sizeof(msg_size), false);
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 2, CFE_SB_PIPE_RD_ERR);
+    UT_SetDeferredRetcode(UT_KEY(CF_CFDP_DecodePh), 1, CF_SHORT_PDU_ERROR);
+    UtAssert_VOIDCALL(CF_CFDP_RxTaskMain());
+    UtAssert_ZERO(chan->rx_ring.head);
+    UtAssert_UINT32_EQ(chan->rx_ring.error, 1);
+    UtAssert_ZERO(chan->rx_ring.pdu);
+    UtAssert_STUB_COUNT(CF_FindTransactionBySequenceNumber, 0);
+
+    /* ring full, message dropped */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, &chan, NULL, NULL, NULL);
+    chan->rx_task_id   = task_id;
+    chan->rx_ring.head = CF_RX_RING_DEPTH_PER_CHAN;
+    UT_SetDataBuffer(UT_KEY(CFE_ES_GetTaskID), &task_id, sizeof(task_id), false);
+    UT_SetDataBuffer(UT_KEY(CFE_SB_ReceiveBuffer), &bufptr, sizeof(bufptr), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &msg_size, sizeof(msg_size), false);
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 2, CFE_SB_PIPE_RD_ERR);
+    UtAssert_VOIDCALL(CF_CFDP_RxTaskMain());
+    UtAssert_UINT32_EQ(chan->rx_ring.head, CF_RX_RING_DEPTH_PER_CHAN);
+    UtAssert_UINT32_EQ(chan->rx_ring.overflow, 1);
+    UtAssert_ZERO(CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].counters.recv.ring_overflow);
+
+    /* message too big for a slot, dropped */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, &chan, NULL, NULL, NULL);
+    chan->rx_task_id   = task_id;
+    chan->rx_ring.head = 0;
+    msg_size           = CF_RX_RING_SLOT_SIZE + 1;
+    UT_SetDataBuffer(UT_KEY(CFE_ES_GetTaskID), &task_id, sizeof(task_id), false);
+    UT_SetDataBuffer(UT_KEY(CFE_SB_ReceiveBuffer), &bufptr, sizeof(bufptr), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &msg_size, sizeof(msg_size), false);
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 2, CFE_SB_PIPE_RD_ERR);
+    UtAssert_VOIDCALL(CF_CFDP_RxTaskMain());
+    UtAssert_UINT32_EQ(chan->rx_ring.head, 0);
+    UtAssert_UINT32_EQ(chan->rx_ring.overflow, 1);
 }
 
 void Test_CF_CFDP_Send(void)
@@ -333,13 +526,94 @@ void Test_CF_CFDP_Send(void)
      * void CF_CFDP_Send(uint8 chan_num, const CF_Logical_PduBuffer_t *ph)
      */
     CF_Logical_PduBuffer_t *ph;
+    CF_Channel_t *          chan;
+    CF_ConfigTable_t *      config;
 
     /* nominal */
-    UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, &ph, NULL, NULL, NULL, NULL);
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, &ph, &chan, NULL, NULL, NULL);
+    chan->out_tokens = 0;
     UtAssert_VOIDCALL(CF_CFDP_Send(UT_CFDP_CHANNEL, ph));
     UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].counters.sent.pdu, 1);
     UtAssert_STUB_COUNT(CFE_MSG_SetSize, 1);
     UtAssert_STUB_COUNT(CFE_SB_TransmitBuffer, 1);
+    UtAssert_INT32_EQ(chan->out_tokens, 0);
+
+    /* with a byte rate, the PDU size is taken from the tokens */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, &ph, &chan, NULL, NULL, &config);
+    config->chan[UT_CFDP_CHANNEL].max_outgoing_bytes_per_second = 1000;
+    ph->pdu_header.header_encoded_length                        = 10;
+    ph->pdu_header.data_encoded_length                          = 100;
+    chan->out_tokens                                            = 50;
+    UtAssert_VOIDCALL(CF_CFDP_Send(UT_CFDP_CHANNEL, ph));
+    UtAssert_INT32_EQ(chan->out_tokens, -60);
+}
+
+static void UT_AltHandler_CFE_TIME_Subtract_OneSecond(void *UserObj, UT_EntryKey_t FuncKey,
+                                                      const UT_StubContext_t *Context)
+{
+    CFE_TIME_SysTime_t elapsed = {1, 0};
+
+    UT_Stub_SetReturnValue(FuncKey, elapsed);
+}
+
+void Test_CF_CFDP_RefillOutputTokens(void)
+{
+    /* Test case for:
+     * void CF_CFDP_RefillOutputTokens(CF_Channel_t *chan);
+     */
+    CF_Channel_t *    chan;
+    CF_ConfigTable_t *config;
+
+    /* no limit, tokens are cleared */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, &chan, NULL, NULL, NULL);
+    chan->out_tokens = -500;
+    UtAssert_VOIDCALL(CF_CFDP_RefillOutputTokens(chan));
+    UtAssert_INT32_EQ(chan->out_tokens, 0);
+
+    /* time did not move forward, nothing added */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, &chan, NULL, NULL, &config);
+    config->chan[UT_CFDP_CHANNEL].max_outgoing_bytes_per_second = 10000;
+    chan->out_tokens                                            = 0;
+    chan->out_frac                                              = 0;
+    UtAssert_VOIDCALL(CF_CFDP_RefillOutputTokens(chan));
+    UtAssert_INT32_EQ(chan->out_tokens, 0);
+
+    /* 0.1 sec elapsed */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TIME_Compare), CFE_TIME_A_GT_B);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TIME_Sub2MicroSecs), 100000);
+    UtAssert_VOIDCALL(CF_CFDP_RefillOutputTokens(chan));
+    UtAssert_INT32_EQ(chan->out_tokens, 1000);
+
+    /* a debt is paid back first */
+    chan->out_tokens = -300;
+    UtAssert_VOIDCALL(CF_CFDP_RefillOutputTokens(chan));
+    UtAssert_INT32_EQ(chan->out_tokens, 700);
+
+    /* unused tokens are only kept up to one PDU */
+    chan->out_tokens = 5 * CF_MAX_PDU_SIZE;
+    UtAssert_VOIDCALL(CF_CFDP_RefillOutputTokens(chan));
+    UtAssert_INT32_EQ(chan->out_tokens, CF_MAX_PDU_SIZE + 1000);
+
+    /* slow rate, the fraction carries over to the next refill */
+    config->chan[UT_CFDP_CHANNEL].max_outgoing_bytes_per_second = 15;
+    chan->out_tokens                                            = 0;
+    UtAssert_VOIDCALL(CF_CFDP_RefillOutputTokens(chan));
+    UtAssert_INT32_EQ(chan->out_tokens, 1);
+    UtAssert_VOIDCALL(CF_CFDP_RefillOutputTokens(chan));
+    UtAssert_INT32_EQ(chan->out_tokens, 3);
+    UtAssert_ZERO(chan->out_frac);
+
+    /* a second or more elapsed, only one second worth is added */
+    UT_SetHandlerFunction(UT_KEY(CFE_TIME_Subtract), UT_AltHandler_CFE_TIME_Subtract_OneSecond, NULL);
+    chan->out_tokens = 0;
+    UtAssert_VOIDCALL(CF_CFDP_RefillOutputTokens(chan));
+    UtAssert_INT32_EQ(chan->out_tokens, 15);
+
+    /* a rate beyond the range of the token count is capped rather than wrapping negative */
+    config->chan[UT_CFDP_CHANNEL].max_outgoing_bytes_per_second = UINT32_MAX;
+    chan->out_tokens                                            = 5 * CF_MAX_PDU_SIZE;
+    UtAssert_VOIDCALL(CF_CFDP_RefillOutputTokens(chan));
+    UtAssert_INT32_EQ(chan->out_tokens, INT32_MAX);
 }
 
 void Test_CF_CFDP_MsgOutGet(void)
@@ -350,6 +624,7 @@ void Test_CF_CFDP_MsgOutGet(void)
     CF_Transaction_t *txn;
     CF_ConfigTable_t *config;
     CF_Channel_t *    chan;
+    uint32            sem_takes;
 
     /* nominal */
     UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, NULL, &txn, NULL);
@@ -357,10 +632,12 @@ void Test_CF_CFDP_MsgOutGet(void)
     UtAssert_STUB_COUNT(CFE_SB_ReleaseMessageBuffer, 0);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 
-    /* This should discard the old message, and get a new one */
-    UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, NULL, &txn, NULL);
+    /* This should put back the old message, and hand it out again */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, NULL, &chan, NULL, &txn, NULL);
     UtAssert_NOT_NULL(CF_CFDP_MsgOutGet(txn, false));
-    UtAssert_STUB_COUNT(CFE_SB_ReleaseMessageBuffer, 1);
+    UtAssert_STUB_COUNT(CFE_SB_ReleaseMessageBuffer, 0);
+    UtAssert_STUB_COUNT(CFE_SB_AllocateMessageBuffer, 1);
+    UtAssert_ADDRESS_EQ(chan->out.msg, &UT_s_msg.sb_buf);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 
     /* test the various throttling mechanisms */
@@ -369,13 +646,32 @@ void Test_CF_CFDP_MsgOutGet(void)
     UtAssert_NOT_NULL(CF_CFDP_MsgOutGet(txn, false));
     UtAssert_NULL(CF_CFDP_MsgOutGet(txn, false));
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    CF_CFDP_ReleaseOutput(chan);
 
     UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, NULL, &chan, NULL, &txn, NULL);
     chan->sem_id = OS_ObjectIdFromInteger(123);
     UtAssert_NOT_NULL(CF_CFDP_MsgOutGet(txn, false));
+    CF_CFDP_ReleaseOutput(chan);
     UT_SetDeferredRetcode(UT_KEY(OS_CountSemTimedWait), 1, OS_ERROR_TIMEOUT);
     UtAssert_NULL(CF_CFDP_MsgOutGet(txn, false));
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_BOOL_TRUE(chan->out_batch.blocked);
+
+    /* blocked for the rest of the cycle, without asking again */
+    sem_takes = UT_GetStubCount(UT_KEY(OS_CountSemTimedWait));
+    UtAssert_NULL(CF_CFDP_MsgOutGet(txn, false));
+    UtAssert_STUB_COUNT(OS_CountSemTimedWait, sem_takes);
+    CF_CFDP_ReleaseOutput(chan);
+
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, NULL, &chan, NULL, &txn, &config);
+    config->chan[UT_CFDP_CHANNEL].max_outgoing_bytes_per_second = 1000;
+    chan->out_tokens                                            = 1;
+    UtAssert_NOT_NULL(CF_CFDP_MsgOutGet(txn, false));
+    chan->out_tokens = 0;
+    UtAssert_NULL(CF_CFDP_MsgOutGet(txn, false));
+    UtAssert_ADDRESS_EQ(chan->cur, txn);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    CF_CFDP_ReleaseOutput(chan);
 
     /* transaction is suspended */
     UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, &txn, NULL);
@@ -390,17 +686,121 @@ void Test_CF_CFDP_MsgOutGet(void)
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
     CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].frozen = 0;
 
-    /* no msg available from SB */
-    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, &txn, NULL);
+    /* no msg available from SB, the credit taken for it goes back */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, &chan, NULL, &txn, NULL);
+    UT_ResetState(UT_KEY(OS_CountSemGive));
     UtAssert_NULL(CF_CFDP_MsgOutGet(txn, false));
     UT_CF_AssertEventID(CF_CFDP_NO_MSG_ERR_EID);
+    UtAssert_STUB_COUNT(OS_CountSemGive, 1);
+    CF_CFDP_ReleaseOutput(chan);
 
     /* same, but the silent flag should suppress the event */
-    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, &txn, NULL);
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, &chan, NULL, &txn, NULL);
     UtAssert_NULL(CF_CFDP_MsgOutGet(txn, true));
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
+void Test_CF_CFDP_MsgOutGet_Batch(void)
+{
+    /* Test case for:
+        CF_Logical_PduBuffer_t *CF_CFDP_MsgOutGet(const CF_Transaction_t *txn, bool silent)
+     */
+    CF_Transaction_t *txn;
+    CF_ConfigTable_t *config;
+    CF_Channel_t *    chan;
+    CFE_SB_Buffer_t * bufs[3];
+
+    bufs[0] = &UT_s_msg.sb_buf;
+    bufs[1] = &UT_s_msg.sb_buf;
+    bufs[2] = &UT_s_msg.sb_buf;
+
+    /* a cycle reserves one at first, then twice the last refill, handing them out without asking again */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, &chan, NULL, &txn, NULL);
+    chan->sem_id = OS_ObjectIdFromInteger(123);
+    UT_SetDataBuffer(UT_KEY(CFE_SB_AllocateMessageBuffer), bufs, sizeof(bufs), true);
+    UtAssert_NOT_NULL(CF_CFDP_MsgOutGet(txn, false));
+    UtAssert_STUB_COUNT(CFE_SB_AllocateMessageBuffer, 1);
+    UtAssert_UINT32_EQ(chan->out_batch.count, 0);
+    UtAssert_UINT32_EQ(chan->out_batch.want, 2);
+    chan->out.msg = NULL;
+    UtAssert_NOT_NULL(CF_CFDP_MsgOutGet(txn, false));
+    UtAssert_UINT32_EQ(chan->out_batch.count, 1);
+    UtAssert_UINT32_EQ(chan->out_batch.want, 4);
+    chan->out.msg = NULL;
+    UtAssert_NOT_NULL(CF_CFDP_MsgOutGet(txn, false));
+    UtAssert_STUB_COUNT(CFE_SB_AllocateMessageBuffer, 3);
+    UtAssert_STUB_COUNT(OS_CountSemTimedWait, 3);
+    UtAssert_UINT32_EQ(chan->out_batch.count, 0);
+    chan->out.msg = NULL;
+    CF_CFDP_ReleaseOutput(chan);
+
+    /* the growth stops at the batch size */
+    chan->out_batch.want = CF_OUTPUT_BATCH_PER_CHAN - 1;
+    UT_ResetState(UT_KEY(CFE_SB_AllocateMessageBuffer));
+    UT_SetDataBuffer(UT_KEY(CFE_SB_AllocateMessageBuffer), bufs, sizeof(bufs), true);
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemTimedWait), 2, OS_ERROR_TIMEOUT);
+    UtAssert_NOT_NULL(CF_CFDP_MsgOutGet(txn, false));
+    UtAssert_UINT32_EQ(chan->out_batch.want, CF_OUTPUT_BATCH_PER_CHAN);
+    chan->out.msg = NULL;
+    CF_CFDP_ReleaseOutput(chan);
+
+    /* no more full size PDUs than the byte rate tokens allow */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, &chan, NULL, &txn, &config);
+    config->chan[UT_CFDP_CHANNEL].max_outgoing_bytes_per_second = 1000;
+    chan->out_tokens                                            = CF_MAX_PDU_SIZE + 1;
+    chan->out_batch.want                                        = 3;
+    UT_ResetState(UT_KEY(CFE_SB_AllocateMessageBuffer));
+    UT_SetDataBuffer(UT_KEY(CFE_SB_AllocateMessageBuffer), bufs, sizeof(bufs), true);
+    UtAssert_NOT_NULL(CF_CFDP_MsgOutGet(txn, false));
+    UtAssert_STUB_COUNT(CFE_SB_AllocateMessageBuffer, 2);
+    UtAssert_UINT32_EQ(chan->out_batch.count, 1);
+    chan->out.msg = NULL;
+    CF_CFDP_ReleaseOutput(chan);
+
+    /* no more than the message limit allows */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, &chan, NULL, &txn, &config);
+    config->chan[UT_CFDP_CHANNEL].max_outgoing_messages_per_wakeup = 2;
+    chan->outgoing_counter                                         = 0;
+    chan->out_batch.want                                           = 3;
+    UT_ResetState(UT_KEY(CFE_SB_AllocateMessageBuffer));
+    UT_SetDataBuffer(UT_KEY(CFE_SB_AllocateMessageBuffer), bufs, sizeof(bufs), true);
+    UtAssert_NOT_NULL(CF_CFDP_MsgOutGet(txn, false));
+    UtAssert_STUB_COUNT(CFE_SB_AllocateMessageBuffer, 2);
+    UtAssert_UINT32_EQ(chan->out_batch.count, 1);
+    chan->out.msg = NULL;
+    CF_CFDP_ReleaseOutput(chan);
+}
+
+void Test_CF_CFDP_ReleaseOutput(void)
+{
+    /* Test case for:
+        void CF_CFDP_ReleaseOutput(CF_Channel_t *chan)
+     */
+    CF_Channel_t *chan;
+
+    /* nothing reserved */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, &chan, NULL, NULL, NULL);
+    UtAssert_VOIDCALL(CF_CFDP_ReleaseOutput(chan));
+    UtAssert_STUB_COUNT(CFE_SB_ReleaseMessageBuffer, 0);
+    UtAssert_UINT32_EQ(chan->out_batch.want, 0);
+
+    /* unused buffers and their credits go back, along with one handed out but not sent */
+    chan->sem_id            = OS_ObjectIdFromInteger(123);
+    chan->out_batch.bufs[0] = &UT_s_msg.sb_buf;
+    chan->out_batch.bufs[1] = &UT_s_msg.sb_buf;
+    chan->out_batch.count   = 2;
+    chan->out_batch.want    = 4;
+    chan->out_batch.blocked = true;
+    chan->out.msg           = &UT_s_msg.sb_buf;
+    UtAssert_VOIDCALL(CF_CFDP_ReleaseOutput(chan));
+    UtAssert_STUB_COUNT(CFE_SB_ReleaseMessageBuffer, 3);
+    UtAssert_STUB_COUNT(OS_CountSemGive, 3);
+    UtAssert_NULL(chan->out.msg);
+    UtAssert_UINT32_EQ(chan->out_batch.count, 0);
+    UtAssert_UINT32_EQ(chan->out_batch.want, 0);
+    UtAssert_BOOL_FALSE(chan->out_batch.blocked);
+}
+
 /*******************************************************************************
 **
 **  cf_cfdp_tests UtTest_Setup
@@ -410,7 +810,14 @@ void Test_CF_CFDP_MsgOutGet(void)
 void UtTest_Setup(void)
 {
     UtTest_Add(Test_CF_CFDP_ReceiveMessage, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_ReceiveMessage");
+    UtTest_Add(Test_CF_CFDP_ReceiveMessage_Ring, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown,
+               "CF_CFDP_ReceiveMessage_Ring");
+    UtTest_Add(Test_CF_CFDP_RxTaskMain, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_RxTaskMain");
 
     UtTest_Add(Test_CF_CFDP_MsgOutGet, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_MsgOutGet");
+    UtTest_Add(Test_CF_CFDP_MsgOutGet_Batch, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_MsgOutGet_Batch");
+    UtTest_Add(Test_CF_CFDP_ReleaseOutput, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_ReleaseOutput");
     UtTest_Add(Test_CF_CFDP_Send, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_Send");
+    UtTest_Add(Test_CF_CFDP_RefillOutputTokens, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown,
+               "CF_CFDP_RefillOutputTokens");
 }
@@ -75,6 +75,7 @@ static void UT_CFDP_SetupBasicTestState(UT_CF_Setup_t setup, CF_Logical_PduBuffe
     static CF_History_t           ut_history;
     static CF_Transaction_t       ut_transaction;
     static CF_ConfigTable_t       ut_config_table;
+    static CF_ChunkWrapper_t      ut_chunks;
 
     /*
      * always clear all objects, regardless of what was asked for.
@@ -85,10 +86,12 @@ static void UT_CFDP_SetupBasicTestState(UT_CF_Setup_t setup, CF_Logical_PduBuffe
     memset(&ut_history, 0, sizeof(ut_history));
     memset(&ut_transaction, 0, sizeof(ut_transaction));
     memset(&ut_config_table, 0, sizeof(ut_config_table));
+    memset(&ut_chunks, 0, sizeof(ut_chunks));
 
     /* certain pointers should be connected even if they were not asked for,
      * as internal code may assume these are set (test cases may un-set) */
     ut_transaction.history  = &ut_history;
+    ut_transaction.chunks   = &ut_chunks;
     CF_AppData.config_table = &ut_config_table;
 
     if (pdu_buffer_p)
@@ -159,6 +162,9 @@ void cf_cfdp_tests_Setup(void)
      * previously left in here.
      */
     memset(&CF_AppData, 0, sizeof(CF_AppData));
+
+    /* Unless a test says otherwise, every checksum type can be computed */
+    UT_SetDefaultReturnValue(UT_KEY(CF_CRC_IsSupported), true);
 }
 
 void cf_cfdp_tests_Teardown(void)
@@ -248,6 +254,79 @@ void Test_CF_CFDP_ArmAckTimer(void)
 
     /* nominal call */
     UtAssert_VOIDCALL(CF_CFDP_ArmAckTimer(txn));
+    UtAssert_STUB_COUNT(CF_Timer_InitRelSec, 1);
+    UtAssert_STUB_COUNT(CF_Timer_Pause, 0);
+    UtAssert_BOOL_TRUE(txn->flags.com.ack_timer_armed);
+
+    /* suspended, so the timer is armed paused */
+    txn->flags.com.suspended = true;
+    UtAssert_VOIDCALL(CF_CFDP_ArmAckTimer(txn));
+    UtAssert_STUB_COUNT(CF_Timer_InitRelSec, 2);
+    UtAssert_STUB_COUNT(CF_Timer_Pause, 1);
+}
+
+void Test_CF_CFDP_ArmInactTimer(void)
+{
+    /* Test case for:
+     * void CF_CFDP_ArmInactTimer(CF_Transaction_t *txn)
+     */
+    CF_Transaction_t *txn;
+
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, &txn, NULL);
+
+    /* nominal call */
+    UtAssert_VOIDCALL(CF_CFDP_ArmInactTimer(txn));
+    UtAssert_STUB_COUNT(CF_Timer_InitRelSec, 1);
+    UtAssert_STUB_COUNT(CF_Timer_Pause, 0);
+
+    /* suspended, so the timer is armed paused */
+    txn->flags.com.suspended = true;
+    UtAssert_VOIDCALL(CF_CFDP_ArmInactTimer(txn));
+    UtAssert_STUB_COUNT(CF_Timer_InitRelSec, 2);
+    UtAssert_STUB_COUNT(CF_Timer_Pause, 1);
+}
+
+void Test_CF_CFDP_TimerExpired(void)
+{
+    /* Test case for:
+     * void CF_CFDP_AckTimerExpired(CF_Timer_t *timer)
+     * void CF_CFDP_InactTimerExpired(CF_Timer_t *timer)
+     */
+    CF_Transaction_t *txn;
+
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, &txn, NULL);
+
+    /* either timer puts its transaction on the tick list */
+    UtAssert_VOIDCALL(CF_CFDP_AckTimerExpired(&txn->ack_timer));
+    UtAssert_STUB_COUNT(CF_InsertTransactionTick, 1);
+
+    UtAssert_VOIDCALL(CF_CFDP_InactTimerExpired(&txn->inactivity_timer));
+    UtAssert_STUB_COUNT(CF_InsertTransactionTick, 2);
+}
+
+void Test_CF_CFDP_DispatchRecv(void)
+{
+    /* Test case for:
+     * void CF_CFDP_DispatchRecv(CF_Transaction_t *txn, CF_Logical_PduBuffer_t *ph)
+     */
+    CF_Transaction_t *      txn;
+    CF_Logical_PduBuffer_t *ph;
+
+    /* nominal, restarts the inactivity timer and ticks the transaction */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, &txn, NULL);
+    txn->flags.com.q_index = CF_QueueIdx_RX;
+    UtAssert_VOIDCALL(CF_CFDP_DispatchRecv(txn, ph));
+    UtAssert_STUB_COUNT(CF_CFDP_RxStateDispatch, 1);
+    UtAssert_STUB_COUNT(CF_Timer_InitRelSec, 1);
+    UtAssert_STUB_COUNT(CF_InsertTransactionTick, 1);
+
+    /* transaction freed while handling the PDU */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, &txn, NULL);
+    txn->flags.com.q_index = CF_QueueIdx_FREE;
+    UtAssert_VOIDCALL(CF_CFDP_DispatchRecv(txn, ph));
+    UtAssert_STUB_COUNT(CF_CFDP_RxStateDispatch, 2);
+    UtAssert_STUB_COUNT(CF_Timer_InitRelSec, 1);
+    UtAssert_STUB_COUNT(CF_InsertTransactionTick, 1);
 }
 
 void Test_CF_CFDP_RecvPh(void)
@@ -272,17 +351,39 @@ void Test_CF_CFDP_RecvPh(void)
     UtAssert_INT32_EQ(CF_CFDP_RecvPh(UT_CFDP_CHANNEL, ph), CF_SHORT_PDU_ERROR);
     UT_CF_AssertEventID(CF_PDU_SHORT_HEADER_ERR_EID);
 
-    /* decode error, large file bit set */
+    /* nominal, large file bit set */
     UT_CFDP_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, NULL, NULL);
     ph->pdu_header.large_flag = true;
-    UtAssert_INT32_EQ(CF_CFDP_RecvPh(UT_CFDP_CHANNEL, ph), CF_ERROR);
-    UT_CF_AssertEventID(CF_PDU_LARGE_FILE_ERR_EID);
+    UtAssert_INT32_EQ(CF_CFDP_RecvPh(UT_CFDP_CHANNEL, ph), 0);
 
     /* decode error, insufficient storage for EID or seq num */
     UT_CFDP_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, NULL, NULL);
     UT_SetDeferredRetcode(UT_KEY(CF_CFDP_DecodeHeader), 1, CF_ERROR);
     UtAssert_INT32_EQ(CF_CFDP_RecvPh(UT_CFDP_CHANNEL, ph), CF_ERROR);
     UT_CF_AssertEventID(CF_PDU_TRUNCATION_ERR_EID);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].counters.recv.pdu, 3);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].counters.recv.error, 2);
+}
+
+void Test_CF_CFDP_DecodePh(void)
+{
+    /* Test case for:
+     * CFE_Status_t CF_CFDP_DecodePh(CF_Logical_PduBuffer_t *ph)
+     */
+    CF_Logical_PduBuffer_t *ph;
+
+    /* nominal, nothing is counted */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, NULL, NULL);
+    UtAssert_INT32_EQ(CF_CFDP_DecodePh(ph), CFE_SUCCESS);
+    UtAssert_STUB_COUNT(CF_CFDP_DecodeFileDirectiveHeader, 1);
+    UtAssert_ZERO(CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].counters.recv.pdu);
+
+    /* decode error, reported but not counted */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, NULL, NULL);
+    CF_CODEC_SET_DONE(ph->pdec);
+    UtAssert_INT32_EQ(CF_CFDP_DecodePh(ph), CF_SHORT_PDU_ERROR);
+    UT_CF_AssertEventID(CF_PDU_SHORT_HEADER_ERR_EID);
+    UtAssert_ZERO(CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].counters.recv.error);
 }
 
 void Test_CF_CFDP_RecvMd(void)
@@ -307,10 +408,27 @@ void Test_CF_CFDP_RecvMd(void)
     md->source_filename.data_ptr = src;
     UtAssert_INT32_EQ(CF_CFDP_RecvMd(txn, ph), 0);
     UtAssert_UINT32_EQ(txn->fsize, md->size);
-    UtAssert_STRINGBUF_EQ(md->dest_filename.data_ptr, md->dest_filename.length, history->fnames.dst_filename,
-                          sizeof(history->fnames.dst_filename));
-    UtAssert_STRINGBUF_EQ(md->source_filename.data_ptr, md->source_filename.length, history->fnames.src_filename,
-                          sizeof(history->fnames.src_filename));
+    UtAssert_STRINGBUF_EQ(md->dest_filename.data_ptr, md->dest_filename.length, txn->fnames.dst_filename,
+                          sizeof(txn->fnames.dst_filename));
+    UtAssert_STRINGBUF_EQ(md->source_filename.data_ptr, md->source_filename.length, txn->fnames.src_filename,
+                          sizeof(txn->fnames.src_filename));
+    UtAssert_STUB_COUNT(CF_CRC_Start, 0); /* same checksum type as already in use */
+
+    /* different checksum type restarts the digest */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, &txn, NULL);
+    md                                             = &ph->int_header.md;
+    md->checksum_type                              = CF_CFDP_ChecksumType_CRC32;
+    txn->state_data.receive.r2.rx_crc_inline_bytes = 100;
+    UtAssert_INT32_EQ(CF_CFDP_RecvMd(txn, ph), 0);
+    UtAssert_STUB_COUNT(CF_CRC_Start, 1);
+    UtAssert_ZERO(txn->state_data.receive.r2.rx_crc_inline_bytes);
+
+    /* unsupported checksum type */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, &txn, NULL);
+    UT_SetDeferredRetcode(UT_KEY(CF_CRC_IsSupported), 1, false);
+    UtAssert_INT32_EQ(CF_CFDP_RecvMd(txn, ph), CF_PDU_METADATA_ERROR);
+    UT_CF_AssertEventID(CF_PDU_MD_CHECKSUM_TYPE_ERR_EID);
+    UtAssert_INT32_EQ(txn->history->txn_stat, CF_TxnStatus_UNSUPPORTED_CHECKSUM_TYPE);
 
     /* decode errors: fixed part */
     UT_CFDP_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, NULL, &txn, NULL);
@@ -508,6 +626,15 @@ void Test_CF_CFDP_RecvIdle(void)
     ph->fdirective.directive_code = CF_CFDP_FileDirective_METADATA;
     UtAssert_VOIDCALL(CF_CFDP_RecvIdle(txn, ph));
     UtAssert_INT32_EQ(txn->state, CF_TxnState_R2);
+    UtAssert_BOOL_FALSE(txn->flags.com.large_file);
+
+    /* the sender's large file mode is kept for the transaction */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_RX, &ph, NULL, &history, &txn, NULL);
+    ph->fdirective.directive_code = CF_CFDP_FileDirective_METADATA;
+    ph->pdu_header.large_flag     = true;
+    UtAssert_VOIDCALL(CF_CFDP_RecvIdle(txn, ph));
+    UtAssert_INT32_EQ(txn->state, CF_TxnState_R2);
+    UtAssert_BOOL_TRUE(txn->flags.com.large_file);
 
     /* decode error in RecvMd */
     /* This will proceed to call CF_CFDP_ResetTransaction() which needs
@@ -572,6 +699,7 @@ CF_Logical_PduBuffer_t *CF_CFDP_ConstructPduHeader(const CF_Transaction_t *txn,
     UtAssert_UINT32_EQ(hdr->source_eid, 3);
     UtAssert_UINT32_EQ(hdr->destination_eid, 2);
     UtAssert_UINT32_EQ(hdr->sequence_num, 42);
+    UtAssert_UINT32_EQ(hdr->large_flag, 0);
     UtAssert_UINT32_EQ(ph->fdirective.directive_code, CF_CFDP_FileDirective_ACK);
 
     UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, &ph, NULL, NULL, &txn, NULL);
@@ -588,6 +716,76 @@ CF_Logical_PduBuffer_t *CF_CFDP_ConstructPduHeader(const CF_Transaction_t *txn,
     UtAssert_UINT32_EQ(hdr->source_eid, 7);
     UtAssert_UINT32_EQ(hdr->destination_eid, 6);
     UtAssert_UINT32_EQ(hdr->sequence_num, 44);
+
+    /* a large file transaction sets the flag in every PDU */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, &ph, NULL, NULL, &txn, NULL);
+    txn->state                = CF_TxnState_S2;
+    txn->flags.com.large_file = true;
+    UtAssert_NOT_NULL(CF_CFDP_ConstructPduHeader(txn, CF_CFDP_FileDirective_EOF, 3, 2, false, 42, false));
+    UtAssert_UINT32_EQ(ph->pdu_header.large_flag, 1);
+}
+
+static void UT_CFDP_Handler_CaptureHeaderTemplate(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CF_Logical_PduHeader_t *capture = UserObj;
+
+    *capture = *UT_Hook_GetArgValueByName(Context, "plh", const CF_Logical_PduHeader_t *);
+}
+
+void Test_CF_CFDP_InitFileDataHeader(void)
+{
+    /* Test case for:
+     * void CF_CFDP_InitFileDataHeader(CF_Transaction_t *txn);
+     */
+    CF_Transaction_t *     txn;
+    CF_History_t *         history;
+    CF_ConfigTable_t *     config;
+    CF_Logical_PduHeader_t hdr;
+
+    memset(&hdr, 0, sizeof(hdr));
+    UT_SetHandlerFunction(UT_KEY(CF_CFDP_EncodeHeaderTemplate), UT_CFDP_Handler_CaptureHeaderTemplate, &hdr);
+
+    /* same fields CF_CFDP_ConstructPduHeader would use for a file data PDU */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, &history, &txn, &config);
+    UT_SetDefaultReturnValue(UT_KEY(CF_CFDP_GetValueEncodedSize), 2);
+    config->local_eid = 7;
+    history->peer_eid = 6;
+    history->seq_num  = 44;
+    txn->state        = CF_TxnState_S2;
+    UtAssert_VOIDCALL(CF_CFDP_InitFileDataHeader(txn));
+    UtAssert_STUB_COUNT(CF_CFDP_EncodeHeaderTemplate, 1);
+    UtAssert_UINT32_EQ(hdr.version, 1);
+    UtAssert_UINT32_EQ(hdr.pdu_type, 1);
+    UtAssert_UINT32_EQ(hdr.direction, 0);
+    UtAssert_UINT32_EQ(hdr.txm_mode, 0);
+    UtAssert_UINT32_EQ(hdr.eid_length, 2);
+    UtAssert_UINT32_EQ(hdr.txn_seq_length, 2);
+    UtAssert_UINT32_EQ(hdr.source_eid, 7);
+    UtAssert_UINT32_EQ(hdr.destination_eid, 6);
+    UtAssert_UINT32_EQ(hdr.sequence_num, 44);
+}
+
+void Test_CF_CFDP_ConstructFileDataHeader(void)
+{
+    /* Test case for:
+     * CF_Logical_PduBuffer_t *CF_CFDP_ConstructFileDataHeader(CF_Transaction_t *txn, bool silent);
+     */
+    CF_Transaction_t *      txn;
+    CF_Logical_PduBuffer_t *ph;
+
+    /* no buffer, template is still built */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, &txn, NULL);
+    UtAssert_NULL(CF_CFDP_ConstructFileDataHeader(txn, true));
+    UtAssert_STUB_COUNT(CF_CFDP_EncodeHeaderTemplate, 1);
+    UtAssert_STUB_COUNT(CF_CFDP_EncodeHeaderFromTemplate, 0);
+
+    /* nominal, template already built so it is only copied */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, &ph, NULL, NULL, &txn, NULL);
+    txn->state_data.send.fd_header.hdr.header_encoded_length = 7;
+    UtAssert_ADDRESS_EQ(CF_CFDP_ConstructFileDataHeader(txn, false), ph);
+    UtAssert_STUB_COUNT(CF_CFDP_EncodeHeaderTemplate, 1);
+    UtAssert_STUB_COUNT(CF_CFDP_EncodeHeaderFromTemplate, 1);
+    UtAssert_STUB_COUNT(CF_CFDP_EncodeHeaderWithoutSize, 0);
 }
 
 void Test_CF_CFDP_SendMd(void)
@@ -607,29 +805,31 @@ void Test_CF_CFDP_SendMd(void)
 
     UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, &ph, NULL, &history, &txn, NULL);
     md = &ph->int_header.md;
-    strncpy(history->fnames.dst_filename, "dst1", sizeof(history->fnames.dst_filename));
-    strncpy(history->fnames.src_filename, "src1", sizeof(history->fnames.src_filename));
-    txn->state = CF_TxnState_S1;
-    txn->fsize = 1234;
+    strncpy(txn->fnames.dst_filename, "dst1", sizeof(txn->fnames.dst_filename));
+    strncpy(txn->fnames.src_filename, "src1", sizeof(txn->fnames.src_filename));
+    txn->state    = CF_TxnState_S1;
+    txn->fsize    = 1234;
+    txn->crc.type = CF_CFDP_ChecksumType_CRC32C;
     UtAssert_INT32_EQ(CF_CFDP_SendMd(txn), CFE_SUCCESS);
     UtAssert_UINT32_EQ(md->size, txn->fsize);
-    UtAssert_STRINGBUF_EQ(md->dest_filename.data_ptr, md->dest_filename.length, history->fnames.dst_filename,
-                          sizeof(history->fnames.dst_filename));
-    UtAssert_STRINGBUF_EQ(md->source_filename.data_ptr, md->source_filename.length, history->fnames.src_filename,
-                          sizeof(history->fnames.src_filename));
+    UtAssert_UINT32_EQ(md->checksum_type, CF_CFDP_ChecksumType_CRC32C);
+    UtAssert_STRINGBUF_EQ(md->dest_filename.data_ptr, md->dest_filename.length, txn->fnames.dst_filename,
+                          sizeof(txn->fnames.dst_filename));
+    UtAssert_STRINGBUF_EQ(md->source_filename.data_ptr, md->source_filename.length, txn->fnames.src_filename,
+                          sizeof(txn->fnames.src_filename));
 
     /* Class 2, also hit maximum string length */
     UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, &ph, NULL, &history, &txn, NULL);
     md = &ph->int_header.md;
-    memset(history->fnames.dst_filename, 0xFF, sizeof(history->fnames.dst_filename));
-    strncpy(history->fnames.src_filename, "src2", sizeof(history->fnames.src_filename));
+    memset(txn->fnames.dst_filename, 0xFF, sizeof(txn->fnames.dst_filename));
+    strncpy(txn->fnames.src_filename, "src2", sizeof(txn->fnames.src_filename));
     txn->state = CF_TxnState_S2;
     txn->fsize = 5678;
     UtAssert_INT32_EQ(CF_CFDP_SendMd(txn), CFE_SUCCESS);
     UtAssert_UINT32_EQ(md->size, txn->fsize);
-    UtAssert_UINT32_EQ(md->dest_filename.length, sizeof(history->fnames.dst_filename));
-    UtAssert_STRINGBUF_EQ(md->source_filename.data_ptr, md->source_filename.length, history->fnames.src_filename,
-                          sizeof(history->fnames.src_filename));
+    UtAssert_UINT32_EQ(md->dest_filename.length, sizeof(txn->fnames.dst_filename));
+    UtAssert_STRINGBUF_EQ(md->source_filename.data_ptr, md->source_filename.length, txn->fnames.src_filename,
+                          sizeof(txn->fnames.src_filename));
 }
 
 void Test_CF_CFDP_SendFd(void)
@@ -849,13 +1049,50 @@ void Test_CF_CFDP_InitEngine(void)
     /* Test case for:
      * int32 CF_CFDP_InitEngine(void)
      */
-    CF_ConfigTable_t *config;
+    CF_ConfigTable_t * config;
+    CF_ChunkWrapper_t *cw;
 
     /* nominal call, no sem */
     UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, NULL, &config);
     UtAssert_INT32_EQ(CF_CFDP_InitEngine(), 0);
     UtAssert_BOOL_TRUE(CF_AppData.engine.enabled);
     UtAssert_STUB_COUNT(CF_FreeTransaction, CF_NUM_TRANSACTIONS_PER_CHANNEL * CF_NUM_CHANNELS);
+    UtAssert_UINT32_EQ(CF_AppData.engine.channels[0].num_transactions, CF_NUM_TRANSACTIONS_PER_CHANNEL);
+    UtAssert_UINT32_EQ(CF_AppData.engine.channels[0].num_histories, CF_NUM_HISTORIES_PER_CHANNEL);
+    UtAssert_ADDRESS_EQ(CF_AppData.engine.channels[0].transactions, CF_AppData.engine.pool_arena);
+
+    /* pools sized by the table, with the rest of the channels at the default */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, NULL, &config);
+    UT_ResetState(UT_KEY(CF_FreeTransaction));
+    UT_ResetState(UT_KEY(CF_ChunkPool_Init));
+    UT_ResetState(UT_KEY(CF_ChunkListInitPool));
+    config->chan[0].max_transactions = 2;
+    config->chan[0].max_histories    = 3;
+    config->chan[0].rx_max_chunks    = 1;
+    config->chan[0].tx_max_chunks    = 1;
+    config->chan[0].txn_max_chunks   = 2;
+    UtAssert_INT32_EQ(CF_CFDP_InitEngine(), 0);
+    UtAssert_BOOL_TRUE(CF_AppData.engine.enabled);
+    UtAssert_STUB_COUNT(CF_FreeTransaction, 2 + (CF_NUM_TRANSACTIONS_PER_CHANNEL * (CF_NUM_CHANNELS - 1)));
+    UtAssert_STUB_COUNT(CF_ChunkPool_Init, CF_NUM_CHANNELS);
+    UtAssert_STUB_COUNT(CF_ChunkListInitPool,
+                        CF_Direction_NUM * (2 + (CF_NUM_TRANSACTIONS_PER_CHANNEL * (CF_NUM_CHANNELS - 1))));
+    UtAssert_UINT32_EQ(CF_AppData.engine.channels[0].num_transactions, 2);
+    UtAssert_UINT32_EQ(CF_AppData.engine.channels[0].num_histories, 3);
+
+    /* the chunk wrappers follow the transactions, and only the send lists merge when full */
+    cw = (CF_ChunkWrapper_t *)((uint8 *)CF_AppData.engine.pool_arena +
+                               ((2 * sizeof(CF_Transaction_t) + sizeof(uint64) - 1) & ~(sizeof(uint64) - 1)));
+    UtAssert_BOOL_FALSE(cw[CF_Direction_RX].chunks.cover_gaps);
+    UtAssert_BOOL_TRUE(cw[CF_Direction_TX].chunks.cover_gaps);
+
+    /* pools that do not fit in the arena */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, NULL, &config);
+    config->chan[0].max_transactions = 0xFFFF;
+    config->chan[0].max_histories    = 0xFFFF;
+    UtAssert_INT32_EQ(CF_CFDP_InitEngine(), CF_ERROR);
+    UtAssert_BOOL_FALSE(CF_AppData.engine.enabled);
+    UT_CF_AssertEventID(CF_INIT_POOL_ERR_EID);
 
     /* nominal call, with sem */
     UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, NULL, &config);
@@ -899,6 +1136,59 @@ void Test_CF_CFDP_InitEngine(void)
     UT_SetDeferredRetcode(UT_KEY(CFE_SB_SubscribeLocal), 1, CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
     UtAssert_INT32_EQ(CF_CFDP_InitEngine(), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
     UtAssert_BOOL_FALSE(CF_AppData.engine.enabled);
+
+    /* nominal call, with receive task */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, NULL, &config);
+    config->chan[0].rx_task_enabled = 1;
+    UtAssert_INT32_EQ(CF_CFDP_InitEngine(), 0);
+    UtAssert_BOOL_TRUE(CF_AppData.engine.enabled);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 1);
+    UtAssert_STUB_COUNT(OS_MutSemCreate, 1); /* guards the transaction index */
+
+    /* failure of OS_MutSemCreate for the transaction index */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, NULL, &config);
+    config->chan[0].rx_task_enabled = 1;
+    UT_SetDeferredRetcode(UT_KEY(OS_MutSemCreate), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CF_CFDP_InitEngine(), OS_ERROR);
+    UtAssert_BOOL_FALSE(CF_AppData.engine.enabled);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 1); /* no increment */
+    UT_CF_AssertEventID(CF_INIT_RX_TASK_ERR_EID);
+
+    /* failure of CFE_ES_CreateChildTask */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, NULL, &config);
+    config->chan[0].rx_task_enabled = 1;
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CreateChildTask), 1, CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+    UtAssert_INT32_EQ(CF_CFDP_InitEngine(), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+    UtAssert_BOOL_FALSE(CF_AppData.engine.enabled);
+    UT_CF_AssertEventID(CF_INIT_RX_TASK_ERR_EID);
+
+    /* nominal call, with worker tasks, which share one sequence number mutex */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, NULL, &config);
+    UT_ResetState(UT_KEY(CFE_ES_CreateChildTask));
+    UT_ResetState(UT_KEY(OS_MutSemCreate));
+    config->chan[0].worker_task_enabled = 1;
+    config->chan[1].worker_task_enabled = 1;
+    UtAssert_INT32_EQ(CF_CFDP_InitEngine(), 0);
+    UtAssert_BOOL_TRUE(CF_AppData.engine.enabled);
+    UtAssert_STUB_COUNT(OS_MutSemCreate, 1);
+    UtAssert_STUB_COUNT(OS_CountSemCreate, 4);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 2);
+
+    /* failure of OS_CountSemCreate */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, NULL, &config);
+    config->chan[0].worker_task_enabled = 1;
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemCreate), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CF_CFDP_InitEngine(), CF_ERROR);
+    UtAssert_BOOL_FALSE(CF_AppData.engine.enabled);
+    UT_CF_AssertEventID(CF_INIT_WORKER_TASK_ERR_EID);
+
+    /* failure of CFE_ES_CreateChildTask for the worker */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, NULL, NULL, NULL, &config);
+    config->chan[0].worker_task_enabled = 1;
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CreateChildTask), 1, CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+    UtAssert_INT32_EQ(CF_CFDP_InitEngine(), CF_ERROR);
+    UtAssert_BOOL_FALSE(CF_AppData.engine.enabled);
+    UT_CF_AssertEventID(CF_INIT_WORKER_TASK_ERR_EID);
 }
 
 void Test_CF_CFDP_TxFile(void)
@@ -925,9 +1215,10 @@ void Test_CF_CFDP_TxFile(void)
     UT_SetHandlerFunction(UT_KEY(CF_CList_Pop), UT_AltHandler_GenericPointerReturn, &chunk_wrap.cl_node);
     chan->cs[CF_Direction_TX] = &chunk_wrap.cl_node;
     UtAssert_INT32_EQ(CF_CFDP_TxFile(src, dest, CF_CFDP_CLASS_1, 1, UT_CFDP_CHANNEL, 0, 1), 0);
-    UtAssert_STRINGBUF_EQ(dest, -1, history->fnames.dst_filename, sizeof(history->fnames.dst_filename));
-    UtAssert_STRINGBUF_EQ(src, -1, history->fnames.src_filename, sizeof(history->fnames.src_filename));
+    UtAssert_STRINGBUF_EQ(dest, -1, txn->fnames.dst_filename, sizeof(txn->fnames.dst_filename));
+    UtAssert_STRINGBUF_EQ(src, -1, txn->fnames.src_filename, sizeof(txn->fnames.src_filename));
     UtAssert_UINT32_EQ(chan->num_cmd_tx, 1);
+    UtAssert_STUB_COUNT(CF_InsertTransactionIndex, 1);
     UT_CF_AssertEventID(CF_CFDP_S_START_SEND_INF_EID);
 
     /* same but for class 2 (for branch coverage) */
@@ -936,16 +1227,37 @@ void Test_CF_CFDP_TxFile(void)
     UT_SetHandlerFunction(UT_KEY(CF_CList_Pop), UT_AltHandler_GenericPointerReturn, &chunk_wrap.cl_node);
     chan->cs[CF_Direction_TX] = &chunk_wrap.cl_node;
     UtAssert_INT32_EQ(CF_CFDP_TxFile(src, dest, CF_CFDP_CLASS_2, 1, UT_CFDP_CHANNEL, 0, 1), 0);
-    UtAssert_STRINGBUF_EQ(dest, -1, history->fnames.dst_filename, sizeof(history->fnames.dst_filename));
-    UtAssert_STRINGBUF_EQ(src, -1, history->fnames.src_filename, sizeof(history->fnames.src_filename));
+    UtAssert_STRINGBUF_EQ(dest, -1, txn->fnames.dst_filename, sizeof(txn->fnames.dst_filename));
+    UtAssert_STRINGBUF_EQ(src, -1, txn->fnames.src_filename, sizeof(txn->fnames.src_filename));
     UtAssert_UINT32_EQ(chan->num_cmd_tx, 2);
     UT_CF_AssertEventID(CF_CFDP_S_START_SEND_INF_EID);
 
+    /* with worker tasks, the sequence number is taken under the mutex */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, NULL, &chan, &history, &txn, NULL);
+    UT_SetHandlerFunction(UT_KEY(CF_FindUnusedTransaction), UT_AltHandler_GenericPointerReturn, txn);
+    UT_SetHandlerFunction(UT_KEY(CF_CList_Pop), UT_AltHandler_GenericPointerReturn, &chunk_wrap.cl_node);
+    chan->cs[CF_Direction_TX]   = &chunk_wrap.cl_node;
+    CF_AppData.engine.seq_num   = 7;
+    CF_AppData.engine.seq_mutex = OS_ObjectIdFromInteger(1);
+    UtAssert_INT32_EQ(CF_CFDP_TxFile(src, dest, CF_CFDP_CLASS_1, 1, UT_CFDP_CHANNEL, 0, 1), 0);
+    UtAssert_UINT32_EQ(history->seq_num, 8);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 1);
+    CF_AppData.engine.seq_mutex = OS_OBJECT_ID_UNDEFINED;
+
     /* max TX */
     UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, NULL, &chan, &history, &txn, NULL);
     chan->num_cmd_tx = CF_MAX_COMMANDED_PLAYBACK_FILES_PER_CHAN;
     UtAssert_INT32_EQ(CF_CFDP_TxFile(src, dest, CF_CFDP_CLASS_1, 1, UT_CFDP_CHANNEL, 0, 1), -1);
     UT_CF_AssertEventID(CF_CFDP_MAX_CMD_TX_ERR_EID);
+
+    /* transaction pool is empty (CF_FindUnusedTransaction returns NULL by default) */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, NULL, &chan, &history, &txn, NULL);
+    UT_ResetState(UT_KEY(CF_FindUnusedTransaction));
+    chan->num_cmd_tx = 0;
+    UtAssert_INT32_EQ(CF_CFDP_TxFile(src, dest, CF_CFDP_CLASS_1, 1, UT_CFDP_CHANNEL, 0, 1), -1);
+    UtAssert_UINT32_EQ(chan->num_cmd_tx, 0);
+    UT_CF_AssertEventID(CF_CFDP_NO_TXN_ERR_EID);
 }
 
 void Test_CF_CFDP_PlaybackDir(void)
@@ -1034,6 +1346,19 @@ void Test_CF_CFDP_CycleTx(void)
     chan->qs[CF_QueueIdx_PEND] = &txn2.cl_node;
     UtAssert_VOIDCALL(CF_CFDP_CycleTx(chan));
     UtAssert_STUB_COUNT(CF_CList_Traverse, 2);
+    UtAssert_UINT32_EQ(txn2.flags.com.q_index, CF_QueueIdx_TXA);
+    UtAssert_STUB_COUNT(CFE_TIME_GetTime, 1);
+
+    /* round-robin mode, nothing to send */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, NULL, &chan, NULL, &txn, &config);
+    UT_ResetState(UT_KEY(CF_CList_Traverse));
+    chan->qs[CF_QueueIdx_PEND]                    = NULL;
+    config->chan[UT_CFDP_CHANNEL].dequeue_enabled = 1;
+    config->chan[UT_CFDP_CHANNEL].tx_drr_enabled  = 1;
+    UtAssert_VOIDCALL(CF_CFDP_CycleTx(chan));
+    UtAssert_STUB_COUNT(CF_CList_Traverse, 1);
+    UtAssert_STUB_COUNT(CF_CFDP_TxStateDispatch, 0);
+    UtAssert_NULL(chan->cur);
 }
 
 static int32 Ut_Hook_StateHandler_SetQIndex(void *UserObj, int32 StubRetcode, uint32 CallCount,
@@ -1077,6 +1402,148 @@ void Test_CF_CFDP_CycleTxFirstActive(void)
     UtAssert_INT32_EQ(CF_CFDP_CycleTxFirstActive(&txn->cl_node, &args), CF_CListTraverse_Status_EXIT);
 }
 
+static int32 Ut_Hook_CycleTxDrr_SetFirst(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                         const UT_StubContext_t *Context)
+{
+    CF_CFDP_ActiveTx_args_t *args = UT_Hook_GetArgValueByName(Context, "context", CF_CFDP_ActiveTx_args_t *);
+    CF_Transaction_t *       txn  = UserObj;
+
+    /* stands in for CF_CFDP_CountActiveTx on a queue holding just this transaction */
+    if (txn->flags.com.q_index == CF_QueueIdx_TXA)
+    {
+        args->first      = txn;
+        args->num_active = 1;
+    }
+
+    return StubRetcode;
+}
+
+static int32 Ut_Hook_CycleTxDrr_SetCur(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                       const UT_StubContext_t *Context)
+{
+    CF_Transaction_t *txn = UT_Hook_GetArgValueByName(Context, "txn", CF_Transaction_t *);
+
+    /* out of output buffers on the given call, CallCount starts from 0 */
+    if ((CallCount + 1) == *((uint32 *)UserObj))
+    {
+        CF_AppData.engine.channels[txn->chan_num].cur = txn;
+    }
+
+    return StubRetcode;
+}
+
+void Test_CF_CFDP_CycleTxDrr(void)
+{
+    /* Test case for:
+     * void CF_CFDP_CycleTxDrr(CF_Channel_t *chan)
+     */
+    CF_Channel_t *    chan;
+    CF_Transaction_t *txn;
+    CF_ConfigTable_t *config;
+    CF_Transaction_t  txn2;
+    uint32            cur_call;
+
+    /* nothing active or pending */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, NULL, &chan, NULL, &txn, &config);
+    UtAssert_VOIDCALL(CF_CFDP_CycleTxDrr(chan));
+    UtAssert_STUB_COUNT(CF_CFDP_TxStateDispatch, 0);
+
+    /* highest priority gets a full turn, cut short when out of buffers on the 3rd PDU */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, NULL, &chan, NULL, &txn, &config);
+    CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].q_size[CF_QueueIdx_TXA] = 10;
+    txn->state                                                                = CF_TxnState_S1;
+    txn->flags.com.q_index                                                    = CF_QueueIdx_TXA;
+    txn->priority                                                             = 0;
+    cur_call                                                                  = 3;
+    UT_SetHookFunction(UT_KEY(CF_CList_Traverse), Ut_Hook_CycleTxDrr_SetFirst, txn);
+    UT_SetHookFunction(UT_KEY(CF_CFDP_TxStateDispatch), Ut_Hook_CycleTxDrr_SetCur, &cur_call);
+    UtAssert_VOIDCALL(CF_CFDP_CycleTxDrr(chan));
+    UtAssert_STUB_COUNT(CF_CFDP_TxStateDispatch, 3);
+    UtAssert_UINT32_EQ(txn->drr_deficit, CF_TX_DRR_MAX_QUANTUM - 2);
+    UtAssert_STUB_COUNT(CF_CList_InsertBack, 0);
+
+    /* the turn carries on at the next call without a new quantum, then the
+     * transaction goes to the back of the line and starts another turn */
+    chan->cur = NULL;
+    cur_call  = CF_TX_DRR_MAX_QUANTUM;
+    UT_ResetState(UT_KEY(CF_CFDP_TxStateDispatch));
+    UT_SetHookFunction(UT_KEY(CF_CFDP_TxStateDispatch), Ut_Hook_CycleTxDrr_SetCur, &cur_call);
+    UtAssert_VOIDCALL(CF_CFDP_CycleTxDrr(chan));
+    UtAssert_STUB_COUNT(CF_CFDP_TxStateDispatch, CF_TX_DRR_MAX_QUANTUM);
+    UtAssert_STUB_COUNT(CF_CList_InsertBack, 1);
+    UtAssert_UINT32_EQ(txn->drr_deficit, CF_TX_DRR_MAX_QUANTUM - 1);
+
+    /* lowest priority gets one PDU per turn */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, NULL, &chan, NULL, &txn, &config);
+    UT_ResetState(UT_KEY(CF_CFDP_TxStateDispatch));
+    UT_ResetState(UT_KEY(CF_CList_InsertBack));
+    chan->cur              = NULL;
+    txn->state             = CF_TxnState_S1;
+    txn->flags.com.q_index = CF_QueueIdx_TXA;
+    txn->priority          = 255;
+    cur_call               = 4;
+    UT_SetHookFunction(UT_KEY(CF_CList_Traverse), Ut_Hook_CycleTxDrr_SetFirst, txn);
+    UT_SetHookFunction(UT_KEY(CF_CFDP_TxStateDispatch), Ut_Hook_CycleTxDrr_SetCur, &cur_call);
+    UtAssert_VOIDCALL(CF_CFDP_CycleTxDrr(chan));
+    UtAssert_STUB_COUNT(CF_CFDP_TxStateDispatch, 4);
+    UtAssert_STUB_COUNT(CF_CList_InsertBack, 3);
+    UtAssert_UINT32_EQ(txn->drr_deficit, 1);
+
+    /* transaction leaves the active queue, nothing else to run */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, NULL, &chan, NULL, &txn, &config);
+    UT_ResetState(UT_KEY(CF_CFDP_TxStateDispatch));
+    UT_ResetState(UT_KEY(CF_CList_InsertBack));
+    chan->cur              = NULL;
+    txn->state             = CF_TxnState_S1;
+    txn->flags.com.q_index = CF_QueueIdx_TXA;
+    UT_SetHookFunction(UT_KEY(CF_CList_Traverse), Ut_Hook_CycleTxDrr_SetFirst, txn);
+    UT_SetHookFunction(UT_KEY(CF_CFDP_TxStateDispatch), Ut_Hook_StateHandler_SetQIndex, NULL);
+    UtAssert_VOIDCALL(CF_CFDP_CycleTxDrr(chan));
+    UtAssert_STUB_COUNT(CF_CFDP_TxStateDispatch, 1);
+    UtAssert_STUB_COUNT(CF_CList_InsertBack, 0);
+
+    /* pending transaction is made active, max_active_tx of 0 still allows one */
+    memset(&txn2, 0, sizeof(txn2));
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, NULL, &chan, NULL, NULL, &config);
+    UT_ResetState(UT_KEY(CF_CList_Traverse));
+    UT_ResetState(UT_KEY(CF_CFDP_TxStateDispatch));
+    CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].q_size[CF_QueueIdx_PEND] = 10;
+    config->chan[UT_CFDP_CHANNEL].max_active_tx                                = 0;
+    txn2.state                                                                 = CF_TxnState_S1;
+    txn2.chan_num                                                              = UT_CFDP_CHANNEL;
+    txn2.flags.com.q_index                                                     = CF_QueueIdx_PEND;
+    chan->qs[CF_QueueIdx_PEND]                                                 = &txn2.cl_node;
+    cur_call                                                                   = 1;
+    UT_SetHookFunction(UT_KEY(CF_CFDP_TxStateDispatch), Ut_Hook_CycleTxDrr_SetCur, &cur_call);
+    UtAssert_VOIDCALL(CF_CFDP_CycleTxDrr(chan));
+    UtAssert_UINT32_EQ(txn2.flags.com.q_index, CF_QueueIdx_TXA);
+    UtAssert_STUB_COUNT(CFE_TIME_GetTime, 1);
+    UtAssert_STUB_COUNT(CF_CFDP_TxStateDispatch, 1);
+    UtAssert_ADDRESS_EQ(chan->cur, &txn2);
+}
+
+void Test_CF_CFDP_CountActiveTx(void)
+{
+    /* Test case for:
+     * CF_CListTraverse_Status_t CF_CFDP_CountActiveTx(CF_CListNode_t *node, void *context)
+     */
+    CF_CFDP_ActiveTx_args_t args;
+    CF_Transaction_t        txn[3];
+
+    memset(&args, 0, sizeof(args));
+    memset(txn, 0, sizeof(txn));
+    txn[0].flags.com.suspended = true;
+
+    UtAssert_INT32_EQ(CF_CFDP_CountActiveTx(&txn[0].cl_node, &args), CF_CListTraverse_Status_CONTINUE);
+    UtAssert_NULL(args.first);
+    UtAssert_ZERO(args.num_active);
+
+    UtAssert_INT32_EQ(CF_CFDP_CountActiveTx(&txn[1].cl_node, &args), CF_CListTraverse_Status_CONTINUE);
+    UtAssert_INT32_EQ(CF_CFDP_CountActiveTx(&txn[2].cl_node, &args), CF_CListTraverse_Status_CONTINUE);
+    UtAssert_ADDRESS_EQ(args.first, &txn[1]);
+    UtAssert_UINT32_EQ(args.num_active, 2);
+}
+
 static void DoTickFnClearCont(CF_Transaction_t *txn, int *cont)
 {
     *cont = 0;
@@ -1103,24 +1570,62 @@ void Test_CF_CFDP_DoTick(void)
     UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, NULL, &args.chan, NULL, &txn, NULL);
     args.chan->cur = &txn2;
     args.cont      = true;
-    UtAssert_INT32_EQ(CF_CFDP_DoTick(&txn->cl_node, &args), CF_CLIST_CONT);
+    UtAssert_INT32_EQ(CF_CFDP_DoTick(&txn->tick_node, &args), CF_CLIST_CONT);
     UtAssert_BOOL_TRUE(args.cont);
+    UtAssert_STUB_COUNT(CF_RemoveTransactionTick, 0);
 
+    /* nothing left to do after the tick, so it comes off the tick list */
     UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, NULL, &args.chan, NULL, &txn, NULL);
     args.chan->cur = txn;
-    UtAssert_INT32_EQ(CF_CFDP_DoTick(&txn->cl_node, &args), CF_CLIST_CONT);
+    UtAssert_INT32_EQ(CF_CFDP_DoTick(&txn->tick_node, &args), CF_CLIST_CONT);
     UtAssert_BOOL_FALSE(args.cont);
+    UtAssert_STUB_COUNT(CF_RemoveTransactionTick, 1);
 
     UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, NULL, &args.chan, NULL, &txn, NULL);
     txn->flags.com.suspended = true;
     args.cont                = true;
-    UtAssert_INT32_EQ(CF_CFDP_DoTick(&txn->cl_node, &args), CF_CLIST_CONT);
+    UtAssert_INT32_EQ(CF_CFDP_DoTick(&txn->tick_node, &args), CF_CLIST_CONT);
     UtAssert_BOOL_TRUE(args.cont);
+    UtAssert_STUB_COUNT(CF_RemoveTransactionTick, 2);
+
+    /* a sender is not ticked before it is waiting on the receiver */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, NULL, &args.chan, NULL, &txn, NULL);
+    txn->state             = CF_TxnState_S2;
+    txn->flags.com.q_index = CF_QueueIdx_TXA;
+    args.cont              = true;
+    UtAssert_INT32_EQ(CF_CFDP_DoTick(&txn->tick_node, &args), CF_CLIST_CONT);
+    UtAssert_BOOL_TRUE(args.cont);
+    UtAssert_STUB_COUNT(CF_RemoveTransactionTick, 3);
+
+    /* a sender with a FIN-ACK to send stays on the tick list */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, NULL, &args.chan, NULL, &txn, NULL);
+    txn->state                     = CF_TxnState_S2;
+    txn->flags.com.q_index         = CF_QueueIdx_TXW;
+    txn->state_data.send.sub_state = CF_TxSubState_SEND_FIN_ACK;
+    args.cont                      = true;
+    UtAssert_INT32_EQ(CF_CFDP_DoTick(&txn->tick_node, &args), CF_CLIST_CONT);
+    UtAssert_BOOL_FALSE(args.cont);
+    UtAssert_STUB_COUNT(CF_RemoveTransactionTick, 3);
+
+    /* a receiver with a FIN to send stays on the tick list */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_RX, NULL, &args.chan, NULL, &txn, NULL);
+    txn->state             = CF_TxnState_R2;
+    txn->flags.com.q_index = CF_QueueIdx_RX;
+    txn->flags.rx.send_fin = true;
+    UtAssert_INT32_EQ(CF_CFDP_DoTick(&txn->tick_node, &args), CF_CLIST_CONT);
+    UtAssert_STUB_COUNT(CF_RemoveTransactionTick, 3);
+
+    /* as does one with an immediate NAK to send */
+    txn->flags.rx.send_fin     = false;
+    txn->flags.rx.send_imm_nak = true;
+    UtAssert_INT32_EQ(CF_CFDP_DoTick(&txn->tick_node, &args), CF_CLIST_CONT);
+    UtAssert_STUB_COUNT(CF_RemoveTransactionTick, 3);
 
     UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, NULL, &args.chan, NULL, &txn, NULL);
     args.fn = DoTickFnSetCur;
-    UtAssert_INT32_EQ(CF_CFDP_DoTick(&txn->cl_node, &args), CF_CLIST_EXIT);
+    UtAssert_INT32_EQ(CF_CFDP_DoTick(&txn->tick_node, &args), CF_CLIST_EXIT);
     UtAssert_BOOL_TRUE(args.early_exit);
+    UtAssert_STUB_COUNT(CF_RemoveTransactionTick, 3);
 }
 
 void Test_CF_CFDP_ProcessPollingDirectories(void)
@@ -1142,24 +1647,24 @@ void Test_CF_CFDP_ProcessPollingDirectories(void)
     UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].poll_counter, 0);
 
     /* nominal call, polldir enabled but interval_sec == 0 */
-    /* Will tick because CF_Timer_Expired stub returns 0 by default (not expired) */
+    /* Will wait because CF_Timer_Expired stub returns 0 by default (not expired) */
     pdcfg->enabled = 1;
     UtAssert_VOIDCALL(CF_CFDP_ProcessPollingDirectories(chan));
     UtAssert_BOOL_FALSE(poll->timer_set);
     UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].poll_counter, 1);
-    UtAssert_STUB_COUNT(CF_Timer_Tick, 1);
+    UtAssert_STUB_COUNT(CF_Timer_InitRelSec, 0);
 
-    /* with interval_sec nonzero the timer should get set, but not tick */
+    /* with interval_sec nonzero the timer should get set on the channel timer wheel */
     pdcfg->interval_sec = 1;
     UtAssert_VOIDCALL(CF_CFDP_ProcessPollingDirectories(chan));
     UtAssert_BOOL_TRUE(poll->timer_set);
-    UtAssert_STUB_COUNT(CF_Timer_Tick, 1);
+    UtAssert_STUB_COUNT(CF_Timer_InitRelSec, 1);
     UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].poll_counter, 1);
 
-    /* call again should tick */
+    /* call again should keep waiting */
     UtAssert_VOIDCALL(CF_CFDP_ProcessPollingDirectories(chan));
     UtAssert_BOOL_TRUE(poll->timer_set);
-    UtAssert_STUB_COUNT(CF_Timer_Tick, 2);
+    UtAssert_STUB_COUNT(CF_Timer_InitRelSec, 1);
 
     /* call again timer should expire and start a playback */
     UT_SetDeferredRetcode(UT_KEY(CF_Timer_Expired), 1, true);
@@ -1216,7 +1721,8 @@ void Test_CF_CFDP_ProcessPlaybackDirectory(void)
     memset(&pb, 0, sizeof(pb));
     memset(dirent, 0, sizeof(dirent));
     UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, &chan, &history, &txn, &config);
-    CF_AppData.engine.enabled = true;
+    CF_AppData.engine.enabled  = true;
+    chan->qs[CF_QueueIdx_FREE] = &txn->cl_node;
 
     /* diropen is true but num_ts is high so operations are restricted */
     pb.busy    = true;
@@ -1262,9 +1768,20 @@ void Test_CF_CFDP_ProcessPlaybackDirectory(void)
     UtAssert_VOIDCALL(CF_CFDP_ProcessPlaybackDirectory(chan, &pb));
     UtAssert_BOOL_TRUE(pb.busy);
     UtAssert_BOOL_FALSE(pb.diropen);
-    UtAssert_STRINGBUF_EQ(history->fnames.src_filename, sizeof(history->fnames.src_filename), "/ut", -1);
-    UtAssert_STRINGBUF_EQ(history->fnames.dst_filename, sizeof(history->fnames.dst_filename), "/ut", -1);
+    UtAssert_STRINGBUF_EQ(txn->fnames.src_filename, sizeof(txn->fnames.src_filename), "/ut", -1);
+    UtAssert_STRINGBUF_EQ(txn->fnames.dst_filename, sizeof(txn->fnames.dst_filename), "/ut", -1);
     UT_CF_AssertEventID(CF_CFDP_S_START_SEND_INF_EID);
+
+    /* transaction pool is empty, so the directory is not read until one is freed */
+    UT_ResetState(UT_KEY(OS_DirectoryRead));
+    chan->qs[CF_QueueIdx_FREE] = NULL;
+    pb.busy                    = true;
+    pb.diropen                 = true;
+    pb.num_ts                  = 0;
+    UtAssert_VOIDCALL(CF_CFDP_ProcessPlaybackDirectory(chan, &pb));
+    UtAssert_STUB_COUNT(OS_DirectoryRead, 0);
+    UtAssert_BOOL_TRUE(pb.busy);
+    UtAssert_BOOL_TRUE(pb.diropen);
 }
 
 static int32 Ut_Hook_TickTransactions_SetEarlyExit(void *UserObj, int32 StubRetcode, uint32 CallCount,
@@ -1338,13 +1855,53 @@ void Test_CF_CFDP_CycleEngine(void)
     UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, &chan, NULL, NULL, NULL);
     UtAssert_VOIDCALL(CF_CFDP_CycleEngine());
 
-    /* enabled but frozen */
+    /* enabled but frozen, timers stand still */
     CF_AppData.engine.enabled                                = true;
     CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].frozen = 1;
     UtAssert_VOIDCALL(CF_CFDP_CycleEngine());
+    UtAssert_STUB_COUNT(CF_Timer_Tick, CF_NUM_CHANNELS - 1);
+    UtAssert_STUB_COUNT(CF_CFDP_RefillOutputTokens, CF_NUM_CHANNELS); /* output tokens refill even when frozen */
+    UtAssert_STUB_COUNT(CF_CFDP_ReleaseOutput, CF_NUM_CHANNELS);      /* and unused output always goes back */
 
     CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].frozen = 0;
     UtAssert_VOIDCALL(CF_CFDP_CycleEngine());
+    UtAssert_STUB_COUNT(CF_Timer_Tick, (2 * CF_NUM_CHANNELS) - 1);
+
+    /* a channel with a worker is started and waited for, not cycled here */
+    chan->worker_task_id = CFE_ES_TASKID_C(CFE_ResourceId_FromInteger(1));
+    UtAssert_VOIDCALL(CF_CFDP_CycleEngine());
+    UtAssert_STUB_COUNT(CF_Timer_Tick, (3 * CF_NUM_CHANNELS) - 2);
+    UtAssert_STUB_COUNT(OS_CountSemGive, 1);
+    UtAssert_STUB_COUNT(OS_CountSemTake, 1);
+}
+
+void Test_CF_CFDP_WorkerTaskMain(void)
+{
+    /* Test case for:
+     * void CF_CFDP_WorkerTaskMain(void);
+     */
+    CF_Channel_t *  chan;
+    CFE_ES_TaskId_t task_id = CFE_ES_TASKID_C(CFE_ResourceId_FromInteger(1));
+
+    /* no channel has this task, gives up after retries */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, &chan, NULL, NULL, NULL);
+    UT_SetDataBuffer(UT_KEY(CFE_ES_GetTaskID), &task_id, sizeof(task_id), false);
+    UtAssert_VOIDCALL(CF_CFDP_WorkerTaskMain());
+    UtAssert_STUB_COUNT(OS_TaskDelay, CF_STARTUP_SEM_MAX_RETRIES);
+    UtAssert_STUB_COUNT(OS_CountSemTake, 0);
+    UtAssert_STUB_COUNT(CFE_ES_ExitChildTask, 1);
+
+    /* nominal, one cycle then the semaphore fails */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_NONE, NULL, &chan, NULL, NULL, NULL);
+    chan->worker_task_id = task_id;
+    UT_SetDataBuffer(UT_KEY(CFE_ES_GetTaskID), &task_id, sizeof(task_id), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemTake), 2, OS_ERROR);
+    UtAssert_VOIDCALL(CF_CFDP_WorkerTaskMain());
+    UtAssert_STUB_COUNT(OS_TaskDelay, CF_STARTUP_SEM_MAX_RETRIES); /* no increment */
+    UtAssert_STUB_COUNT(OS_CountSemTake, 2);
+    UtAssert_STUB_COUNT(CF_CFDP_RefillOutputTokens, 1);
+    UtAssert_STUB_COUNT(OS_CountSemGive, 1);
+    UtAssert_STUB_COUNT(CFE_ES_ExitChildTask, 2);
 }
 
 void Test_CF_CFDP_ResetTransaction(void)
@@ -1374,6 +1931,7 @@ void Test_CF_CFDP_ResetTransaction(void)
     UtAssert_STUB_COUNT(CF_FreeTransaction, 1);
 
     UT_ResetState(UT_KEY(CF_FreeTransaction));
+    UT_ResetState(UT_KEY(CF_StoreHistoryNames));
     UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, &history, &txn, NULL);
     txn->fd      = OS_ObjectIdFromInteger(1);
     history->dir = CF_Direction_TX;
@@ -1381,6 +1939,7 @@ void Test_CF_CFDP_ResetTransaction(void)
     UtAssert_VOIDCALL(CF_CFDP_ResetTransaction(txn, true));
     UtAssert_VOIDCALL(CF_CFDP_ResetTransaction(txn, false));
     UtAssert_STUB_COUNT(CF_FreeTransaction, 2);
+    UtAssert_STUB_COUNT(CF_StoreHistoryNames, 1);
 
     UT_ResetState(UT_KEY(CF_FreeTransaction));
     UT_CFDP_SetupBasicTestState(UT_CF_Setup_RX, NULL, NULL, &history, &txn, NULL);
@@ -1421,6 +1980,65 @@ void Test_CF_CFDP_ResetTransaction(void)
     UtAssert_UINT32_EQ(chan->num_cmd_tx, 7);
     UtAssert_STUB_COUNT(CF_FreeTransaction, 1);
 
+    /* read-ahead buffer goes back to the channel */
+    UT_ResetState(UT_KEY(CF_FreeTransaction));
+    UT_ResetState(UT_KEY(CF_CList_InsertBack));
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, NULL, &chan, &history, &txn, NULL);
+    txn->state_data.send.read_ahead = &CF_AppData.engine.read_ahead[0];
+    history->dir                    = CF_Direction_TX;
+    txn->state                      = CF_TxnState_S1;
+    UtAssert_VOIDCALL(CF_CFDP_ResetTransaction(txn, true));
+    UtAssert_STUB_COUNT(CF_CList_InsertBack, 2);
+    UtAssert_STUB_COUNT(CF_FreeTransaction, 1);
+
+    /* write-behind buffer goes back to the channel */
+    UT_ResetState(UT_KEY(CF_FreeTransaction));
+    UT_ResetState(UT_KEY(CF_CList_InsertBack));
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_RX, NULL, &chan, &history, &txn, NULL);
+    txn->state_data.receive.write_behind = &CF_AppData.engine.write_behind[0];
+    history->dir                         = CF_Direction_RX;
+    txn->state                           = CF_TxnState_R1;
+    UtAssert_VOIDCALL(CF_CFDP_ResetTransaction(txn, true));
+    UtAssert_STUB_COUNT(CF_CList_InsertBack, 2);
+    UtAssert_STUB_COUNT(CF_FreeTransaction, 1);
+
+    /* receive bitmap goes back to the channel, and the chunk list is reset for the next user */
+    UT_ResetState(UT_KEY(CF_FreeTransaction));
+    UT_ResetState(UT_KEY(CF_CList_InsertBack));
+    UT_ResetState(UT_KEY(CF_ChunkListReset));
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_RX, NULL, &chan, &history, &txn, NULL);
+    txn->state_data.receive.bitmap = &CF_AppData.engine.recv_bitmap[0];
+    history->dir                   = CF_Direction_RX;
+    txn->state                     = CF_TxnState_R2;
+    UtAssert_VOIDCALL(CF_CFDP_ResetTransaction(txn, true));
+    UtAssert_STUB_COUNT(CF_CList_InsertBack, 3);
+    UtAssert_STUB_COUNT(CF_ChunkListReset, 1);
+    UtAssert_STUB_COUNT(CF_FreeTransaction, 1);
+
+    /* the chunk list high-water mark and overflow counters go to the channel */
+    UT_ResetState(UT_KEY(CF_FreeTransaction));
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_RX, NULL, NULL, &history, &txn, NULL);
+    CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].chunk_merges = 1;
+    CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].chunk_drops  = 2;
+    txn->chunks->chunks.hwm                                        = 4;
+    txn->chunks->chunks.merges                                     = 3;
+    txn->chunks->chunks.drops                                      = 5;
+    history->dir                                                   = CF_Direction_RX;
+    txn->state                                                     = CF_TxnState_R2;
+    UtAssert_VOIDCALL(CF_CFDP_ResetTransaction(txn, true));
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].chunk_hwm, 4);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].chunk_merges, 4);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].chunk_drops, 7);
+    UtAssert_STUB_COUNT(CF_FreeTransaction, 1);
+
+    /* a high-water mark beyond the 16 bit counter saturates it */
+    UT_CFDP_SetupBasicTestState(UT_CF_Setup_RX, NULL, NULL, &history, &txn, NULL);
+    txn->chunks->chunks.hwm = 70000;
+    history->dir            = CF_Direction_RX;
+    txn->state              = CF_TxnState_R2;
+    UtAssert_VOIDCALL(CF_CFDP_ResetTransaction(txn, true));
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].chunk_hwm, UINT16_MAX);
+
     /*
      * File is in Polling Directory, Not Keep, and is Error
      * Move to fail directory successful
@@ -1434,7 +2052,7 @@ void Test_CF_CFDP_ResetTransaction(void)
     txn->fd    = OS_ObjectIdFromInteger(1);
     txn->keep  = 0;
     txn->state = CF_TxnState_S2;
-    strcpy(history->fnames.src_filename, "/ram/poll1/test1");
+    strcpy(txn->fnames.src_filename, "/ram/poll1/test1");
     strcpy(config->chan[0].polldir[0].src_dir, "/ram/poll1");
     strcpy(config->fail_dir, "/ram/fail");
 
@@ -1456,7 +2074,7 @@ void Test_CF_CFDP_ResetTransaction(void)
     txn->fd    = OS_ObjectIdFromInteger(1);
     txn->keep  = 0;
     txn->state = CF_TxnState_S2;
-    strcpy(history->fnames.src_filename, "/ram/poll1/test1");
+    strcpy(txn->fnames.src_filename, "/ram/poll1/test1");
     strcpy(config->chan[0].polldir[0].src_dir, "/ram/poll1");
     strcpy(config->fail_dir, "/ram/fail");
 
@@ -1476,7 +2094,7 @@ void Test_CF_CFDP_ResetTransaction(void)
     txn->fd    = OS_ObjectIdFromInteger(1);
     txn->keep  = 0;
     txn->state = CF_TxnState_S2;
-    strcpy(history->fnames.src_filename, "/ram/test.txt");
+    strcpy(txn->fnames.src_filename, "/ram/test.txt");
     strcpy(config->chan[0].polldir[0].src_dir, "/ram/poll1");
     strcpy(config->fail_dir, "/ram/fail");
 
@@ -1496,7 +2114,7 @@ void Test_CF_CFDP_ResetTransaction(void)
     txn->fd    = OS_ObjectIdFromInteger(1);
     txn->keep  = 0;
     txn->state = CF_TxnState_S2;
-    strcpy(history->fnames.src_filename, "");
+    strcpy(txn->fnames.src_filename, "");
     strcpy(config->chan[0].polldir[0].src_dir, "/ram/poll1");
     strcpy(config->fail_dir, "/ram/fail");
 
@@ -1529,6 +2147,14 @@ void Test_CF_CFDP_SetTxnStatus(void)
     UtAssert_INT32_EQ(txn->history->txn_stat, CF_TxnStatus_FILESTORE_REJECTION);
 }
 
+static void UT_AltHandler_CFE_TIME_Subtract_TwoSeconds(void *UserObj, UT_EntryKey_t FuncKey,
+                                                       const UT_StubContext_t *Context)
+{
+    CFE_TIME_SysTime_t elapsed = {2, 0};
+
+    UT_Stub_SetReturnValue(FuncKey, elapsed);
+}
+
 void Test_CF_CFDP_SendEotPkt(void)
 {
     CF_EotPacket_t  PktBuf;
@@ -1556,12 +2182,50 @@ void Test_CF_CFDP_SendEotPkt(void)
 
     /* Execute the function being tested */
     /* nominal call */
+    txn->file_data_bytes = 100;
     UtAssert_VOIDCALL(CF_CFDP_SendEotPkt(txn));
 
     /* Verify results */
     UtAssert_STUB_COUNT(CFE_MSG_Init, 1);
     UtAssert_STUB_COUNT(CFE_SB_TimeStampMsg, 1);
     UtAssert_STUB_COUNT(CFE_SB_TransmitBuffer, 1);
+
+    /* no measurable time passed, throughput is the byte count */
+    UtAssert_UINT32_EQ(PktBuf.Payload.file_data_bytes, 100);
+    UtAssert_UINT32_EQ(PktBuf.Payload.elapsed_ms, 0);
+    UtAssert_UINT32_EQ(PktBuf.Payload.bytes_per_second, 100);
+
+    /* throughput over the time the transaction was active */
+    memset(PktBufPtr, 0, sizeof(*PktBufPtr));
+    UT_SetDataBuffer(UT_KEY(CFE_SB_AllocateMessageBuffer), &PktBufPtr, sizeof(PktBufPtr), true);
+    UT_SetHandlerFunction(UT_KEY(CFE_TIME_Subtract), UT_AltHandler_CFE_TIME_Subtract_TwoSeconds, NULL);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TIME_Sub2MicroSecs), 500000);
+    txn->file_data_bytes = 5000;
+    UtAssert_VOIDCALL(CF_CFDP_SendEotPkt(txn));
+    UtAssert_UINT32_EQ(PktBuf.Payload.file_data_bytes, 5000);
+    UtAssert_UINT32_EQ(PktBuf.Payload.elapsed_ms, 2500);
+    UtAssert_UINT32_EQ(PktBuf.Payload.bytes_per_second, 2000);
+}
+
+typedef struct
+{
+    char *order;
+    char  step;
+} UT_CFDP_OrderStep_t;
+
+static int32 Ut_Hook_RecordOrder(void *UserObj, int32 StubRetcode, uint32 CallCount, const UT_StubContext_t *Context)
+{
+    const UT_CFDP_OrderStep_t *step = UserObj;
+    size_t                     len  = strlen(step->order);
+
+    /* the buffer holds 8, so leave room for the terminator */
+    if (len < 7)
+    {
+        step->order[len]     = step->step;
+        step->order[len + 1] = 0;
+    }
+
+    return StubRetcode;
 }
 
 void Test_CF_CFDP_DisableEngine(void)
@@ -1569,11 +2233,14 @@ void Test_CF_CFDP_DisableEngine(void)
     /* Test case for:
      * void CF_CFDP_DisableEngine(void)
      */
+    char                order[8];
+    UT_CFDP_OrderStep_t steps[] = {{order, 'T'}, {order, 'D'}, {order, 'G'}, {order, 'M'}};
 
     /* nominal call */
     CF_AppData.engine.enabled = true;
     UtAssert_VOIDCALL(CF_CFDP_DisableEngine());
     UtAssert_STUB_COUNT(CFE_SB_DeletePipe, CF_NUM_CHANNELS);
+    UtAssert_STUB_COUNT(CF_CFDP_ReleaseOutput, CF_NUM_CHANNELS);
     UtAssert_BOOL_FALSE(CF_AppData.engine.enabled);
 
     /* nominal call with playbacks and polls active */
@@ -1583,6 +2250,38 @@ void Test_CF_CFDP_DisableEngine(void)
     OS_DirectoryOpen(&CF_AppData.engine.channels[UT_CFDP_CHANNEL].poll[0].pb.dir_id, "ut");
     UtAssert_VOIDCALL(CF_CFDP_DisableEngine());
     UtAssert_STUB_COUNT(OS_DirectoryClose, 2);
+
+    /* receive task is stopped before its pipe and index mutex are deleted */
+    CF_AppData.engine.channels[UT_CFDP_CHANNEL].rx_task_id  = CFE_ES_TASKID_C(CFE_ResourceId_FromInteger(1));
+    CF_AppData.engine.channels[UT_CFDP_CHANNEL].index_mutex = OS_ObjectIdFromInteger(4);
+    UtAssert_VOIDCALL(CF_CFDP_DisableEngine());
+    UtAssert_STUB_COUNT(CFE_ES_DeleteChildTask, 1);
+    UtAssert_BOOL_FALSE(CFE_RESOURCEID_TEST_DEFINED(CF_AppData.engine.channels[UT_CFDP_CHANNEL].rx_task_id));
+    UtAssert_STUB_COUNT(OS_MutSemDelete, 1);
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(CF_AppData.engine.channels[UT_CFDP_CHANNEL].index_mutex));
+
+    /* worker task, its semaphores and the sequence number mutex are deleted */
+    CF_AppData.engine.channels[UT_CFDP_CHANNEL].worker_task_id  = CFE_ES_TASKID_C(CFE_ResourceId_FromInteger(2));
+    CF_AppData.engine.channels[UT_CFDP_CHANNEL].worker_wake_sem = OS_ObjectIdFromInteger(1);
+    CF_AppData.engine.channels[UT_CFDP_CHANNEL].worker_done_sem = OS_ObjectIdFromInteger(2);
+    CF_AppData.engine.seq_mutex                                 = OS_ObjectIdFromInteger(3);
+    UtAssert_VOIDCALL(CF_CFDP_DisableEngine());
+    UtAssert_STUB_COUNT(CFE_ES_DeleteChildTask, 2);
+    UtAssert_STUB_COUNT(OS_CountSemDelete, 2);
+    UtAssert_STUB_COUNT(OS_MutSemDelete, 2);
+    UtAssert_BOOL_FALSE(CFE_RESOURCEID_TEST_DEFINED(CF_AppData.engine.channels[UT_CFDP_CHANNEL].worker_task_id));
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(CF_AppData.engine.seq_mutex));
+
+    /* the index mutex is held while the receive task is deleted, and only deleted once released */
+    order[0] = 0;
+    UT_SetHookFunction(UT_KEY(OS_MutSemTake), Ut_Hook_RecordOrder, &steps[0]);
+    UT_SetHookFunction(UT_KEY(CFE_ES_DeleteChildTask), Ut_Hook_RecordOrder, &steps[1]);
+    UT_SetHookFunction(UT_KEY(OS_MutSemGive), Ut_Hook_RecordOrder, &steps[2]);
+    UT_SetHookFunction(UT_KEY(OS_MutSemDelete), Ut_Hook_RecordOrder, &steps[3]);
+    CF_AppData.engine.channels[UT_CFDP_CHANNEL].rx_task_id  = CFE_ES_TASKID_C(CFE_ResourceId_FromInteger(1));
+    CF_AppData.engine.channels[UT_CFDP_CHANNEL].index_mutex = OS_ObjectIdFromInteger(4);
+    UtAssert_VOIDCALL(CF_CFDP_DisableEngine());
+    UtAssert_STRINGBUF_EQ(order, sizeof(order), "TDGM", -1);
 }
 
 void Test_CF_CFDP_CloseFiles(void)
@@ -1613,10 +2312,12 @@ void Test_CF_CFDP_CancelTransaction(void)
     UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, NULL, &txn, NULL);
     txn->flags.com.canceled = true;
     UtAssert_VOIDCALL(CF_CFDP_CancelTransaction(txn));
+    UtAssert_STUB_COUNT(CF_InsertTransactionTick, 0);
 
     UT_CFDP_SetupBasicTestState(UT_CF_Setup_TX, NULL, NULL, NULL, &txn, NULL);
     txn->flags.com.canceled = false;
     UtAssert_VOIDCALL(CF_CFDP_CancelTransaction(txn));
+    UtAssert_STUB_COUNT(CF_InsertTransactionTick, 1);
 }
 
 void Test_CF_CFDP_MoveFile(void)
@@ -1681,11 +2382,14 @@ void UtTest_Setup(void)
 {
     UtTest_Add(Test_CF_CFDP_InitEngine, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_InitEngine");
     UtTest_Add(Test_CF_CFDP_CycleEngine, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_CycleEngine");
+    UtTest_Add(Test_CF_CFDP_WorkerTaskMain, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_WorkerTaskMain");
     UtTest_Add(Test_CF_CFDP_ProcessPlaybackDirectory, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown,
                "Test_CF_CFDP_ProcessPlaybackDirectory");
     UtTest_Add(Test_CF_CFDP_ProcessPollingDirectories, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown,
                "Test_CF_CFDP_ProcessPollingDirectories");
     UtTest_Add(Test_CF_CFDP_CycleTx, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "Test_CF_CFDP_CycleTx");
+    UtTest_Add(Test_CF_CFDP_CycleTxDrr, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "Test_CF_CFDP_CycleTxDrr");
+    UtTest_Add(Test_CF_CFDP_CountActiveTx, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "Test_CF_CFDP_CountActiveTx");
     UtTest_Add(Test_CF_CFDP_CycleTxFirstActive, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown,
                "Test_CF_CFDP_CycleTxFirstActive");
     UtTest_Add(Test_CF_CFDP_DoTick, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_DoTick");
@@ -1702,6 +2406,9 @@ void UtTest_Setup(void)
     UtTest_Add(Test_CF_CFDP_TxFile, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_TxFile");
     UtTest_Add(Test_CF_CFDP_PlaybackDir, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_PlaybackDir");
     UtTest_Add(Test_CF_CFDP_ArmAckTimer, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_ArmAckTimer");
+    UtTest_Add(Test_CF_CFDP_ArmInactTimer, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_ArmInactTimer");
+    UtTest_Add(Test_CF_CFDP_TimerExpired, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_TimerExpired");
+    UtTest_Add(Test_CF_CFDP_DispatchRecv, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_DispatchRecv");
 
     UtTest_Add(Test_CF_CFDP_CF_CFDP_EncodeStart, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown,
                "CF_CFDP_CF_CFDP_EncodeStart");
@@ -1710,6 +2417,7 @@ void UtTest_Setup(void)
 
     UtTest_Add(Test_CF_CFDP_RecvDrop, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_RecvDrop");
     UtTest_Add(Test_CF_CFDP_RecvIdle, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_RecvIdle");
+    UtTest_Add(Test_CF_CFDP_DecodePh, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_DecodePh");
     UtTest_Add(Test_CF_CFDP_RecvPh, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_RecvPh");
     UtTest_Add(Test_CF_CFDP_RecvMd, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_RecvMd");
     UtTest_Add(Test_CF_CFDP_RecvFd, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_RecvFd");
@@ -1721,6 +2429,10 @@ void UtTest_Setup(void)
 
     UtTest_Add(Test_CF_CFDP_ConstructPduHeader, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown,
                "CF_CFDP_ConstructPduHeader");
+    UtTest_Add(Test_CF_CFDP_InitFileDataHeader, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown,
+               "CF_CFDP_InitFileDataHeader");
+    UtTest_Add(Test_CF_CFDP_ConstructFileDataHeader, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown,
+               "CF_CFDP_ConstructFileDataHeader");
     UtTest_Add(Test_CF_CFDP_SendMd, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_SendMd");
     UtTest_Add(Test_CF_CFDP_SendFd, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_SendFd");
     UtTest_Add(Test_CF_CFDP_SendEof, cf_cfdp_tests_Setup, cf_cfdp_tests_Teardown, "CF_CFDP_SendEof");
@@ -48,6 +48,9 @@ void UT_CF_Chunk_SetupFull(CF_ChunkList_t *CList)
 {
     CF_ChunkIdx_t cidx;
 
+    /* Start from nothing, so no gap is indexed or pending */
+    CF_ChunkListReset(CList);
+
     /*
      * Set up nonzero values for size and calculate a "realistic" offsets w/ size
      *   Size: just set to index+1 so it's uniquely identifiable
@@ -96,8 +99,7 @@ void UT_CF_Chunk_Print(CF_ChunkList_t *CList)
  */
 
 /*
- * Cover nominal create (which resets), add cases (empty, front, end, replace smallest)
- * Note out of order sizes are to fully cover CF_Chunks_FindSmallestSize
+ * Cover nominal create (which resets), add cases (empty, front, end, merge when full)
  */
 void Test_CF_Chunk_CreateAddReset(void)
 {
@@ -109,7 +111,13 @@ void Test_CF_Chunk_CreateAddReset(void)
     memset(chunks, 0xFF, sizeof(chunks));
     UtAssert_VOIDCALL(CF_ChunkListInit(&clist, sizeof(chunks) / sizeof(chunks[0]), chunks));
     UtAssert_UINT32_EQ(clist.count, 0);
+    UtAssert_UINT32_EQ(clist.hwm, 0);
     UtAssert_UINT32_EQ(clist.max_chunks, sizeof(chunks) / sizeof(chunks[0]));
+    UtAssert_BOOL_FALSE(clist.cover_gaps);
+    UtAssert_UINT32_EQ(clist.merges, 0);
+    UtAssert_UINT32_EQ(clist.drops, 0);
+    UtAssert_UINT32_EQ(clist.pending.count, 0);
+    UtAssert_UINT32_EQ(clist.gaps.limit, 0);
     /* Spot check chunks clear */
     UtAssert_UINT32_EQ(chunks[1].size, 0);
     UtAssert_UINT32_EQ(chunks[1].offset, 0);
@@ -138,25 +146,366 @@ void Test_CF_Chunk_CreateAddReset(void)
     UtAssert_UINT32_EQ(clist.chunks[2].size, 1);
     UtAssert_UINT32_EQ(clist.count, 3);
 
-    /* Force 1 to drop (first smallest), with new at the end */
+    /* Force the closest two (0 and 1) to merge, with new at the end, keeping the space between pending */
     UtAssert_VOIDCALL(CF_ChunkListAdd(&clist, 20, 2));
     UtAssert_UINT32_EQ(clist.chunks[0].offset, 0);
-    UtAssert_UINT32_EQ(clist.chunks[0].size, 2);
+    UtAssert_UINT32_EQ(clist.chunks[0].size, 6);
     UtAssert_UINT32_EQ(clist.chunks[1].offset, 10);
     UtAssert_UINT32_EQ(clist.chunks[1].size, 1);
     UtAssert_UINT32_EQ(clist.chunks[2].offset, 20);
     UtAssert_UINT32_EQ(clist.chunks[2].size, 2);
     UtAssert_UINT32_EQ(clist.count, 3);
+    UtAssert_UINT32_EQ(clist.merges, 1);
+    UtAssert_UINT32_EQ(clist.drops, 0);
+    UtAssert_UINT32_EQ(clist.pending.count, 1);
+    UtAssert_UINT32_EQ(clist.pending.holes[0].offset, 2);
+    UtAssert_UINT32_EQ(clist.pending.holes[0].size, 3);
 
     /* Nominal combine previous (no overlap, at the end) */
     UtAssert_VOIDCALL(CF_ChunkListAdd(&clist, 22, 2));
     UtAssert_UINT32_EQ(clist.chunks[0].offset, 0);
-    UtAssert_UINT32_EQ(clist.chunks[0].size, 2);
+    UtAssert_UINT32_EQ(clist.chunks[0].size, 6);
     UtAssert_UINT32_EQ(clist.chunks[1].offset, 10);
     UtAssert_UINT32_EQ(clist.chunks[1].size, 1);
     UtAssert_UINT32_EQ(clist.chunks[2].offset, 20);
     UtAssert_UINT32_EQ(clist.chunks[2].size, 4);
     UtAssert_UINT32_EQ(clist.count, 3);
+    UtAssert_UINT32_EQ(clist.hwm, 3);
+
+    /* Reset empties the list, its high-water mark, counters and pending gaps */
+    UtAssert_VOIDCALL(CF_ChunkListReset(&clist));
+    UtAssert_UINT32_EQ(clist.count, 0);
+    UtAssert_UINT32_EQ(clist.hwm, 0);
+    UtAssert_UINT32_EQ(clist.merges, 0);
+    UtAssert_UINT32_EQ(clist.pending.count, 0);
+}
+
+/* Cover the overflow policies of a full list */
+void Test_CF_Chunk_Overflow(void)
+{
+    CF_ChunkList_t clist;
+    CF_Chunk_t     chunks[5];
+
+    CF_ChunkListInit(&clist, sizeof(chunks) / sizeof(chunks[0]), chunks);
+
+    /* Fewer than two chunks have no pair */
+    UtAssert_UINT32_EQ(CF_Chunks_FindClosestPair(&clist), 0);
+    CF_ChunkListAdd(&clist, 0, 1);
+    UtAssert_UINT32_EQ(CF_Chunks_FindClosestPair(&clist), 0);
+
+    /* Not covering: the closest two merge, and the space between them is pending */
+    UT_CF_Chunk_SetupFull(&clist);
+    UtAssert_UINT32_EQ(CF_Chunks_FindClosestPair(&clist), 1);
+    UtAssert_VOIDCALL(CF_ChunkListAdd(&clist, 100, 1));
+    UtAssert_UINT32_EQ(clist.count, 5);
+    UtAssert_UINT32_EQ(clist.chunks[0].size, 13);
+    UtAssert_UINT32_EQ(clist.chunks[4].offset, 100);
+    UtAssert_UINT32_EQ(clist.pending.count, 1);
+    UtAssert_UINT32_EQ(clist.pending.holes[0].offset, 1);
+    UtAssert_UINT32_EQ(clist.pending.holes[0].size, 10);
+    UtAssert_UINT32_EQ(clist.drops, 0);
+    UtAssert_UINT32_EQ(clist.merges, 1);
+
+    /* Covering: the space merged in is not pending, and reset keeps the policy */
+    clist.cover_gaps = true;
+    CF_ChunkListReset(&clist);
+    UtAssert_BOOL_TRUE(clist.cover_gaps);
+    UT_CF_Chunk_SetupFull(&clist);
+
+    /* Closest to the previous chunk, at the end */
+    UtAssert_VOIDCALL(CF_ChunkListAdd(&clist, 60, 1));
+    UtAssert_UINT32_EQ(clist.count, 5);
+    UtAssert_UINT32_EQ(clist.chunks[4].offset, 50);
+    UtAssert_UINT32_EQ(clist.chunks[4].size, 11);
+
+    /* Closest to the previous chunk, in between */
+    UtAssert_VOIDCALL(CF_ChunkListAdd(&clist, 15, 2));
+    UtAssert_UINT32_EQ(clist.chunks[1].offset, 11);
+    UtAssert_UINT32_EQ(clist.chunks[1].size, 6);
+
+    /* Closest to the next chunk */
+    UtAssert_VOIDCALL(CF_ChunkListAdd(&clist, 20, 1));
+    UtAssert_UINT32_EQ(clist.chunks[2].offset, 20);
+    UtAssert_UINT32_EQ(clist.chunks[2].size, 6);
+    UtAssert_UINT32_EQ(CF_Chunks_FindClosestPair(&clist), 2);
+
+    /* Two existing chunks are closer than the new one is to either neighbor */
+    UtAssert_VOIDCALL(CF_ChunkListAdd(&clist, 80, 1));
+    UtAssert_UINT32_EQ(clist.count, 5);
+    UtAssert_UINT32_EQ(clist.chunks[1].offset, 11);
+    UtAssert_UINT32_EQ(clist.chunks[1].size, 15);
+    UtAssert_UINT32_EQ(clist.chunks[2].offset, 36);
+    UtAssert_UINT32_EQ(clist.chunks[4].offset, 80);
+    UtAssert_UINT32_EQ(clist.chunks[4].size, 1);
+    UtAssert_UINT32_EQ(clist.merges, 4);
+    UtAssert_UINT32_EQ(clist.drops, 0);
+    UtAssert_UINT32_EQ(clist.pending.count, 0);
+}
+
+/* Smallest space between neighboring chunks, found the long way */
+CF_ChunkOffset_t UT_CF_Chunk_MinGap(const CF_ChunkList_t *CList)
+{
+    CF_ChunkIdx_t    cidx;
+    CF_ChunkOffset_t space;
+    CF_ChunkOffset_t min_space = UINT64_MAX;
+
+    for (cidx = 1; cidx < CList->count; cidx++)
+    {
+        space = CList->chunks[cidx].offset - (CList->chunks[cidx - 1].offset + CList->chunks[cidx - 1].size);
+        if (space < min_space)
+        {
+            min_space = space;
+        }
+    }
+
+    return min_space;
+}
+
+/* Cover the index of the smallest gaps used to find the closest pair */
+void Test_CF_Chunk_GapIndex(void)
+{
+    CF_ChunkList_t   clist;
+    CF_Chunk_t       chunks[21];
+    CF_ChunkIdx_t    cidx;
+    CF_ChunkIdx_t    pair;
+    CF_ChunkOffset_t seed = 1;
+
+    CF_ChunkListInit(&clist, sizeof(chunks) / sizeof(chunks[0]), chunks);
+    clist.cover_gaps = true;
+
+    /* Not built until needed, and a few gaps all fit */
+    CF_ChunkListAdd(&clist, 0, 10);
+    CF_ChunkListAdd(&clist, 15, 10);
+    CF_ChunkListAdd(&clist, 27, 10);
+    UtAssert_UINT32_EQ(clist.gaps.limit, 0);
+    UtAssert_UINT32_EQ(CF_Chunks_FindClosestPair(&clist), 2);
+    UtAssert_UINT32_EQ(clist.gaps.count, 2);
+    UtAssert_BOOL_TRUE(clist.gaps.limit == UINT64_MAX);
+
+    /* Twenty chunks, with spaces of 1 to 19 in no order, leave out the larger gaps */
+    CF_ChunkListReset(&clist);
+    for (cidx = 0; cidx < 20; cidx++)
+    {
+        CF_ChunkListAdd(&clist, (cidx * 100) + ((cidx * 7) % 19), 50);
+    }
+    UtAssert_UINT32_EQ(clist.count, 20);
+    pair = CF_Chunks_FindClosestPair(&clist);
+    UtAssert_UINT32_EQ(clist.gaps.count, CF_CHUNK_GAP_INDEX_SIZE);
+    UtAssert_BOOL_TRUE(clist.gaps.limit < UINT64_MAX);
+    UtAssert_BOOL_TRUE(clist.gaps.heap[0].size == UT_CF_Chunk_MinGap(&clist));
+    UtAssert_BOOL_TRUE(clist.chunks[pair].offset == (clist.gaps.heap[0].offset + clist.gaps.heap[0].size));
+
+    /* A new gap smaller than the limit, with the index full, leaves it to be built again */
+    CF_ChunkListAdd(&clist, 567, 1);
+    UtAssert_UINT32_EQ(clist.gaps.limit, 0);
+    pair = CF_Chunks_FindClosestPair(&clist);
+    UtAssert_UINT32_EQ(clist.chunks[pair].offset, 567);
+    UtAssert_BOOL_TRUE(clist.gaps.limit != 0);
+
+    /* While full, each merge takes the closest pair as a full scan would have found it */
+    for (cidx = 0; cidx < 200; cidx++)
+    {
+        seed = ((seed * 1103515245) + 12345) % 2147483648;
+        CF_ChunkListAdd(&clist, seed % 2100, (seed / 2100) % 20 + 1);
+        pair = CF_Chunks_FindClosestPair(&clist);
+        if (clist.count > 1)
+        {
+            UtAssert_BOOL_TRUE(clist.gaps.heap[0].size == UT_CF_Chunk_MinGap(&clist));
+            UtAssert_BOOL_TRUE(clist.chunks[pair].offset == (clist.gaps.heap[0].offset + clist.gaps.heap[0].size));
+        }
+    }
+    UtAssert_NONZERO(clist.merges);
+}
+
+/* Cover the gaps merged in to make room in a list that keeps them pending */
+void Test_CF_Chunk_Pending(void)
+{
+    CF_ChunkList_t   clist;
+    CF_Chunk_t       chunks[5];
+    CF_ChunkIdx_t    cidx;
+    CF_ChunkOffset_t seed = 1;
+    CF_ChunkOffset_t offset;
+    CF_ChunkSize_t   size;
+    uint8            added[500];
+    uint32           lost = 0;
+
+    CF_ChunkListInit(&clist, sizeof(chunks) / sizeof(chunks[0]), chunks);
+
+    /* 0-13 after the merge, with 1-11 pending */
+    UT_CF_Chunk_SetupFull(&clist);
+    CF_ChunkListAdd(&clist, 100, 1);
+    UtAssert_UINT32_EQ(clist.pending.count, 1);
+
+    /* Pending gaps are reported in order with the others, and clipped to the start */
+    memset(&Test_CF_compute_gap_context, 0, sizeof(Test_CF_compute_gap_context));
+    UtAssert_UINT32_EQ(CF_ChunkList_ComputeGaps(&clist, TEST_CF_MAX_GAPS, 110, 0, Test_CF_compute_gap_fn, &clist), 3);
+    UtAssert_UINT32_EQ(Test_CF_compute_gap_context.chunks[0].offset, 1);
+    UtAssert_UINT32_EQ(Test_CF_compute_gap_context.chunks[0].size, 10);
+    UtAssert_UINT32_EQ(Test_CF_compute_gap_context.chunks[1].offset, 13);
+    UtAssert_UINT32_EQ(Test_CF_compute_gap_context.chunks[1].size, 10);
+    UtAssert_UINT32_EQ(Test_CF_compute_gap_context.chunks[2].offset, 26);
+    memset(&Test_CF_compute_gap_context, 0, sizeof(Test_CF_compute_gap_context));
+    UtAssert_UINT32_EQ(CF_ChunkList_ComputeGaps(&clist, 1, 110, 5, Test_CF_compute_gap_fn, &clist), 1);
+    UtAssert_UINT32_EQ(Test_CF_compute_gap_context.chunks[0].offset, 5);
+    UtAssert_UINT32_EQ(Test_CF_compute_gap_context.chunks[0].size, 6);
+
+    /* They are not covered, so bytes arriving there are new */
+    UtAssert_UINT32_EQ(CF_ChunkList_ComputeUncovered(&clist, 0, 13, NULL, NULL), 10);
+    UtAssert_UINT32_EQ(CF_ChunkList_ComputeUncovered(&clist, 11, 2, NULL, NULL), 0);
+
+    /* Adding inside one splits it */
+    CF_ChunkListAdd(&clist, 3, 2);
+    UtAssert_UINT32_EQ(clist.pending.count, 2);
+    UtAssert_UINT32_EQ(clist.pending.holes[0].offset, 1);
+    UtAssert_UINT32_EQ(clist.pending.holes[0].size, 2);
+    UtAssert_UINT32_EQ(clist.pending.holes[1].offset, 5);
+    UtAssert_UINT32_EQ(clist.pending.holes[1].size, 6);
+
+    /* Adding all of one removes it */
+    CF_ChunkListAdd(&clist, 0, 4);
+    UtAssert_UINT32_EQ(clist.pending.count, 1);
+    UtAssert_UINT32_EQ(clist.pending.holes[0].offset, 5);
+
+    /* Adding over either end trims it */
+    CF_ChunkListAdd(&clist, 4, 3);
+    UtAssert_UINT32_EQ(clist.pending.holes[0].offset, 7);
+    UtAssert_UINT32_EQ(clist.pending.holes[0].size, 4);
+    CF_ChunkListAdd(&clist, 10, 2);
+    UtAssert_UINT32_EQ(clist.pending.holes[0].offset, 7);
+    UtAssert_UINT32_EQ(clist.pending.holes[0].size, 3);
+    CF_ChunkListAdd(&clist, 7, 3);
+    UtAssert_UINT32_EQ(clist.pending.count, 0);
+    UtAssert_UINT32_EQ(CF_ChunkList_ComputeUncovered(&clist, 0, 13, NULL, NULL), 0);
+    UtAssert_UINT32_EQ(clist.drops, 0);
+
+    /* Once as many as can be are pending, the smallest chunk is dropped instead */
+    UT_CF_Chunk_SetupFull(&clist);
+    for (cidx = 0; cidx < CF_CHUNK_PENDING_MAX; cidx++)
+    {
+        CF_ChunkListAdd(&clist, 1000 * (cidx + 1), 100);
+    }
+    UtAssert_UINT32_EQ(clist.pending.count, CF_CHUNK_PENDING_MAX);
+    UtAssert_UINT32_EQ(clist.merges, CF_CHUNK_PENDING_MAX);
+    UtAssert_UINT32_EQ(clist.drops, 0);
+
+    /* A chunk no bigger than the smallest is itself lost */
+    CF_ChunkListAdd(&clist, 20000, 1);
+    UtAssert_UINT32_EQ(clist.drops, 1);
+    UtAssert_UINT32_EQ(clist.pending.count, CF_CHUNK_PENDING_MAX);
+
+    /* Splitting one with no room left keeps it whole */
+    CF_ChunkListAdd(&clist, 2, 1);
+    UtAssert_UINT32_EQ(clist.pending.count, CF_CHUNK_PENDING_MAX);
+    UtAssert_UINT32_EQ(clist.pending.holes[0].offset, 1);
+    UtAssert_UINT32_EQ(clist.pending.holes[0].size, 10);
+
+    /* However ranges arrive, no byte that has not been added is ever counted as covered */
+    CF_ChunkListReset(&clist);
+    memset(added, 0, sizeof(added));
+    for (cidx = 0; cidx < 300; cidx++)
+    {
+        seed   = ((seed * 1103515245) + 12345) % 2147483648;
+        offset = seed % (sizeof(added) - 20);
+        size   = (seed / sizeof(added)) % 20 + 1;
+        CF_ChunkListAdd(&clist, offset, size);
+        memset(&added[offset], 1, size);
+    }
+    for (offset = 0; offset < sizeof(added); offset++)
+    {
+        if (!added[offset] && !CF_ChunkList_ComputeUncovered(&clist, offset, 1, NULL, NULL))
+        {
+            ++lost;
+        }
+    }
+    UtAssert_NONZERO(clist.merges);
+    UtAssert_ZERO(lost);
+}
+
+/* Cover lists that grow from a pool */
+void Test_CF_Chunk_Pool(void)
+{
+    CF_ChunkPool_t pool;
+    CF_Chunk_t     mem[12];
+    uint8          used[6];
+    CF_ChunkList_t a;
+    CF_ChunkList_t b;
+    CF_ChunkList_t c;
+    CF_ChunkList_t d;
+
+    /* Six blocks of two chunks, all free */
+    memset(used, 0xFF, sizeof(used));
+    UtAssert_VOIDCALL(CF_ChunkPool_Init(&pool, mem, used, 6, 2));
+    UtAssert_UINT32_EQ(pool.free_blocks, 6);
+    UtAssert_ZERO(used[5]);
+
+    /* Lists start with nothing, and take a block for the first chunk */
+    UtAssert_VOIDCALL(CF_ChunkListInitPool(&a, &pool, 100));
+    CF_ChunkListInitPool(&b, &pool, 100);
+    CF_ChunkListInitPool(&c, &pool, 3);
+    CF_ChunkListInitPool(&d, &pool, 100);
+    UtAssert_NULL(a.chunks);
+    UtAssert_UINT32_EQ(a.max_chunks, 0);
+    CF_ChunkListAdd(&a, 0, 1);
+    CF_ChunkListAdd(&a, 10, 1);
+    UtAssert_ADDRESS_EQ(a.chunks, &mem[0]);
+    UtAssert_UINT32_EQ(a.max_chunks, 2);
+    UtAssert_UINT32_EQ(pool.free_blocks, 5);
+
+    /* The next block is free, so the list grows in place */
+    CF_ChunkListAdd(&a, 20, 1);
+    UtAssert_ADDRESS_EQ(a.chunks, &mem[0]);
+    UtAssert_UINT32_EQ(a.max_chunks, 4);
+    UtAssert_UINT32_EQ(pool.free_blocks, 4);
+
+    /* Another list takes the block after it */
+    CF_ChunkListAdd(&b, 0, 1);
+    UtAssert_ADDRESS_EQ(b.chunks, &mem[4]);
+
+    /* So growing again moves the list to a longer run, keeping its chunks */
+    CF_ChunkListAdd(&a, 30, 1);
+    CF_ChunkListAdd(&a, 40, 1);
+    UtAssert_ADDRESS_EQ(a.chunks, &mem[6]);
+    UtAssert_UINT32_EQ(a.max_chunks, 6);
+    UtAssert_UINT32_EQ(a.count, 5);
+    UtAssert_UINT32_EQ(a.chunks[0].offset, 0);
+    UtAssert_UINT32_EQ(a.chunks[4].offset, 40);
+    UtAssert_ZERO(used[0]);
+    UtAssert_ZERO(used[1]);
+    UtAssert_UINT32_EQ(pool.free_blocks, 2);
+
+    /* A list stops at its cap, even part way into a block */
+    CF_ChunkListAdd(&c, 0, 1);
+    CF_ChunkListAdd(&c, 10, 1);
+    CF_ChunkListAdd(&c, 20, 1);
+    UtAssert_ADDRESS_EQ(c.chunks, &mem[0]);
+    UtAssert_UINT32_EQ(c.max_chunks, 3);
+    CF_ChunkListAdd(&c, 30, 1);
+    UtAssert_UINT32_EQ(c.count, 3);
+    UtAssert_UINT32_EQ(c.merges, 1);
+    UtAssert_UINT32_EQ(pool.free_blocks, 0);
+
+    /* Or when the pool has nothing left */
+    CF_ChunkListAdd(&b, 10, 1);
+    CF_ChunkListAdd(&b, 20, 1);
+    UtAssert_UINT32_EQ(b.count, 2);
+    UtAssert_UINT32_EQ(b.merges, 1);
+
+    /* Even for a list with no memory at all, whatever the policy */
+    d.cover_gaps = true;
+    CF_ChunkListAdd(&d, 0, 1);
+    UtAssert_UINT32_EQ(d.count, 0);
+    UtAssert_UINT32_EQ(d.drops, 1);
+    UtAssert_UINT32_EQ(d.merges, 0);
+
+    /* Reset gives the blocks back */
+    UtAssert_VOIDCALL(CF_ChunkListReset(&a));
+    UtAssert_NULL(a.chunks);
+    UtAssert_UINT32_EQ(a.max_chunks, 0);
+    UtAssert_UINT32_EQ(pool.free_blocks, 3);
+    CF_ChunkListReset(&b);
+    CF_ChunkListReset(&c);
+    CF_ChunkListReset(&d);
+    UtAssert_UINT32_EQ(pool.free_blocks, 6);
 }
 
 /* Cover combination cases */
@@ -172,26 +521,30 @@ void Test_CF_Chunk_Combine(void)
     UT_CF_Chunk_SetupFull(&clist);
     UT_CF_Chunk_Print(&clist);
 
-    UtPrintf("Add chunk that won't add since list full and new chunk is smallest");
+    UtPrintf("Add chunk that merges into chunk 0 since list full and chunk 0 is closest");
     UtAssert_VOIDCALL(CF_ChunkListAdd(&clist, 2, 1)); /* 2-3 */
     UT_CF_Chunk_Print(&clist);
-    /* Confirm 0 and 1 didn't change */
+    /* Confirm 0 took it in and 1 didn't change */
     UtAssert_UINT32_EQ(clist.chunks[0].offset, 0);
-    UtAssert_UINT32_EQ(clist.chunks[0].size, 1);
+    UtAssert_UINT32_EQ(clist.chunks[0].size, 3);
     UtAssert_UINT32_EQ(clist.chunks[1].offset, 11);
     UtAssert_UINT32_EQ(clist.chunks[1].size, 2);
     UtAssert_UINT32_EQ(clist.count, 5);
+    UtAssert_UINT32_EQ(clist.pending.holes[0].offset, 1);
+    UtAssert_UINT32_EQ(clist.pending.holes[0].size, 1);
 
     UT_CF_Chunk_SetupFull(&clist);
-    UtPrintf("Add chunk that replaces chunk 0 as the smallest chunk");
-    UtAssert_VOIDCALL(CF_ChunkListAdd(&clist, 2, 2)); /* 2-4 */
+    UtPrintf("Add chunk that merges into chunk 1 since list full and chunk 1 is closest");
+    UtAssert_VOIDCALL(CF_ChunkListAdd(&clist, 8, 2)); /* 8-10 */
     UT_CF_Chunk_Print(&clist);
-    /* Confirm 0 replaced and 1 didn't change */
-    UtAssert_UINT32_EQ(clist.chunks[0].offset, 2);
-    UtAssert_UINT32_EQ(clist.chunks[0].size, 2);
-    UtAssert_UINT32_EQ(clist.chunks[1].offset, 11);
-    UtAssert_UINT32_EQ(clist.chunks[1].size, 2);
+    /* Confirm 0 didn't change and 1 took it in */
+    UtAssert_UINT32_EQ(clist.chunks[0].offset, 0);
+    UtAssert_UINT32_EQ(clist.chunks[0].size, 1);
+    UtAssert_UINT32_EQ(clist.chunks[1].offset, 8);
+    UtAssert_UINT32_EQ(clist.chunks[1].size, 5);
     UtAssert_UINT32_EQ(clist.count, 5);
+    UtAssert_UINT32_EQ(clist.pending.holes[0].offset, 10);
+    UtAssert_UINT32_EQ(clist.pending.holes[0].size, 1);
 
     UT_CF_Chunk_SetupFull(&clist);
     UtPrintf("Add chunk that combines with chunk 1 w/ no overlap");
@@ -288,6 +641,49 @@ void Test_CF_Chunk_GetRmFirst(void)
     UtAssert_UINT32_EQ(clist.count, 1);
 }
 
+void Test_CF_Chunk_CoalesceRemoveBelow(void)
+{
+    CF_ChunkList_t clist;
+    CF_Chunk_t     chunks[5];
+
+    /* Initialize list (note already tested) */
+    CF_ChunkListInit(&clist, sizeof(chunks) / sizeof(chunks[0]), chunks);
+
+    /* Empty list */
+    UtAssert_UINT32_EQ(CF_ChunkList_CoalesceFirst(&clist, 100), 0);
+    UtAssert_VOIDCALL(CF_ChunkList_RemoveBelow(&clist, 10));
+    UtAssert_UINT32_EQ(clist.count, 0);
+
+    /* Add three: 10-19, 40-49, 120-129 */
+    CF_ChunkListAdd(&clist, 10, 10);
+    CF_ChunkListAdd(&clist, 40, 10);
+    CF_ChunkListAdd(&clist, 120, 10);
+
+    /* the second starts within 100 of the first, the third does not */
+    UtAssert_UINT32_EQ(CF_ChunkList_CoalesceFirst(&clist, 100), 40);
+
+    /* the first alone fills the size */
+    UtAssert_UINT32_EQ(CF_ChunkList_CoalesceFirst(&clist, 10), 10);
+
+    /* all three, the range may run past the size */
+    UtAssert_UINT32_EQ(CF_ChunkList_CoalesceFirst(&clist, 111), 120);
+
+    /* remove below the first does nothing */
+    UtAssert_VOIDCALL(CF_ChunkList_RemoveBelow(&clist, 5));
+    UtAssert_UINT32_EQ(clist.count, 3);
+    UtAssert_UINT32_EQ(clist.chunks[0].offset, 10);
+
+    /* remove through the first and part of the second */
+    UtAssert_VOIDCALL(CF_ChunkList_RemoveBelow(&clist, 45));
+    UtAssert_UINT32_EQ(clist.count, 2);
+    UtAssert_UINT32_EQ(clist.chunks[0].offset, 45);
+    UtAssert_UINT32_EQ(clist.chunks[0].size, 5);
+
+    /* remove to the end of the last */
+    UtAssert_VOIDCALL(CF_ChunkList_RemoveBelow(&clist, 130));
+    UtAssert_UINT32_EQ(clist.count, 0);
+}
+
 void Test_CF_Chunk_ComputeGaps(void)
 {
     CF_ChunkList_t clist;
@@ -309,6 +705,12 @@ void Test_CF_Chunk_ComputeGaps(void)
     memset(&Test_CF_compute_gap_context, 0, sizeof(Test_CF_compute_gap_context));
     UtAssert_UINT32_EQ(CF_ChunkList_ComputeGaps(&clist, TEST_CF_MAX_GAPS, total, 0, NULL, NULL), 1);
 
+    /* Empty list, the gap starts at the scope start */
+    memset(&Test_CF_compute_gap_context, 0, sizeof(Test_CF_compute_gap_context));
+    UtAssert_UINT32_EQ(CF_ChunkList_ComputeGaps(&clist, TEST_CF_MAX_GAPS, total, 4, Test_CF_compute_gap_fn, &clist), 1);
+    UtAssert_UINT32_EQ(Test_CF_compute_gap_context.chunks[0].size, total - 4);
+    UtAssert_UINT32_EQ(Test_CF_compute_gap_context.chunks[0].offset, 4);
+
     /* Add three with gaps 0-4, 10-19, 30-49 */
     CF_ChunkListAdd(&clist, 5, 5);
     CF_ChunkListAdd(&clist, 20, 10);
@@ -327,6 +729,18 @@ void Test_CF_Chunk_ComputeGaps(void)
     memset(&Test_CF_compute_gap_context, 0, sizeof(Test_CF_compute_gap_context));
     UtAssert_UINT32_EQ(CF_ChunkList_ComputeGaps(&clist, TEST_CF_MAX_GAPS, 45, 0, NULL, NULL), 3);
 
+    /* Check 0-15, gaps are clipped to the total */
+    memset(&Test_CF_compute_gap_context, 0, sizeof(Test_CF_compute_gap_context));
+    UtAssert_UINT32_EQ(CF_ChunkList_ComputeGaps(&clist, TEST_CF_MAX_GAPS, 15, 0, Test_CF_compute_gap_fn, &clist), 2);
+    UtAssert_UINT32_EQ(Test_CF_compute_gap_context.chunks[1].size, 5);
+    UtAssert_UINT32_EQ(Test_CF_compute_gap_context.chunks[1].offset, 10);
+
+    /* Check 0-3, initial gap is clipped to the total */
+    memset(&Test_CF_compute_gap_context, 0, sizeof(Test_CF_compute_gap_context));
+    UtAssert_UINT32_EQ(CF_ChunkList_ComputeGaps(&clist, TEST_CF_MAX_GAPS, 3, 0, Test_CF_compute_gap_fn, &clist), 1);
+    UtAssert_UINT32_EQ(Test_CF_compute_gap_context.chunks[0].size, 3);
+    UtAssert_UINT32_EQ(Test_CF_compute_gap_context.chunks[0].offset, 0);
+
     /* Check 25-75, end while loop at end of chunk list */
     memset(&Test_CF_compute_gap_context, 0, sizeof(Test_CF_compute_gap_context));
     UtAssert_UINT32_EQ(CF_ChunkList_ComputeGaps(&clist, TEST_CF_MAX_GAPS, 75, 25, Test_CF_compute_gap_fn, &clist), 2);
@@ -346,6 +760,206 @@ void Test_CF_Chunk_ComputeGaps(void)
     UtAssert_UINT32_EQ(Test_CF_compute_gap_context.chunks[2].size, 20);
     UtAssert_UINT32_EQ(Test_CF_compute_gap_context.chunks[2].offset, 30);
     UtAssert_UINT32_EQ(Test_CF_compute_gap_context.count, 3);
+
+    /* Sparse large file, data past 4 GiB leaves a gap spanning the 32-bit boundary */
+    CF_ChunkListReset(&clist);
+    CF_ChunkListAdd(&clist, 0, 100);
+    CF_ChunkListAdd(&clist, 0x100000100, 100);
+    memset(&Test_CF_compute_gap_context, 0, sizeof(Test_CF_compute_gap_context));
+    UtAssert_UINT32_EQ(
+        CF_ChunkList_ComputeGaps(&clist, TEST_CF_MAX_GAPS, 0x100000400, 0, Test_CF_compute_gap_fn, &clist), 2);
+    UtAssert_BOOL_TRUE(Test_CF_compute_gap_context.chunks[0].offset == 100);
+    UtAssert_BOOL_TRUE(Test_CF_compute_gap_context.chunks[0].size == 0x100000100 - 100);
+    UtAssert_BOOL_TRUE(Test_CF_compute_gap_context.chunks[1].offset == 0x100000100 + 100);
+    UtAssert_BOOL_TRUE(Test_CF_compute_gap_context.chunks[1].size == 0x400 - 0x100 - 100);
+}
+
+void Test_CF_Chunk_ComputeUncovered(void)
+{
+    CF_ChunkList_t clist;
+    CF_Chunk_t     chunks[5];
+
+    /* Initialize list (note already tested) */
+    CF_ChunkListInit(&clist, sizeof(chunks) / sizeof(chunks[0]), chunks);
+
+    /* Empty list, whole range is uncovered */
+    memset(&Test_CF_compute_gap_context, 0, sizeof(Test_CF_compute_gap_context));
+    UtAssert_UINT32_EQ(CF_ChunkList_ComputeUncovered(&clist, 7, 10, Test_CF_compute_gap_fn, &clist), 10);
+    UtAssert_UINT32_EQ(Test_CF_compute_gap_context.chunks[0].offset, 7);
+    UtAssert_UINT32_EQ(Test_CF_compute_gap_context.chunks[0].size, 10);
+    UtAssert_UINT32_EQ(Test_CF_compute_gap_context.count, 1);
+
+    /* Zero size range */
+    UtAssert_UINT32_EQ(CF_ChunkList_ComputeUncovered(&clist, 7, 0, NULL, NULL), 0);
+
+    /* Add three with gaps 0-4, 10-19, 30-49 */
+    CF_ChunkListAdd(&clist, 5, 5);
+    CF_ChunkListAdd(&clist, 20, 10);
+    CF_ChunkListAdd(&clist, 50, 10);
+
+    /* Fully covered range, including one ending exactly at a chunk end */
+    memset(&Test_CF_compute_gap_context, 0, sizeof(Test_CF_compute_gap_context));
+    UtAssert_UINT32_EQ(CF_ChunkList_ComputeUncovered(&clist, 22, 8, Test_CF_compute_gap_fn, &clist), 0);
+    UtAssert_UINT32_EQ(CF_ChunkList_ComputeUncovered(&clist, 20, 10, Test_CF_compute_gap_fn, &clist), 0);
+    UtAssert_UINT32_EQ(Test_CF_compute_gap_context.count, 0);
+
+    /* Range starting inside a chunk, spanning two gaps and ending inside another chunk */
+    memset(&Test_CF_compute_gap_context, 0, sizeof(Test_CF_compute_gap_context));
+    UtAssert_UINT32_EQ(CF_ChunkList_ComputeUncovered(&clist, 7, 48, Test_CF_compute_gap_fn, &clist), 30);
+    UtAssert_UINT32_EQ(Test_CF_compute_gap_context.chunks[0].offset, 10);
+    UtAssert_UINT32_EQ(Test_CF_compute_gap_context.chunks[0].size, 10);
+    UtAssert_UINT32_EQ(Test_CF_compute_gap_context.chunks[1].offset, 30);
+    UtAssert_UINT32_EQ(Test_CF_compute_gap_context.chunks[1].size, 20);
+    UtAssert_UINT32_EQ(Test_CF_compute_gap_context.count, 2);
+
+    /* Range starting in a gap and running past the last chunk */
+    memset(&Test_CF_compute_gap_context, 0, sizeof(Test_CF_compute_gap_context));
+    UtAssert_UINT32_EQ(CF_ChunkList_ComputeUncovered(&clist, 0, 70, Test_CF_compute_gap_fn, &clist), 45);
+    UtAssert_UINT32_EQ(Test_CF_compute_gap_context.chunks[0].offset, 0);
+    UtAssert_UINT32_EQ(Test_CF_compute_gap_context.chunks[0].size, 5);
+    UtAssert_UINT32_EQ(Test_CF_compute_gap_context.chunks[1].offset, 10);
+    UtAssert_UINT32_EQ(Test_CF_compute_gap_context.chunks[1].size, 10);
+    UtAssert_UINT32_EQ(Test_CF_compute_gap_context.chunks[2].offset, 30);
+    UtAssert_UINT32_EQ(Test_CF_compute_gap_context.chunks[2].size, 20);
+    UtAssert_UINT32_EQ(Test_CF_compute_gap_context.count, 4);
+
+    /* Range entirely within a gap */
+    memset(&Test_CF_compute_gap_context, 0, sizeof(Test_CF_compute_gap_context));
+    UtAssert_UINT32_EQ(CF_ChunkList_ComputeUncovered(&clist, 35, 5, NULL, NULL), 5);
+}
+
+void Test_CF_Chunk_Bitmap(void)
+{
+    CF_ChunkList_t clist;
+    CF_Chunk_t     chunks[5];
+    uint32         words[2];
+    uint32         summary[CF_CHUNK_BITMAP_SUMMARY_WORDS(2)];
+
+    /* Initialize list (note already tested), attach a 64 bit map of 10 byte granules */
+    CF_ChunkListInit(&clist, sizeof(chunks) / sizeof(chunks[0]), chunks);
+    memset(words, 0xFF, sizeof(words));
+    memset(summary, 0xFF, sizeof(summary));
+    UtAssert_VOIDCALL(CF_ChunkList_AttachBitmap(&clist, words, 2, summary, 10));
+    UtAssert_ADDRESS_EQ(clist.bitmap.words, words);
+    UtAssert_UINT32_EQ(words[0], 0);
+    UtAssert_UINT32_EQ(words[1], 0);
+    UtAssert_UINT32_EQ(summary[0], 0);
+    UtAssert_UINT32_EQ(summary[1], 0);
+
+    /* Aligned ranges only set bits */
+    CF_ChunkListAdd(&clist, 0, 10);
+    CF_ChunkListAdd(&clist, 10, 10);
+    UtAssert_UINT32_EQ(words[0], 0x3);
+    UtAssert_UINT32_EQ(clist.count, 0);
+    UtAssert_UINT32_EQ(*clist.bitmap.any, 0x1);
+    UtAssert_UINT32_EQ(*clist.bitmap.full, 0);
+
+    /* Range with no whole granule goes in the list */
+    CF_ChunkListAdd(&clist, 35, 10);
+    UtAssert_UINT32_EQ(clist.count, 1);
+
+    /* Range running past the end of the bitmap, the part beyond goes in the list */
+    CF_ChunkListAdd(&clist, 630, 20);
+    UtAssert_UINT32_EQ(words[1], 0x80000000);
+    UtAssert_UINT32_EQ(clist.count, 2);
+    UtAssert_UINT32_EQ(clist.chunks[1].offset, 640);
+    UtAssert_UINT32_EQ(clist.chunks[1].size, 10);
+
+    /* Gaps come from both the bitmap and the list: 20-34, 45-629, 650-699 */
+    memset(&Test_CF_compute_gap_context, 0, sizeof(Test_CF_compute_gap_context));
+    UtAssert_UINT32_EQ(CF_ChunkList_ComputeGaps(&clist, TEST_CF_MAX_GAPS, 700, 0, Test_CF_compute_gap_fn, &clist), 3);
+    UtAssert_UINT32_EQ(Test_CF_compute_gap_context.chunks[0].offset, 20);
+    UtAssert_UINT32_EQ(Test_CF_compute_gap_context.chunks[0].size, 15);
+    UtAssert_UINT32_EQ(Test_CF_compute_gap_context.chunks[1].offset, 45);
+    UtAssert_UINT32_EQ(Test_CF_compute_gap_context.chunks[1].size, 585);
+    UtAssert_UINT32_EQ(Test_CF_compute_gap_context.chunks[2].offset, 650);
+    UtAssert_UINT32_EQ(Test_CF_compute_gap_context.chunks[2].size, 50);
+
+    /* Start inside a gap, limit by max gaps */
+    memset(&Test_CF_compute_gap_context, 0, sizeof(Test_CF_compute_gap_context));
+    UtAssert_UINT32_EQ(CF_ChunkList_ComputeGaps(&clist, 1, 700, 30, Test_CF_compute_gap_fn, &clist), 1);
+    UtAssert_UINT32_EQ(Test_CF_compute_gap_context.chunks[0].offset, 30);
+    UtAssert_UINT32_EQ(Test_CF_compute_gap_context.chunks[0].size, 5);
+
+    /* Uncovered bytes also come from both */
+    memset(&Test_CF_compute_gap_context, 0, sizeof(Test_CF_compute_gap_context));
+    UtAssert_UINT32_EQ(CF_ChunkList_ComputeUncovered(&clist, 0, 50, Test_CF_compute_gap_fn, &clist), 20);
+    UtAssert_UINT32_EQ(Test_CF_compute_gap_context.count, 2);
+
+    /* Filling a gap sets the whole granule and merges the unaligned tail with the list */
+    CF_ChunkListAdd(&clist, 20, 15);
+    UtAssert_UINT32_EQ(words[0], 0x7);
+    UtAssert_UINT32_EQ(clist.count, 2);
+    UtAssert_UINT32_EQ(clist.chunks[0].offset, 30);
+    UtAssert_UINT32_EQ(clist.chunks[0].size, 15);
+    UtAssert_UINT32_EQ(CF_ChunkList_ComputeUncovered(&clist, 0, 50, NULL, NULL), 5);
+
+    /* Data past 4 GiB is far beyond the bitmap, so it all goes in the list */
+    CF_ChunkListAdd(&clist, 0x100000000, 20);
+    UtAssert_UINT32_EQ(clist.count, 3);
+    UtAssert_BOOL_TRUE(clist.chunks[2].offset == 0x100000000);
+    UtAssert_UINT32_EQ(clist.chunks[2].size, 20);
+    UtAssert_UINT32_EQ(CF_ChunkList_ComputeUncovered(&clist, 0x100000000 - 10, 40, NULL, NULL), 20);
+
+    /* Reset detaches the bitmap */
+    UtAssert_VOIDCALL(CF_ChunkListReset(&clist));
+    UtAssert_NULL(clist.bitmap.words);
+    UtAssert_UINT32_EQ(clist.count, 0);
+    UtAssert_UINT32_EQ(CF_ChunkList_ComputeUncovered(&clist, 0, 50, NULL, NULL), 50);
+}
+
+void Test_CF_Chunk_BitmapSummary(void)
+{
+    CF_ChunkList_t clist;
+    CF_Chunk_t     chunks[2];
+    uint32         words[96];
+    uint32         summary[CF_CHUNK_BITMAP_SUMMARY_WORDS(96)];
+
+    /* 3072 granules of one byte, three words in each summary */
+    CF_ChunkListInit(&clist, sizeof(chunks) / sizeof(chunks[0]), chunks);
+    CF_ChunkList_AttachBitmap(&clist, words, 96, summary, 1);
+
+    /* A long run fills whole words in one go: words 0-61, and half of 62 */
+    CF_ChunkListAdd(&clist, 0, 2000);
+    UtAssert_UINT32_EQ(words[61], UINT32_MAX);
+    UtAssert_UINT32_EQ(words[62], 0xFFFF);
+    UtAssert_UINT32_EQ(clist.bitmap.full[0], UINT32_MAX);
+    UtAssert_UINT32_EQ(clist.bitmap.full[1], 0x3FFFFFFF);
+    UtAssert_UINT32_EQ(clist.bitmap.any[1], 0x7FFFFFFF);
+    UtAssert_UINT32_EQ(clist.count, 0);
+
+    /* A short run within word 78 */
+    CF_ChunkListAdd(&clist, 2500, 10);
+    UtAssert_UINT32_EQ(words[78], 0x3FF0);
+    UtAssert_UINT32_EQ(clist.bitmap.any[2], 0x4000);
+    UtAssert_UINT32_EQ(clist.bitmap.full[2], 0);
+
+    /* Gaps 2000-2499 and 2510-3071, from the start and from inside the full run */
+    memset(&Test_CF_compute_gap_context, 0, sizeof(Test_CF_compute_gap_context));
+    UtAssert_UINT32_EQ(CF_ChunkList_ComputeGaps(&clist, TEST_CF_MAX_GAPS, 3072, 0, Test_CF_compute_gap_fn, &clist), 2);
+    UtAssert_UINT32_EQ(Test_CF_compute_gap_context.chunks[0].offset, 2000);
+    UtAssert_UINT32_EQ(Test_CF_compute_gap_context.chunks[0].size, 500);
+    UtAssert_UINT32_EQ(Test_CF_compute_gap_context.chunks[1].offset, 2510);
+    UtAssert_UINT32_EQ(Test_CF_compute_gap_context.chunks[1].size, 562);
+    memset(&Test_CF_compute_gap_context, 0, sizeof(Test_CF_compute_gap_context));
+    UtAssert_UINT32_EQ(CF_ChunkList_ComputeGaps(&clist, TEST_CF_MAX_GAPS, 3072, 100, Test_CF_compute_gap_fn, &clist),
+                       2);
+    UtAssert_UINT32_EQ(Test_CF_compute_gap_context.chunks[0].offset, 2000);
+
+    /* Filling to the end leaves a gap that ends where the summary finds the next set word */
+    CF_ChunkListAdd(&clist, 3000, 72);
+    UtAssert_UINT32_EQ(clist.bitmap.full[2], 0xC0000000);
+    memset(&Test_CF_compute_gap_context, 0, sizeof(Test_CF_compute_gap_context));
+    UtAssert_UINT32_EQ(CF_ChunkList_ComputeGaps(&clist, TEST_CF_MAX_GAPS, 3072, 0, Test_CF_compute_gap_fn, &clist), 2);
+    UtAssert_UINT32_EQ(Test_CF_compute_gap_context.chunks[1].offset, 2510);
+    UtAssert_UINT32_EQ(Test_CF_compute_gap_context.chunks[1].size, 490);
+    UtAssert_UINT32_EQ(CF_ChunkList_ComputeUncovered(&clist, 0, 3072, NULL, NULL), 990);
+
+    /* Once all set, there are no gaps */
+    CF_ChunkListAdd(&clist, 2000, 1000);
+    UtAssert_UINT32_EQ(clist.bitmap.full[0] & clist.bitmap.full[1] & clist.bitmap.full[2], UINT32_MAX);
+    UtAssert_UINT32_EQ(CF_ChunkList_ComputeGaps(&clist, TEST_CF_MAX_GAPS, 3072, 0, NULL, NULL), 0);
+    UtAssert_UINT32_EQ(clist.count, 0);
 }
 
 /* Add tests */
@@ -353,7 +967,15 @@ void UtTest_Setup(void)
 {
     /* Full coverage with just this section of tests */
     TEST_CF_ADD(Test_CF_Chunk_CreateAddReset);
+    TEST_CF_ADD(Test_CF_Chunk_Overflow);
+    TEST_CF_ADD(Test_CF_Chunk_GapIndex);
+    TEST_CF_ADD(Test_CF_Chunk_Pending);
+    TEST_CF_ADD(Test_CF_Chunk_Pool);
     TEST_CF_ADD(Test_CF_Chunk_Combine);
     TEST_CF_ADD(Test_CF_Chunk_GetRmFirst);
+    TEST_CF_ADD(Test_CF_Chunk_CoalesceRemoveBelow);
     TEST_CF_ADD(Test_CF_Chunk_ComputeGaps);
+    TEST_CF_ADD(Test_CF_Chunk_ComputeUncovered);
+    TEST_CF_ADD(Test_CF_Chunk_Bitmap);
+    TEST_CF_ADD(Test_CF_Chunk_BitmapSummary);
 }
@@ -20,6 +20,7 @@
 /* cf testing includes */
 #include "cf_test_utils.h"
 #include "cf_cmd.h"
+#include "cf_dump.h"
 #include "cf_events.h"
 #include "cf_test_alt_handler.h"
 
@@ -1223,6 +1224,8 @@ void Test_CF_DoSuspRes_Txn_When_suspended_NotEqTo_action_Set_suspended_To_action
     CF_ChanAction_SuspResArg_t  context;
     CF_ChanAction_SuspResArg_t *arg_context = &context;
 
+    memset(&txn, 0, sizeof(txn));
+
     /* set same to 0 to ensure change was done - not required for test,
      * but it is helpful for verification that the function did the change */
     arg_context->same   = 0;
@@ -1239,6 +1242,38 @@ void Test_CF_DoSuspRes_Txn_When_suspended_NotEqTo_action_Set_suspended_To_action
                   arg_t->flags.com.suspended, arg_context->action);
 }
 
+void Test_CF_DoSuspRes_Txn_Pauses_Timers_While_Suspended(void)
+{
+    /* Arrange */
+    CF_Transaction_t           txn;
+    CF_ChanAction_SuspResArg_t context;
+
+    memset(&txn, 0, sizeof(txn));
+    context.same   = 0;
+    context.action = 1;
+
+    /* Act - suspend */
+    CF_DoSuspRes_Txn(&txn, &context);
+
+    /* Assert - both timers stop counting down */
+    UtAssert_BOOL_TRUE(txn.flags.com.suspended);
+    UtAssert_STUB_COUNT(CF_Timer_Pause, 2);
+    UtAssert_STUB_COUNT(CF_Timer_Resume, 0);
+    UtAssert_STUB_COUNT(CF_InsertTransactionTick, 0);
+
+    /* Act - resume */
+    context.action = 0;
+    CF_DoSuspRes_Txn(&txn, &context);
+
+    /* Assert - both timers carry on with the time they had left, and nothing is restarted */
+    UtAssert_BOOL_FALSE(txn.flags.com.suspended);
+    UtAssert_STUB_COUNT(CF_Timer_Pause, 2);
+    UtAssert_STUB_COUNT(CF_Timer_Resume, 2);
+    UtAssert_STUB_COUNT(CF_CFDP_ArmInactTimer, 0);
+    UtAssert_STUB_COUNT(CF_CFDP_ArmAckTimer, 0);
+    UtAssert_STUB_COUNT(CF_InsertTransactionTick, 1);
+}
+
 /*******************************************************************************
 **
 **  CF_DoSuspRes tests
@@ -2351,31 +2386,22 @@ void Test_CF_WriteQueueCmd_WhenUpAndPendingQueueSendEventAndRejectCommand(void)
     UtAssert_UINT32_EQ(CF_AppData.hk.Payload.counters.err, (initial_hk_err_counter + 1) & 0xFFFF);
 }
 
-void Test_CF_WriteQueueCmd_When_CF_WrappedCreat_Fails_type_Is_type_up_And_queue_IsNot_q_pend_SendEventAndRejectCommand(
-    void)
+void Test_CF_WriteQueueCmd_WhenBadFormatSendEventAndRejectCommand(void)
 {
     /* Arrange */
-    CF_WriteQueueCmd_t             utbuf;
-    CF_WriteQueue_Payload_t *      wq = &utbuf.Payload;
-    CF_WrappedOpenCreate_context_t context_CF_WrappedOpenCreate;
-    uint16                         initial_hk_err_counter = Any_uint16();
+    CF_WriteQueueCmd_t       utbuf;
+    CF_WriteQueue_Payload_t *wq                     = &utbuf.Payload;
+    uint16                   initial_hk_err_counter = Any_uint16();
 
     memset(&utbuf, 0, sizeof(utbuf));
 
-    /* valid channel */
-    wq->chan = Any_uint8_LessThan(CF_NUM_CHANNELS);
-
-    /* valid combination up direction, NOT pending queue */
-    wq->type  = CF_Type_up;
-    wq->queue = Any_queue_Except_q_pend(); /* 0 is q_pend */
-
-    /* invalid result from CF_WrappedCreat */
-    strncpy(wq->filename, AnyRandomStringOfLettersOfLength(10), 10);
-
-    context_CF_WrappedOpenCreate.forced_return = Any_int_Negative();
+    /* valid channel, queue and type */
+    wq->chan  = Any_uint8_LessThan(CF_NUM_CHANNELS);
+    wq->type  = CF_Type_all;
+    wq->queue = CF_Queue_all;
 
-    UT_SetDataBuffer(UT_KEY(CF_WrappedOpenCreate), &context_CF_WrappedOpenCreate, sizeof(context_CF_WrappedOpenCreate),
-                     false);
+    /* invalid format */
+    wq->format = CF_QueueFormat_num;
 
     CF_AppData.hk.Payload.counters.err = initial_hk_err_counter;
 
@@ -2383,40 +2409,30 @@ void Test_CF_WriteQueueCmd_When_CF_WrappedCreat_Fails_type_Is_type_up_And_queue_
     CF_WriteQueueCmd(&utbuf);
 
     /* Assert */
-    UtAssert_STUB_COUNT(CF_WrappedOpenCreate, 1);
-    UtAssert_INT32_EQ(context_CF_WrappedOpenCreate.access, OS_WRITE_ONLY);
+    UtAssert_STUB_COUNT(CF_Dump_Start, 0);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UT_CF_AssertEventID(CF_CMD_WQ_OPEN_ERR_EID);
+    UT_CF_AssertEventID(CF_CMD_WQ_ARGS_ERR_EID);
 
     /* Assert for incremented counter */
     UtAssert_UINT32_EQ(CF_AppData.hk.Payload.counters.err, (initial_hk_err_counter + 1) & 0xFFFF);
 }
 
-void Test_CF_WriteQueueCmd_When_CF_WrappedCreat_Fails_type_IsNot_type_up_And_queue_Is_q_pend_SendEventAndRejectCommand(
-    void)
+void Test_CF_WriteQueueCmd_When_CF_Dump_Start_FailsRejectCommand(void)
 {
     /* Arrange */
-    CF_WriteQueueCmd_t             utbuf;
-    CF_WriteQueue_Payload_t *      wq = &utbuf.Payload;
-    CF_WrappedOpenCreate_context_t context_CF_WrappedOpenCreate;
-    uint16                         initial_hk_err_counter = Any_uint16();
+    CF_WriteQueueCmd_t       utbuf;
+    CF_WriteQueue_Payload_t *wq                     = &utbuf.Payload;
+    uint16                   initial_hk_err_counter = Any_uint16();
 
     memset(&utbuf, 0, sizeof(utbuf));
 
-    /* valid channel */
-    wq->chan = Any_uint8_LessThan(CF_NUM_CHANNELS);
-
-    /* valid combination down direction, pending queue */
-    wq->type  = CF_Type_down;
-    wq->queue = CF_Queue_pend;
-
-    /* invalid result from CF_WrappedCreat */
-    strncpy(wq->filename, AnyRandomStringOfLettersOfLength(10), 10);
-
-    context_CF_WrappedOpenCreate.forced_return = Any_int_Negative();
+    wq->chan   = Any_uint8_LessThan(CF_NUM_CHANNELS);
+    wq->type   = CF_Type_down;
+    wq->queue  = CF_Queue_pend;
+    wq->format = CF_QueueFormat_binary;
 
-    UT_SetDataBuffer(UT_KEY(CF_WrappedOpenCreate), &context_CF_WrappedOpenCreate, sizeof(context_CF_WrappedOpenCreate),
-                     false);
+    /* busy, or the file did not open; CF_Dump_Start() sends the event */
+    UT_SetDefaultReturnValue(UT_KEY(CF_Dump_Start), CF_ERROR);
 
     CF_AppData.hk.Payload.counters.err = initial_hk_err_counter;
 
@@ -2424,1015 +2440,180 @@ void Test_CF_WriteQueueCmd_When_CF_WrappedCreat_Fails_type_IsNot_type_up_And_que
     CF_WriteQueueCmd(&utbuf);
 
     /* Assert */
-    UtAssert_STUB_COUNT(CF_WrappedOpenCreate, 1);
-    UtAssert_INT32_EQ(context_CF_WrappedOpenCreate.access, OS_WRITE_ONLY);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UT_CF_AssertEventID(CF_CMD_WQ_OPEN_ERR_EID);
+    UtAssert_STUB_COUNT(CF_Dump_Start, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 
     /* Assert for incremented counter */
     UtAssert_UINT32_EQ(CF_AppData.hk.Payload.counters.err, (initial_hk_err_counter + 1) & 0xFFFF);
 }
 
-void Test_CF_WriteQueueCmd_When_wq_IsAllAnd_queue_IsAll_fd_Is_0_Call_CF_WrappedClose_SendEventCloseAndRejectCommandWhen_CF_WriteTxnQueueDataToFile_Fails(
-    void)
+void Test_CF_WriteQueueCmd_Success(void)
 {
     /* Arrange */
     CF_WriteQueueCmd_t       utbuf;
-    CF_WriteQueue_Payload_t *wq = &utbuf.Payload;
-
-    CF_WrappedOpenCreate_context_t       context_CF_WrappedOpenCreate;
-    CF_WriteTxnQueueDataToFile_context_t context_CF_WriteTxnQueueDataToFile;
-    int32                                forced_return_CF_WriteTxnQueueDataToFile = Any_int32_Except(0);
-    uint16                               initial_hk_err_counter                   = Any_uint16();
+    CF_WriteQueue_Payload_t *wq                     = &utbuf.Payload;
+    uint16                   initial_hk_cmd_counter = Any_uint16();
 
     memset(&utbuf, 0, sizeof(utbuf));
 
-    /* valid channel */
-    wq->chan = Any_uint8_LessThan(CF_NUM_CHANNELS);
-
-    /* valid combination all direction, all queue */
-    wq->type  = CF_Type_all;
-    wq->queue = CF_Queue_all;
-
-    /* valid result from CF_WrappedCreat */
-    strncpy(wq->filename, AnyRandomStringOfLettersOfLength(10), 10);
-
-    context_CF_WrappedOpenCreate.forced_return = 0;
+    wq->chan   = Any_uint8_LessThan(CF_NUM_CHANNELS);
+    wq->type   = CF_Type_up;
+    wq->queue  = Any_queue_Except_q_pend(); /* 0 is q_pend */
+    wq->format = CF_QueueFormat_text;
 
-    UT_SetDataBuffer(UT_KEY(CF_WrappedOpenCreate), &context_CF_WrappedOpenCreate, sizeof(context_CF_WrappedOpenCreate),
-                     false);
-
-    /* invalid result from CF_WriteTxnQueueDataToFile */
-    UT_SetDataBuffer(UT_KEY(CF_WriteTxnQueueDataToFile), &context_CF_WriteTxnQueueDataToFile,
-                     sizeof(context_CF_WriteTxnQueueDataToFile), false);
-    UT_SetDefaultReturnValue(UT_KEY(CF_WriteTxnQueueDataToFile), forced_return_CF_WriteTxnQueueDataToFile);
-
-    CF_AppData.hk.Payload.counters.err = initial_hk_err_counter;
+    CF_AppData.hk.Payload.counters.cmd = initial_hk_cmd_counter;
 
     /* Act */
     CF_WriteQueueCmd(&utbuf);
 
     /* Assert */
-    UtAssert_STUB_COUNT(CF_WriteTxnQueueDataToFile, 1);
+    UtAssert_STUB_COUNT(CF_Dump_Start, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UT_CF_AssertEventID(CF_CMD_WQ_WRITEQ_RX_ERR_EID);
-    UtAssert_STUB_COUNT(CF_WrappedClose, 1);
+    UT_CF_AssertEventID(CF_CMD_WQ_INF_EID);
+
     /* Assert for incremented counter */
-    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.counters.err, (initial_hk_err_counter + 1) & 0xFFFF);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.counters.cmd, (initial_hk_cmd_counter + 1) & 0xFFFF);
 }
 
-void Test_CF_WriteQueueCmd_When_CF_WriteTxnQueueDataToFile_FailsAnd_wq_IsUpAnd_queue_IsActive_fd_IsPositive_Call_CF_WrappedClose_SendEventClosesAndRejectCommand(
-    void)
+/*******************************************************************************
+**
+**  CF_ValidateChunkSizeCmd tests
+**
+*******************************************************************************/
+
+void Test_CF_ValidateChunkSizeCmd_val_GreaterThan_pdu_fd_data_t_FailAndReturn_1(void)
 {
     /* Arrange */
-    CF_WriteQueueCmd_t       utbuf;
-    CF_WriteQueue_Payload_t *wq = &utbuf.Payload;
-
-    CF_WrappedOpenCreate_context_t       context_CF_WrappedOpenCreate;
-    CF_WriteTxnQueueDataToFile_context_t context_CF_WriteTxnQueueDataToFile;
-    int32                                forced_return_CF_WriteTxnQueueDataToFile = Any_int32_Except(0);
-    int32                                context_CF_WrappedClose_fd;
-    uint16                               initial_hk_err_counter = Any_uint16();
-
-    memset(&utbuf, 0, sizeof(utbuf));
-
-    /* valid channel */
-    wq->chan = Any_uint8_LessThan(CF_NUM_CHANNELS);
-
-    /* valid combination all direction, all queue */
-    wq->type  = CF_Type_up;
-    wq->queue = CF_Queue_active;
-
-    /* valid result from CF_WrappedCreat */
-    strncpy(wq->filename, AnyRandomStringOfLettersOfLength(10), 10);
-
-    context_CF_WrappedOpenCreate.forced_return = Any_int_Positive();
-
-    UT_SetDataBuffer(UT_KEY(CF_WrappedOpenCreate), &context_CF_WrappedOpenCreate, sizeof(context_CF_WrappedOpenCreate),
-                     false);
-
-    /* invalid result from CF_WriteTxnQueueDataToFile */
-    UT_SetDataBuffer(UT_KEY(CF_WriteTxnQueueDataToFile), &context_CF_WriteTxnQueueDataToFile,
-                     sizeof(context_CF_WriteTxnQueueDataToFile), false);
-    UT_SetDefaultReturnValue(UT_KEY(CF_WriteTxnQueueDataToFile), forced_return_CF_WriteTxnQueueDataToFile);
-
-    UT_SetDataBuffer(UT_KEY(CF_WrappedClose), &context_CF_WrappedClose_fd, sizeof(context_CF_WrappedClose_fd), false);
-
-    CF_AppData.hk.Payload.counters.err = initial_hk_err_counter;
+    uint8                  arg_chan_num = Any_uint8(); /* value labeled as 'ignored' in func def */
+    size_t                 arg_val      = sizeof(CF_CFDP_PduFileDataContent_t) + 1;
+    CF_ChanAction_Status_t local_result;
 
     /* Act */
-    CF_WriteQueueCmd(&utbuf);
+    local_result = CF_ValidateChunkSizeCmd(arg_val, arg_chan_num);
 
     /* Assert */
-    UtAssert_STUB_COUNT(CF_WriteTxnQueueDataToFile, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UT_CF_AssertEventID(CF_CMD_WQ_WRITEQ_RX_ERR_EID);
-    UtAssert_STUB_COUNT(CF_WrappedClose, 1);
-    /* Assert for incremented counter */
-    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.counters.err, (initial_hk_err_counter + 1) & 0xFFFF);
+    UtAssert_INT32_EQ(local_result, CF_ChanAction_Status_ERROR);
 }
 
-void Test_CF_WriteQueueCmd_When_CF_WriteHistoryQueueDataToFile_FailsAnd_wq_IsUpAnd_queue_IsHistory_fd_IsPositive_Call_CF_WrappedClose_SendEventCloseAndRejectCommand(
-    void)
+void Test_CF_ValidateChunkSizeCmd_Any_val_GreaterThan_pdu_fd_data_t_FailAndReturn_1(void)
 {
     /* Arrange */
-    CF_WriteQueueCmd_t       utbuf;
-    CF_WriteQueue_Payload_t *wq = &utbuf.Payload;
-
-    CF_WrappedOpenCreate_context_t           context_CF_WrappedOpenCreate;
-    CF_WriteHistoryQueueDataToFile_context_t context_CF_WriteHistoryQueueDataToFile;
-    int32                                    forced_return_CF_WriteHistoryQueueDataToFile = Any_int32_Except(0);
-    int32                                    context_CF_WrappedClose_fd;
-    uint16                                   initial_hk_err_counter = Any_uint16();
-
-    memset(&utbuf, 0, sizeof(utbuf));
-
-    /* valid channel */
-    wq->chan = Any_uint8_LessThan(CF_NUM_CHANNELS);
-
-    /* valid combination all direction, all queue */
-    wq->type  = CF_Type_up;
-    wq->queue = CF_Queue_history;
-
-    /* valid result from CF_WrappedCreat */
-    strncpy(wq->filename, AnyRandomStringOfLettersOfLength(10), 10);
-
-    context_CF_WrappedOpenCreate.forced_return = Any_int_Positive();
-
-    UT_SetDataBuffer(UT_KEY(CF_WrappedOpenCreate), &context_CF_WrappedOpenCreate, sizeof(context_CF_WrappedOpenCreate),
-                     false);
-
-    /* invalid result from CF_WriteHistoryQueueDataToFile */
-    UT_SetDataBuffer(UT_KEY(CF_WriteHistoryQueueDataToFile), &context_CF_WriteHistoryQueueDataToFile,
-                     sizeof(context_CF_WriteHistoryQueueDataToFile), false);
-    UT_SetDefaultReturnValue(UT_KEY(CF_WriteHistoryQueueDataToFile), forced_return_CF_WriteHistoryQueueDataToFile);
-
-    UT_SetDataBuffer(UT_KEY(CF_WrappedClose), &context_CF_WrappedClose_fd, sizeof(context_CF_WrappedClose_fd), false);
-
-    CF_AppData.hk.Payload.counters.err = initial_hk_err_counter;
+    uint8                  arg_chan_num = Any_uint8(); /* value labeled as 'ignored' in func def */
+    uint32                 arg_val      = Any_uint32_GreaterThan(sizeof(CF_CFDP_PduFileDataContent_t));
+    CF_ChanAction_Status_t local_result;
 
     /* Act */
-    CF_WriteQueueCmd(&utbuf);
+    local_result = CF_ValidateChunkSizeCmd(arg_val, arg_chan_num);
 
     /* Assert */
-    UtAssert_STUB_COUNT(CF_WriteTxnQueueDataToFile, 0);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UT_CF_AssertEventID(CF_CMD_WQ_WRITEHIST_RX_ERR_EID);
-    UtAssert_STUB_COUNT(CF_WrappedClose, 1);
-    /* Assert for incremented counter */
-    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.counters.err, (initial_hk_err_counter + 1) & 0xFFFF);
+    UtAssert_INT32_EQ(local_result, CF_ChanAction_Status_ERROR);
 }
 
-void Test_CF_WriteQueueCmd_When_CF_WriteHistoryDataToFile_FailsOnFirstCallAnd_wq_IsDownAnd_queue_IsActive_fd_IsPositive_Call_CF_WrappedClose_SendEventCloseAndRejectCommand(
-    void)
+void Test_CF_ValidateChunkSizeCmd_val_SizeOf_pdu_fd_data_t_SuccessAndReturn_0(void)
 {
     /* Arrange */
-    CF_WriteQueueCmd_t       utbuf;
-    CF_WriteQueue_Payload_t *wq = &utbuf.Payload;
-
-    CF_WrappedOpenCreate_context_t       context_CF_WrappedOpenCreate;
-    CF_WriteTxnQueueDataToFile_context_t context_CF_WriteTxnQueueDataToFile;
-    int32                                forced_return_CF_WriteTxnQueueDataToFile = Any_int32_Except(0);
-    int32                                context_CF_WrappedClose_fd;
-    uint16                               initial_hk_err_counter = Any_uint16();
-
-    memset(&utbuf, 0, sizeof(utbuf));
-
-    /* valid channel */
-    wq->chan = Any_uint8_LessThan(CF_NUM_CHANNELS);
-
-    /* valid combination all direction, all queue */
-    wq->type  = CF_Type_down;
-    wq->queue = CF_Queue_active;
-
-    /* valid result from CF_WrappedCreat */
-    strncpy(wq->filename, AnyRandomStringOfLettersOfLength(10), 10);
-
-    context_CF_WrappedOpenCreate.forced_return = Any_int_Positive();
-
-    UT_SetDataBuffer(UT_KEY(CF_WrappedOpenCreate), &context_CF_WrappedOpenCreate, sizeof(context_CF_WrappedOpenCreate),
-                     false);
-
-    /* invalid result from CF_WriteTxnQueueDataToFile */
-    UT_SetDataBuffer(UT_KEY(CF_WriteTxnQueueDataToFile), &context_CF_WriteTxnQueueDataToFile,
-                     sizeof(context_CF_WriteTxnQueueDataToFile), false);
-    UT_SetDefaultReturnValue(UT_KEY(CF_WriteTxnQueueDataToFile), forced_return_CF_WriteTxnQueueDataToFile);
-
-    UT_SetDataBuffer(UT_KEY(CF_WrappedClose), &context_CF_WrappedClose_fd, sizeof(context_CF_WrappedClose_fd), false);
-
-    CF_AppData.hk.Payload.counters.err = initial_hk_err_counter;
+    uint8                  arg_chan_num = Any_uint8(); /* value labeled as 'ignored' in func def */
+    size_t                 arg_val      = sizeof(CF_CFDP_PduFileDataContent_t);
+    CF_ChanAction_Status_t local_result;
 
     /* Act */
-    CF_WriteQueueCmd(&utbuf);
+    local_result = CF_ValidateChunkSizeCmd(arg_val, arg_chan_num);
 
     /* Assert */
-    UtAssert_STUB_COUNT(CF_WriteTxnQueueDataToFile, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UT_CF_AssertEventID(CF_CMD_WQ_WRITEQ_TX_ERR_EID);
-    UtAssert_STUB_COUNT(CF_WrappedClose, 1);
-    /* Assert for incremented counter */
-    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.counters.err, (initial_hk_err_counter + 1) & 0xFFFF);
+    UtAssert_INT32_EQ(local_result, CF_ChanAction_Status_SUCCESS);
 }
 
-void Test_CF_WriteQueueCmd_When_CF_WriteHistoryDataToFile_FailsOnSecondCallAnd_wq_IsDownAnd_queue_IsActive_fd_IsPositive_Call_CF_WrappedClose_SendEventCloseAndRejectCommand(
-    void)
+void Test_CF_ValidateChunkSizeCmd_val_LessThanOrEqSizeOf_pdu_fd_data_t_SuccessAndReturn_0(void)
 {
     /* Arrange */
-    CF_WriteQueueCmd_t       utbuf;
-    CF_WriteQueue_Payload_t *wq = &utbuf.Payload;
-
-    CF_WrappedOpenCreate_context_t       context_CF_WrappedOpenCreate;
-    CF_WriteTxnQueueDataToFile_context_t context_CF_WriteTxnQueueDataToFile[2];
-    int32                                forced_return_CF_WriteTxnQueueDataToFile_1st_call = 0;
-    int32                                forced_return_CF_WriteTxnQueueDataToFile_2nd_call = Any_int32_Except(0);
-    int32                                context_CF_WrappedClose_fd;
-    uint16                               initial_hk_err_counter = Any_uint16();
-
-    memset(&utbuf, 0, sizeof(utbuf));
-
-    /* valid channel */
-    wq->chan = Any_uint8_LessThan(CF_NUM_CHANNELS);
-
-    /* valid combination all direction, all queue */
-    wq->type  = CF_Type_down;
-    wq->queue = CF_Queue_active;
-
-    /* valid result from CF_WrappedCreat */
-    strncpy(wq->filename, AnyRandomStringOfLettersOfLength(10), 10);
-
-    context_CF_WrappedOpenCreate.forced_return = Any_int_Positive();
+    uint8                  arg_chan_num = Any_uint8(); /* value labeled as 'ignored' in func def */
+    uint32                 arg_val      = Any_uint32_LessThan_or_EqualTo(sizeof(CF_CFDP_PduFileDataContent_t));
+    CF_ChanAction_Status_t local_result;
 
-    UT_SetDataBuffer(UT_KEY(CF_WrappedOpenCreate), &context_CF_WrappedOpenCreate, sizeof(context_CF_WrappedOpenCreate),
-                     false);
+    /* Act */
+    local_result = CF_ValidateChunkSizeCmd(arg_val, arg_chan_num);
 
-    /* invalid result from CF_WriteTxnQueueDataToFile */
-    UT_SetDataBuffer(UT_KEY(CF_WriteTxnQueueDataToFile), &context_CF_WriteTxnQueueDataToFile,
-                     sizeof(context_CF_WriteTxnQueueDataToFile), false);
-    UT_SetDefaultReturnValue(UT_KEY(CF_WriteTxnQueueDataToFile), forced_return_CF_WriteTxnQueueDataToFile_1st_call);
-    UT_SetDeferredRetcode(UT_KEY(CF_WriteTxnQueueDataToFile), 2, forced_return_CF_WriteTxnQueueDataToFile_2nd_call);
+    /* Assert */
+    UtAssert_INT32_EQ(local_result, CF_ChanAction_Status_SUCCESS);
+}
 
-    UT_SetDataBuffer(UT_KEY(CF_WrappedClose), &context_CF_WrappedClose_fd, sizeof(context_CF_WrappedClose_fd), false);
+/*******************************************************************************
+**
+**  CF_ValidateMaxOutgoingCmd tests
+**
+*******************************************************************************/
 
-    CF_AppData.hk.Payload.counters.err = initial_hk_err_counter;
+void Test_CF_ValidateMaxOutgoingCmd_WhenGiven_val_IsNot_0_Return_0_Success(void)
+{
+    /* Arrange */
+    uint32 arg_val      = Any_uint32_Except(0);
+    uint8  arg_chan_num = Any_uint8(); /* Any_uint8() used here because it shows value does not matter in this test */
+    CF_ChanAction_Status_t local_result;
 
     /* Act */
-    CF_WriteQueueCmd(&utbuf);
+    local_result = CF_ValidateMaxOutgoingCmd(arg_val, arg_chan_num);
 
     /* Assert */
-    UtAssert_STUB_COUNT(CF_WriteTxnQueueDataToFile, 2);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UT_CF_AssertEventID(CF_CMD_WQ_WRITEQ_TX_ERR_EID);
-    UtAssert_STUB_COUNT(CF_WrappedClose, 1);
-    /* Assert for incremented counter */
-    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.counters.err, (initial_hk_err_counter + 1) & 0xFFFF);
+    UtAssert_INT32_EQ(local_result, CF_ChanAction_Status_SUCCESS);
 }
 
-void Test_CF_WriteQueueCmd_When_CF_WriteHistoryQueueDataToFile_FailsAnd_wq_IsDownAnd_queue_IsPend_fd_IsPositive_Call_CF_WrappedClose_SendEventCloseAndRejectCommand(
-    void)
+void Test_CF_ValidateMaxOutgoingCmd_WhenGiven_val_Is_0_But_sem_name_IsNot_NULL_Return_0_Success(void)
 {
     /* Arrange */
-    CF_WriteQueueCmd_t       utbuf;
-    CF_WriteQueue_Payload_t *wq = &utbuf.Payload;
-
-    CF_WrappedOpenCreate_context_t       context_CF_WrappedOpenCreate;
-    CF_WriteTxnQueueDataToFile_context_t context_CF_WriteTxnQueueDataToFile;
-    int32                                forced_return_CF_WriteTxnQueueDataToFile = Any_int32_Except(0);
-    int32                                context_CF_WrappedClose_fd;
-    uint16                               initial_hk_err_counter = Any_uint16();
-
-    memset(&utbuf, 0, sizeof(utbuf));
-
-    /* valid channel */
-    wq->chan = Any_uint8_LessThan(CF_NUM_CHANNELS);
-
-    /* valid combination all direction, all queue */
-    wq->type  = CF_Type_down;
-    wq->queue = CF_Queue_pend;
-
-    /* valid result from CF_WrappedCreat */
-    strncpy(wq->filename, AnyRandomStringOfLettersOfLength(10), 10);
-
-    context_CF_WrappedOpenCreate.forced_return = Any_int_Positive();
-
-    UT_SetDataBuffer(UT_KEY(CF_WrappedOpenCreate), &context_CF_WrappedOpenCreate, sizeof(context_CF_WrappedOpenCreate),
-                     false);
-
-    /* invalid result from CF_WriteTxnQueueDataToFile */
-    UT_SetDataBuffer(UT_KEY(CF_WriteTxnQueueDataToFile), &context_CF_WriteTxnQueueDataToFile,
-                     sizeof(context_CF_WriteTxnQueueDataToFile), false);
-    UT_SetDefaultReturnValue(UT_KEY(CF_WriteTxnQueueDataToFile), forced_return_CF_WriteTxnQueueDataToFile);
-
-    UT_SetDataBuffer(UT_KEY(CF_WrappedClose), &context_CF_WrappedClose_fd, sizeof(context_CF_WrappedClose_fd), false);
+    uint32 arg_val      = 0;
+    uint8  arg_chan_num = Any_cf_chan_num(); /* Any_cf_chan_num used here because value matters to this test */
+    CF_ConfigTable_t       config_table;
+    CF_ChanAction_Status_t local_result;
 
-    CF_AppData.hk.Payload.counters.err = initial_hk_err_counter;
+    CF_AppData.config_table = &config_table;
+    memset(CF_AppData.config_table->chan[arg_chan_num].sem_name, (char)Any_uint8_Except(0), 1);
 
     /* Act */
-    CF_WriteQueueCmd(&utbuf);
+    local_result = CF_ValidateMaxOutgoingCmd(arg_val, arg_chan_num);
 
     /* Assert */
-    UtAssert_STUB_COUNT(CF_WriteTxnQueueDataToFile, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UT_CF_AssertEventID(CF_CMD_WQ_WRITEQ_PEND_ERR_EID);
-    UtAssert_STUB_COUNT(CF_WrappedClose, 1);
-    /* Assert for incremented counter */
-    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.counters.err, (initial_hk_err_counter + 1) & 0xFFFF);
+    UtAssert_INT32_EQ(local_result, CF_ChanAction_Status_SUCCESS);
 }
 
-void Test_CF_WriteQueueCmd_When_CF_WriteHistoryQueueDataToFile_FailsAnd_wq_IsDownAnd_queue_IsHistory_fd_IsPositive_Call_CF_WrappedClose_SendEventCloseAndRejectCommand(
-    void)
+void Test_CF_ValidateMaxOutgoingCmd_WhenGiven_val_Is_0_And_sem_name_Is_NULL_Return_1_Fail(void)
 {
     /* Arrange */
-    CF_WriteQueueCmd_t       utbuf;
-    CF_WriteQueue_Payload_t *wq = &utbuf.Payload;
-
-    CF_WrappedOpenCreate_context_t           context_CF_WrappedOpenCreate;
-    CF_WriteHistoryQueueDataToFile_context_t context_CF_WriteHistoryQueueDataToFile;
-    int32                                    forced_return_CF_WriteHistoryQueueDataToFile = Any_int32_Except(0);
-    int32                                    context_CF_WrappedClose_fd;
-    uint16                                   initial_hk_err_counter = Any_uint16();
-
-    memset(&utbuf, 0, sizeof(utbuf));
-
-    /* valid channel */
-    wq->chan = Any_uint8_LessThan(CF_NUM_CHANNELS);
-
-    /* valid combination all direction, all queue */
-    wq->type  = CF_Type_down;
-    wq->queue = CF_Queue_history;
-
-    /* valid result from CF_WrappedCreat */
-    strncpy(wq->filename, AnyRandomStringOfLettersOfLength(10), 10);
-
-    context_CF_WrappedOpenCreate.forced_return = Any_int_Positive();
-
-    UT_SetDataBuffer(UT_KEY(CF_WrappedOpenCreate), &context_CF_WrappedOpenCreate, sizeof(context_CF_WrappedOpenCreate),
-                     false);
-
-    /* invalid result from CF_WriteHistoryQueueDataToFile */
-    UT_SetDataBuffer(UT_KEY(CF_WriteHistoryQueueDataToFile), &context_CF_WriteHistoryQueueDataToFile,
-                     sizeof(context_CF_WriteHistoryQueueDataToFile), false);
-    UT_SetDefaultReturnValue(UT_KEY(CF_WriteHistoryQueueDataToFile), forced_return_CF_WriteHistoryQueueDataToFile);
-
-    UT_SetDataBuffer(UT_KEY(CF_WrappedClose), &context_CF_WrappedClose_fd, sizeof(context_CF_WrappedClose_fd), false);
+    uint32 arg_val      = 0;
+    uint8  arg_chan_num = Any_cf_chan_num(); /* Any_cf_chan_num used here because value matters to this test */
+    CF_ConfigTable_t       config_table;
+    CF_ChanAction_Status_t local_result;
 
-    CF_AppData.hk.Payload.counters.err = initial_hk_err_counter;
+    CF_AppData.config_table = &config_table;
+    memset(CF_AppData.config_table->chan[arg_chan_num].sem_name, (char)0, 1);
 
     /* Act */
-    CF_WriteQueueCmd(&utbuf);
+    local_result = CF_ValidateMaxOutgoingCmd(arg_val, arg_chan_num);
 
     /* Assert */
-    UtAssert_STUB_COUNT(CF_WriteTxnQueueDataToFile, 0);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UT_CF_AssertEventID(CF_CMD_WQ_WRITEHIST_TX_ERR_EID);
-    UtAssert_STUB_COUNT(CF_WrappedClose, 1);
-    /* Assert for incremented counter */
-    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.counters.err, (initial_hk_err_counter + 1) & 0xFFFF);
+    UtAssert_INT32_EQ(local_result, CF_ChanAction_Status_ERROR);
 }
 
-void Test_CF_WriteQueueCmd_Success_type_AllAnd_q_All(void)
+/*******************************************************************************
+**
+**  CF_GetSetParamCmd tests
+**
+*******************************************************************************/
+
+void Test_CF_GetSetParamCmd(void)
 {
-    /* Arrange */
-    CF_WriteQueueCmd_t       utbuf;
-    CF_WriteQueue_Payload_t *wq = &utbuf.Payload;
+    /* Test cases for:
+     * void CF_GetSetParamCmd(bool is_set, CF_GetSet_ValueID_t param_id, uint32 value, uint8 chan_num);
+     */
 
-    CF_WrappedOpenCreate_context_t context_CF_WrappedOpenCreate;
-    int32                          forced_return_CF_WriteTxnQueueDataToFile     = 0;
-    int32                          forced_return_CF_WriteHistoryQueueDataToFile = 0;
-    uint16                         initial_hk_cmd_counter                       = Any_uint16();
+    /* Arrange */
+    CF_ConfigTable_t    ut_config_table;
+    CF_GetSet_ValueID_t param_id;
+    uint16              expected_count;
 
-    memset(&utbuf, 0, sizeof(utbuf));
-
-    /* valid channel */
-    wq->chan = Any_uint8_LessThan(CF_NUM_CHANNELS);
-
-    /* valid combination all direction, all queue */
-    wq->type  = CF_Type_all;
-    wq->queue = CF_Queue_all;
-
-    /* valid result from CF_WrappedCreat */
-    strncpy(wq->filename, AnyRandomStringOfLettersOfLength(10), 10);
-
-    context_CF_WrappedOpenCreate.forced_return = Any_int_Positive();
-
-    UT_SetDataBuffer(UT_KEY(CF_WrappedOpenCreate), &context_CF_WrappedOpenCreate, sizeof(context_CF_WrappedOpenCreate),
-                     false);
-
-    /* valid result from CF_WriteTxnQueueDataToFile */
-    UT_SetDefaultReturnValue(UT_KEY(CF_WriteTxnQueueDataToFile), forced_return_CF_WriteTxnQueueDataToFile);
-
-    /* valid result from CF_WriteHistoryQueueDataToFile */
-    UT_SetDefaultReturnValue(UT_KEY(CF_WriteHistoryQueueDataToFile), forced_return_CF_WriteHistoryQueueDataToFile);
-
-    CF_AppData.hk.Payload.counters.cmd = initial_hk_cmd_counter;
-
-    /* Act */
-    CF_WriteQueueCmd(&utbuf);
-
-    /* Assert */
-    UtAssert_STUB_COUNT(CF_WriteTxnQueueDataToFile, 4);
-    UtAssert_STUB_COUNT(CF_WriteHistoryQueueDataToFile, 2);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UT_CF_AssertEventID(CF_CMD_WQ_INF_EID);
-    UtAssert_STUB_COUNT(CF_WrappedClose, 0);
-    /* Assert for incremented counter */
-    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.counters.cmd, (initial_hk_cmd_counter + 1) & 0xFFFF);
-}
-
-void Test_CF_WriteQueueCmd_Success_type_AllAnd_q_History(void)
-{
-    /* Arrange */
-    CF_WriteQueueCmd_t       utbuf;
-    CF_WriteQueue_Payload_t *wq = &utbuf.Payload;
-
-    CF_WrappedOpenCreate_context_t context_CF_WrappedOpenCreate;
-    int32                          forced_return_CF_WriteHistoryQueueDataToFile = 0;
-    uint16                         initial_hk_cmd_counter                       = Any_uint16();
-
-    memset(&utbuf, 0, sizeof(utbuf));
-
-    /* valid channel */
-    wq->chan = Any_uint8_LessThan(CF_NUM_CHANNELS);
-
-    /* valid combination all direction, all queue */
-    wq->type  = CF_Type_all;
-    wq->queue = CF_Queue_history;
-
-    /* valid result from CF_WrappedCreat */
-    strncpy(wq->filename, AnyRandomStringOfLettersOfLength(10), 10);
-
-    context_CF_WrappedOpenCreate.forced_return = Any_int_Positive();
-
-    UT_SetDataBuffer(UT_KEY(CF_WrappedOpenCreate), &context_CF_WrappedOpenCreate, sizeof(context_CF_WrappedOpenCreate),
-                     false);
-
-    /* valid result from CF_WriteHistoryQueueDataToFile */
-    UT_SetDefaultReturnValue(UT_KEY(CF_WriteHistoryQueueDataToFile), forced_return_CF_WriteHistoryQueueDataToFile);
-
-    CF_AppData.hk.Payload.counters.cmd = initial_hk_cmd_counter;
-
-    /* Act */
-    CF_WriteQueueCmd(&utbuf);
-
-    /* Assert */
-    UtAssert_STUB_COUNT(CF_WriteTxnQueueDataToFile, 0);
-    UtAssert_STUB_COUNT(CF_WriteHistoryQueueDataToFile, 2);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UT_CF_AssertEventID(CF_CMD_WQ_INF_EID);
-    UtAssert_STUB_COUNT(CF_WrappedClose, 0);
-    /* Assert for incremented counter */
-    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.counters.cmd, (initial_hk_cmd_counter + 1) & 0xFFFF);
-}
-
-void Test_CF_WriteQueueCmd_Success_type_AllAnd_q_Active(void)
-{
-    /* Arrange */
-    CF_WriteQueueCmd_t       utbuf;
-    CF_WriteQueue_Payload_t *wq = &utbuf.Payload;
-
-    CF_WrappedOpenCreate_context_t context_CF_WrappedOpenCreate;
-    int32                          forced_return_CF_WriteTxnQueueDataToFile = 0;
-    uint16                         initial_hk_cmd_counter                   = Any_uint16();
-
-    memset(&utbuf, 0, sizeof(utbuf));
-
-    /* valid channel */
-    wq->chan = Any_uint8_LessThan(CF_NUM_CHANNELS);
-
-    /* valid combination all direction, all queue */
-    wq->type  = CF_Type_all;
-    wq->queue = CF_Queue_active;
-
-    /* valid result from CF_WrappedCreat */
-    strncpy(wq->filename, AnyRandomStringOfLettersOfLength(10), 10);
-
-    context_CF_WrappedOpenCreate.forced_return = Any_int_Positive();
-
-    UT_SetDataBuffer(UT_KEY(CF_WrappedOpenCreate), &context_CF_WrappedOpenCreate, sizeof(context_CF_WrappedOpenCreate),
-                     false);
-
-    /* valid result from CF_WriteTxnQueueDataToFile */
-    UT_SetDefaultReturnValue(UT_KEY(CF_WriteTxnQueueDataToFile), forced_return_CF_WriteTxnQueueDataToFile);
-
-    CF_AppData.hk.Payload.counters.cmd = initial_hk_cmd_counter;
-
-    /* Act */
-    CF_WriteQueueCmd(&utbuf);
-
-    /* Assert */
-    UtAssert_STUB_COUNT(CF_WriteTxnQueueDataToFile, 3);
-    UtAssert_STUB_COUNT(CF_WriteHistoryQueueDataToFile, 0);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UT_CF_AssertEventID(CF_CMD_WQ_INF_EID);
-    UtAssert_STUB_COUNT(CF_WrappedClose, 0);
-    /* Assert for incremented counter */
-    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.counters.cmd, (initial_hk_cmd_counter + 1) & 0xFFFF);
-}
-
-void Test_CF_WriteQueueCmd_Success_type_AllAnd_q_Pend(void)
-{
-    /* Arrange */
-    CF_WriteQueueCmd_t       utbuf;
-    CF_WriteQueue_Payload_t *wq = &utbuf.Payload;
-
-    CF_WrappedOpenCreate_context_t context_CF_WrappedOpenCreate;
-    int32                          forced_return_CF_WriteTxnQueueDataToFile = 0;
-    uint16                         initial_hk_cmd_counter                   = Any_uint16();
-
-    memset(&utbuf, 0, sizeof(utbuf));
-
-    /* valid channel */
-    wq->chan = Any_uint8_LessThan(CF_NUM_CHANNELS);
-
-    /* valid combination all direction, all queue */
-    wq->type  = CF_Type_all;
-    wq->queue = CF_Queue_pend;
-
-    /* valid result from CF_WrappedCreat */
-    strncpy(wq->filename, AnyRandomStringOfLettersOfLength(10), 10);
-
-    context_CF_WrappedOpenCreate.forced_return = Any_int_Positive();
-
-    UT_SetDataBuffer(UT_KEY(CF_WrappedOpenCreate), &context_CF_WrappedOpenCreate, sizeof(context_CF_WrappedOpenCreate),
-                     false);
-
-    /* valid result from CF_WriteTxnQueueDataToFile */
-    UT_SetDefaultReturnValue(UT_KEY(CF_WriteTxnQueueDataToFile), forced_return_CF_WriteTxnQueueDataToFile);
-
-    CF_AppData.hk.Payload.counters.cmd = initial_hk_cmd_counter;
-
-    /* Act */
-    CF_WriteQueueCmd(&utbuf);
-
-    /* Assert */
-    UtAssert_STUB_COUNT(CF_WriteTxnQueueDataToFile, 1);
-    UtAssert_STUB_COUNT(CF_WriteHistoryQueueDataToFile, 0);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UT_CF_AssertEventID(CF_CMD_WQ_INF_EID);
-    UtAssert_STUB_COUNT(CF_WrappedClose, 0);
-    /* Assert for incremented counter */
-    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.counters.cmd, (initial_hk_cmd_counter + 1) & 0xFFFF);
-}
-
-void Test_CF_WriteQueueCmd_Success_type_UpAnd_q_All(void)
-{
-    /* Arrange */
-    CF_WriteQueueCmd_t       utbuf;
-    CF_WriteQueue_Payload_t *wq = &utbuf.Payload;
-
-    CF_WrappedOpenCreate_context_t context_CF_WrappedOpenCreate;
-    int32                          forced_return_CF_WriteTxnQueueDataToFile     = 0;
-    int32                          forced_return_CF_WriteHistoryQueueDataToFile = 0;
-    uint16                         initial_hk_cmd_counter                       = Any_uint16();
-
-    memset(&utbuf, 0, sizeof(utbuf));
-
-    /* valid channel */
-    wq->chan = Any_uint8_LessThan(CF_NUM_CHANNELS);
-
-    /* valid combination all direction, all queue */
-    wq->type  = CF_Type_up;
-    wq->queue = CF_Queue_all;
-
-    /* valid result from CF_WrappedCreat */
-    strncpy(wq->filename, AnyRandomStringOfLettersOfLength(10), 10);
-
-    context_CF_WrappedOpenCreate.forced_return = Any_int_Positive();
-
-    UT_SetDataBuffer(UT_KEY(CF_WrappedOpenCreate), &context_CF_WrappedOpenCreate, sizeof(context_CF_WrappedOpenCreate),
-                     false);
-
-    /* valid result from CF_WriteTxnQueueDataToFile */
-    UT_SetDefaultReturnValue(UT_KEY(CF_WriteTxnQueueDataToFile), forced_return_CF_WriteTxnQueueDataToFile);
-
-    /* valid result from CF_WriteHistoryQueueDataToFile */
-    UT_SetDefaultReturnValue(UT_KEY(CF_WriteHistoryQueueDataToFile), forced_return_CF_WriteHistoryQueueDataToFile);
-
-    CF_AppData.hk.Payload.counters.cmd = initial_hk_cmd_counter;
-
-    /* Act */
-    CF_WriteQueueCmd(&utbuf);
-
-    /* Assert */
-    UtAssert_STUB_COUNT(CF_WriteTxnQueueDataToFile, 1);
-    UtAssert_STUB_COUNT(CF_WriteHistoryQueueDataToFile, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UT_CF_AssertEventID(CF_CMD_WQ_INF_EID);
-    UtAssert_STUB_COUNT(CF_WrappedClose, 0);
-    /* Assert for incremented counter */
-    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.counters.cmd, (initial_hk_cmd_counter + 1) & 0xFFFF);
-}
-
-void Test_CF_WriteQueueCmd_Success_type_UpAnd_q_History(void)
-{
-    /* Arrange */
-    CF_WriteQueueCmd_t       utbuf;
-    CF_WriteQueue_Payload_t *wq = &utbuf.Payload;
-
-    CF_WrappedOpenCreate_context_t context_CF_WrappedOpenCreate;
-    int32                          forced_return_CF_WriteHistoryQueueDataToFile = 0;
-    uint16                         initial_hk_cmd_counter                       = Any_uint16();
-
-    memset(&utbuf, 0, sizeof(utbuf));
-
-    /* valid channel */
-    wq->chan = Any_uint8_LessThan(CF_NUM_CHANNELS);
-
-    /* valid combination all direction, all queue */
-    wq->type  = CF_Type_up;
-    wq->queue = CF_Queue_history;
-
-    /* valid result from CF_WrappedCreat */
-    strncpy(wq->filename, AnyRandomStringOfLettersOfLength(10), 10);
-
-    context_CF_WrappedOpenCreate.forced_return = Any_int_Positive();
-
-    UT_SetDataBuffer(UT_KEY(CF_WrappedOpenCreate), &context_CF_WrappedOpenCreate, sizeof(context_CF_WrappedOpenCreate),
-                     false);
-
-    /* valid result from CF_WriteHistoryQueueDataToFile */
-    UT_SetDefaultReturnValue(UT_KEY(CF_WriteHistoryQueueDataToFile), forced_return_CF_WriteHistoryQueueDataToFile);
-
-    CF_AppData.hk.Payload.counters.cmd = initial_hk_cmd_counter;
-
-    /* Act */
-    CF_WriteQueueCmd(&utbuf);
-
-    /* Assert */
-    UtAssert_STUB_COUNT(CF_WriteTxnQueueDataToFile, 0);
-    UtAssert_STUB_COUNT(CF_WriteHistoryQueueDataToFile, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UT_CF_AssertEventID(CF_CMD_WQ_INF_EID);
-    UtAssert_STUB_COUNT(CF_WrappedClose, 0);
-    /* Assert for incremented counter */
-    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.counters.cmd, (initial_hk_cmd_counter + 1) & 0xFFFF);
-}
-
-void Test_CF_WriteQueueCmd_Success_type_UpAnd_q_Active(void)
-{
-    /* Arrange */
-    CF_WriteQueueCmd_t       utbuf;
-    CF_WriteQueue_Payload_t *wq = &utbuf.Payload;
-
-    CF_WrappedOpenCreate_context_t context_CF_WrappedOpenCreate;
-    int32                          forced_return_CF_WriteTxnQueueDataToFile = 0;
-    uint16                         initial_hk_cmd_counter                   = Any_uint16();
-
-    memset(&utbuf, 0, sizeof(utbuf));
-
-    /* valid channel */
-    wq->chan = Any_uint8_LessThan(CF_NUM_CHANNELS);
-
-    /* valid combination all direction, all queue */
-    wq->type  = CF_Type_up;
-    wq->queue = CF_Queue_active;
-
-    /* valid result from CF_WrappedCreat */
-    strncpy(wq->filename, AnyRandomStringOfLettersOfLength(10), 10);
-
-    context_CF_WrappedOpenCreate.forced_return = Any_int_Positive();
-
-    UT_SetDataBuffer(UT_KEY(CF_WrappedOpenCreate), &context_CF_WrappedOpenCreate, sizeof(context_CF_WrappedOpenCreate),
-                     false);
-
-    /* valid result from CF_WriteTxnQueueDataToFile */
-    UT_SetDefaultReturnValue(UT_KEY(CF_WriteTxnQueueDataToFile), forced_return_CF_WriteTxnQueueDataToFile);
-
-    CF_AppData.hk.Payload.counters.cmd = initial_hk_cmd_counter;
-
-    /* Act */
-    CF_WriteQueueCmd(&utbuf);
-
-    /* Assert */
-    UtAssert_STUB_COUNT(CF_WriteTxnQueueDataToFile, 1);
-    UtAssert_STUB_COUNT(CF_WriteHistoryQueueDataToFile, 0);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UT_CF_AssertEventID(CF_CMD_WQ_INF_EID);
-    UtAssert_STUB_COUNT(CF_WrappedClose, 0);
-    /* Assert for incremented counter */
-    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.counters.cmd, (initial_hk_cmd_counter + 1) & 0xFFFF);
-}
-
-/* Test_CF_WriteQueueCmd_Success_type_UpAnd_q_Pend IS an error and is handled by a previous test */
-
-void Test_CF_WriteQueueCmd_Success_type_DownAnd_q_All(void)
-{
-    /* Arrange */
-    CF_WriteQueueCmd_t       utbuf;
-    CF_WriteQueue_Payload_t *wq = &utbuf.Payload;
-
-    CF_WrappedOpenCreate_context_t context_CF_WrappedOpenCreate;
-    int32                          forced_return_CF_WriteTxnQueueDataToFile = 0;
-    uint16                         initial_hk_cmd_counter                   = Any_uint16();
-
-    memset(&utbuf, 0, sizeof(utbuf));
-
-    /* valid channel */
-    wq->chan = Any_uint8_LessThan(CF_NUM_CHANNELS);
-
-    /* valid combination all direction, all queue */
-    wq->type  = CF_Type_down;
-    wq->queue = CF_Queue_all;
-
-    /* valid result from CF_WrappedCreat */
-    strncpy(wq->filename, AnyRandomStringOfLettersOfLength(10), 10);
-
-    context_CF_WrappedOpenCreate.forced_return = Any_int_Positive();
-
-    UT_SetDataBuffer(UT_KEY(CF_WrappedOpenCreate), &context_CF_WrappedOpenCreate, sizeof(context_CF_WrappedOpenCreate),
-                     false);
-
-    /* valid result from CF_WriteTxnQueueDataToFile */
-    UT_SetDefaultReturnValue(UT_KEY(CF_WriteTxnQueueDataToFile), forced_return_CF_WriteTxnQueueDataToFile);
-
-    CF_AppData.hk.Payload.counters.cmd = initial_hk_cmd_counter;
-
-    /* Act */
-    CF_WriteQueueCmd(&utbuf);
-
-    /* Assert */
-    UtAssert_STUB_COUNT(CF_WriteTxnQueueDataToFile, 3);
-    UtAssert_STUB_COUNT(CF_WriteHistoryQueueDataToFile, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UT_CF_AssertEventID(CF_CMD_WQ_INF_EID);
-    UtAssert_STUB_COUNT(CF_WrappedClose, 0);
-    /* Assert for incremented counter */
-    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.counters.cmd, (initial_hk_cmd_counter + 1) & 0xFFFF);
-}
-
-void Test_CF_WriteQueueCmd_Success_type_DownAnd_q_History(void)
-{
-    /* Arrange */
-    CF_WriteQueueCmd_t       utbuf;
-    CF_WriteQueue_Payload_t *wq = &utbuf.Payload;
-
-    CF_WrappedOpenCreate_context_t context_CF_WrappedOpenCreate;
-    int32                          forced_return_CF_WriteTxnQueueDataToFile = 0;
-    uint16                         initial_hk_cmd_counter                   = Any_uint16();
-
-    memset(&utbuf, 0, sizeof(utbuf));
-
-    /* valid channel */
-    wq->chan = Any_uint8_LessThan(CF_NUM_CHANNELS);
-
-    /* valid combination all direction, all queue */
-    wq->type  = CF_Type_down;
-    wq->queue = CF_Queue_history;
-
-    /* valid result from CF_WrappedCreat */
-    strncpy(wq->filename, AnyRandomStringOfLettersOfLength(10), 10);
-
-    context_CF_WrappedOpenCreate.forced_return = Any_int_Positive();
-
-    UT_SetDataBuffer(UT_KEY(CF_WrappedOpenCreate), &context_CF_WrappedOpenCreate, sizeof(context_CF_WrappedOpenCreate),
-                     false);
-
-    /* valid result from CF_WriteTxnQueueDataToFile */
-    UT_SetDefaultReturnValue(UT_KEY(CF_WriteTxnQueueDataToFile), forced_return_CF_WriteTxnQueueDataToFile);
-
-    CF_AppData.hk.Payload.counters.cmd = initial_hk_cmd_counter;
-
-    /* Act */
-    CF_WriteQueueCmd(&utbuf);
-
-    /* Assert */
-    UtAssert_STUB_COUNT(CF_WriteTxnQueueDataToFile, 0);
-    UtAssert_STUB_COUNT(CF_WriteHistoryQueueDataToFile, 1);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UT_CF_AssertEventID(CF_CMD_WQ_INF_EID);
-    UtAssert_STUB_COUNT(CF_WrappedClose, 0);
-    /* Assert for incremented counter */
-    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.counters.cmd, (initial_hk_cmd_counter + 1) & 0xFFFF);
-}
-
-void Test_CF_WriteQueueCmd_Success_type_DownAnd_q_Active(void)
-{
-    /* Arrange */
-    CF_WriteQueueCmd_t       utbuf;
-    CF_WriteQueue_Payload_t *wq = &utbuf.Payload;
-
-    CF_WrappedOpenCreate_context_t context_CF_WrappedOpenCreate;
-    int32                          forced_return_CF_WriteTxnQueueDataToFile = 0;
-    uint16                         initial_hk_cmd_counter                   = Any_uint16();
-
-    memset(&utbuf, 0, sizeof(utbuf));
-
-    /* valid channel */
-    wq->chan = Any_uint8_LessThan(CF_NUM_CHANNELS);
-
-    /* valid combination all direction, all queue */
-    wq->type  = CF_Type_down;
-    wq->queue = CF_Queue_active;
-
-    /* valid result from CF_WrappedCreat */
-    strncpy(wq->filename, AnyRandomStringOfLettersOfLength(10), 10);
-
-    context_CF_WrappedOpenCreate.forced_return = Any_int_Positive();
-
-    UT_SetDataBuffer(UT_KEY(CF_WrappedOpenCreate), &context_CF_WrappedOpenCreate, sizeof(context_CF_WrappedOpenCreate),
-                     false);
-
-    /* valid result from CF_WriteTxnQueueDataToFile */
-    UT_SetDefaultReturnValue(UT_KEY(CF_WriteTxnQueueDataToFile), forced_return_CF_WriteTxnQueueDataToFile);
-
-    CF_AppData.hk.Payload.counters.cmd = initial_hk_cmd_counter;
-
-    /* Act */
-    CF_WriteQueueCmd(&utbuf);
-
-    /* Assert */
-    UtAssert_STUB_COUNT(CF_WriteTxnQueueDataToFile, 2);
-    UtAssert_STUB_COUNT(CF_WriteHistoryQueueDataToFile, 0);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UT_CF_AssertEventID(CF_CMD_WQ_INF_EID);
-    UtAssert_STUB_COUNT(CF_WrappedClose, 0);
-    /* Assert for incremented counter */
-    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.counters.cmd, (initial_hk_cmd_counter + 1) & 0xFFFF);
-}
-
-void Test_CF_WriteQueueCmd_Success_type_DownAnd_q_Pend(void)
-{
-    /* Arrange */
-    CF_WriteQueueCmd_t       utbuf;
-    CF_WriteQueue_Payload_t *wq = &utbuf.Payload;
-
-    CF_WrappedOpenCreate_context_t context_CF_WrappedOpenCreate;
-    int32                          forced_return_CF_WriteTxnQueueDataToFile = 0;
-    uint16                         initial_hk_cmd_counter                   = Any_uint16();
-
-    memset(&utbuf, 0, sizeof(utbuf));
-
-    /* valid channel */
-    wq->chan = Any_uint8_LessThan(CF_NUM_CHANNELS);
-
-    /* valid combination all direction, all queue */
-    wq->type  = CF_Type_down;
-    wq->queue = CF_Queue_pend;
-
-    /* valid result from CF_WrappedCreat */
-    strncpy(wq->filename, AnyRandomStringOfLettersOfLength(10), 10);
-
-    context_CF_WrappedOpenCreate.forced_return = Any_int_Positive();
-
-    UT_SetDataBuffer(UT_KEY(CF_WrappedOpenCreate), &context_CF_WrappedOpenCreate, sizeof(context_CF_WrappedOpenCreate),
-                     false);
-
-    /* valid result from CF_WriteTxnQueueDataToFile */
-    UT_SetDefaultReturnValue(UT_KEY(CF_WriteTxnQueueDataToFile), forced_return_CF_WriteTxnQueueDataToFile);
-
-    CF_AppData.hk.Payload.counters.cmd = initial_hk_cmd_counter;
-
-    /* Act */
-    CF_WriteQueueCmd(&utbuf);
-
-    /* Assert */
-    UtAssert_STUB_COUNT(CF_WriteTxnQueueDataToFile, 1);
-    UtAssert_STUB_COUNT(CF_WriteHistoryQueueDataToFile, 0);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UT_CF_AssertEventID(CF_CMD_WQ_INF_EID);
-    UtAssert_STUB_COUNT(CF_WrappedClose, 0);
-    /* Assert for incremented counter */
-    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.counters.cmd, (initial_hk_cmd_counter + 1) & 0xFFFF);
-}
-
-/*******************************************************************************
-**
-**  CF_ValidateChunkSizeCmd tests
-**
-*******************************************************************************/
-
-void Test_CF_ValidateChunkSizeCmd_val_GreaterThan_pdu_fd_data_t_FailAndReturn_1(void)
-{
-    /* Arrange */
-    uint8                  arg_chan_num = Any_uint8(); /* value labeled as 'ignored' in func def */
-    size_t                 arg_val      = sizeof(CF_CFDP_PduFileDataContent_t) + 1;
-    CF_ChanAction_Status_t local_result;
-
-    /* Act */
-    local_result = CF_ValidateChunkSizeCmd(arg_val, arg_chan_num);
-
-    /* Assert */
-    UtAssert_INT32_EQ(local_result, CF_ChanAction_Status_ERROR);
-}
-
-void Test_CF_ValidateChunkSizeCmd_Any_val_GreaterThan_pdu_fd_data_t_FailAndReturn_1(void)
-{
-    /* Arrange */
-    uint8                  arg_chan_num = Any_uint8(); /* value labeled as 'ignored' in func def */
-    uint32                 arg_val      = Any_uint32_GreaterThan(sizeof(CF_CFDP_PduFileDataContent_t));
-    CF_ChanAction_Status_t local_result;
-
-    /* Act */
-    local_result = CF_ValidateChunkSizeCmd(arg_val, arg_chan_num);
-
-    /* Assert */
-    UtAssert_INT32_EQ(local_result, CF_ChanAction_Status_ERROR);
-}
-
-void Test_CF_ValidateChunkSizeCmd_val_SizeOf_pdu_fd_data_t_SuccessAndReturn_0(void)
-{
-    /* Arrange */
-    uint8                  arg_chan_num = Any_uint8(); /* value labeled as 'ignored' in func def */
-    size_t                 arg_val      = sizeof(CF_CFDP_PduFileDataContent_t);
-    CF_ChanAction_Status_t local_result;
-
-    /* Act */
-    local_result = CF_ValidateChunkSizeCmd(arg_val, arg_chan_num);
-
-    /* Assert */
-    UtAssert_INT32_EQ(local_result, CF_ChanAction_Status_SUCCESS);
-}
-
-void Test_CF_ValidateChunkSizeCmd_val_LessThanOrEqSizeOf_pdu_fd_data_t_SuccessAndReturn_0(void)
-{
-    /* Arrange */
-    uint8                  arg_chan_num = Any_uint8(); /* value labeled as 'ignored' in func def */
-    uint32                 arg_val      = Any_uint32_LessThan_or_EqualTo(sizeof(CF_CFDP_PduFileDataContent_t));
-    CF_ChanAction_Status_t local_result;
-
-    /* Act */
-    local_result = CF_ValidateChunkSizeCmd(arg_val, arg_chan_num);
-
-    /* Assert */
-    UtAssert_INT32_EQ(local_result, CF_ChanAction_Status_SUCCESS);
-}
-
-/*******************************************************************************
-**
-**  CF_ValidateMaxOutgoingCmd tests
-**
-*******************************************************************************/
-
-void Test_CF_ValidateMaxOutgoingCmd_WhenGiven_val_IsNot_0_Return_0_Success(void)
-{
-    /* Arrange */
-    uint32 arg_val      = Any_uint32_Except(0);
-    uint8  arg_chan_num = Any_uint8(); /* Any_uint8() used here because it shows value does not matter in this test */
-    CF_ChanAction_Status_t local_result;
-
-    /* Act */
-    local_result = CF_ValidateMaxOutgoingCmd(arg_val, arg_chan_num);
-
-    /* Assert */
-    UtAssert_INT32_EQ(local_result, CF_ChanAction_Status_SUCCESS);
-}
-
-void Test_CF_ValidateMaxOutgoingCmd_WhenGiven_val_Is_0_But_sem_name_IsNot_NULL_Return_0_Success(void)
-{
-    /* Arrange */
-    uint32 arg_val      = 0;
-    uint8  arg_chan_num = Any_cf_chan_num(); /* Any_cf_chan_num used here because value matters to this test */
-    CF_ConfigTable_t       config_table;
-    CF_ChanAction_Status_t local_result;
-
-    CF_AppData.config_table = &config_table;
-    memset(CF_AppData.config_table->chan[arg_chan_num].sem_name, (char)Any_uint8_Except(0), 1);
-
-    /* Act */
-    local_result = CF_ValidateMaxOutgoingCmd(arg_val, arg_chan_num);
-
-    /* Assert */
-    UtAssert_INT32_EQ(local_result, CF_ChanAction_Status_SUCCESS);
-}
-
-void Test_CF_ValidateMaxOutgoingCmd_WhenGiven_val_Is_0_And_sem_name_Is_NULL_Return_1_Fail(void)
-{
-    /* Arrange */
-    uint32 arg_val      = 0;
-    uint8  arg_chan_num = Any_cf_chan_num(); /* Any_cf_chan_num used here because value matters to this test */
-    CF_ConfigTable_t       config_table;
-    CF_ChanAction_Status_t local_result;
-
-    CF_AppData.config_table = &config_table;
-    memset(CF_AppData.config_table->chan[arg_chan_num].sem_name, (char)0, 1);
-
-    /* Act */
-    local_result = CF_ValidateMaxOutgoingCmd(arg_val, arg_chan_num);
-
-    /* Assert */
-    UtAssert_INT32_EQ(local_result, CF_ChanAction_Status_ERROR);
-}
-
-/*******************************************************************************
-**
-**  CF_GetSetParamCmd tests
-**
-*******************************************************************************/
-
-void Test_CF_GetSetParamCmd(void)
-{
-    /* Test cases for:
-     * void CF_GetSetParamCmd(bool is_set, CF_GetSet_ValueID_t param_id, uint32 value, uint8 chan_num);
-     */
-
-    /* Arrange */
-    CF_ConfigTable_t    ut_config_table;
-    CF_GetSet_ValueID_t param_id;
-    uint16              expected_count;
-
-    memset(&ut_config_table, 0, sizeof(ut_config_table));
-    memset(&CF_AppData.hk.Payload.counters, 0, sizeof(CF_AppData.hk.Payload.counters));
-    CF_AppData.config_table = &ut_config_table;
-    expected_count          = 0;
+    memset(&ut_config_table, 0, sizeof(ut_config_table));
+    memset(&CF_AppData.hk.Payload.counters, 0, sizeof(CF_AppData.hk.Payload.counters));
+    CF_AppData.config_table = &ut_config_table;
+    expected_count          = 0;
 
     /* Nominal: "set" for each parameter */
     for (param_id = 0; param_id < CF_GetSet_ValueID_MAX; ++param_id)
@@ -3455,6 +2636,7 @@ void Test_CF_GetSetParamCmd(void)
     UtAssert_UINT32_EQ(ut_config_table.chan[UT_CFDP_CHANNEL].nak_limit, 8);
     UtAssert_UINT32_EQ(ut_config_table.local_eid, 9);
     UtAssert_UINT32_EQ(ut_config_table.chan[UT_CFDP_CHANNEL].max_outgoing_messages_per_wakeup, 10);
+    UtAssert_UINT32_EQ(ut_config_table.chan[UT_CFDP_CHANNEL].max_outgoing_bytes_per_second, 11);
 
     /* Nominal: "get" for each parameter */
     for (param_id = 0; param_id < CF_GetSet_ValueID_MAX; ++param_id)
@@ -3722,6 +2904,7 @@ void Test_CF_WakeupCmd(void)
 
     /* Assert */
     UtAssert_STUB_COUNT(CF_CFDP_CycleEngine, 1);
+    UtAssert_STUB_COUNT(CF_Dump_Cycle, 1);
 }
 
 /*******************************************************************************
@@ -3844,6 +3027,8 @@ void add_CF_DoSuspRes_Txn_tests(void)
                cf_cmd_tests_Teardown, "Test_CF_DoSuspRes_Txn_Set_context_same_To_1_suspended_Eq_action");
     UtTest_Add(Test_CF_DoSuspRes_Txn_When_suspended_NotEqTo_action_Set_suspended_To_action, cf_cmd_tests_Setup,
                cf_cmd_tests_Teardown, "Test_CF_DoSuspRes_Txn_When_suspended_NotEqTo_action_Set_suspended_To_action");
+    UtTest_Add(Test_CF_DoSuspRes_Txn_Pauses_Timers_While_Suspended, cf_cmd_tests_Setup, cf_cmd_tests_Teardown,
+               "Test_CF_DoSuspRes_Txn_Pauses_Timers_While_Suspended");
 }
 
 void add_CF_DoSuspRes_tests(void)
@@ -3983,75 +3168,12 @@ void add_CF_WriteQueueCmd_tests(void)
                "Test_CF_WriteQueueCmd_When_chan_GreaterThan_CF_NUM_CAHNNELS_SendEventAndRejectCommand");
     UtTest_Add(Test_CF_WriteQueueCmd_WhenUpAndPendingQueueSendEventAndRejectCommand, cf_cmd_tests_Setup,
                cf_cmd_tests_Teardown, "Test_CF_WriteQueueCmd_WhenUpAndPendingQueueSendEventAndRejectCommand");
-    UtTest_Add(
-        Test_CF_WriteQueueCmd_When_CF_WrappedCreat_Fails_type_Is_type_up_And_queue_IsNot_q_pend_SendEventAndRejectCommand,
-        cf_cmd_tests_Setup, cf_cmd_tests_Teardown,
-        "Test_CF_WriteQueueCmd_When_CF_WrappedCreat_Fails_type_Is_type_up_And_queue_IsNot_q_pend_"
-        "SendEventAndRejectCommand");
-    UtTest_Add(
-        Test_CF_WriteQueueCmd_When_CF_WrappedCreat_Fails_type_IsNot_type_up_And_queue_Is_q_pend_SendEventAndRejectCommand,
-        cf_cmd_tests_Setup, cf_cmd_tests_Teardown,
-        "Test_CF_WriteQueueCmd_When_CF_WrappedCreat_Fails_type_IsNot_type_up_And_queue_Is_q_pend_"
-        "SendEventAndRejectCommand");
-    UtTest_Add(
-        Test_CF_WriteQueueCmd_When_wq_IsAllAnd_queue_IsAll_fd_Is_0_Call_CF_WrappedClose_SendEventCloseAndRejectCommandWhen_CF_WriteTxnQueueDataToFile_Fails,
-        cf_cmd_tests_Setup, cf_cmd_tests_Teardown,
-        "Test_CF_WriteQueueCmd_When_wq_IsAllAnd_queue_IsAll_fd_Is_0_Call_CF_WrappedClose_"
-        "SendEventCloseAndRejectCommandWhen_CF_WriteTxnQueueDataToFile_Fails");
-    UtTest_Add(
-        Test_CF_WriteQueueCmd_When_CF_WriteTxnQueueDataToFile_FailsAnd_wq_IsUpAnd_queue_IsActive_fd_IsPositive_Call_CF_WrappedClose_SendEventClosesAndRejectCommand,
-        cf_cmd_tests_Setup, cf_cmd_tests_Teardown,
-        "Test_CF_WriteQueueCmd_When_CF_WriteTxnQueueDataToFile_FailsAnd_wq_IsUpAnd_queue_IsActive_fd_IsPositive_Call_"
-        "CF_"
-        "WrappedClose_SendEventClosesAndRejectCommand");
-    UtTest_Add(
-        Test_CF_WriteQueueCmd_When_CF_WriteHistoryQueueDataToFile_FailsAnd_wq_IsUpAnd_queue_IsHistory_fd_IsPositive_Call_CF_WrappedClose_SendEventCloseAndRejectCommand,
-        cf_cmd_tests_Setup, cf_cmd_tests_Teardown,
-        "Test_CF_WriteQueueCmd_When_CF_WriteHistoryQueueDataToFile_FailsAnd_wq_IsUpAnd_queue_IsHistory_fd_IsPositive_"
-        "Call_CF_WrappedClose_SendEventCloseAndRejectCommand");
-    UtTest_Add(
-        Test_CF_WriteQueueCmd_When_CF_WriteHistoryDataToFile_FailsOnFirstCallAnd_wq_IsDownAnd_queue_IsActive_fd_IsPositive_Call_CF_WrappedClose_SendEventCloseAndRejectCommand,
-        cf_cmd_tests_Setup, cf_cmd_tests_Teardown,
-        "Test_CF_WriteQueueCmd_When_CF_WriteHistoryDataToFile_FailsOnFirstCallAnd_wq_IsDownAnd_queue_IsActive_fd_"
-        "IsPositive_Call_CF_WrappedClose_SendEventCloseAndRejectCommand");
-    UtTest_Add(
-        Test_CF_WriteQueueCmd_When_CF_WriteHistoryDataToFile_FailsOnSecondCallAnd_wq_IsDownAnd_queue_IsActive_fd_IsPositive_Call_CF_WrappedClose_SendEventCloseAndRejectCommand,
-        cf_cmd_tests_Setup, cf_cmd_tests_Teardown,
-        "Test_CF_WriteQueueCmd_When_CF_WriteHistoryDataToFile_FailsOnSecondCallAnd_wq_IsDownAnd_queue_IsActive_fd_"
-        "IsPositive_Call_CF_WrappedClose_SendEventCloseAndRejectCommand");
-    UtTest_Add(
-        Test_CF_WriteQueueCmd_When_CF_WriteHistoryQueueDataToFile_FailsAnd_wq_IsDownAnd_queue_IsPend_fd_IsPositive_Call_CF_WrappedClose_SendEventCloseAndRejectCommand,
-        cf_cmd_tests_Setup, cf_cmd_tests_Teardown,
-        "Test_CF_WriteQueueCmd_When_CF_WriteHistoryQueueDataToFile_FailsAnd_wq_IsDownAnd_queue_IsPend_fd_IsPositive_"
-        "Call_CF_WrappedClose_SendEventCloseAndRejectCommand");
-    UtTest_Add(
-        Test_CF_WriteQueueCmd_When_CF_WriteHistoryQueueDataToFile_FailsAnd_wq_IsDownAnd_queue_IsHistory_fd_IsPositive_Call_CF_WrappedClose_SendEventCloseAndRejectCommand,
-        cf_cmd_tests_Setup, cf_cmd_tests_Teardown,
-        "Test_CF_WriteQueueCmd_When_CF_WriteHistoryQueueDataToFile_FailsAnd_wq_IsDownAnd_queue_IsHistory_fd_IsPositive_"
-        "Call_CF_WrappedClose_SendEventCloseAndRejectCommand");
-    UtTest_Add(Test_CF_WriteQueueCmd_Success_type_AllAnd_q_All, cf_cmd_tests_Setup, cf_cmd_tests_Teardown,
-               "Test_CF_WriteQueueCmd_Success_type_AllAnd_q_All");
-    UtTest_Add(Test_CF_WriteQueueCmd_Success_type_AllAnd_q_History, cf_cmd_tests_Setup, cf_cmd_tests_Teardown,
-               "Test_CF_WriteQueueCmd_Success_type_AllAnd_q_History");
-    UtTest_Add(Test_CF_WriteQueueCmd_Success_type_AllAnd_q_Active, cf_cmd_tests_Setup, cf_cmd_tests_Teardown,
-               "Test_CF_WriteQueueCmd_Success_type_AllAnd_q_Active");
-    UtTest_Add(Test_CF_WriteQueueCmd_Success_type_AllAnd_q_Pend, cf_cmd_tests_Setup, cf_cmd_tests_Teardown,
-               "Test_CF_WriteQueueCmd_Success_type_AllAnd_q_Pend");
-    UtTest_Add(Test_CF_WriteQueueCmd_Success_type_UpAnd_q_All, cf_cmd_tests_Setup, cf_cmd_tests_Teardown,
-               "Test_CF_WriteQueueCmd_Success_type_UpAnd_q_All");
-    UtTest_Add(Test_CF_WriteQueueCmd_Success_type_UpAnd_q_History, cf_cmd_tests_Setup, cf_cmd_tests_Teardown,
-               "Test_CF_WriteQueueCmd_Success_type_UpAnd_q_History");
-    UtTest_Add(Test_CF_WriteQueueCmd_Success_type_UpAnd_q_Active, cf_cmd_tests_Setup, cf_cmd_tests_Teardown,
-               "Test_CF_WriteQueueCmd_Success_type_UpAnd_q_Active");
-    /* see Test_CF_WriteQueueCmd_WhenUpAndPendingQueueSendEventAndRejectCommand */
-    UtTest_Add(Test_CF_WriteQueueCmd_Success_type_DownAnd_q_All, cf_cmd_tests_Setup, cf_cmd_tests_Teardown,
-               "Test_CF_WriteQueueCmd_Success_type_DownAnd_q_All");
-    UtTest_Add(Test_CF_WriteQueueCmd_Success_type_DownAnd_q_History, cf_cmd_tests_Setup, cf_cmd_tests_Teardown,
-               "Test_CF_WriteQueueCmd_Success_type_DownAnd_q_History");
-    UtTest_Add(Test_CF_WriteQueueCmd_Success_type_DownAnd_q_Active, cf_cmd_tests_Setup, cf_cmd_tests_Teardown,
-               "Test_CF_WriteQueueCmd_Success_type_DownAnd_q_Active");
-    UtTest_Add(Test_CF_WriteQueueCmd_Success_type_DownAnd_q_Pend, cf_cmd_tests_Setup, cf_cmd_tests_Teardown,
-               "Test_CF_WriteQueueCmd_Success_type_DownAnd_q_Pend");
+    UtTest_Add(Test_CF_WriteQueueCmd_WhenBadFormatSendEventAndRejectCommand, cf_cmd_tests_Setup,
+               cf_cmd_tests_Teardown, "Test_CF_WriteQueueCmd_WhenBadFormatSendEventAndRejectCommand");
+    UtTest_Add(Test_CF_WriteQueueCmd_When_CF_Dump_Start_FailsRejectCommand, cf_cmd_tests_Setup,
+               cf_cmd_tests_Teardown, "Test_CF_WriteQueueCmd_When_CF_Dump_Start_FailsRejectCommand");
+    UtTest_Add(Test_CF_WriteQueueCmd_Success, cf_cmd_tests_Setup, cf_cmd_tests_Teardown,
+               "Test_CF_WriteQueueCmd_Success");
 }
 
 void add_CF_ValidateChunkSizeCmd_tests(void)
@@ -139,6 +139,15 @@ void Test_CF_CFDP_EncodeHeaderWithoutSize(void)
     UtAssert_UINT32_EQ(CF_CODEC_GET_POSITION(&state), sizeof(expected));
     UtAssert_MemCmp(bytes, expected, sizeof(expected), "Encoded Bytes");
     UtAssert_MemCmpValue(bytes + sizeof(expected), 0xEE, sizeof(bytes) - sizeof(expected), "Remainder unchanged");
+    UtAssert_BOOL_FALSE(state.codec_state.large_file);
+
+    /* large file flag, the rest of the PDU is then encoded with 64-bit FSS fields */
+    in.large_flag = 1;
+    UT_CF_SetupEncodeState(&state, bytes, sizeof(bytes));
+    CF_CFDP_EncodeHeaderWithoutSize(&state, &in);
+    UtAssert_BOOL_TRUE(CF_CODEC_IS_OK(&state));
+    UtAssert_UINT32_EQ(bytes[0], 0x3d);
+    UtAssert_BOOL_TRUE(state.codec_state.large_file);
 }
 
 void Test_CF_CFDP_EncodeHeaderFinalSize(void)
@@ -175,6 +184,114 @@ void Test_CF_CFDP_EncodeHeaderFinalSize(void)
     UtAssert_BOOL_FALSE(CF_CODEC_IS_OK(&state));
 }
 
+void Test_CF_CFDP_EncodeHeaderTemplate(void)
+{
+    /* Test for:
+     * void CF_CFDP_EncodeHeaderTemplate(CF_EncodedHeader_t *tmpl, const CF_Logical_PduHeader_t *plh);
+     * void CF_CFDP_EncodeHeaderFromTemplate(CF_EncoderState_t *state, CF_Logical_PduHeader_t *plh,
+     *                                       const CF_EncodedHeader_t *tmpl);
+     */
+    static const uint8     eid_lengths[] = {1, 2, 4, 8};
+    CF_EncoderState_t      state;
+    CF_Logical_PduHeader_t in;
+    CF_Logical_PduHeader_t out;
+    CF_EncodedHeader_t     tmpl;
+    uint8                  expected[CF_CFDP_MAX_HEADER_SIZE + 2];
+    uint8                  bytes[CF_CFDP_MAX_HEADER_SIZE + 2];
+    size_t                 i;
+
+    for (i = 0; i < sizeof(eid_lengths); ++i)
+    {
+        memset(&in, 0, sizeof(in));
+        in.version         = 1;
+        in.pdu_type        = 1;
+        in.txm_mode        = i & 1;
+        in.eid_length      = eid_lengths[i];
+        in.txn_seq_length  = eid_lengths[sizeof(eid_lengths) - 1 - i];
+        in.source_eid      = 0x44;
+        in.sequence_num    = 0x55;
+        in.destination_eid = 0x66;
+
+        /* reference encoding, the length field is not encoded until the end so finish both PDUs */
+        memset(expected, 0xEE, sizeof(expected));
+        UT_CF_SetupEncodeState(&state, expected, sizeof(expected));
+        CF_CFDP_EncodeHeaderWithoutSize(&state, &in);
+        in.data_encoded_length = 0x1234;
+        CF_CFDP_EncodeHeaderFinalSize(&state, &in);
+
+        /* template must produce exactly the same bytes, position and logical header */
+        CF_CFDP_EncodeHeaderTemplate(&tmpl, &in);
+        UtAssert_UINT32_EQ(tmpl.hdr.header_encoded_length, in.header_encoded_length);
+
+        memset(bytes, 0xEE, sizeof(bytes));
+        memset(&out, 0, sizeof(out));
+        UT_CF_SetupEncodeState(&state, bytes, sizeof(bytes));
+        CF_CFDP_EncodeHeaderFromTemplate(&state, &out, &tmpl);
+        UtAssert_BOOL_TRUE(CF_CODEC_IS_OK(&state));
+        UtAssert_UINT32_EQ(CF_CODEC_GET_POSITION(&state), in.header_encoded_length);
+        CF_CFDP_EncodeHeaderFinalSize(&state, &out);
+        UtAssert_MemCmp(bytes, expected, sizeof(bytes), "Template Bytes");
+        UtAssert_UINT32_EQ(out.header_encoded_length, in.header_encoded_length);
+        UtAssert_UINT32_EQ(out.eid_length, in.eid_length);
+        UtAssert_UINT32_EQ(out.txn_seq_length, in.txn_seq_length);
+        UtAssert_UINT32_EQ(out.txm_mode, in.txm_mode);
+    }
+
+    /* no room, should be noop */
+    memset(bytes, 0xEE, sizeof(bytes));
+    memset(&out, 0, sizeof(out));
+    UT_CF_SetupEncodeState(&state, bytes, 2);
+    CF_CFDP_EncodeHeaderFromTemplate(&state, &out, &tmpl);
+    UtAssert_BOOL_FALSE(CF_CODEC_IS_OK(&state));
+    UtAssert_MemCmpValue(bytes, 0xEE, sizeof(bytes), "Bytes unchanged");
+    UtAssert_ZERO(out.header_encoded_length);
+}
+
+void Test_CF_CFDP_EncodeHeaderTemplate_Benchmark(void)
+{
+    CF_EncoderState_t      state;
+    CF_Logical_PduHeader_t in;
+    CF_EncodedHeader_t     tmpl;
+    uint8                  bytes[CF_CFDP_MAX_HEADER_SIZE];
+    uint32                 rep;
+    clock_t                start;
+    double                 secs_encode;
+    double                 secs_copy;
+
+    memset(&in, 0, sizeof(in));
+    in.version         = 1;
+    in.pdu_type        = 1;
+    in.source_eid      = 0x1234;
+    in.sequence_num    = 0x56789A;
+    in.destination_eid = 0x42;
+
+    /* what CF_CFDP_ConstructPduHeader does for every file data PDU */
+    start = clock();
+    for (rep = 0; rep < 1000000; ++rep)
+    {
+        in.eid_length     = CF_CFDP_GetValueEncodedSize(in.source_eid);
+        in.txn_seq_length = CF_CFDP_GetValueEncodedSize(in.sequence_num);
+        UT_CF_SetupEncodeState(&state, bytes, sizeof(bytes));
+        CF_CFDP_EncodeHeaderWithoutSize(&state, &in);
+    }
+    secs_encode = (double)(clock() - start) / CLOCKS_PER_SEC;
+    UtAssert_UINT32_EQ(CF_CODEC_GET_POSITION(&state), in.header_encoded_length);
+
+    /* what CF_CFDP_ConstructFileDataHeader does instead */
+    CF_CFDP_EncodeHeaderTemplate(&tmpl, &in);
+    start = clock();
+    for (rep = 0; rep < 1000000; ++rep)
+    {
+        UT_CF_SetupEncodeState(&state, bytes, sizeof(bytes));
+        CF_CFDP_EncodeHeaderFromTemplate(&state, &in, &tmpl);
+    }
+    secs_copy = (double)(clock() - start) / CLOCKS_PER_SEC;
+    UtAssert_UINT32_EQ(CF_CODEC_GET_POSITION(&state), in.header_encoded_length);
+
+    UtPrintf("CF_CFDP PDU header: encode %.1f ns/PDU, template %.1f ns/PDU", secs_encode * 1000.0,
+             secs_copy * 1000.0);
+}
+
 void Test_CF_CFDP_EncodeFileDirectiveHeader(void)
 {
     /* Test for:
@@ -332,7 +449,10 @@ void Test_CF_CFDP_EncodeSegmentRequest(void)
     CF_EncoderState_t           state;
     CF_Logical_SegmentRequest_t in;
     uint8                       bytes[10];
-    const uint8                 expected[] = {0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88};
+    uint8                       bytes_large[20];
+    const uint8                 expected[]       = {0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88};
+    const uint8                 expected_large[] = {0x00, 0x00, 0x00, 0x01, 0x11, 0x22, 0x33, 0x44,
+                                                    0x00, 0x00, 0x00, 0x02, 0x55, 0x66, 0x77, 0x88};
 
     memset(&in, 0, sizeof(in));
     in.offset_start = 0x11223344;
@@ -354,6 +474,25 @@ void Test_CF_CFDP_EncodeSegmentRequest(void)
     UtAssert_UINT32_EQ(CF_CODEC_GET_POSITION(&state), sizeof(expected));
     UtAssert_MemCmp(bytes, expected, sizeof(expected), "Encoded Bytes");
     UtAssert_MemCmpValue(bytes + sizeof(expected), 0xEE, sizeof(bytes) - sizeof(expected), "Remainder unchanged");
+
+    /* large file, offsets past 4 GiB */
+    in.offset_start = 0x111223344;
+    in.offset_end   = 0x255667788;
+    memset(bytes_large, 0xEE, sizeof(bytes_large));
+    UT_CF_SetupEncodeState(&state, bytes_large, sizeof(bytes_large));
+    state.codec_state.large_file = true;
+    CF_CFDP_EncodeSegmentRequest(&state, &in);
+    UtAssert_BOOL_TRUE(CF_CODEC_IS_OK(&state));
+    UtAssert_UINT32_EQ(CF_CODEC_GET_POSITION(&state), sizeof(expected_large));
+    UtAssert_MemCmp(bytes_large, expected_large, sizeof(expected_large), "Encoded Bytes");
+
+    /* large file, no room for the second offset */
+    memset(bytes_large, 0xEE, sizeof(bytes_large));
+    UT_CF_SetupEncodeState(&state, bytes_large, 12);
+    state.codec_state.large_file = true;
+    CF_CFDP_EncodeSegmentRequest(&state, &in);
+    UtAssert_BOOL_FALSE(CF_CODEC_IS_OK(&state));
+    UtAssert_MemCmpValue(bytes_large + 8, 0xEE, sizeof(bytes_large) - 8, "Bytes unchanged");
 }
 
 void Test_CF_CFDP_EncodeAllTlv(void)
@@ -447,7 +586,8 @@ void Test_CF_CFDP_EncodeMd(void)
     CF_EncoderState_t  state;
     CF_Logical_PduMd_t in;
     uint8              bytes[20];
-    const uint8        expected[] = {0x00, 0x00, 0x00, 0x12, 0x34, 0x03, 's', 'r', 'c', 0x04, 'd', 'e', 's', 't'};
+    const uint8        expected[]       = {0x00, 0x00, 0x00, 0x12, 0x34, 0x03, 's', 'r', 'c', 0x04, 'd', 'e', 's', 't'};
+    const uint8        expected_large[] = {0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x12, 0x34};
 
     memset(&in, 0, sizeof(in));
     in.size                     = 0x1234;
@@ -472,6 +612,16 @@ void Test_CF_CFDP_EncodeMd(void)
     UtAssert_UINT32_EQ(CF_CODEC_GET_POSITION(&state), sizeof(expected));
     UtAssert_MemCmp(bytes, expected, sizeof(expected), "Encoded Bytes");
     UtAssert_MemCmpValue(bytes + sizeof(expected), 0xEE, sizeof(bytes) - sizeof(expected), "Remainder unchanged");
+
+    /* large file, size past 4 GiB, the filenames follow the same way */
+    in.size = 0x100001234;
+    UT_CF_SetupEncodeState(&state, bytes, sizeof(bytes));
+    state.codec_state.large_file = true;
+    CF_CFDP_EncodeMd(&state, &in);
+    UtAssert_BOOL_TRUE(CF_CODEC_IS_OK(&state));
+    UtAssert_UINT32_EQ(CF_CODEC_GET_POSITION(&state), sizeof(expected) + 4);
+    UtAssert_MemCmp(bytes, expected_large, sizeof(expected_large), "Encoded Bytes");
+    UtAssert_MemCmp(bytes + sizeof(expected_large), expected + 5, sizeof(expected) - 5, "Encoded Filenames");
 }
 
 void Test_CF_CFDP_EncodeFileDataHeader(void)
@@ -484,7 +634,8 @@ void Test_CF_CFDP_EncodeFileDataHeader(void)
     CF_Logical_PduFileDataHeader_t in;
     uint8                          bytes[20];
     const uint8                    expected_basic[] = {0x00, 0x00, 0x00, 0x13};
-    const uint8 expected_meta[] = {0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x13};
+    const uint8 expected_meta[]  = {0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x13};
+    const uint8 expected_large[] = {0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x13};
 
     memset(&in, 0, sizeof(in));
     in.offset   = 0x13;
@@ -519,6 +670,16 @@ void Test_CF_CFDP_EncodeFileDataHeader(void)
     UtAssert_BOOL_TRUE(CF_CODEC_IS_OK(&state));
     UtAssert_UINT32_EQ(CF_CODEC_GET_POSITION(&state), sizeof(expected_meta));
     UtAssert_MemCmp(bytes, expected_meta, sizeof(expected_meta), "Encoded Bytes");
+
+    /* large file, offset past 4 GiB */
+    in.offset = 0x100000013;
+    memset(bytes, 0xEE, sizeof(bytes));
+    UT_CF_SetupEncodeState(&state, bytes, sizeof(bytes));
+    state.codec_state.large_file = true;
+    CF_CFDP_EncodeFileDataHeader(&state, false, &in);
+    UtAssert_BOOL_TRUE(CF_CODEC_IS_OK(&state));
+    UtAssert_UINT32_EQ(CF_CODEC_GET_POSITION(&state), sizeof(expected_large));
+    UtAssert_MemCmp(bytes, expected_large, sizeof(expected_large), "Encoded Bytes");
 }
 
 void Test_CF_CFDP_EncodeEof(void)
@@ -529,7 +690,9 @@ void Test_CF_CFDP_EncodeEof(void)
     CF_EncoderState_t   state;
     CF_Logical_PduEof_t in;
     uint8               bytes[20];
-    const uint8         expected[] = {0x10, 0x12, 0x34, 0x56, 0x78, 0x00, 0x00, 0x45, 0x67, 0x06, 0x01, 0xaa};
+    const uint8         expected[]       = {0x10, 0x12, 0x34, 0x56, 0x78, 0x00, 0x00, 0x45, 0x67, 0x06, 0x01, 0xaa};
+    const uint8         expected_large[] = {0x10, 0x12, 0x34, 0x56, 0x78, 0x00, 0x00, 0x00,
+                                            0x02, 0x00, 0x00, 0x45, 0x67, 0x06, 0x01, 0xaa};
 
     memset(&in, 0, sizeof(in));
     in.crc                      = 0x12345678;
@@ -556,6 +719,15 @@ void Test_CF_CFDP_EncodeEof(void)
     UtAssert_UINT32_EQ(CF_CODEC_GET_POSITION(&state), sizeof(expected));
     UtAssert_MemCmp(bytes, expected, sizeof(expected), "Encoded Bytes");
     UtAssert_MemCmpValue(bytes + sizeof(expected), 0xEE, sizeof(bytes) - sizeof(expected), "Remainder unchanged");
+
+    /* large file, size past 4 GiB */
+    in.size = 0x200004567;
+    UT_CF_SetupEncodeState(&state, bytes, sizeof(bytes));
+    state.codec_state.large_file = true;
+    CF_CFDP_EncodeEof(&state, &in);
+    UtAssert_BOOL_TRUE(CF_CODEC_IS_OK(&state));
+    UtAssert_UINT32_EQ(CF_CODEC_GET_POSITION(&state), sizeof(expected_large));
+    UtAssert_MemCmp(bytes, expected_large, sizeof(expected_large), "Encoded Bytes");
 }
 
 void Test_CF_CFDP_EncodeFin(void)
@@ -736,6 +908,7 @@ void Test_CF_CFDP_DecodeHeader(void)
     const uint8            bytes[]   = {0x3c, 0x01, 0x02, 0x00, 0x44, 0x55, 0x66};
     const uint8            bad_eid[] = {0x3c, 0x01, 0x02, 0x73, 0x44, 0x55, 0x66};
     const uint8            bad_tsn[] = {0x3c, 0x01, 0x02, 0x37, 0x44, 0x55, 0x66};
+    const uint8            large[]   = {0x3d, 0x01, 0x02, 0x00, 0x44, 0x55, 0x66};
 
     /* fill with nonzero bytes so it is evident what was set */
     memset(&out, 0xEE, sizeof(out));
@@ -762,6 +935,14 @@ void Test_CF_CFDP_DecodeHeader(void)
     UtAssert_UINT32_EQ(out.sequence_num, 0x55);
     UtAssert_UINT32_EQ(out.destination_eid, 0x66);
     UtAssert_UINT32_EQ(out.header_encoded_length, sizeof(bytes));
+    UtAssert_UINT32_EQ(out.large_flag, 0);
+    UtAssert_BOOL_FALSE(state.codec_state.large_file);
+
+    /* large file flag, the rest of the PDU is then decoded with 64-bit FSS fields */
+    UT_CF_SetupDecodeState(&state, large, sizeof(large));
+    UtAssert_INT32_EQ(CF_CFDP_DecodeHeader(&state, &out), 0);
+    UtAssert_UINT32_EQ(out.large_flag, 1);
+    UtAssert_BOOL_TRUE(state.codec_state.large_file);
 
     /*
      * Check for EID that would be truncated
@@ -887,6 +1068,8 @@ void Test_CF_CFDP_DecodeSegmentRequest(void)
     CF_DecoderState_t           state;
     CF_Logical_SegmentRequest_t out;
     const uint8                 bytes[] = {0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88};
+    const uint8                 large[] = {0x00, 0x00, 0x00, 0x01, 0x11, 0x22, 0x33, 0x44,
+                                           0x00, 0x00, 0x00, 0x02, 0x55, 0x66, 0x77, 0x88};
 
     /* fill with nonzero bytes so it is evident what was set */
     memset(&out, 0xEE, sizeof(out));
@@ -904,6 +1087,21 @@ void Test_CF_CFDP_DecodeSegmentRequest(void)
     UtAssert_UINT32_EQ(CF_CODEC_GET_POSITION(&state), sizeof(bytes));
     UtAssert_UINT32_EQ(out.offset_start, 0x11223344);
     UtAssert_UINT32_EQ(out.offset_end, 0x55667788);
+
+    /* large file, offsets past 4 GiB */
+    UT_CF_SetupDecodeState(&state, large, sizeof(large));
+    state.codec_state.large_file = true;
+    CF_CFDP_DecodeSegmentRequest(&state, &out);
+    UtAssert_BOOL_TRUE(CF_CODEC_IS_OK(&state));
+    UtAssert_UINT32_EQ(CF_CODEC_GET_POSITION(&state), sizeof(large));
+    UtAssert_BOOL_TRUE(out.offset_start == 0x111223344);
+    UtAssert_BOOL_TRUE(out.offset_end == 0x255667788);
+
+    /* large file, the same bytes do not hold a whole segment request */
+    UT_CF_SetupDecodeState(&state, bytes, sizeof(bytes));
+    state.codec_state.large_file = true;
+    CF_CFDP_DecodeSegmentRequest(&state, &out);
+    UtAssert_BOOL_FALSE(CF_CODEC_IS_OK(&state));
 }
 
 void Test_CF_CFDP_DecodeAllTlv(void)
@@ -1017,6 +1215,8 @@ void Test_CF_CFDP_DecodeMd(void)
     CF_Logical_PduMd_t out;
     const uint8        bytes[]     = {0x00, 0x00, 0x00, 0x12, 0x34, 0x03, 's', 'r', 'c', 0x04, 'd', 'e', 's', 't'};
     const uint8        bad_input[] = {0x00, 0x00, 0x00, 0x12, 0x34, 0x56, 's', 'r', 'c', 0x04, 'd', 'e', 's', 't'};
+    const uint8        large[]     = {0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x12, 0x34,
+                                  0x03, 's',  'r',  'c',  0x04, 'd',  'e',  's',  't'};
 
     /* fill with nonzero bytes so it is evident what was set */
     memset(&out, 0xEE, sizeof(out));
@@ -1038,6 +1238,16 @@ void Test_CF_CFDP_DecodeMd(void)
     UtAssert_ADDRESS_EQ(out.dest_filename.data_ptr, &bytes[10]);
     UtAssert_UINT32_EQ(out.dest_filename.length, 4);
 
+    /* large file, size past 4 GiB */
+    UT_CF_SetupDecodeState(&state, large, sizeof(large));
+    state.codec_state.large_file = true;
+    CF_CFDP_DecodeMd(&state, &out);
+    UtAssert_BOOL_TRUE(CF_CODEC_IS_OK(&state));
+    UtAssert_UINT32_EQ(CF_CODEC_GET_POSITION(&state), sizeof(large));
+    UtAssert_BOOL_TRUE(out.size == 0x100001234);
+    UtAssert_ADDRESS_EQ(out.source_filename.data_ptr, &large[10]);
+    UtAssert_ADDRESS_EQ(out.dest_filename.data_ptr, &large[14]);
+
     /* The bad input has a long length that would go beyond the end */
     UT_CF_SetupDecodeState(&state, bad_input, sizeof(bad_input));
     CF_CFDP_DecodeMd(&state, &out);
@@ -1056,6 +1266,7 @@ void Test_CF_CFDP_DecodeFileDataHeader(void)
     const uint8 bytes_meta[]  = {0x41, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x00, 0x00, 0x00, 0x13, 0xcc};
     const uint8 bad_input_1[] = {0xff, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x00, 0x00, 0x00, 0x13, 0xcc};
     const uint8 bad_input_2[] = {0x41, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06};
+    const uint8 bytes_large[] = {0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x13, 0xdd};
 
     /* fill with nonzero bytes so it is evident what was set */
     memset(&out, 0xEE, sizeof(out));
@@ -1097,6 +1308,21 @@ void Test_CF_CFDP_DecodeFileDataHeader(void)
     UT_CF_SetupDecodeState(&state, bad_input_2, sizeof(bad_input_2));
     CF_CFDP_DecodeFileDataHeader(&state, true, &out);
     UtAssert_BOOL_FALSE(CF_CODEC_IS_OK(&state));
+
+    /* large file, offset past 4 GiB */
+    UT_CF_SetupDecodeState(&state, bytes_large, sizeof(bytes_large));
+    state.codec_state.large_file = true;
+    CF_CFDP_DecodeFileDataHeader(&state, false, &out);
+    UtAssert_BOOL_TRUE(CF_CODEC_IS_OK(&state));
+    UtAssert_BOOL_TRUE(out.offset == 0x100000013);
+    UtAssert_UINT32_EQ(out.data_len, 1);
+    UtAssert_ADDRESS_EQ(out.data_ptr, &bytes_large[8]);
+
+    /* large file, too short for the offset */
+    UT_CF_SetupDecodeState(&state, bytes_basic, sizeof(bytes_basic));
+    state.codec_state.large_file = true;
+    CF_CFDP_DecodeFileDataHeader(&state, false, &out);
+    UtAssert_BOOL_FALSE(CF_CODEC_IS_OK(&state));
 }
 
 void Test_CF_CFDP_DecodeEof(void)
@@ -1108,6 +1334,8 @@ void Test_CF_CFDP_DecodeEof(void)
     CF_Logical_PduEof_t out;
     const uint8         bytes[]     = {0x10, 0x12, 0x34, 0x56, 0x78, 0x00, 0x00, 0x45, 0x67, 0x06, 0x01, 0xaa};
     const uint8         bad_input[] = {0x10, 0x12, 0x34, 0x56, 0x78, 0x00, 0x00, 0x45, 0x67, 0x06, 0x06, 0xaa, 0xbb};
+    const uint8         large[]     = {0x10, 0x12, 0x34, 0x56, 0x78, 0x00, 0x00, 0x00,
+                                   0x02, 0x00, 0x00, 0x45, 0x67, 0x06, 0x01, 0xaa};
 
     /* fill with nonzero bytes so it is evident what was set */
     memset(&out, 0xEE, sizeof(out));
@@ -1131,6 +1359,15 @@ void Test_CF_CFDP_DecodeEof(void)
     UtAssert_UINT32_EQ(out.tlv_list.tlv[0].length, 1);
     UtAssert_UINT32_EQ(out.tlv_list.tlv[0].data.eid, 0xaa);
 
+    /* large file, size past 4 GiB */
+    UT_CF_SetupDecodeState(&state, large, sizeof(large));
+    state.codec_state.large_file = true;
+    CF_CFDP_DecodeEof(&state, &out);
+    UtAssert_BOOL_TRUE(CF_CODEC_IS_OK(&state));
+    UtAssert_UINT32_EQ(CF_CODEC_GET_POSITION(&state), sizeof(large));
+    UtAssert_BOOL_TRUE(out.size == 0x200004567);
+    UtAssert_UINT32_EQ(out.tlv_list.tlv[0].data.eid, 0xaa);
+
     /* The bad input has a long length that would go beyond the end */
     UT_CF_SetupDecodeState(&state, bad_input, sizeof(bad_input));
     CF_CFDP_DecodeEof(&state, &out);
@@ -1264,6 +1501,8 @@ void Add_CF_Encode_tests(void)
     UtTest_Add(Test_CF_EncodeIntegerInSize, NULL, NULL, "CF_EncodeIntegerInSize");
     UtTest_Add(Test_CF_CFDP_EncodeHeaderWithoutSize, NULL, NULL, "CF_CFDP_EncodeHeaderWithoutSize");
     UtTest_Add(Test_CF_CFDP_EncodeHeaderFinalSize, NULL, NULL, "CF_CFDP_EncodeHeaderFinalSize");
+    UtTest_Add(Test_CF_CFDP_EncodeHeaderTemplate, NULL, NULL, "CF_CFDP_EncodeHeaderTemplate");
+    UtTest_Add(Test_CF_CFDP_EncodeHeaderTemplate_Benchmark, NULL, NULL, "CF_CFDP_EncodeHeaderTemplate_Benchmark");
     UtTest_Add(Test_CF_CFDP_EncodeFileDirectiveHeader, NULL, NULL, "CF_CFDP_EncodeFileDirectiveHeader");
     UtTest_Add(Test_CF_CFDP_EncodeLV, NULL, NULL, "CF_CFDP_EncodeLV");
     UtTest_Add(Test_CF_CFDP_EncodeTLV, NULL, NULL, "CF_CFDP_EncodeTLV");
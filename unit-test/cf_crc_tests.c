@@ -20,6 +20,58 @@
 /* cf testing includes */
 #include "cf_test_utils.h"
 
+/* the scaling benchmark needs host threads and a wall clock, see unit-test/CMakeLists.txt */
+#ifdef CF_UT_HOST_THREADS
+#include <pthread.h>
+#include <time.h>
+
+/* File data digested by each benchmark thread, as a channel worker would */
+uint8 UT_CF_CRC_WorkerData[65536];
+
+/* One benchmark thread, standing in for the worker task of a channel */
+typedef struct UT_CF_CRC_Worker
+{
+    pthread_t thread;
+    uint32    result;
+} UT_CF_CRC_Worker_t;
+#endif
+
+void cf_crc_tests_Setup(void)
+{
+    cf_tests_Setup();
+    CF_CRC_Init();
+}
+
+#ifdef CF_UT_HOST_THREADS
+
+/* Digests the file data, reading the same CRC tables as every other thread */
+void *UT_CF_CRC_WorkerMain(void *arg)
+{
+    UT_CF_CRC_Worker_t *worker = arg;
+    CF_Crc_t            crc;
+    uint32              rep;
+
+    CF_CRC_Start(&crc, CF_CFDP_ChecksumType_CRC32);
+    for (rep = 0; rep < 64; ++rep)
+    {
+        CF_CRC_Digest(&crc, UT_CF_CRC_WorkerData, sizeof(UT_CF_CRC_WorkerData));
+    }
+    CF_CRC_Finalize(&crc);
+
+    worker->result = crc.result;
+    return NULL;
+}
+
+/* Wall clock time, as clock() adds up the time of every thread */
+double UT_CF_CRC_WallSecs(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + ((double)now.tv_nsec / 1e9);
+}
+#endif
+
 void Test_CF_CRC_Start(void)
 {
     /* Arrange */
@@ -28,12 +80,108 @@ void Test_CF_CRC_Start(void)
     memset(&crc, 0xFF, sizeof(crc));
 
     /* Act */
-    UtAssert_VOIDCALL(CF_CRC_Start(&crc));
+    UtAssert_VOIDCALL(CF_CRC_Start(&crc, CF_CFDP_ChecksumType_MODULAR));
 
     /* Assert */
     UtAssert_ZERO(crc.working);
     UtAssert_ZERO(crc.result);
     UtAssert_ZERO(crc.index);
+    UtAssert_ZERO(crc.length);
+    UtAssert_UINT32_EQ(crc.type, CF_CFDP_ChecksumType_MODULAR);
+
+    /* CRC types preset the register */
+    UtAssert_VOIDCALL(CF_CRC_Start(&crc, CF_CFDP_ChecksumType_CRC32));
+    UtAssert_UINT32_EQ(crc.working, 0xFFFFFFFF);
+    UtAssert_UINT32_EQ(crc.type, CF_CFDP_ChecksumType_CRC32);
+
+    /* unsupported type is recorded but otherwise left clear */
+    UtAssert_VOIDCALL(CF_CRC_Start(&crc, 1));
+    UtAssert_ZERO(crc.working);
+    UtAssert_UINT32_EQ(crc.type, 1);
+}
+
+void Test_CF_CRC_IsSupported(void)
+{
+    UtAssert_BOOL_TRUE(CF_CRC_IsSupported(CF_CFDP_ChecksumType_MODULAR));
+    UtAssert_BOOL_TRUE(CF_CRC_IsSupported(CF_CFDP_ChecksumType_CRC32C));
+    UtAssert_BOOL_TRUE(CF_CRC_IsSupported(CF_CFDP_ChecksumType_CRC32));
+    UtAssert_BOOL_TRUE(CF_CRC_IsSupported(CF_CFDP_ChecksumType_NULL));
+    UtAssert_BOOL_FALSE(CF_CRC_IsSupported(1));
+    UtAssert_BOOL_FALSE(CF_CRC_IsSupported(14));
+    UtAssert_BOOL_FALSE(CF_CRC_IsSupported(CF_CRC_MAX_CHECKSUM_TYPES));
+}
+
+/* Bit at a time reflected CRC, as a reference for the table and instruction paths */
+static uint32 UT_CF_CRC_Reflected(uint32 poly, const uint8 *data, size_t len)
+{
+    uint32 reg = 0xFFFFFFFF;
+    int    k;
+
+    for (; len > 0; --len, ++data)
+    {
+        reg ^= *data;
+        for (k = 0; k < 8; ++k)
+        {
+            reg = (reg & 1) ? ((reg >> 1) ^ poly) : (reg >> 1);
+        }
+    }
+
+    return ~reg;
+}
+
+void Test_CF_CRC_Types(void)
+{
+    static const uint8 check[] = "123456789";
+    CF_Crc_t           crc;
+    uint8              data[101];
+    size_t             len;
+    size_t             split;
+
+    /* standard check values */
+    CF_CRC_Start(&crc, CF_CFDP_ChecksumType_CRC32);
+    CF_CRC_Digest(&crc, check, 9);
+    UtAssert_VOIDCALL(CF_CRC_Finalize(&crc));
+    UtAssert_UINT32_EQ(crc.result, 0xCBF43926);
+    UtAssert_UINT32_EQ(crc.length, 9);
+
+    CF_CRC_Start(&crc, CF_CFDP_ChecksumType_CRC32C);
+    CF_CRC_Digest(&crc, check, 9);
+    UtAssert_VOIDCALL(CF_CRC_Finalize(&crc));
+    UtAssert_UINT32_EQ(crc.result, 0xE3069283);
+
+    CF_CRC_Start(&crc, CF_CFDP_ChecksumType_NULL);
+    CF_CRC_Digest(&crc, check, 9);
+    UtAssert_VOIDCALL(CF_CRC_Finalize(&crc));
+    UtAssert_ZERO(crc.result);
+
+    CF_CRC_Start(&crc, 1);
+    CF_CRC_Digest(&crc, check, 9);
+    UtAssert_VOIDCALL(CF_CRC_Finalize(&crc));
+    UtAssert_ZERO(crc.result);
+
+    /* every length, split in two at every point, must match the bitwise reference */
+    for (len = 0; len < sizeof(data); ++len)
+    {
+        data[len] = (uint8)((len * 151) + 7);
+    }
+
+    for (len = 0; len <= sizeof(data); len += 5)
+    {
+        for (split = 0; split <= len; ++split)
+        {
+            CF_CRC_Start(&crc, CF_CFDP_ChecksumType_CRC32);
+            CF_CRC_Digest(&crc, data, split);
+            CF_CRC_Digest(&crc, &data[split], len - split);
+            CF_CRC_Finalize(&crc);
+            UtAssert_UINT32_EQ(crc.result, UT_CF_CRC_Reflected(0xEDB88320, data, len));
+
+            CF_CRC_Start(&crc, CF_CFDP_ChecksumType_CRC32C);
+            CF_CRC_Digest(&crc, data, split);
+            CF_CRC_Digest(&crc, &data[split], len - split);
+            CF_CRC_Finalize(&crc);
+            UtAssert_UINT32_EQ(crc.result, UT_CF_CRC_Reflected(0x82F63B78, data, len));
+        }
+    }
 }
 
 void Test_CF_CRC_Digest(void)
@@ -42,7 +190,7 @@ void Test_CF_CRC_Digest(void)
     uint8    data[] = {1, 2, 3, 4, 5};
 
     /* Already tested, so OK to use */
-    CF_CRC_Start(&crc);
+    CF_CRC_Start(&crc, CF_CFDP_ChecksumType_MODULAR);
 
     /* Zero length should leave crc as zeros */
     UtAssert_VOIDCALL(CF_CRC_Digest(&crc, NULL, 0));
@@ -63,7 +211,7 @@ void Test_CF_CRC_Finalize(void)
     uint8    data[] = {1, 2, 3, 4, 5};
 
     /* Already tested, so OK to use */
-    CF_CRC_Start(&crc);
+    CF_CRC_Start(&crc, CF_CFDP_ChecksumType_MODULAR);
 
     /* Test with clear crc */
     UtAssert_VOIDCALL(CF_CRC_Finalize(&crc));
@@ -81,9 +229,267 @@ void Test_CF_CRC_Finalize(void)
     UtAssert_ZERO(crc.index);
 }
 
+/* byte at a time reference, as CF_CRC_Digest() was originally written */
+static void UT_CF_CRC_DigestBytes(CF_Crc_t *crc, const uint8 *data, size_t len)
+{
+    size_t i;
+
+    for (i = 0; i < len; ++i)
+    {
+        crc->working <<= 8;
+        crc->working |= data[i];
+
+        ++crc->index;
+
+        if (crc->index == 4)
+        {
+            crc->result += crc->working;
+            crc->index = 0;
+        }
+    }
+}
+
+void Test_CF_CRC_Digest_Unaligned(void)
+{
+    CF_Crc_t crc;
+    CF_Crc_t ref;
+    uint8    data[97];
+    size_t   head;
+    size_t   split;
+    size_t   i;
+    bool     match = true;
+
+    for (i = 0; i < sizeof(data); ++i)
+    {
+        data[i] = (uint8)((i * 37) + 0xA5);
+    }
+
+    /* every buffer alignment and every split between two calls must match the byte reference */
+    for (head = 0; head < 8; ++head)
+    {
+        for (split = 0; split <= (sizeof(data) - head); ++split)
+        {
+            CF_CRC_Start(&crc, CF_CFDP_ChecksumType_MODULAR);
+            CF_CRC_Start(&ref, CF_CFDP_ChecksumType_MODULAR);
+
+            CF_CRC_Digest(&crc, &data[head], split);
+            CF_CRC_Digest(&crc, &data[head + split], sizeof(data) - head - split);
+            UT_CF_CRC_DigestBytes(&ref, &data[head], sizeof(data) - head);
+
+            if ((crc.working != ref.working) || (crc.result != ref.result) || (crc.index != ref.index))
+            {
+                match = false;
+            }
+        }
+    }
+
+    UtAssert_BOOL_TRUE(match);
+}
+
+void Test_CF_CRC_DigestAt(void)
+{
+    static const size_t splits[] = {0, 3, 5, 6, 17, 40, 41, 64, 97};
+    CF_Crc_t            crc;
+    CF_Crc_t            ref;
+    uint8               data[97];
+    size_t              i;
+
+    for (i = 0; i < sizeof(data); ++i)
+    {
+        data[i] = (uint8)((i * 53) + 0x3C);
+    }
+
+    CF_CRC_Start(&ref, CF_CFDP_ChecksumType_MODULAR);
+    CF_CRC_Digest(&ref, data, sizeof(data));
+    CF_CRC_Finalize(&ref);
+
+    /* digest the pieces in reverse order, at misaligned boundaries, to get the same result */
+    CF_CRC_Start(&crc, CF_CFDP_ChecksumType_MODULAR);
+    for (i = (sizeof(splits) / sizeof(splits[0])) - 1; i > 0; --i)
+    {
+        CF_CRC_DigestAt(&crc, splits[i - 1], &data[splits[i - 1]], splits[i] - splits[i - 1]);
+    }
+
+    UtAssert_VOIDCALL(CF_CRC_Finalize(&crc));
+    UtAssert_UINT32_EQ(crc.result, ref.result);
+
+    /* zero length changes nothing */
+    UtAssert_BOOL_TRUE(CF_CRC_DigestAt(&crc, 1, NULL, 0));
+    UtAssert_UINT32_EQ(crc.result, ref.result);
+
+    /* CRC types only take data in stream order */
+    CF_CRC_Start(&ref, CF_CFDP_ChecksumType_CRC32C);
+    CF_CRC_Digest(&ref, data, sizeof(data));
+    CF_CRC_Finalize(&ref);
+
+    CF_CRC_Start(&crc, CF_CFDP_ChecksumType_CRC32C);
+    UtAssert_BOOL_FALSE(CF_CRC_DigestAt(&crc, 40, &data[40], sizeof(data) - 40));
+    UtAssert_BOOL_TRUE(CF_CRC_DigestAt(&crc, 0, data, 40));
+    UtAssert_BOOL_TRUE(CF_CRC_DigestAt(&crc, 40, &data[40], sizeof(data) - 40));
+    CF_CRC_Finalize(&crc);
+    UtAssert_UINT32_EQ(crc.result, ref.result);
+
+    /* null checksum takes anything */
+    CF_CRC_Start(&crc, CF_CFDP_ChecksumType_NULL);
+    UtAssert_BOOL_TRUE(CF_CRC_DigestAt(&crc, 40, &data[40], sizeof(data) - 40));
+
+    /* unsupported type takes nothing */
+    CF_CRC_Start(&crc, 1);
+    UtAssert_BOOL_FALSE(CF_CRC_DigestAt(&crc, 0, data, sizeof(data)));
+}
+
+void Test_CF_CRC_GetKernel(void)
+{
+    uint32 idx = 0;
+
+    UtAssert_NOT_NULL(CF_CRC_GetKernel(0));
+
+    while (CF_CRC_GetKernel(idx + 1) != NULL)
+    {
+        ++idx;
+    }
+
+    /* the portable kernel is always available, and always last */
+    UtAssert_ADDRESS_EQ(CF_CRC_GetKernel(idx)->sum_words, CF_CRC_SumWords_Generic);
+    UtAssert_NULL(CF_CRC_GetKernel(idx + 1));
+}
+
+void Test_CF_CRC_SumWords_Benchmark(void)
+{
+    static uint8           data[65536];
+    const CF_CRC_Kernel_t *kernel;
+    CF_Crc_t               ref;
+    uint32                 idx;
+    uint32                 sum;
+    uint32                 rep;
+    size_t                 i;
+    clock_t                start;
+    double                 secs;
+
+    for (i = 0; i < sizeof(data); ++i)
+    {
+        data[i] = (uint8)rand();
+    }
+
+    /* long runs of 0xFF would expose any lane carry mistakes, so include one */
+    memset(data, 0xFF, sizeof(data) / 4);
+
+    CF_CRC_Start(&ref, CF_CFDP_ChecksumType_MODULAR);
+    UT_CF_CRC_DigestBytes(&ref, data, sizeof(data));
+
+    for (idx = 0; (kernel = CF_CRC_GetKernel(idx)) != NULL; ++idx)
+    {
+        /* output must be bit-identical to the byte at a time digest, from any offset */
+        UtAssert_UINT32_EQ(kernel->sum_words(data, sizeof(data) / 4), ref.result);
+        UtAssert_UINT32_EQ(kernel->sum_words(&data[1], 7), CF_CRC_SumWords_Generic(&data[1], 7));
+
+        sum   = 0;
+        start = clock();
+        for (rep = 0; rep < 256; ++rep)
+        {
+            sum += kernel->sum_words(data, sizeof(data) / 4);
+        }
+        secs = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+        UtAssert_UINT32_EQ(sum, ref.result * 256);
+        UtPrintf("CF_CRC kernel %s: %.0f bytes/sec", kernel->name,
+                 (secs > 0) ? ((double)sizeof(data) * 256 / secs) : 0.0);
+    }
+}
+
+void Test_CF_CRC_Types_Benchmark(void)
+{
+    static const uint8 types[] = {CF_CFDP_ChecksumType_MODULAR, CF_CFDP_ChecksumType_CRC32C,
+                                  CF_CFDP_ChecksumType_CRC32, CF_CFDP_ChecksumType_NULL};
+    static uint8       data[65536];
+    CF_Crc_t           crc;
+    uint32             rep;
+    size_t             i;
+    clock_t            start;
+    double             secs;
+
+    for (i = 0; i < sizeof(data); ++i)
+    {
+        data[i] = (uint8)rand();
+    }
+
+    for (i = 0; i < sizeof(types); ++i)
+    {
+        CF_CRC_Start(&crc, types[i]);
+        start = clock();
+        for (rep = 0; rep < 256; ++rep)
+        {
+            CF_CRC_Digest(&crc, data, sizeof(data));
+        }
+        CF_CRC_Finalize(&crc);
+        secs = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+        UtAssert_UINT32_EQ(crc.length, sizeof(data) * 256);
+        UtPrintf("CF_CRC checksum type %u: %.0f bytes/sec", (unsigned int)types[i],
+                 (secs > 0) ? ((double)sizeof(data) * 256 / secs) : 0.0);
+    }
+}
+
+#ifdef CF_UT_HOST_THREADS
+void Test_CF_CRC_Scaling_Benchmark(void)
+{
+    UT_CF_CRC_Worker_t workers[CF_NUM_CHANNELS];
+    uint32             expected;
+    uint32             num_chans;
+    uint32             i;
+    size_t             j;
+    double             start;
+    double             secs;
+    double             secs_one = 0;
+
+    for (j = 0; j < sizeof(UT_CF_CRC_WorkerData); ++j)
+    {
+        UT_CF_CRC_WorkerData[j] = (uint8)rand();
+    }
+
+    UT_CF_CRC_WorkerMain(&workers[0]);
+    expected = workers[0].result;
+
+    /* every channel has the same work, so with a core each the time should stay flat */
+    for (num_chans = 1; num_chans <= CF_NUM_CHANNELS; ++num_chans)
+    {
+        start = UT_CF_CRC_WallSecs();
+        for (i = 0; i < num_chans; ++i)
+        {
+            UtAssert_INT32_EQ(pthread_create(&workers[i].thread, NULL, UT_CF_CRC_WorkerMain, &workers[i]), 0);
+        }
+        for (i = 0; i < num_chans; ++i)
+        {
+            UtAssert_INT32_EQ(pthread_join(workers[i].thread, NULL), 0);
+            UtAssert_UINT32_EQ(workers[i].result, expected);
+        }
+        secs = UT_CF_CRC_WallSecs() - start;
+
+        if (num_chans == 1)
+        {
+            secs_one = secs;
+        }
+
+        UtPrintf("CF_CRC %lu channel workers: %.0f bytes/sec, %.2fx one channel", (unsigned long)num_chans,
+                 (secs > 0) ? ((double)sizeof(UT_CF_CRC_WorkerData) * 64 * num_chans / secs) : 0.0,
+                 (secs > 0) ? (secs_one * num_chans / secs) : 0.0);
+    }
+}
+#endif
+
 void UtTest_Setup(void)
 {
-    TEST_CF_ADD(Test_CF_CRC_Start);
-    TEST_CF_ADD(Test_CF_CRC_Digest);
-    TEST_CF_ADD(Test_CF_CRC_Finalize);
+    UtTest_Add(Test_CF_CRC_Start, cf_crc_tests_Setup, cf_tests_Teardown, "CF_CRC_Start");
+    UtTest_Add(Test_CF_CRC_IsSupported, cf_crc_tests_Setup, cf_tests_Teardown, "CF_CRC_IsSupported");
+    UtTest_Add(Test_CF_CRC_Types, cf_crc_tests_Setup, cf_tests_Teardown, "CF_CRC_Types");
+    UtTest_Add(Test_CF_CRC_Digest, cf_crc_tests_Setup, cf_tests_Teardown, "CF_CRC_Digest");
+    UtTest_Add(Test_CF_CRC_Digest_Unaligned, cf_crc_tests_Setup, cf_tests_Teardown, "CF_CRC_Digest_Unaligned");
+    UtTest_Add(Test_CF_CRC_DigestAt, cf_crc_tests_Setup, cf_tests_Teardown, "CF_CRC_DigestAt");
+    UtTest_Add(Test_CF_CRC_Finalize, cf_crc_tests_Setup, cf_tests_Teardown, "CF_CRC_Finalize");
+    UtTest_Add(Test_CF_CRC_GetKernel, cf_crc_tests_Setup, cf_tests_Teardown, "CF_CRC_GetKernel");
+    UtTest_Add(Test_CF_CRC_SumWords_Benchmark, cf_crc_tests_Setup, cf_tests_Teardown, "CF_CRC_SumWords_Benchmark");
+    UtTest_Add(Test_CF_CRC_Types_Benchmark, cf_crc_tests_Setup, cf_tests_Teardown, "CF_CRC_Types_Benchmark");
+#ifdef CF_UT_HOST_THREADS
+    UtTest_Add(Test_CF_CRC_Scaling_Benchmark, cf_crc_tests_Setup, cf_tests_Teardown, "CF_CRC_Scaling_Benchmark");
+#endif
 }
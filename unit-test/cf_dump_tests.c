@@ -0,0 +1,370 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,447-1, and identified as “CFS CFDP (CF)
+ * Application version 3.0.0”
+ *
+ * Copyright (c) 2019 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/* cf testing includes */
+#include "cf_test_utils.h"
+#include "cf_dump.h"
+#include "cf_events.h"
+
+/* Enough entries to take more than one wakeup */
+#define UT_CF_DUMP_ENTRIES (CF_QUEUE_FILE_ENTRIES_PER_WAKEUP + 2)
+
+/* Entries under test, too big for the stack */
+CF_History_t     UT_CF_Dump_Histories[UT_CF_DUMP_ENTRIES];
+CF_Transaction_t UT_CF_Dump_Txns[UT_CF_DUMP_ENTRIES];
+
+/* Everything written to the queue file */
+uint8  UT_CF_Dump_File[UT_CF_DUMP_ENTRIES * ((CF_FILENAME_MAX_LEN * 2) + 128)];
+uint32 UT_CF_Dump_FileLen;
+
+/* Unlinks the node like the real CF_CList_Remove() */
+void UT_CF_Dump_Remove(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CF_CListNode_t **head = UT_Hook_GetArgValueByName(Context, "head", CF_CListNode_t **);
+    CF_CListNode_t * node = UT_Hook_GetArgValueByName(Context, "node", CF_CListNode_t *);
+
+    if (node->next == node)
+    {
+        *head = NULL;
+    }
+    else
+    {
+        node->prev->next = node->next;
+        node->next->prev = node->prev;
+        if (*head == node)
+        {
+            *head = node->next;
+        }
+    }
+
+    node->next = node;
+    node->prev = node;
+}
+
+/* Captures the file and writes all of it */
+void UT_CF_Dump_Write(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    const void * buf        = UT_Hook_GetArgValueByName(Context, "buf", const void *);
+    size_t       write_size = UT_Hook_GetArgValueByName(Context, "write_size", size_t);
+    CFE_Status_t ret        = write_size;
+
+    if ((UT_CF_Dump_FileLen + write_size) <= sizeof(UT_CF_Dump_File))
+    {
+        memcpy(&UT_CF_Dump_File[UT_CF_Dump_FileLen], buf, write_size);
+    }
+    UT_CF_Dump_FileLen += write_size;
+
+    UT_Stub_SetReturnValue(FuncKey, ret);
+}
+
+/* Link count nodes into a list on the given queue of channel 0 */
+void UT_CF_Dump_Link(CF_QueueIdx_t queue, CF_CListNode_t *first, size_t stride, uint32 count)
+{
+    CF_CListNode_t *node;
+    CF_CListNode_t *prev = NULL;
+    uint32          i;
+
+    for (i = 0; i < count; ++i)
+    {
+        node = (CF_CListNode_t *)((uint8 *)first + (i * stride));
+        if (prev != NULL)
+        {
+            prev->next = node;
+            node->prev = prev;
+        }
+        prev = node;
+    }
+
+    prev->next  = first;
+    first->prev = prev;
+
+    CF_AppData.engine.channels[0].qs[queue] = first;
+}
+
+void cf_dump_tests_Setup(void)
+{
+    cf_tests_Setup();
+
+    memset(UT_CF_Dump_Histories, 0, sizeof(UT_CF_Dump_Histories));
+    memset(UT_CF_Dump_Txns, 0, sizeof(UT_CF_Dump_Txns));
+    UT_CF_Dump_FileLen = 0;
+
+    UT_SetHandlerFunction(UT_KEY(CF_CList_Remove), UT_CF_Dump_Remove, NULL);
+    UT_SetHandlerFunction(UT_KEY(CF_WrappedWrite), UT_CF_Dump_Write, NULL);
+}
+
+/*
+ * Test routines
+ */
+
+/*
+ * Cover start while busy, open failure, and the lists for each selection
+ */
+void Test_CF_Dump_Start(void)
+{
+    CF_WriteQueue_Payload_t wq;
+
+    memset(&wq, 0, sizeof(wq));
+
+    /* Everything, in the order the command always wrote it */
+    wq.type  = CF_Type_all;
+    wq.queue = CF_Queue_all;
+    UtAssert_INT32_EQ(CF_Dump_Start(&wq), CFE_SUCCESS);
+    UtAssert_BOOL_TRUE(CF_AppData.dump.busy);
+    UtAssert_UINT32_EQ(CF_AppData.dump.num_steps, CF_DumpStep_NUM);
+    UtAssert_UINT32_EQ(CF_AppData.dump.steps[0], CF_DumpStep_RX_ACTIVE);
+    UtAssert_UINT32_EQ(CF_AppData.dump.steps[5], CF_DumpStep_TX_HISTORY);
+    UtAssert_STUB_COUNT(CF_WrappedOpenCreate, 1);
+
+    /* Only one at a time */
+    UtAssert_INT32_EQ(CF_Dump_Start(&wq), CF_ERROR);
+    UT_CF_AssertEventID(CF_CMD_WQ_BUSY_ERR_EID);
+    UtAssert_STUB_COUNT(CF_WrappedOpenCreate, 1);
+
+    /* Pending is only for TX */
+    CF_AppData.dump.busy = false;
+    wq.type              = CF_Type_down;
+    wq.queue             = CF_Queue_pend;
+    UtAssert_INT32_EQ(CF_Dump_Start(&wq), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(CF_AppData.dump.num_steps, 1);
+    UtAssert_UINT32_EQ(CF_AppData.dump.steps[0], CF_DumpStep_TX_PEND);
+
+    CF_AppData.dump.busy = false;
+    wq.type              = CF_Type_up;
+    wq.queue             = CF_Queue_history;
+    wq.format            = CF_QueueFormat_binary;
+    UtAssert_INT32_EQ(CF_Dump_Start(&wq), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(CF_AppData.dump.num_steps, 1);
+    UtAssert_UINT32_EQ(CF_AppData.dump.steps[0], CF_DumpStep_RX_HISTORY);
+    UtAssert_UINT32_EQ(CF_AppData.dump.format, CF_QueueFormat_binary);
+
+    /* Open failure */
+    CF_AppData.dump.busy = false;
+    UT_SetDefaultReturnValue(UT_KEY(CF_WrappedOpenCreate), OS_ERROR);
+    UtAssert_INT32_EQ(CF_Dump_Start(&wq), CF_ERROR);
+    UT_CF_AssertEventID(CF_CMD_WQ_OPEN_ERR_EID);
+    UtAssert_BOOL_FALSE(CF_AppData.dump.busy);
+}
+
+/*
+ * Cover a text file of history entries taking two wakeups, with entries of the other direction left out
+ */
+void Test_CF_Dump_Cycle_Text(void)
+{
+    CF_WriteQueue_Payload_t wq;
+    uint32                  i;
+
+    memset(&wq, 0, sizeof(wq));
+    wq.type  = CF_Type_up;
+    wq.queue = CF_Queue_history;
+
+    for (i = 0; i < UT_CF_DUMP_ENTRIES; ++i)
+    {
+        UT_CF_Dump_Histories[i].dir     = CF_Direction_RX;
+        UT_CF_Dump_Histories[i].seq_num = i;
+    }
+    UT_CF_Dump_Histories[1].dir = CF_Direction_TX;
+    UT_CF_Dump_Link(CF_QueueIdx_HIST, &UT_CF_Dump_Histories[0].cl_node, sizeof(CF_History_t), UT_CF_DUMP_ENTRIES);
+
+    /* Nothing to do while idle */
+    UtAssert_VOIDCALL(CF_Dump_Cycle());
+    UtAssert_STUB_COUNT(CF_Names_Get, 0);
+
+    UtAssert_INT32_EQ(CF_Dump_Start(&wq), CFE_SUCCESS);
+
+    /* The first wakeup only gets through part of the list, and it all stays in the buffer */
+    UtAssert_VOIDCALL(CF_Dump_Cycle());
+    UtAssert_BOOL_TRUE(CF_AppData.dump.busy);
+    UtAssert_ADDRESS_EQ(CF_AppData.dump.next, &UT_CF_Dump_Histories[CF_QUEUE_FILE_ENTRIES_PER_WAKEUP].cl_node);
+    UtAssert_UINT32_EQ(CF_AppData.dump.entries, CF_QUEUE_FILE_ENTRIES_PER_WAKEUP - 1);
+    UtAssert_STUB_COUNT(CF_Names_Get, CF_QUEUE_FILE_ENTRIES_PER_WAKEUP - 1);
+    UtAssert_STUB_COUNT(CF_WrappedWrite, 0);
+
+    /* The second picks up where it left off, finishes and closes the file */
+    UtAssert_VOIDCALL(CF_Dump_Cycle());
+    UtAssert_BOOL_FALSE(CF_AppData.dump.busy);
+    UtAssert_UINT32_EQ(CF_AppData.dump.entries, UT_CF_DUMP_ENTRIES - 1);
+    UtAssert_STUB_COUNT(CF_WrappedWrite, 1);
+    UtAssert_STUB_COUNT(CF_WrappedClose, 1);
+    UT_CF_AssertEventID(CF_CMD_WQ_DONE_INF_EID);
+    UtAssert_True(strncmp((char *)UT_CF_Dump_File, "SEQ (0, 0)\tDIR: RX\t", 19) == 0, "First entry is sequence 0");
+    UtAssert_NULL(strstr((char *)UT_CF_Dump_File, "SEQ (0, 1)"));
+}
+
+/*
+ * Cover a binary file of active transactions that fills the buffer more than once
+ */
+void Test_CF_Dump_Cycle_Binary(void)
+{
+    CF_WriteQueue_Payload_t wq;
+    CF_History_t            history;
+    CF_QueueRecord_t        rec;
+    uint32                  i;
+
+    memset(&wq, 0, sizeof(wq));
+    memset(&history, 0, sizeof(history));
+    wq.type   = CF_Type_up;
+    wq.queue  = CF_Queue_active;
+    wq.format = CF_QueueFormat_binary;
+
+    history.dir      = CF_Direction_RX;
+    history.src_eid  = 3;
+    history.seq_num  = 4;
+    history.peer_eid = 5;
+    history.txn_stat = CF_TxnStatus_NO_ERROR;
+    for (i = 0; i < UT_CF_DUMP_ENTRIES; ++i)
+    {
+        UT_CF_Dump_Txns[i].history = &history;
+        strcpy(UT_CF_Dump_Txns[i].fnames.src_filename, "/cf/src.bin");
+        strcpy(UT_CF_Dump_Txns[i].fnames.dst_filename, "/ram/dst.bin");
+    }
+    UT_CF_Dump_Link(CF_QueueIdx_RX, &UT_CF_Dump_Txns[0].cl_node, sizeof(CF_Transaction_t), UT_CF_DUMP_ENTRIES);
+
+    UtAssert_INT32_EQ(CF_Dump_Start(&wq), CFE_SUCCESS);
+    UtAssert_VOIDCALL(CF_Dump_Cycle());
+    UtAssert_VOIDCALL(CF_Dump_Cycle());
+    UtAssert_BOOL_FALSE(CF_AppData.dump.busy);
+    UT_CF_AssertEventID(CF_CMD_WQ_DONE_INF_EID);
+
+    /* Every record is written, whether in one write or several */
+    UtAssert_UINT32_EQ(UT_CF_Dump_FileLen, UT_CF_DUMP_ENTRIES * sizeof(CF_QueueRecord_t));
+    UtAssert_NONZERO(UT_GetStubCount(UT_KEY(CF_WrappedWrite)));
+
+    memcpy(&rec, &UT_CF_Dump_File[sizeof(rec)], sizeof(rec));
+    UtAssert_UINT32_EQ(rec.src_eid, 3);
+    UtAssert_UINT32_EQ(rec.seq_num, 4);
+    UtAssert_UINT32_EQ(rec.peer_eid, 5);
+    UtAssert_UINT32_EQ(rec.dir, CF_Direction_RX);
+    UtAssert_UINT32_EQ(rec.queue, CF_QueueIdx_RX);
+    UtAssert_STRINGBUF_EQ(rec.src_filename, sizeof(rec.src_filename), "/cf/src.bin", sizeof("/cf/src.bin"));
+    UtAssert_STRINGBUF_EQ(rec.dst_filename, sizeof(rec.dst_filename), "/ram/dst.bin", sizeof("/ram/dst.bin"));
+}
+
+/*
+ * Cover empty lists and a failed write
+ */
+void Test_CF_Dump_Cycle_WriteError(void)
+{
+    CF_WriteQueue_Payload_t wq;
+
+    memset(&wq, 0, sizeof(wq));
+    wq.type  = CF_Type_down;
+    wq.queue = CF_Queue_all;
+
+    UT_CF_Dump_Histories[0].dir = CF_Direction_TX;
+    UT_CF_Dump_Link(CF_QueueIdx_HIST, &UT_CF_Dump_Histories[0].cl_node, sizeof(CF_History_t), 1);
+
+    /* Every TX list is visited, only the history has an entry */
+    UtAssert_INT32_EQ(CF_Dump_Start(&wq), CFE_SUCCESS);
+    UT_SetHandlerFunction(UT_KEY(CF_WrappedWrite), NULL, NULL);
+    UT_SetDefaultReturnValue(UT_KEY(CF_WrappedWrite), OS_ERROR);
+    UtAssert_VOIDCALL(CF_Dump_Cycle());
+    UtAssert_UINT32_EQ(CF_AppData.dump.step, CF_AppData.dump.num_steps);
+    UtAssert_STUB_COUNT(CF_WrappedWrite, 1);
+    UtAssert_STUB_COUNT(CF_WrappedClose, 1);
+    UtAssert_BOOL_FALSE(CF_AppData.dump.busy);
+    UT_CF_AssertEventID(CF_CMD_WQ_WRITEHIST_TX_ERR_EID);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.counters.err, 1);
+}
+
+/*
+ * Cover entries leaving and joining the list between wakeups, which must not skip or repeat any entry
+ */
+void Test_CF_Dump_Cycle_QueueChange(void)
+{
+    CF_WriteQueue_Payload_t wq;
+    CF_Channel_t *          chan = &CF_AppData.engine.channels[0];
+    CF_CListNode_t *        head;
+    CF_History_t *          added;
+    const char *            found;
+    char                    seq[32];
+    uint32                  i;
+
+    memset(&wq, 0, sizeof(wq));
+    wq.type  = CF_Type_up;
+    wq.queue = CF_Queue_history;
+
+    for (i = 0; i < UT_CF_DUMP_ENTRIES; ++i)
+    {
+        UT_CF_Dump_Histories[i].dir     = CF_Direction_RX;
+        UT_CF_Dump_Histories[i].seq_num = i;
+    }
+
+    /* The last entry joins the list only after the first wakeup */
+    UT_CF_Dump_Link(CF_QueueIdx_HIST, &UT_CF_Dump_Histories[0].cl_node, sizeof(CF_History_t), UT_CF_DUMP_ENTRIES - 1);
+    CF_AppData.hk.Payload.channel_hk[0].q_size[CF_QueueIdx_HIST] = UT_CF_DUMP_ENTRIES - 1;
+
+    UtAssert_INT32_EQ(CF_Dump_Start(&wq), CFE_SUCCESS);
+    UtAssert_VOIDCALL(CF_Dump_Cycle());
+    UtAssert_UINT32_EQ(CF_AppData.dump.entries, CF_QUEUE_FILE_ENTRIES_PER_WAKEUP);
+    UtAssert_ADDRESS_EQ(CF_AppData.dump.next, &UT_CF_Dump_Histories[CF_QUEUE_FILE_ENTRIES_PER_WAKEUP].cl_node);
+
+    /* Entries already written leave, shifting everything after them */
+    UtAssert_VOIDCALL(CF_CList_Remove_Ex(chan, CF_QueueIdx_HIST, &UT_CF_Dump_Histories[0].cl_node));
+    UtAssert_VOIDCALL(CF_CList_Remove_Ex(chan, CF_QueueIdx_HIST, &UT_CF_Dump_Histories[1].cl_node));
+    UtAssert_ADDRESS_EQ(CF_AppData.dump.next, &UT_CF_Dump_Histories[CF_QUEUE_FILE_ENTRIES_PER_WAKEUP].cl_node);
+
+    /* A new entry goes on the end */
+    added               = &UT_CF_Dump_Histories[UT_CF_DUMP_ENTRIES - 1];
+    head                = chan->qs[CF_QueueIdx_HIST];
+    added->cl_node.prev = head->prev;
+    added->cl_node.next = head;
+    head->prev->next    = &added->cl_node;
+    head->prev          = &added->cl_node;
+
+    /* The entry to resume at leaves, so the cursor moves on to the one after it */
+    UtAssert_VOIDCALL(
+        CF_CList_Remove_Ex(chan, CF_QueueIdx_HIST, &UT_CF_Dump_Histories[CF_QUEUE_FILE_ENTRIES_PER_WAKEUP].cl_node));
+    UtAssert_ADDRESS_EQ(CF_AppData.dump.next, &added->cl_node);
+
+    /* The second wakeup writes the rest, new one included, and nothing twice */
+    UtAssert_VOIDCALL(CF_Dump_Cycle());
+    UtAssert_BOOL_FALSE(CF_AppData.dump.busy);
+    UtAssert_NULL(CF_AppData.dump.next);
+    UtAssert_UINT32_EQ(CF_AppData.dump.entries, UT_CF_DUMP_ENTRIES - 1);
+    UT_CF_AssertEventID(CF_CMD_WQ_DONE_INF_EID);
+
+    for (i = 0; i < UT_CF_DUMP_ENTRIES; ++i)
+    {
+        snprintf(seq, sizeof(seq), "SEQ (0, %lu)\t", (unsigned long)i);
+        found = strstr((char *)UT_CF_Dump_File, seq);
+        if (i == CF_QUEUE_FILE_ENTRIES_PER_WAKEUP)
+        {
+            UtAssert_NULL(found);
+        }
+        else
+        {
+            UtAssert_NOT_NULL(found);
+            UtAssert_True((found == NULL) || (strstr(found + 1, seq) == NULL), "Sequence %lu written once",
+                          (unsigned long)i);
+        }
+    }
+}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    UtTest_Add(Test_CF_Dump_Start, cf_dump_tests_Setup, cf_tests_Teardown, "CF_Dump_Start");
+    UtTest_Add(Test_CF_Dump_Cycle_Text, cf_dump_tests_Setup, cf_tests_Teardown, "CF_Dump_Cycle_Text");
+    UtTest_Add(Test_CF_Dump_Cycle_Binary, cf_dump_tests_Setup, cf_tests_Teardown, "CF_Dump_Cycle_Binary");
+    UtTest_Add(Test_CF_Dump_Cycle_QueueChange, cf_dump_tests_Setup, cf_tests_Teardown, "CF_Dump_Cycle_QueueChange");
+    UtTest_Add(Test_CF_Dump_Cycle_WriteError, cf_dump_tests_Setup, cf_tests_Teardown, "CF_Dump_Cycle_WriteError");
+}
@@ -0,0 +1,234 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,447-1, and identified as “CFS CFDP (CF)
+ * Application version 3.0.0”
+ *
+ * Copyright (c) 2019 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/* cf testing includes */
+#include "cf_test_utils.h"
+#include "cf_names.h"
+
+/* Arena under test, too big for the stack */
+CF_NameArena_t UT_CF_NameArena;
+
+/* Fill a filename pair */
+void UT_CF_Names_Set(CF_TxnFilenames_t *fnames, const char *src, const char *dst)
+{
+    memset(fnames, 0, sizeof(*fnames));
+    strncpy(fnames->src_filename, src, sizeof(fnames->src_filename) - 1);
+    strncpy(fnames->dst_filename, dst, sizeof(fnames->dst_filename) - 1);
+}
+
+/*
+ * Test routines
+ */
+
+/*
+ * Cover store/get/release with and without directories, and release of nothing
+ */
+void Test_CF_Names_StoreGetRelease(void)
+{
+    CF_TxnFilenames_t in;
+    CF_TxnFilenames_t out;
+    CF_NameRef_t      ref1;
+    CF_NameRef_t      ref2;
+
+    memset(&UT_CF_NameArena, 0, sizeof(UT_CF_NameArena));
+
+    /* Both names in directories */
+    UT_CF_Names_Set(&in, "/cf/src/file1.bin", "/ram/file1.bin");
+    UtAssert_INT32_EQ(CF_Names_Store(&UT_CF_NameArena, &in, &ref1), CFE_SUCCESS);
+    UtAssert_NONZERO(ref1);
+    UtAssert_UINT32_EQ(UT_CF_NameArena.dirs[0].refs, 1);
+    UtAssert_UINT32_EQ(UT_CF_NameArena.dirs[1].refs, 1);
+    UtAssert_STRINGBUF_EQ(UT_CF_NameArena.dirs[0].path, sizeof(UT_CF_NameArena.dirs[0].path), "/cf/src",
+                          sizeof("/cf/src"));
+    UtAssert_STRINGBUF_EQ(UT_CF_NameArena.dirs[1].path, sizeof(UT_CF_NameArena.dirs[1].path), "/ram", sizeof("/ram"));
+
+    /* Names with no directory, or only the root, are kept whole */
+    UT_CF_Names_Set(&in, "file2.bin", "/file2.bin");
+    UtAssert_INT32_EQ(CF_Names_Store(&UT_CF_NameArena, &in, &ref2), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(UT_CF_NameArena.dirs[2].len, 0);
+
+    memset(&out, 0xFF, sizeof(out));
+    UtAssert_VOIDCALL(CF_Names_Get(&UT_CF_NameArena, ref1, &out));
+    UtAssert_STRINGBUF_EQ(out.src_filename, sizeof(out.src_filename), "/cf/src/file1.bin", sizeof("/cf/src/file1.bin"));
+    UtAssert_STRINGBUF_EQ(out.dst_filename, sizeof(out.dst_filename), "/ram/file1.bin", sizeof("/ram/file1.bin"));
+
+    UtAssert_VOIDCALL(CF_Names_Get(&UT_CF_NameArena, ref2, &out));
+    UtAssert_STRINGBUF_EQ(out.src_filename, sizeof(out.src_filename), "file2.bin", sizeof("file2.bin"));
+    UtAssert_STRINGBUF_EQ(out.dst_filename, sizeof(out.dst_filename), "/file2.bin", sizeof("/file2.bin"));
+
+    /* Nothing stored */
+    UtAssert_VOIDCALL(CF_Names_Get(&UT_CF_NameArena, 0, &out));
+    UtAssert_STRINGBUF_EQ(out.src_filename, sizeof(out.src_filename), "", sizeof(""));
+    UtAssert_STRINGBUF_EQ(out.dst_filename, sizeof(out.dst_filename), "", sizeof(""));
+    UtAssert_VOIDCALL(CF_Names_Release(&UT_CF_NameArena, 0));
+    UtAssert_NONZERO(UT_CF_NameArena.used);
+
+    /* Releasing the newest first holds the space until the oldest goes */
+    UtAssert_VOIDCALL(CF_Names_Release(&UT_CF_NameArena, ref2));
+    UtAssert_NONZERO(UT_CF_NameArena.used);
+    UtAssert_VOIDCALL(CF_Names_Release(&UT_CF_NameArena, ref1));
+    UtAssert_ZERO(UT_CF_NameArena.used);
+    UtAssert_ZERO(UT_CF_NameArena.dirs[0].refs);
+    UtAssert_ZERO(UT_CF_NameArena.dirs[1].refs);
+}
+
+/*
+ * Cover directory sharing, and names kept whole once the directories run out
+ */
+void Test_CF_Names_Dirs(void)
+{
+    CF_TxnFilenames_t in;
+    CF_TxnFilenames_t out;
+    CF_NameRef_t      ref;
+    CF_NameRef_t      shared;
+    char              dir[CF_FILENAME_MAX_LEN];
+    int               i;
+
+    memset(&UT_CF_NameArena, 0, sizeof(UT_CF_NameArena));
+
+    /* Same directories, one entry each */
+    UT_CF_Names_Set(&in, "/cf/a.bin", "/cf/b.bin");
+    UtAssert_INT32_EQ(CF_Names_Store(&UT_CF_NameArena, &in, &shared), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(UT_CF_NameArena.dirs[0].refs, 2);
+    UtAssert_ZERO(UT_CF_NameArena.dirs[1].len);
+
+    /* Use up the rest of the directories */
+    for (i = 1; i < CF_NAME_DIRS_PER_CHAN; ++i)
+    {
+        snprintf(dir, sizeof(dir), "/d%d/f", i);
+        UT_CF_Names_Set(&in, dir, "/cf/c.bin");
+        UtAssert_INT32_EQ(CF_Names_Store(&UT_CF_NameArena, &in, &ref), CFE_SUCCESS);
+    }
+    UtAssert_UINT32_EQ(UT_CF_NameArena.dirs[0].refs, 1 + CF_NAME_DIRS_PER_CHAN);
+    UtAssert_ZERO(UT_CF_NameArena.dir_misses);
+
+    /* No directory left, the name is kept whole and counted */
+    UT_CF_Names_Set(&in, "/full/x.bin", "/cf/x.bin");
+    UtAssert_INT32_EQ(CF_Names_Store(&UT_CF_NameArena, &in, &ref), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(UT_CF_NameArena.dir_misses, 1);
+    UtAssert_VOIDCALL(CF_Names_Get(&UT_CF_NameArena, ref, &out));
+    UtAssert_STRINGBUF_EQ(out.src_filename, sizeof(out.src_filename), "/full/x.bin", sizeof("/full/x.bin"));
+    UtAssert_STRINGBUF_EQ(out.dst_filename, sizeof(out.dst_filename), "/cf/x.bin", sizeof("/cf/x.bin"));
+
+    /* A name without a directory has nothing to share, so it is not counted */
+    UT_CF_Names_Set(&in, "x.bin", "/cf/x.bin");
+    UtAssert_INT32_EQ(CF_Names_Store(&UT_CF_NameArena, &in, &ref), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(UT_CF_NameArena.dir_misses, 1);
+
+    /* Releasing drops the directory references */
+    UtAssert_VOIDCALL(CF_Names_Release(&UT_CF_NameArena, shared));
+    UtAssert_UINT32_EQ(UT_CF_NameArena.dirs[0].refs, CF_NAME_DIRS_PER_CHAN + 1);
+}
+
+/*
+ * Cover a full arena, and wrapping around the end once space is released
+ */
+void Test_CF_Names_Full(void)
+{
+    CF_TxnFilenames_t in;
+    CF_TxnFilenames_t out;
+    CF_NameRef_t      refs[CF_NAME_ARENA_SIZE / 8];
+    CF_NameRef_t      ref;
+    uint32            count;
+    uint32            i;
+
+    memset(&UT_CF_NameArena, 0, sizeof(UT_CF_NameArena));
+
+    /* Fill it */
+    UT_CF_Names_Set(&in, "/cf/abcdefghijklmnopqrstuvwxyz.bin", "/ram/abcdefghijklmnopqrstuvwxyz.bin");
+    count = 0;
+    while (CF_Names_Store(&UT_CF_NameArena, &in, &refs[count]) == CFE_SUCCESS)
+    {
+        ++count;
+        UtAssert_True(count < (sizeof(refs) / sizeof(refs[0])), "Arena holds %lu pairs", (unsigned long)count);
+    }
+    UtAssert_ZERO(refs[count]);
+    UtAssert_UINT32_EQ(UT_CF_NameArena.dirs[0].refs, count);
+
+    /* Releasing a newer pair does not make room */
+    UtAssert_VOIDCALL(CF_Names_Release(&UT_CF_NameArena, refs[1]));
+    UtAssert_INT32_EQ(CF_Names_Store(&UT_CF_NameArena, &in, &ref), CF_ERROR);
+
+    /* Releasing the oldest does, and the new pair wraps to the start */
+    UtAssert_VOIDCALL(CF_Names_Release(&UT_CF_NameArena, refs[0]));
+    UtAssert_INT32_EQ(CF_Names_Store(&UT_CF_NameArena, &in, &ref), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(ref, 1);
+    UtAssert_VOIDCALL(CF_Names_Get(&UT_CF_NameArena, ref, &out));
+    UtAssert_STRINGBUF_EQ(out.src_filename, sizeof(out.src_filename), in.src_filename, sizeof(in.src_filename));
+    UtAssert_STRINGBUF_EQ(out.dst_filename, sizeof(out.dst_filename), in.dst_filename, sizeof(in.dst_filename));
+
+    /* Release everything in order, including the end passed over on the wrap */
+    for (i = 2; i < count; ++i)
+    {
+        UtAssert_VOIDCALL(CF_Names_Release(&UT_CF_NameArena, refs[i]));
+    }
+    UtAssert_VOIDCALL(CF_Names_Release(&UT_CF_NameArena, ref));
+    UtAssert_ZERO(UT_CF_NameArena.used);
+    UtAssert_ZERO(UT_CF_NameArena.dirs[0].refs);
+    UtAssert_ZERO(UT_CF_NameArena.dirs[1].refs);
+}
+
+/*
+ * Cover a record that does not fit at the end of the ring with a short gap left over
+ */
+void Test_CF_Names_Wrap(void)
+{
+    CF_TxnFilenames_t in;
+    CF_NameRef_t      ref1;
+    CF_NameRef_t      ref2;
+
+    memset(&UT_CF_NameArena, 0, sizeof(UT_CF_NameArena));
+
+    /* Pretend the ring is nearly done, with 4 bytes left at the end */
+    UT_CF_NameArena.head = sizeof(UT_CF_NameArena.buf) - 4;
+    UT_CF_NameArena.tail = UT_CF_NameArena.head - 16;
+    UT_CF_NameArena.used = 16;
+    memset(&UT_CF_NameArena.buf[UT_CF_NameArena.tail / 2], 0, 16);
+    ((CF_NameRecord_t *)&UT_CF_NameArena.buf[UT_CF_NameArena.tail / 2])->size = 16;
+    ((CF_NameRecord_t *)&UT_CF_NameArena.buf[UT_CF_NameArena.tail / 2])->live = 1;
+
+    UT_CF_Names_Set(&in, "a", "b");
+    UtAssert_INT32_EQ(CF_Names_Store(&UT_CF_NameArena, &in, &ref1), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(ref1, 1);
+    UtAssert_UINT32_EQ(UT_CF_NameArena.used, 16 + 4 + 10);
+
+    /* Releasing the old record reclaims the short gap too */
+    UtAssert_VOIDCALL(CF_Names_Release(&UT_CF_NameArena, (sizeof(UT_CF_NameArena.buf) - 20) + 1));
+    UtAssert_UINT32_EQ(UT_CF_NameArena.tail, 0);
+    UtAssert_UINT32_EQ(UT_CF_NameArena.used, 10);
+
+    /* Nothing held, so the next record starts over at the beginning */
+    UT_CF_NameArena.head = sizeof(UT_CF_NameArena.buf) - 10;
+    UT_CF_NameArena.tail = UT_CF_NameArena.head;
+    UT_CF_NameArena.used = 0;
+    UtAssert_INT32_EQ(CF_Names_Store(&UT_CF_NameArena, &in, &ref2), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(ref2, 1);
+    UtAssert_UINT32_EQ(UT_CF_NameArena.head, 10);
+}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    TEST_CF_ADD(Test_CF_Names_StoreGetRelease);
+    TEST_CF_ADD(Test_CF_Names_Dirs);
+    TEST_CF_ADD(Test_CF_Names_Full);
+    TEST_CF_ADD(Test_CF_Names_Wrap);
+}
@@ -57,75 +57,307 @@ void Test_CF_Timer_Sec2Ticks_ReturnExpectedValue(void)
     UtAssert_UINT32_EQ(CF_Timer_Sec2Ticks(arg_sec), arg_sec * ticks_per_second);
 }
 
+/*******************************************************************************
+**
+**  cf_timer_tests local helpers
+**
+*******************************************************************************/
+
+static CF_Timer_t *UT_CF_Timer_LastExpired;
+static uint32      UT_CF_Timer_ExpireCount;
+
+static void UT_CF_Timer_ExpireFn(CF_Timer_t *timer)
+{
+    UT_CF_Timer_LastExpired = timer;
+    ++UT_CF_Timer_ExpireCount;
+}
+
+/* makes CF_CList_Pop() return the node once, then NULL */
+static void UT_CF_Timer_Handler_PopOnce(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CF_CListNode_t **node = UserObj;
+
+    UT_Stub_SetReturnValue(FuncKey, *node);
+    *node = NULL;
+}
+
+static void UT_CF_Timer_SetTicksPerSecond(CF_ConfigTable_t *config_table, uint32 ticks_per_second)
+{
+    CF_AppData.config_table                   = config_table;
+    CF_AppData.config_table->ticks_per_second = ticks_per_second;
+
+    UT_CF_Timer_LastExpired = NULL;
+    UT_CF_Timer_ExpireCount = 0;
+}
+
 /*******************************************************************************
 **
 **  CF_Timer_InitRelSec tests
 **
 *******************************************************************************/
 
-void Test_CF_Timer_InitRelSec_ReceiveExpectedValue(void)
+void Test_CF_Timer_InitRelSec_PutsNearTimerInLevel0(void)
 {
     /* Arrange */
-    uint32      arg_rel_sec = Any_uint32();
-    CF_Timer_t  timer;
-    CF_Timer_t *arg_t = &timer;
+    CF_TimerWheel_t  wheel;
+    CF_Timer_t       timer;
+    CF_ConfigTable_t config_table;
+
+    memset(&wheel, 0, sizeof(wheel));
+    memset(&timer, 0, sizeof(timer));
+    UT_CF_Timer_SetTicksPerSecond(&config_table, 10);
+    wheel.now = 1000;
+
+    /* Act */
+    CF_Timer_InitRelSec(&wheel, &timer, 5, UT_CF_Timer_ExpireFn);
+
+    /* Assert */
+    UtAssert_UINT32_EQ(timer.expire, 1050);
+    UtAssert_ADDRESS_EQ(timer.slot, &wheel.slots[0][1050 & (CF_TIMER_WHEEL_SLOTS - 1)]);
+    UtAssert_True(timer.fn == UT_CF_Timer_ExpireFn, "timer.fn set");
+    UtAssert_STUB_COUNT(CF_CList_InsertBack, 1);
+    UtAssert_STUB_COUNT(CF_CList_Remove, 0);
+    UtAssert_BOOL_FALSE(CF_Timer_Expired(&timer));
+    UtAssert_UINT32_EQ(UT_CF_Timer_ExpireCount, 0);
+}
 
-    /* Arrange unstubbalbe: CF_Timer_Sec2Ticks in same file */
-    uint32           ticks_per_second = Any_uint32();
+void Test_CF_Timer_InitRelSec_PutsFartherTimerInHigherLevel(void)
+{
+    /* Arrange */
+    CF_TimerWheel_t  wheel;
+    CF_Timer_t       timer;
     CF_ConfigTable_t config_table;
+    uint32           expire;
 
-    CF_AppData.config_table                   = &config_table;
-    CF_AppData.config_table->ticks_per_second = ticks_per_second;
+    memset(&wheel, 0, sizeof(wheel));
+    memset(&timer, 0, sizeof(timer));
+    UT_CF_Timer_SetTicksPerSecond(&config_table, 100);
+    wheel.now = 1000;
+    expire    = 1000 + (300 * 100);
 
-    arg_t->tick = ticks_per_second;
+    /* Act */
+    CF_Timer_InitRelSec(&wheel, &timer, 300, UT_CF_Timer_ExpireFn);
+
+    /* Assert */
+    UtAssert_UINT32_EQ(timer.expire, expire);
+    UtAssert_ADDRESS_EQ(timer.slot,
+                        &wheel.slots[2][(expire >> (2 * CF_TIMER_WHEEL_SLOT_BITS)) & (CF_TIMER_WHEEL_SLOTS - 1)]);
+}
+
+void Test_CF_Timer_InitRelSec_ParksTimerBeyondWheelInTopLevel(void)
+{
+    /* Arrange */
+    CF_TimerWheel_t  wheel;
+    CF_Timer_t       timer;
+    CF_ConfigTable_t config_table;
+    uint32           range = 1UL << (CF_TIMER_WHEEL_SLOT_BITS * CF_TIMER_WHEEL_LEVELS);
+    uint32           park;
+
+    memset(&wheel, 0, sizeof(wheel));
+    memset(&timer, 0, sizeof(timer));
+    UT_CF_Timer_SetTicksPerSecond(&config_table, 100);
+    wheel.now = 12345;
+    park      = wheel.now + range - 1;
+
+    /* Act */
+    CF_Timer_InitRelSec(&wheel, &timer, range / 50, UT_CF_Timer_ExpireFn);
+
+    /* Assert */
+    UtAssert_UINT32_EQ(timer.expire, 12345 + (range / 50) * 100);
+    UtAssert_ADDRESS_EQ(timer.slot, &wheel.slots[CF_TIMER_WHEEL_LEVELS - 1]
+                                                [(park >> (CF_TIMER_WHEEL_SLOT_BITS * (CF_TIMER_WHEEL_LEVELS - 1))) &
+                                                 (CF_TIMER_WHEEL_SLOTS - 1)]);
+}
+
+void Test_CF_Timer_InitRelSec_ZeroSeconds_ExpiresNow(void)
+{
+    /* Arrange */
+    CF_TimerWheel_t  wheel;
+    CF_Timer_t       timer;
+    CF_ConfigTable_t config_table;
+
+    memset(&wheel, 0, sizeof(wheel));
+    memset(&timer, 0, sizeof(timer));
+    UT_CF_Timer_SetTicksPerSecond(&config_table, 10);
 
     /* Act */
-    CF_Timer_InitRelSec(arg_t, arg_rel_sec);
+    CF_Timer_InitRelSec(&wheel, &timer, 0, UT_CF_Timer_ExpireFn);
 
     /* Assert */
-    UtAssert_UINT32_EQ(arg_t->tick, arg_rel_sec * ticks_per_second);
+    UtAssert_NULL(timer.slot);
+    UtAssert_STUB_COUNT(CF_CList_InsertBack, 0);
+    UtAssert_UINT32_EQ(UT_CF_Timer_ExpireCount, 1);
+    UtAssert_ADDRESS_EQ(UT_CF_Timer_LastExpired, &timer);
+
+    /* no expire function is fine too */
+    UtAssert_VOIDCALL(CF_Timer_InitRelSec(&wheel, &timer, 0, NULL));
+    UtAssert_UINT32_EQ(UT_CF_Timer_ExpireCount, 1);
+}
+
+void Test_CF_Timer_InitRelSec_RestartsRunningTimer(void)
+{
+    /* Arrange */
+    CF_TimerWheel_t  wheel;
+    CF_Timer_t       timer;
+    CF_ConfigTable_t config_table;
+
+    memset(&wheel, 0, sizeof(wheel));
+    memset(&timer, 0, sizeof(timer));
+    UT_CF_Timer_SetTicksPerSecond(&config_table, 10);
+    timer.slot = &wheel.slots[0][3];
+
+    /* Act */
+    CF_Timer_InitRelSec(&wheel, &timer, 1, UT_CF_Timer_ExpireFn);
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CF_CList_Remove, 1);
+    UtAssert_STUB_COUNT(CF_CList_InsertBack, 1);
+    UtAssert_ADDRESS_EQ(timer.slot, &wheel.slots[0][10]);
 }
 
 /*******************************************************************************
 **
-**  CF_Timer_Expired tests
+**  CF_Timer_Stop tests
 **
 *******************************************************************************/
 
-void Test_CF_Timer_Expired_When_t_tick_Is_0_Return_1(void)
+void Test_CF_Timer_Stop(void)
 {
     /* Arrange */
-    CF_Timer_t timer;
-    timer.tick                        = 0;
-    const CF_Timer_t *arg_t           = &timer;
-    int               expected_result = 1;
+    CF_TimerWheel_t wheel;
+    CF_Timer_t      timer;
+
+    memset(&timer, 0, sizeof(timer));
+
+    /* Act - not running */
+    CF_Timer_Stop(&timer);
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CF_CList_Remove, 0);
+    UtAssert_NULL(timer.slot);
+
+    /* Act - running */
+    timer.slot = &wheel.slots[1][7];
+    CF_Timer_Stop(&timer);
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CF_CList_Remove, 1);
+    UtAssert_NULL(timer.slot);
+    UtAssert_BOOL_TRUE(CF_Timer_Expired(&timer));
+}
+
+/*******************************************************************************
+**
+**  CF_Timer_Pause and CF_Timer_Resume tests
+**
+*******************************************************************************/
+
+void Test_CF_Timer_Pause_Resume_KeepsTicksLeft(void)
+{
+    /* Arrange */
+    CF_TimerWheel_t wheel;
+    CF_Timer_t      timer;
+
+    memset(&wheel, 0, sizeof(wheel));
+    memset(&timer, 0, sizeof(timer));
+    wheel.now    = 1000;
+    timer.expire = 1030;
+    timer.slot   = &wheel.slots[0][1030 & (CF_TIMER_WHEEL_SLOTS - 1)];
+
+    /* Act - pause */
+    CF_Timer_Pause(&wheel, &timer);
+
+    /* Assert - off the wheel, but not expired */
+    UtAssert_STUB_COUNT(CF_CList_Remove, 1);
+    UtAssert_NULL(timer.slot);
+    UtAssert_UINT32_EQ(timer.paused, 30);
+    UtAssert_BOOL_FALSE(CF_Timer_Expired(&timer));
+
+    /* pausing again does nothing */
+    CF_Timer_Pause(&wheel, &timer);
+    UtAssert_STUB_COUNT(CF_CList_Remove, 1);
+    UtAssert_UINT32_EQ(timer.paused, 30);
+
+    /* Act - resume long after the timer would have expired */
+    wheel.now = 5000;
+    CF_Timer_Resume(&wheel, &timer);
+
+    /* Assert - back on the wheel with the same ticks left */
+    UtAssert_STUB_COUNT(CF_CList_InsertBack, 1);
+    UtAssert_UINT32_EQ(timer.expire, 5030);
+    UtAssert_ADDRESS_EQ(timer.slot, &wheel.slots[0][5030 & (CF_TIMER_WHEEL_SLOTS - 1)]);
+    UtAssert_ZERO(timer.paused);
+    UtAssert_BOOL_FALSE(CF_Timer_Expired(&timer));
+
+    /* resuming a timer that is not paused does nothing */
+    CF_Timer_Resume(&wheel, &timer);
+    UtAssert_STUB_COUNT(CF_CList_InsertBack, 1);
+}
+
+void Test_CF_Timer_Pause_ExpiredTimer_StaysExpired(void)
+{
+    /* Arrange */
+    CF_TimerWheel_t wheel;
+    CF_Timer_t      timer;
+
+    memset(&wheel, 0, sizeof(wheel));
+    memset(&timer, 0, sizeof(timer));
 
     /* Act */
-    UtAssert_INT32_EQ(CF_Timer_Expired(arg_t), expected_result);
+    CF_Timer_Pause(&wheel, &timer);
+    CF_Timer_Resume(&wheel, &timer);
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CF_CList_Remove, 0);
+    UtAssert_STUB_COUNT(CF_CList_InsertBack, 0);
+    UtAssert_BOOL_TRUE(CF_Timer_Expired(&timer));
 }
 
-void Test_CF_Timer_Expired_When_t_tick_Is_1_Return_0(void)
+void Test_CF_Timer_Stop_PausedTimer(void)
 {
     /* Arrange */
     CF_Timer_t timer;
-    timer.tick                        = 1;
-    const CF_Timer_t *arg_t           = &timer;
-    int               expected_result = 0;
+
+    memset(&timer, 0, sizeof(timer));
+    timer.paused = 30;
 
     /* Act */
-    UtAssert_INT32_EQ(CF_Timer_Expired(arg_t), expected_result);
+    CF_Timer_Stop(&timer);
+
+    /* Assert */
+    UtAssert_STUB_COUNT(CF_CList_Remove, 0);
+    UtAssert_ZERO(timer.paused);
+    UtAssert_BOOL_TRUE(CF_Timer_Expired(&timer));
 }
 
-void Test_CF_Timer_Expired_When_t_tick_IsAnyIntegerExcept_0_Return_0(void)
+/*******************************************************************************
+**
+**  CF_Timer_Expired tests
+**
+*******************************************************************************/
+
+void Test_CF_Timer_Expired_When_NotRunning_Return_1(void)
 {
     /* Arrange */
     CF_Timer_t timer;
-    timer.tick                        = Any_int_Except(0);
-    const CF_Timer_t *arg_t           = &timer;
-    int               expected_result = 0;
+
+    memset(&timer, 0, sizeof(timer));
+
+    /* Act */
+    UtAssert_BOOL_TRUE(CF_Timer_Expired(&timer));
+}
+
+void Test_CF_Timer_Expired_When_Running_Return_0(void)
+{
+    /* Arrange */
+    CF_TimerWheel_t wheel;
+    CF_Timer_t      timer;
+
+    memset(&timer, 0, sizeof(timer));
+    timer.slot = &wheel.slots[0][Any_uint8_LessThan(CF_TIMER_WHEEL_SLOTS)];
 
     /* Act */
-    UtAssert_INT32_EQ(CF_Timer_Expired(arg_t), expected_result);
+    UtAssert_BOOL_FALSE(CF_Timer_Expired(&timer));
 }
 
 /*******************************************************************************
@@ -134,20 +366,91 @@ void Test_CF_Timer_Expired_When_t_tick_IsAnyIntegerExcept_0_Return_0(void)
 **
 *******************************************************************************/
 
-void Test_CF_Timer_Tick_When_t_tick_Is_non0_Decrement_t_tick(void)
+void Test_CF_Timer_Tick_ExpiresTimersInCurrentSlot(void)
 {
     /* Arrange */
-    uint32      initial_tick = Any_uint32_Except(0);
-    CF_Timer_t  timer;
-    CF_Timer_t *arg_t = &timer;
+    CF_TimerWheel_t wheel;
+    CF_Timer_t      timer;
+    CF_CListNode_t *node = &timer.cl_node;
+
+    memset(&wheel, 0, sizeof(wheel));
+    memset(&timer, 0, sizeof(timer));
+    UT_CF_Timer_LastExpired = NULL;
+    UT_CF_Timer_ExpireCount = 0;
+    wheel.now               = 9;
+    timer.expire            = 10;
+    timer.slot              = &wheel.slots[0][10];
+    timer.fn                = UT_CF_Timer_ExpireFn;
+    UT_SetHandlerFunction(UT_KEY(CF_CList_Pop), UT_CF_Timer_Handler_PopOnce, &node);
+
+    /* Act */
+    CF_Timer_Tick(&wheel);
 
-    arg_t->tick = initial_tick;
+    /* Assert */
+    UtAssert_UINT32_EQ(wheel.now, 10);
+    UtAssert_STUB_COUNT(CF_CList_Pop, 2);
+    UtAssert_NULL(timer.slot);
+    UtAssert_UINT32_EQ(UT_CF_Timer_ExpireCount, 1);
+    UtAssert_ADDRESS_EQ(UT_CF_Timer_LastExpired, &timer);
+
+    /* a timer without an expire function just reads as expired */
+    UT_ResetState(UT_KEY(CF_CList_Pop));
+    node       = &timer.cl_node;
+    timer.slot = &wheel.slots[0][11];
+    timer.fn   = NULL;
+    UT_SetHandlerFunction(UT_KEY(CF_CList_Pop), UT_CF_Timer_Handler_PopOnce, &node);
+    CF_Timer_Tick(&wheel);
+    UtAssert_BOOL_TRUE(CF_Timer_Expired(&timer));
+    UtAssert_UINT32_EQ(UT_CF_Timer_ExpireCount, 1);
+}
+
+void Test_CF_Timer_Tick_MovesHigherLevelTimersDown(void)
+{
+    /* Arrange */
+    CF_TimerWheel_t wheel;
+    CF_Timer_t      timer;
+    CF_CListNode_t *node = &timer.cl_node;
+
+    memset(&wheel, 0, sizeof(wheel));
+    memset(&timer, 0, sizeof(timer));
+    UT_CF_Timer_ExpireCount = 0;
+    wheel.now               = CF_TIMER_WHEEL_SLOTS - 1;
+    timer.expire            = CF_TIMER_WHEEL_SLOTS + 5;
+    timer.slot              = &wheel.slots[1][1];
+    timer.fn                = UT_CF_Timer_ExpireFn;
+    UT_SetHandlerFunction(UT_KEY(CF_CList_Pop), UT_CF_Timer_Handler_PopOnce, &node);
 
     /* Act */
-    CF_Timer_Tick(arg_t);
+    CF_Timer_Tick(&wheel);
 
     /* Assert */
-    UtAssert_UINT32_EQ(arg_t->tick, initial_tick - 1);
+    UtAssert_UINT32_EQ(wheel.now, CF_TIMER_WHEEL_SLOTS);
+    UtAssert_STUB_COUNT(CF_CList_InsertBack, 1);
+    UtAssert_ADDRESS_EQ(timer.slot, &wheel.slots[0][5]);
+    UtAssert_UINT32_EQ(UT_CF_Timer_ExpireCount, 0);
+}
+
+void Test_CF_Timer_Tick_OnlyLevel0WhenNotOnBoundary(void)
+{
+    /* Arrange */
+    CF_TimerWheel_t wheel;
+
+    memset(&wheel, 0, sizeof(wheel));
+    wheel.now = 5;
+
+    /* Act */
+    CF_Timer_Tick(&wheel);
+
+    /* Assert */
+    UtAssert_UINT32_EQ(wheel.now, 6);
+    UtAssert_STUB_COUNT(CF_CList_Pop, 1);
+
+    /* every level is moved down when the count wraps */
+    UT_ResetState(UT_KEY(CF_CList_Pop));
+    wheel.now = 0xFFFFFFFF;
+    CF_Timer_Tick(&wheel);
+    UtAssert_UINT32_EQ(wheel.now, 0);
+    UtAssert_STUB_COUNT(CF_CList_Pop, CF_TIMER_WHEEL_LEVELS);
 }
 
 /*******************************************************************************
@@ -164,26 +467,50 @@ void add_CF_Timer_Sec2Ticks_tests(void)
 
 void add_CF_Timer_InitRelSec_tests(void)
 {
-    UtTest_Add(Test_CF_Timer_InitRelSec_ReceiveExpectedValue, cf_timer_tests_Setup, cf_timer_tests_Teardown,
-               "Test_CF_Timer_InitRelSec_ReceiveExpectedValue");
+    UtTest_Add(Test_CF_Timer_InitRelSec_PutsNearTimerInLevel0, cf_timer_tests_Setup, cf_timer_tests_Teardown,
+               "Test_CF_Timer_InitRelSec_PutsNearTimerInLevel0");
+    UtTest_Add(Test_CF_Timer_InitRelSec_PutsFartherTimerInHigherLevel, cf_timer_tests_Setup, cf_timer_tests_Teardown,
+               "Test_CF_Timer_InitRelSec_PutsFartherTimerInHigherLevel");
+    UtTest_Add(Test_CF_Timer_InitRelSec_ParksTimerBeyondWheelInTopLevel, cf_timer_tests_Setup,
+               cf_timer_tests_Teardown, "Test_CF_Timer_InitRelSec_ParksTimerBeyondWheelInTopLevel");
+    UtTest_Add(Test_CF_Timer_InitRelSec_ZeroSeconds_ExpiresNow, cf_timer_tests_Setup, cf_timer_tests_Teardown,
+               "Test_CF_Timer_InitRelSec_ZeroSeconds_ExpiresNow");
+    UtTest_Add(Test_CF_Timer_InitRelSec_RestartsRunningTimer, cf_timer_tests_Setup, cf_timer_tests_Teardown,
+               "Test_CF_Timer_InitRelSec_RestartsRunningTimer");
 }
 
-void add_CF_Timer_Expired_tests(void)
+void add_CF_Timer_Stop_tests(void)
 {
-    UtTest_Add(Test_CF_Timer_Expired_When_t_tick_Is_0_Return_1, cf_timer_tests_Setup, cf_timer_tests_Teardown,
-               "Test_CF_Timer_Expired_When_t_tick_Is_0_Return_1");
+    UtTest_Add(Test_CF_Timer_Stop, cf_timer_tests_Setup, cf_timer_tests_Teardown, "Test_CF_Timer_Stop");
+}
 
-    UtTest_Add(Test_CF_Timer_Expired_When_t_tick_Is_1_Return_0, cf_timer_tests_Setup, cf_timer_tests_Teardown,
-               "Test_CF_Timer_Expired_When_t_tick_Is_1_Return_0");
+void add_CF_Timer_Pause_Resume_tests(void)
+{
+    UtTest_Add(Test_CF_Timer_Pause_Resume_KeepsTicksLeft, cf_timer_tests_Setup, cf_timer_tests_Teardown,
+               "Test_CF_Timer_Pause_Resume_KeepsTicksLeft");
+    UtTest_Add(Test_CF_Timer_Pause_ExpiredTimer_StaysExpired, cf_timer_tests_Setup, cf_timer_tests_Teardown,
+               "Test_CF_Timer_Pause_ExpiredTimer_StaysExpired");
+    UtTest_Add(Test_CF_Timer_Stop_PausedTimer, cf_timer_tests_Setup, cf_timer_tests_Teardown,
+               "Test_CF_Timer_Stop_PausedTimer");
+}
 
-    UtTest_Add(Test_CF_Timer_Expired_When_t_tick_IsAnyIntegerExcept_0_Return_0, cf_timer_tests_Setup,
-               cf_timer_tests_Teardown, "Test_CF_Timer_Expired_When_t_tick_IsAnyIntegerExcept_0_Return_0");
+void add_CF_Timer_Expired_tests(void)
+{
+    UtTest_Add(Test_CF_Timer_Expired_When_NotRunning_Return_1, cf_timer_tests_Setup, cf_timer_tests_Teardown,
+               "Test_CF_Timer_Expired_When_NotRunning_Return_1");
+
+    UtTest_Add(Test_CF_Timer_Expired_When_Running_Return_0, cf_timer_tests_Setup, cf_timer_tests_Teardown,
+               "Test_CF_Timer_Expired_When_Running_Return_0");
 }
 
 void add_CF_Timer_Tick_tests(void)
 {
-    UtTest_Add(Test_CF_Timer_Tick_When_t_tick_Is_non0_Decrement_t_tick, cf_timer_tests_Setup, cf_timer_tests_Teardown,
-               "Test_CF_Timer_Tick_When_t_tick_Is_non0_Decrement_t_tick");
+    UtTest_Add(Test_CF_Timer_Tick_ExpiresTimersInCurrentSlot, cf_timer_tests_Setup, cf_timer_tests_Teardown,
+               "Test_CF_Timer_Tick_ExpiresTimersInCurrentSlot");
+    UtTest_Add(Test_CF_Timer_Tick_MovesHigherLevelTimersDown, cf_timer_tests_Setup, cf_timer_tests_Teardown,
+               "Test_CF_Timer_Tick_MovesHigherLevelTimersDown");
+    UtTest_Add(Test_CF_Timer_Tick_OnlyLevel0WhenNotOnBoundary, cf_timer_tests_Setup, cf_timer_tests_Teardown,
+               "Test_CF_Timer_Tick_OnlyLevel0WhenNotOnBoundary");
 }
 
 /*******************************************************************************
@@ -200,6 +527,10 @@ void UtTest_Setup(void)
 
     add_CF_Timer_InitRelSec_tests();
 
+    add_CF_Timer_Stop_tests();
+
+    add_CF_Timer_Pause_Resume_tests();
+
     add_CF_Timer_Expired_tests();
 
     add_CF_Timer_Tick_tests();
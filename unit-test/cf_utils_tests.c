@@ -112,6 +112,17 @@ static void UT_AltHandler_CF_CList_Traverse_SeqArg_SetTxn(void *UserObj, UT_Entr
     arg->txn                       = UserObj;
 }
 
+/*----------------------------------------------------------------
+ *
+ * A handler for CF_Names_Store that counts a name kept whole in the arena
+ *
+ *-----------------------------------------------------------------*/
+static void UT_AltHandler_CF_Names_Store_DirMiss(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CF_NameArena_t *arena = UT_Hook_GetArgValueByName(Context, "arena", CF_NameArena_t *);
+    ++arena->dir_misses;
+}
+
 /*******************************************************************************
 **
 **  cf_utils.h function tests
@@ -126,11 +137,62 @@ void Test_CF_ResetHistory(void)
     CF_History_t history;
 
     memset(&history, 0, sizeof(history));
+    history.names = 5;
 
     CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].q_size[CF_QueueIdx_HIST] = 4;
 
-    /* nominal call */
+    /* nominal call, the names go back to the arena */
     UtAssert_VOIDCALL(CF_ResetHistory(&CF_AppData.engine.channels[UT_CFDP_CHANNEL], &history));
+    UtAssert_STUB_COUNT(CF_Names_Release, 1);
+    UtAssert_ZERO(history.names);
+}
+
+void Test_CF_StoreHistoryNames(void)
+{
+    /* Test case for:
+     * void CF_StoreHistoryNames(CF_Channel_t *chan, CF_History_t *history, const CF_TxnFilenames_t *fnames)
+     */
+    CF_Channel_t *    chan;
+    CF_History_t      history;
+    CF_History_t      oldest;
+    CF_TxnFilenames_t fnames;
+
+    memset(&CF_AppData, 0, sizeof(CF_AppData));
+    memset(&history, 0, sizeof(history));
+    memset(&oldest, 0, sizeof(oldest));
+    memset(&fnames, 0, sizeof(fnames));
+    chan = &CF_AppData.engine.channels[UT_CFDP_CHANNEL];
+
+    /* nominal, the names fit */
+    UtAssert_VOIDCALL(CF_StoreHistoryNames(chan, &history, &fnames));
+    UtAssert_STUB_COUNT(CF_Names_Store, 1);
+    UtAssert_ZERO(CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].name_evictions);
+
+    /* the names fit once the oldest history entry is recycled */
+    UT_ResetState(UT_KEY(CF_Names_Store));
+    UT_SetDeferredRetcode(UT_KEY(CF_Names_Store), 1, CF_ERROR);
+    CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].q_size[CF_QueueIdx_HIST] = 1;
+    chan->qs[CF_QueueIdx_HIST]                                                 = &oldest.cl_node;
+    UtAssert_VOIDCALL(CF_StoreHistoryNames(chan, &history, &fnames));
+    UtAssert_STUB_COUNT(CF_Names_Store, 2);
+    UtAssert_STUB_COUNT(CF_Names_Release, 1);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].name_evictions, 1);
+
+    /* nothing left to recycle, so the entry is kept without names */
+    UT_ResetState(UT_KEY(CF_Names_Store));
+    UT_SetDefaultReturnValue(UT_KEY(CF_Names_Store), CF_ERROR);
+    chan->qs[CF_QueueIdx_HIST] = NULL;
+    UtAssert_VOIDCALL(CF_StoreHistoryNames(chan, &history, &fnames));
+    UtAssert_STUB_COUNT(CF_Names_Store, 1);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].name_evictions, 1);
+
+    /* names kept whole for want of a directory entry are counted in HK */
+    UT_ResetState(UT_KEY(CF_Names_Store));
+    UT_SetHandlerFunction(UT_KEY(CF_Names_Store), UT_AltHandler_CF_Names_Store_DirMiss, NULL);
+    chan->name_arena.dir_misses = 5;
+    UtAssert_VOIDCALL(CF_StoreHistoryNames(chan, &history, &fnames));
+    UtAssert_UINT32_EQ(chan->name_arena.dir_misses, 6);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].name_dir_misses, 1);
 }
 
 void Test_CF_FindUnusedTransaction(void)
@@ -145,7 +207,10 @@ void Test_CF_FindUnusedTransaction(void)
     memset(&hist, 0, sizeof(hist));
     memset(&txn, 0, sizeof(txn));
     memset(&CF_AppData, 0, sizeof(CF_AppData));
-    chan = &CF_AppData.engine.channels[UT_CFDP_CHANNEL];
+    chan                   = &CF_AppData.engine.channels[UT_CFDP_CHANNEL];
+    chan->num_transactions = 5;
+    chan->num_histories    = 4;
+    txn.chan_num           = UT_CFDP_CHANNEL;
     CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].q_size[CF_QueueIdx_FREE]      = 2;
     CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].q_size[CF_QueueIdx_HIST_FREE] = 1;
     CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].q_size[CF_QueueIdx_HIST]      = 1;
@@ -157,12 +222,18 @@ void Test_CF_FindUnusedTransaction(void)
     chan->qs[CF_QueueIdx_HIST]      = NULL;
     UtAssert_ADDRESS_EQ(CF_FindUnusedTransaction(chan), &txn);
     UtAssert_ADDRESS_EQ(txn.history, &hist);
-
-    chan->qs[CF_QueueIdx_FREE]      = &txn.cl_node;
-    chan->qs[CF_QueueIdx_HIST_FREE] = NULL;
-    chan->qs[CF_QueueIdx_HIST]      = &hist.cl_node;
+    UtAssert_STUB_COUNT(CFE_TIME_GetTime, 1);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].txn_hwm, 3);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].hist_hwm, 3);
+
+    /* fewer in use than before leaves the high-water marks alone */
+    CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].q_size[CF_QueueIdx_FREE] = 4;
+    chan->qs[CF_QueueIdx_FREE]                                                 = &txn.cl_node;
+    chan->qs[CF_QueueIdx_HIST_FREE]                                            = NULL;
+    chan->qs[CF_QueueIdx_HIST]                                                 = &hist.cl_node;
     UtAssert_ADDRESS_EQ(CF_FindUnusedTransaction(chan), &txn);
     UtAssert_ADDRESS_EQ(txn.history, &hist);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].txn_hwm, 3);
 }
 
 void Test_CF_FreeTransaction(void)
@@ -173,12 +244,130 @@ void Test_CF_FreeTransaction(void)
     CF_Transaction_t *txn;
 
     memset(&CF_AppData, 0, sizeof(CF_AppData));
-    txn = &CF_AppData.engine.transactions[UT_CFDP_CHANNEL];
+    txn = (CF_Transaction_t *)CF_AppData.engine.pool_arena;
 
     UtAssert_VOIDCALL(CF_FreeTransaction(txn));
 
     UtAssert_UINT32_EQ(txn->state, CF_TxnState_IDLE);
     UtAssert_UINT32_EQ(txn->flags.com.q_index, CF_QueueIdx_FREE);
+    UtAssert_STUB_COUNT(CF_CList_Remove, 0);
+
+    /* an indexed transaction must be removed from the index */
+    txn->hash_head = &CF_AppData.engine.channels[UT_CFDP_CHANNEL].txn_hash[0];
+    UtAssert_VOIDCALL(CF_FreeTransaction(txn));
+    UtAssert_STUB_COUNT(CF_CList_Remove, 1);
+    UtAssert_NULL(txn->hash_head);
+
+    /* a transaction on the tick list must be taken off it, and its timers stopped */
+    txn->tick_head = &CF_AppData.engine.channels[UT_CFDP_CHANNEL].tick_list[CF_Direction_RX];
+    UtAssert_VOIDCALL(CF_FreeTransaction(txn));
+    UtAssert_STUB_COUNT(CF_CList_Remove, 2);
+    UtAssert_NULL(txn->tick_head);
+    UtAssert_STUB_COUNT(CF_Timer_Stop, 6);
+}
+
+void Test_CF_InsertTransactionIndex(void)
+{
+    /* Test case for:
+     * void CF_InsertTransactionIndex(CF_Channel_t *chan, CF_Transaction_t *txn)
+     */
+    CF_Transaction_t *txn;
+    CF_Channel_t *    chan;
+    CF_History_t      hist;
+
+    memset(&CF_AppData, 0, sizeof(CF_AppData));
+    memset(&hist, 0, sizeof(hist));
+    chan         = &CF_AppData.engine.channels[UT_CFDP_CHANNEL];
+    txn          = (CF_Transaction_t *)CF_AppData.engine.pool_arena;
+    txn->history = &hist;
+    hist.src_eid = 12;
+    hist.seq_num = 34;
+
+    /* not yet indexed */
+    UtAssert_VOIDCALL(CF_InsertTransactionIndex(chan, txn));
+    UtAssert_STUB_COUNT(CF_CList_InsertBack, 1);
+    UtAssert_STUB_COUNT(CF_CList_Remove, 0);
+    UtAssert_NOT_NULL(txn->hash_head);
+    UtAssert_True(txn->hash_head >= &chan->txn_hash[0] &&
+                      txn->hash_head < &chan->txn_hash[CF_NUM_TRANSACTION_HASH_BUCKETS_PER_CHAN],
+                  "hash_head is a bucket of the channel index");
+
+    /* already indexed, gets re-inserted */
+    UtAssert_VOIDCALL(CF_InsertTransactionIndex(chan, txn));
+    UtAssert_STUB_COUNT(CF_CList_InsertBack, 2);
+    UtAssert_STUB_COUNT(CF_CList_Remove, 1);
+}
+
+void Test_CF_RemoveTransactionIndex(void)
+{
+    /* Test case for:
+     * void CF_RemoveTransactionIndex(CF_Transaction_t *txn)
+     */
+    CF_Transaction_t txn;
+
+    memset(&CF_AppData, 0, sizeof(CF_AppData));
+    memset(&txn, 0, sizeof(txn));
+
+    /* not indexed, nothing to do */
+    UtAssert_VOIDCALL(CF_RemoveTransactionIndex(&txn));
+    UtAssert_STUB_COUNT(CF_CList_Remove, 0);
+
+    /* indexed */
+    txn.hash_head = &CF_AppData.engine.channels[UT_CFDP_CHANNEL].txn_hash[1];
+    UtAssert_VOIDCALL(CF_RemoveTransactionIndex(&txn));
+    UtAssert_STUB_COUNT(CF_CList_Remove, 1);
+    UtAssert_NULL(txn.hash_head);
+}
+
+void Test_CF_InsertTransactionTick(void)
+{
+    /* Test case for:
+     * void CF_InsertTransactionTick(CF_Channel_t *chan, CF_Transaction_t *txn)
+     */
+    CF_Transaction_t *txn;
+    CF_Channel_t *    chan;
+
+    memset(&CF_AppData, 0, sizeof(CF_AppData));
+    chan = &CF_AppData.engine.channels[UT_CFDP_CHANNEL];
+    txn  = (CF_Transaction_t *)CF_AppData.engine.pool_arena;
+
+    /* receiver goes on the RX list */
+    txn->state = CF_TxnState_R2;
+    UtAssert_VOIDCALL(CF_InsertTransactionTick(chan, txn));
+    UtAssert_STUB_COUNT(CF_CList_InsertBack, 1);
+    UtAssert_ADDRESS_EQ(txn->tick_head, &chan->tick_list[CF_Direction_RX]);
+
+    /* already on the tick list, nothing to do */
+    UtAssert_VOIDCALL(CF_InsertTransactionTick(chan, txn));
+    UtAssert_STUB_COUNT(CF_CList_InsertBack, 1);
+
+    /* sender goes on the TX list */
+    txn->tick_head = NULL;
+    txn->state     = CF_TxnState_S2;
+    UtAssert_VOIDCALL(CF_InsertTransactionTick(chan, txn));
+    UtAssert_STUB_COUNT(CF_CList_InsertBack, 2);
+    UtAssert_ADDRESS_EQ(txn->tick_head, &chan->tick_list[CF_Direction_TX]);
+}
+
+void Test_CF_RemoveTransactionTick(void)
+{
+    /* Test case for:
+     * void CF_RemoveTransactionTick(CF_Transaction_t *txn)
+     */
+    CF_Transaction_t txn;
+
+    memset(&CF_AppData, 0, sizeof(CF_AppData));
+    memset(&txn, 0, sizeof(txn));
+
+    /* not on the tick list, nothing to do */
+    UtAssert_VOIDCALL(CF_RemoveTransactionTick(&txn));
+    UtAssert_STUB_COUNT(CF_CList_Remove, 0);
+
+    /* on the tick list */
+    txn.tick_head = &CF_AppData.engine.channels[UT_CFDP_CHANNEL].tick_list[CF_Direction_TX];
+    UtAssert_VOIDCALL(CF_RemoveTransactionTick(&txn));
+    UtAssert_STUB_COUNT(CF_CList_Remove, 1);
+    UtAssert_NULL(txn.tick_head);
 }
 
 void Test_CF_FindTransactionBySequenceNumber_Impl(void)
@@ -201,7 +390,7 @@ void Test_CF_FindTransactionBySequenceNumber_Impl(void)
     ctxt.src_eid                     = 34;
     hist.seq_num                     = 56;
     ctxt.transaction_sequence_number = 78;
-    UtAssert_INT32_EQ(CF_FindTransactionBySequenceNumber_Impl(&txn.cl_node, &ctxt), 0);
+    UtAssert_INT32_EQ(CF_FindTransactionBySequenceNumber_Impl(&txn.hash_node, &ctxt), 0);
     UtAssert_NULL(ctxt.txn);
 
     /* matching eid and non-matching sequence */
@@ -209,7 +398,7 @@ void Test_CF_FindTransactionBySequenceNumber_Impl(void)
     ctxt.src_eid                     = 13;
     hist.seq_num                     = 56;
     ctxt.transaction_sequence_number = 78;
-    UtAssert_INT32_EQ(CF_FindTransactionBySequenceNumber_Impl(&txn.cl_node, &ctxt), 0);
+    UtAssert_INT32_EQ(CF_FindTransactionBySequenceNumber_Impl(&txn.hash_node, &ctxt), 0);
     UtAssert_NULL(ctxt.txn);
 
     /* non-matching eid and matching sequence */
@@ -217,7 +406,7 @@ void Test_CF_FindTransactionBySequenceNumber_Impl(void)
     ctxt.src_eid                     = 34;
     hist.seq_num                     = 57;
     ctxt.transaction_sequence_number = 57;
-    UtAssert_INT32_EQ(CF_FindTransactionBySequenceNumber_Impl(&txn.cl_node, &ctxt), 0);
+    UtAssert_INT32_EQ(CF_FindTransactionBySequenceNumber_Impl(&txn.hash_node, &ctxt), 0);
     UtAssert_NULL(ctxt.txn);
 
     /* matching eid and matching sequence */
@@ -225,7 +414,7 @@ void Test_CF_FindTransactionBySequenceNumber_Impl(void)
     ctxt.src_eid                     = 23;
     hist.seq_num                     = 67;
     ctxt.transaction_sequence_number = 67;
-    UtAssert_INT32_EQ(CF_FindTransactionBySequenceNumber_Impl(&txn.cl_node, &ctxt), 1);
+    UtAssert_INT32_EQ(CF_FindTransactionBySequenceNumber_Impl(&txn.hash_node, &ctxt), 1);
     UtAssert_ADDRESS_EQ(ctxt.txn, &txn);
 }
 
@@ -243,9 +432,9 @@ void Test_CF_FindTransactionBySequenceNumber(void)
     chan = &CF_AppData.engine.channels[UT_CFDP_CHANNEL];
 
     UtAssert_NULL(CF_FindTransactionBySequenceNumber(chan, 12, 34));
-    UtAssert_STUB_COUNT(CF_CList_Traverse, 4); /* this checks 4 different queues */
+    UtAssert_STUB_COUNT(CF_CList_Traverse, 1); /* this checks only the one index bucket */
 
-    txn = &CF_AppData.engine.transactions[UT_CFDP_CHANNEL];
+    txn = (CF_Transaction_t *)CF_AppData.engine.pool_arena;
     UT_SetHandlerFunction(UT_KEY(CF_CList_Traverse), UT_AltHandler_CF_CList_Traverse_SeqArg_SetTxn, txn);
     UtAssert_ADDRESS_EQ(CF_FindTransactionBySequenceNumber(chan, 12, 34), txn);
 }
@@ -443,392 +632,128 @@ void Test_CF_CList_InsertBack_Ex_Call_CF_CList_InsertBack_AndIncrement_q_size(vo
 
 /*******************************************************************************
 **
-**  CF_Traverse_WriteHistoryQueueEntryToFile tests
+**  CF_InsertSortPrio tests
 **
 *******************************************************************************/
 
-void Test_CF_Traverse_WriteHistoryQueueEntryToFile(void)
+void Test_CF_InsertSortPrio(void)
 {
     /* Test case for:
-     * int CF_Traverse_WriteHistoryQueueEntryToFile(CF_CListNode_t *node, void *arg);
+     * void CF_InsertSortPrio(CF_Transaction_t *txn, CF_QueueIdx_t queue)
      */
-    CF_History_t                      hist;
-    CF_Traverse_WriteHistoryFileArg_t args;
-
-    memset(&hist, 0, sizeof(hist));
-    memset(&args, 0, sizeof(args));
-
-    /* nominal, if everything works, should continue */
-    hist.dir        = CF_Direction_TX;
-    args.filter_dir = CF_Direction_TX;
-    UtAssert_INT32_EQ(CF_Traverse_WriteHistoryQueueEntryToFile(&hist.cl_node, &args), CF_CLIST_CONT);
-    UtAssert_UINT32_EQ(args.counter, 1);
-    UtAssert_BOOL_FALSE(args.error);
-
-    /* filter disabled (anything goes) */
-    hist.dir        = CF_Direction_RX;
-    args.filter_dir = CF_Direction_NUM;
-    UtAssert_INT32_EQ(CF_Traverse_WriteHistoryQueueEntryToFile(&hist.cl_node, &args), CF_CLIST_CONT);
-    UtAssert_UINT32_EQ(args.counter, 2);
-    UtAssert_BOOL_FALSE(args.error);
-
-    /* filter no match (does not write) */
-    hist.dir        = CF_Direction_RX;
-    args.filter_dir = CF_Direction_TX;
-    UtAssert_INT32_EQ(CF_Traverse_WriteHistoryQueueEntryToFile(&hist.cl_node, &args), CF_CLIST_CONT);
-    UtAssert_UINT32_EQ(args.counter, 2); /* no increment */
-    UtAssert_BOOL_FALSE(args.error);
-
-    /* Setup for failure */
-    UT_SetDeferredRetcode(UT_KEY(OS_write), 1, -1);
-    hist.dir        = CF_Direction_RX;
-    args.filter_dir = CF_Direction_RX;
-    UtAssert_INT32_EQ(CF_Traverse_WriteHistoryQueueEntryToFile(&hist.cl_node, &args), CF_CLIST_EXIT);
-    UtAssert_UINT32_EQ(args.counter, 2); /* no increment */
-    UtAssert_BOOL_TRUE(args.error);
-}
+    CF_Transaction_t               txn[5];
+    CF_Channel_t *                 chan;
+    CF_CList_InsertAfter_context_t context_insert_after;
+    int                            i;
 
-/*******************************************************************************
-**
-**  CF_Traverse_WriteTxnQueueEntryToFile tests
-**
-*******************************************************************************/
-
-void Test_CF_Traverse_WriteTxnQueueEntryToFile(void)
-{
-    /* Test case for:
-     * int CF_Traverse_WriteTxnQueueEntryToFile(CF_CListNode_t *node, void *arg);
-     */
-    CF_Transaction_t              txn;
-    CF_History_t                  hist;
-    CF_Traverse_WriteTxnFileArg_t args;
+    memset(txn, 0, sizeof(txn));
+    memset(&CF_AppData, 0, sizeof(CF_AppData));
+    chan = &CF_AppData.engine.channels[UT_CFDP_CHANNEL];
+    for (i = 0; i < 5; ++i)
+    {
+        txn[i].chan_num = UT_CFDP_CHANNEL;
+        txn[i].state    = CF_TxnState_S1;
+    }
 
-    memset(&txn, 0, sizeof(txn));
-    memset(&hist, 0, sizeof(hist));
-    memset(&args, 0, sizeof(args));
-    txn.history = &hist;
+    UT_SetDataBuffer(UT_KEY(CF_CList_InsertAfter), &context_insert_after, sizeof(context_insert_after), false);
 
-    /* nominal, if everything works, should continue */
-    UtAssert_INT32_EQ(CF_Traverse_WriteTxnQueueEntryToFile(&txn.cl_node, &args), CF_CLIST_CONT);
-    UtAssert_UINT32_EQ(args.counter, 1);
-    UtAssert_BOOL_FALSE(args.error);
+    /* empty queue, goes on the front */
+    txn[0].priority = 10;
+    UtAssert_VOIDCALL(CF_InsertSortPrio(&txn[0], CF_QueueIdx_PEND));
+    UtAssert_STUB_COUNT(CF_CList_InsertFront, 1);
+    UtAssert_UINT32_EQ(txn[0].flags.com.q_index, CF_QueueIdx_PEND);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].q_size[CF_QueueIdx_PEND], 1);
+    UtAssert_ADDRESS_EQ(chan->pend_prio.tail[10], &txn[0].cl_node);
+    UtAssert_UINT32_EQ(chan->pend_prio.nonempty[0], 1U << 10);
 
-    /* Setup for failure */
-    UT_SetDeferredRetcode(UT_KEY(OS_write), 1, -1);
-    UtAssert_INT32_EQ(CF_Traverse_WriteTxnQueueEntryToFile(&txn.cl_node, &args), CF_CLIST_EXIT);
-    UtAssert_UINT32_EQ(args.counter, 1); /* no increment */
-    UtAssert_BOOL_TRUE(args.error);
+    /* same priority goes after it, and ends the run now */
+    txn[1].priority = 10;
+    UtAssert_VOIDCALL(CF_InsertSortPrio(&txn[1], CF_QueueIdx_PEND));
+    UtAssert_STUB_COUNT(CF_CList_InsertAfter, 1);
+    UtAssert_ADDRESS_EQ(context_insert_after.head, &chan->qs[CF_QueueIdx_PEND]);
+    UtAssert_ADDRESS_EQ(context_insert_after.start, &txn[0].cl_node);
+    UtAssert_ADDRESS_EQ(context_insert_after.after, &txn[1].cl_node);
+    UtAssert_ADDRESS_EQ(chan->pend_prio.tail[10], &txn[1].cl_node);
+    UtAssert_UINT32_EQ(CF_AppData.hk.Payload.channel_hk[UT_CFDP_CHANNEL].q_size[CF_QueueIdx_PEND], 2);
+
+    /* lower priority goes after the nearest level in use, found in another bitmap word */
+    txn[2].priority = 200;
+    UtAssert_VOIDCALL(CF_InsertSortPrio(&txn[2], CF_QueueIdx_PEND));
+    UtAssert_STUB_COUNT(CF_CList_InsertAfter, 2);
+    UtAssert_ADDRESS_EQ(context_insert_after.start, &txn[1].cl_node);
+    UtAssert_ADDRESS_EQ(chan->pend_prio.tail[200], &txn[2].cl_node);
+    UtAssert_UINT32_EQ(chan->pend_prio.nonempty[200 / 32], 1U << (200 % 32));
+
+    /* higher priority than anything queued goes on the front */
+    txn[3].priority = 5;
+    UtAssert_VOIDCALL(CF_InsertSortPrio(&txn[3], CF_QueueIdx_PEND));
+    UtAssert_STUB_COUNT(CF_CList_InsertFront, 2);
+    UtAssert_ADDRESS_EQ(chan->pend_prio.tail[5], &txn[3].cl_node);
+    UtAssert_UINT32_EQ(chan->pend_prio.nonempty[0], (1U << 10) | (1U << 5));
+
+    /* TXW has an index of its own */
+    txn[4].priority = 200;
+    UtAssert_VOIDCALL(CF_InsertSortPrio(&txn[4], CF_QueueIdx_TXW));
+    UtAssert_STUB_COUNT(CF_CList_InsertFront, 3);
+    UtAssert_UINT32_EQ(txn[4].flags.com.q_index, CF_QueueIdx_TXW);
+    UtAssert_ADDRESS_EQ(chan->txw_prio.tail[200], &txn[4].cl_node);
+    UtAssert_ADDRESS_EQ(chan->pend_prio.tail[200], &txn[2].cl_node);
 }
 
-/*******************************************************************************
-**
-**  CF_WriteHistoryEntryToFile tests
-**
-*******************************************************************************/
-
-void Test_CF_WriteHistoryEntryToFile(void)
+void Test_CF_RemoveTransactionPrio(void)
 {
     /* Test case for:
-     * int CF_WriteHistoryEntryToFile(osal_id_t fd, const CF_History_t *history)
+     * void CF_RemoveTransactionPrio(CF_Transaction_t *txn)
      */
-    osal_id_t    arg_fd = OS_ObjectIdFromInteger(1);
-    CF_History_t history;
-
-    memset(&history, 0, sizeof(history));
-    strcpy(history.fnames.src_filename, "sf");
-    strcpy(history.fnames.dst_filename, "df");
-
-    /* Successful write - need to set up for 3 successful calls to OS_write() */
-    UT_SetDeferredRetcode(UT_KEY(OS_write), 1, 44);
-    UT_SetDeferredRetcode(UT_KEY(OS_write), 1, strlen(history.fnames.src_filename) + 6);
-    UT_SetDeferredRetcode(UT_KEY(OS_write), 1, strlen(history.fnames.dst_filename) + 6);
-    UtAssert_INT32_EQ(CF_WriteHistoryEntryToFile(arg_fd, &history), 0);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
-
-    /* Unsuccessful write */
-    UT_CF_ResetEventCapture();
-    UT_SetDeferredRetcode(UT_KEY(OS_write), 1, -1);
-    UtAssert_INT32_EQ(CF_WriteHistoryEntryToFile(arg_fd, &history), -1);
-    UT_CF_AssertEventID(CF_CMD_WHIST_WRITE_ERR_EID);
-}
-
-/*******************************************************************************
-**
-**  CF_WriteQueueDataToFile tests
-**
-*******************************************************************************/
-
-void Test_CF_WriteTxnQueueDataToFile(void)
-{
-    /* Arrange */
-    osal_id_t      arg_fd = OS_ObjectIdFromInteger(1);
-    CF_Channel_t   ch;
-    CF_CListNode_t node;
-
-    memset(&node, 0, sizeof(node));
-    memset(&ch, 0, sizeof(ch));
-    ch.qs[CF_QueueIdx_TXA] = &node;
-
-    /* Act */
-    /* with no configuration, this should return no error (0) */
-    UtAssert_INT32_EQ(CF_WriteTxnQueueDataToFile(arg_fd, &ch, CF_QueueIdx_TXA), 0);
-
-    /* Assert */
-    UtAssert_STUB_COUNT(CF_CList_Traverse, 1);
-}
-
-/*******************************************************************************
-**
-**  CF_WriteHistoryQueueDataToFile tests
-**
-*******************************************************************************/
-
-void Test_CF_WriteHistoryQueueDataToFile(void)
-{
-    /* Arrange */
-    osal_id_t      arg_fd = OS_ObjectIdFromInteger(1);
-    CF_Channel_t   ch;
-    CF_CListNode_t node;
-
-    memset(&node, 0, sizeof(node));
-    memset(&ch, 0, sizeof(ch));
-    ch.qs[CF_QueueIdx_HIST] = &node;
-
-    /* Act */
-    /* with no configuration, this should return no error (0) */
-    UtAssert_INT32_EQ(CF_WriteHistoryQueueDataToFile(arg_fd, &ch, CF_QueueIdx_HIST), 0);
-
-    /* Assert */
-    UtAssert_STUB_COUNT(CF_CList_Traverse, 1);
-}
-
-/*******************************************************************************
-**
-**  CF_PrioSearch tests
-**
-*******************************************************************************/
-
-void Test_CF_PrioSearch_When_t_PrioIsGreaterThanContextPrioReturn_CLIST_CONT(void)
-{
-    /* Arrange */
-    CF_Transaction_t          txn;
-    CF_CListNode_t *          arg_node = &txn.cl_node;
-    CF_Traverse_PriorityArg_t arg;
-    void *                    arg_context = (void *)&arg;
-    int32                     result;
-
-    txn.priority = Any_uint8_Except(0);
-    arg.priority = Any_uint8_LessThan(txn.priority);
-
-    /* Act */
-    result = CF_PrioSearch(arg_node, arg_context);
-
-    /* Assert */
-    UtAssert_INT32_EQ(result, CF_CLIST_CONT);
-}
-
-void Test_CF_PrioSearch_When_t_PrioIsEqToContextPrio_Set_context_t_To_t_AndReturn_CLIST_EXIT(void)
-{
-    /* Arrange */
-    CF_Transaction_t          txn;
-    CF_CListNode_t *          arg_node = &txn.cl_node;
-    CF_Traverse_PriorityArg_t arg;
-    void *                    arg_context = (void *)&arg;
-    int32                     result;
-
-    memset(&arg, 0, sizeof(arg));
-
-    /* NOTE: these are inverted from previous test! */
-    txn.priority = Any_uint8_Except(0);
-    arg.priority = txn.priority;
-
-    /* Act */
-    result = CF_PrioSearch(arg_node, arg_context);
-
-    /* Assert */
-    UtAssert_INT32_EQ(result, CF_CLIST_EXIT);
-    UtAssert_ADDRESS_EQ(arg.txn, &txn);
-}
-
-void Test_CF_PrioSearch_When_t_PrioIsLessThanContextPrio_Set_context_t_To_t_AndReturn_CLIST_EXIT(void)
-{
-    /* Arrange */
-    CF_Transaction_t          txn;
-    CF_CListNode_t *          arg_node = &txn.cl_node;
-    CF_Traverse_PriorityArg_t arg;
-    void *                    arg_context = (void *)&arg;
-    int32                     result;
-
-    memset(&arg, 0, sizeof(arg));
-
-    /* NOTE: these are inverted from previous test! */
-    arg.priority = Any_uint8_Except(0);
-    txn.priority = Any_uint8_LessThan(arg.priority);
-
-    /* Act */
-    result = CF_PrioSearch(arg_node, arg_context);
-
-    /* Assert */
-    UtAssert_INT32_EQ(result, CF_CLIST_EXIT);
-    UtAssert_ADDRESS_EQ(arg.txn, &txn);
-}
-
-/*******************************************************************************
-**
-**  CF_InsertSortPrio tests
-**
-*******************************************************************************/
-
-void Test_CF_InsertSortPrio_Call_CF_CList_InsertBack_Ex_ListIsEmpty_AndSet_q_index_To_q(void)
-{
-    /* Arrange */
-    CF_Transaction_t  txn;
-    CF_Transaction_t *arg_t = &txn;
-    CF_QueueIdx_t     arg_q = Any_cf_queue_index_t();
-    CF_Channel_t *    chan;
-    CF_CListNode_t ** expected_insert_back_head;
-    CF_CListNode_t *  expected_insert_back_node;
-
-    CF_CList_InsertBack_context_t context_clist_insert_back;
-
-    /* txn settings to bypass CF_Assert */
-    txn.chan_num = Any_uint8_LessThan(CF_NUM_CHANNELS);
-    txn.state    = Any_uint8_Except(CF_TxnState_IDLE);
-
-    UT_SetDataBuffer(UT_KEY(CF_CList_InsertBack), &context_clist_insert_back, sizeof(context_clist_insert_back), false);
-
-    /* setting (&CF_AppData.engine.channels[arg_t->chan_num])->qs[arg_q] to NULL
-     * makes the list empty */
-    chan            = &CF_AppData.engine.channels[arg_t->chan_num];
-    chan->qs[arg_q] = NULL;
-
-    expected_insert_back_head = &chan->qs[arg_q];
-    expected_insert_back_node = &arg_t->cl_node;
-
-    /* Act */
-    CF_InsertSortPrio(arg_t, arg_q);
-
-    /* Assert */
-    UtAssert_STUB_COUNT(CF_CList_InsertBack, 1);
-    UtAssert_ADDRESS_EQ(context_clist_insert_back.head, expected_insert_back_head);
-    UtAssert_ADDRESS_EQ(context_clist_insert_back.node, expected_insert_back_node);
-    UtAssert_True(arg_t->flags.com.q_index == arg_q,
-                  "arg_t->flags.com.q_index set to %d and should be %d (CF_QueueIdx_t queue)", arg_t->flags.com.q_index,
-                  arg_q);
-}
-
-void Test_CF_InsertSortPrio_Call_CF_CList_InsertAfter_Ex_AndSet_q_index_To_q(void)
-{
-    /* Arrange */
-    CF_Transaction_t  p_t;
-    CF_Transaction_t  txn;
-    CF_Transaction_t *arg_t = &txn;
-    CF_QueueIdx_t     arg_q = Any_cf_queue_index_t();
-    CF_CListNode_t *  qs;
-    CF_Channel_t *    chan;
-    CF_CListNode_t *  expected_end;
-    CF_CListFn_t      expected_fn;
-    CF_CListNode_t ** expected_insert_after_head;
-    CF_CListNode_t ** expected_insert_after_start;
-    CF_CListNode_t ** expected_insert_after_after;
-
-    CF_CList_Traverse_R_context_t  context_cf_clist_traverse_r;
-    CF_CList_InsertAfter_context_t context_CF_CList_InsertAfter;
-
-    UT_SetHandlerFunction(UT_KEY(CF_CList_Traverse_R), UT_AltHandler_CF_CList_Traverse_R_PRIO,
-                          &context_cf_clist_traverse_r);
-
-    /* txn settings to bypass CF_Assert */
-    txn.chan_num = Any_uint8_LessThan(CF_NUM_CHANNELS);
-    txn.state    = Any_uint8_Except(CF_TxnState_IDLE);
-
-    /* setting (&CF_AppData.engine.channels[arg_t->chan_num])->qs[arg_q] to
-     * &qs makes the list NOT empty */
-    chan            = &CF_AppData.engine.channels[arg_t->chan_num];
-    chan->qs[arg_q] = (CF_CListNode_t *)&qs;
-
-    /* setup CF_Traverse_PriorityArg_t altered value */
-    context_cf_clist_traverse_r.context_t = &p_t;
-
-    /* Arrange for CF_CList_InsertAfter_Ex */
-    UT_SetDataBuffer(UT_KEY(CF_CList_InsertAfter), &context_CF_CList_InsertAfter, sizeof(context_CF_CList_InsertAfter),
-                     false);
-
-    /* set expected values */
-    expected_end                = chan->qs[arg_q];
-    expected_fn                 = CF_PrioSearch;
-    expected_insert_after_head  = (CF_CListNode_t **)&chan->qs[arg_q];
-    expected_insert_after_start = (CF_CListNode_t **)&p_t.cl_node;
-    expected_insert_after_after = (CF_CListNode_t **)&arg_t->cl_node;
-
-    /* Act */
-    CF_InsertSortPrio(arg_t, arg_q);
-
-    /* Assert */
-    UtAssert_STUB_COUNT(CF_CList_Traverse_R, 1);
-    UtAssert_ADDRESS_EQ(context_cf_clist_traverse_r.end, expected_end);
-    UtAssert_True(context_cf_clist_traverse_r.fn == expected_fn, "context_cf_clist_traverse_r.fn ==  expected_fn");
-    UtAssert_STUB_COUNT(CF_CList_InsertAfter, 1);
-    UtAssert_ADDRESS_EQ(context_CF_CList_InsertAfter.head, (CF_CListNode_t **)expected_insert_after_head);
-    UtAssert_ADDRESS_EQ(context_CF_CList_InsertAfter.start, (CF_CListNode_t *)expected_insert_after_start);
-    UtAssert_ADDRESS_EQ(context_CF_CList_InsertAfter.after, (CF_CListNode_t *)expected_insert_after_after);
-    UtAssert_True(arg_t->flags.com.q_index == arg_q, "txn->flags.com.q_index is %u and should be %u (q)",
-                  arg_t->flags.com.q_index, arg_q);
-}
-
-void Test_CF_InsertSortPrio_When_p_t_Is_NULL_Call_CF_CList_InsertBack_Ex(void)
-{
-    /* Arrange */
-    CF_Transaction_t  txn;
-    CF_Transaction_t *arg_t = &txn;
-    CF_QueueIdx_t     arg_q = Any_cf_queue_index_t();
-    CF_CListNode_t *  qs;
-    CF_Channel_t *    chan;
-    CF_CListNode_t *  expected_end;
-    CF_CListFn_t      expected_fn;
-    CF_CListNode_t ** expected_insert_back_head;
-    CF_CListNode_t *  expected_insert_back_node;
-
-    CF_CList_Traverse_R_context_t context_cf_clist_traverse_r;
-    CF_CList_InsertBack_context_t context_clist_insert_back;
-
-    UT_SetDataBuffer(UT_KEY(CF_CList_Traverse_R), &context_cf_clist_traverse_r, sizeof(context_cf_clist_traverse_r),
-                     false);
-
-    /* txn settings to bypass CF_Assert */
-    txn.chan_num = Any_uint8_LessThan(CF_NUM_CHANNELS);
-    txn.state    = Any_uint8_Except(CF_TxnState_IDLE);
-
-    /* setting (&CF_AppData.engine.channels[arg_t->chan_num])->qs[arg_q] to
-     * &qs makes the list NOT empty */
-    chan            = &CF_AppData.engine.channels[arg_t->chan_num];
-    chan->qs[arg_q] = (CF_CListNode_t *)&qs;
-
-    /* setup CF_Traverse_PriorityArg_t altered value */
-    context_cf_clist_traverse_r.context_t = NULL;
-
-    /* set expected values */
-    expected_end              = chan->qs[arg_q];
-    expected_fn               = CF_PrioSearch;
-    expected_insert_back_head = &chan->qs[arg_q];
-    expected_insert_back_node = &arg_t->cl_node;
-
-    /* Arrange for CF_CList_InsertBack_Ex */
-    UT_SetDataBuffer(UT_KEY(CF_CList_InsertBack), &context_clist_insert_back, sizeof(context_clist_insert_back), false);
+    CF_Transaction_t txn[3];
+    CF_Channel_t *   chan;
+    int              i;
 
-    /* Act */
-    CF_InsertSortPrio(arg_t, arg_q);
+    memset(txn, 0, sizeof(txn));
+    memset(&CF_AppData, 0, sizeof(CF_AppData));
+    chan = &CF_AppData.engine.channels[UT_CFDP_CHANNEL];
+    for (i = 0; i < 3; ++i)
+    {
+        txn[i].chan_num = UT_CFDP_CHANNEL;
+    }
 
-    /* Assert */
-    UtAssert_STUB_COUNT(CF_CList_Traverse_R, 1);
-    UtAssert_ADDRESS_EQ(context_cf_clist_traverse_r.end, expected_end);
-    UtAssert_True(context_cf_clist_traverse_r.fn == expected_fn, "context_cf_clist_traverse_r.fn ==  expected_fn");
-    UtAssert_STUB_COUNT(CF_CList_InsertAfter, 0);
-    UtAssert_STUB_COUNT(CF_CList_InsertBack, 1);
-    UtAssert_ADDRESS_EQ(context_clist_insert_back.head, expected_insert_back_head);
-    UtAssert_ADDRESS_EQ(context_clist_insert_back.node, expected_insert_back_node);
-    UtAssert_True(arg_t->flags.com.q_index == arg_q, "txn->flags.com.q_index is %u and should be %u (q)",
-                  arg_t->flags.com.q_index, arg_q);
+    /* queue without a priority index */
+    txn[0].flags.com.q_index = CF_QueueIdx_TXA;
+    UtAssert_VOIDCALL(CF_RemoveTransactionPrio(&txn[0]));
+
+    /* not the end of its run */
+    txn[0].flags.com.q_index    = CF_QueueIdx_PEND;
+    txn[0].priority             = 10;
+    txn[1].flags.com.q_index    = CF_QueueIdx_PEND;
+    txn[1].priority             = 10;
+    txn[1].cl_node.prev         = &txn[0].cl_node;
+    chan->qs[CF_QueueIdx_PEND]  = &txn[0].cl_node;
+    chan->pend_prio.tail[10]    = &txn[1].cl_node;
+    chan->pend_prio.nonempty[0] = 1U << 10;
+    UtAssert_VOIDCALL(CF_RemoveTransactionPrio(&txn[0]));
+    UtAssert_ADDRESS_EQ(chan->pend_prio.tail[10], &txn[1].cl_node);
+
+    /* end of the run, the one before it has the same priority */
+    UtAssert_VOIDCALL(CF_RemoveTransactionPrio(&txn[1]));
+    UtAssert_ADDRESS_EQ(chan->pend_prio.tail[10], &txn[0].cl_node);
+    UtAssert_UINT32_EQ(chan->pend_prio.nonempty[0], 1U << 10);
+
+    /* end of the run, the one before it has a higher priority */
+    txn[0].priority          = 5;
+    chan->pend_prio.tail[10] = &txn[1].cl_node;
+    UtAssert_VOIDCALL(CF_RemoveTransactionPrio(&txn[1]));
+    UtAssert_NULL(chan->pend_prio.tail[10]);
+    UtAssert_ZERO(chan->pend_prio.nonempty[0]);
+
+    /* only one on the queue, so its prev is itself */
+    txn[2].flags.com.q_index   = CF_QueueIdx_TXW;
+    txn[2].priority            = 40;
+    chan->qs[CF_QueueIdx_TXW]  = &txn[2].cl_node;
+    chan->txw_prio.tail[40]    = &txn[2].cl_node;
+    chan->txw_prio.nonempty[1] = 1U << 8;
+    UtAssert_VOIDCALL(CF_RemoveTransactionPrio(&txn[2]));
+    UtAssert_NULL(chan->txw_prio.tail[40]);
+    UtAssert_ZERO(chan->txw_prio.nonempty[1]);
 }
 
 /*******************************************************************************
@@ -1071,6 +996,39 @@ void Test_CF_WrappedLseek_Call_OS_lseek_WithGivenArgumentsAndReturnItsReturnValu
     UtAssert_INT32_EQ(CF_WrappedLseek(UT_CF_OS_OBJID, test_offset, test_mode), expected_result);
 }
 
+void Test_CF_WrappedSeekTo(void)
+{
+    /* Test function for:
+     * CFE_Status_t CF_WrappedSeekTo(osal_id_t fd, CF_FileSize_t offset)
+     */
+
+    /* nominal, one seek */
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, 100);
+    UtAssert_INT32_EQ(CF_WrappedSeekTo(UT_CF_OS_OBJID, 100), CFE_SUCCESS);
+    UtAssert_STUB_COUNT(OS_lseek, 1);
+
+    /* past 4 GiB in steps, each returning the truncated position */
+    UT_ResetState(UT_KEY(OS_lseek));
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, 0x40000000);
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, (int32)0x80000000);
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, (int32)0xC0000000);
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, 0);
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, 0x10);
+    UtAssert_INT32_EQ(CF_WrappedSeekTo(UT_CF_OS_OBJID, 0x100000010), CFE_SUCCESS);
+    UtAssert_STUB_COUNT(OS_lseek, 5);
+
+    /* OSAL error is passed back, and no further steps are taken */
+    UT_ResetState(UT_KEY(OS_lseek));
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CF_WrappedSeekTo(UT_CF_OS_OBJID, 0x100000010), OS_ERROR);
+    UtAssert_STUB_COUNT(OS_lseek, 1);
+
+    /* ended up somewhere else */
+    UT_ResetState(UT_KEY(OS_lseek));
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, 50);
+    UtAssert_INT32_EQ(CF_WrappedSeekTo(UT_CF_OS_OBJID, 100), CF_ERROR);
+}
+
 void Test_CF_TxnStatus_IsError(void)
 {
     /* Test function for:
@@ -1151,9 +1109,18 @@ void Test_CF_TxnStatus_From_ConditionCode(void)
 void add_cf_utils_h_tests(void)
 {
     UtTest_Add(Test_CF_ResetHistory, cf_utils_tests_Setup, cf_utils_tests_Teardown, "CF_ResetHistory");
+    UtTest_Add(Test_CF_StoreHistoryNames, cf_utils_tests_Setup, cf_utils_tests_Teardown, "CF_StoreHistoryNames");
     UtTest_Add(Test_CF_FindUnusedTransaction, cf_utils_tests_Setup, cf_utils_tests_Teardown,
                "CF_FindUnusedTransaction");
     UtTest_Add(Test_CF_FreeTransaction, cf_utils_tests_Setup, cf_utils_tests_Teardown, "CF_FreeTransaction");
+    UtTest_Add(Test_CF_InsertTransactionIndex, cf_utils_tests_Setup, cf_utils_tests_Teardown,
+               "CF_InsertTransactionIndex");
+    UtTest_Add(Test_CF_RemoveTransactionIndex, cf_utils_tests_Setup, cf_utils_tests_Teardown,
+               "CF_RemoveTransactionIndex");
+    UtTest_Add(Test_CF_InsertTransactionTick, cf_utils_tests_Setup, cf_utils_tests_Teardown,
+               "CF_InsertTransactionTick");
+    UtTest_Add(Test_CF_RemoveTransactionTick, cf_utils_tests_Setup, cf_utils_tests_Teardown,
+               "CF_RemoveTransactionTick");
     UtTest_Add(Test_CF_FindTransactionBySequenceNumber_Impl, cf_utils_tests_Setup, cf_utils_tests_Teardown,
                "CF_FindTransactionBySequenceNumber_Impl");
     UtTest_Add(Test_CF_FindTransactionBySequenceNumber, cf_utils_tests_Setup, cf_utils_tests_Teardown,
@@ -1191,51 +1158,11 @@ void add_cf_utils_h_tests(void)
                "CF_TxnStatus_From_ConditionCode");
 }
 
-void add_CF_Traverse_WriteHistoryToFile_tests(void)
-{
-    UtTest_Add(Test_CF_Traverse_WriteHistoryQueueEntryToFile, cf_utils_tests_Setup, cf_utils_tests_Teardown,
-               "CF_Traverse_WriteHistoryQueueEntryToFile");
-}
-
-void add_CF_Traverse_WriteAllTxnToFile_tests(void)
-{
-    UtTest_Add(Test_CF_Traverse_WriteTxnQueueEntryToFile, cf_utils_tests_Setup, cf_utils_tests_Teardown,
-               "CF_Traverse_WriteTxnQueueEntryToFile");
-}
-
-void add_CF_WriteTxnQueueDataToFile_tests(void)
-{
-    UtTest_Add(Test_CF_WriteTxnQueueDataToFile, cf_utils_tests_Setup, cf_utils_tests_Teardown,
-               "Test_CF_WriteTxnQueueDataToFile");
-}
-
-void add_CF_WriteHistoryQueueDataToFile_tests(void)
-{
-    UtTest_Add(Test_CF_WriteHistoryQueueDataToFile, cf_utils_tests_Setup, cf_utils_tests_Teardown,
-               "Test_CF_WriteHistoryQueueDataToFile");
-}
-
-void add_CF_PrioSearch_tests(void)
-{
-    UtTest_Add(Test_CF_PrioSearch_When_t_PrioIsGreaterThanContextPrioReturn_CLIST_CONT, cf_utils_tests_Setup,
-               cf_utils_tests_Teardown, "Test_CF_PrioSearch_When_t_PrioIsGreaterThanContextPrioReturn_CLIST_CONT");
-    UtTest_Add(Test_CF_PrioSearch_When_t_PrioIsEqToContextPrio_Set_context_t_To_t_AndReturn_CLIST_EXIT,
-               cf_utils_tests_Setup, cf_utils_tests_Teardown,
-               "Test_CF_PrioSearch_When_t_PrioIsEqToContextPrio_Set_context_t_To_t_AndReturn_CLIST_EXIT");
-    UtTest_Add(Test_CF_PrioSearch_When_t_PrioIsLessThanContextPrio_Set_context_t_To_t_AndReturn_CLIST_EXIT,
-               cf_utils_tests_Setup, cf_utils_tests_Teardown,
-               "Test_CF_PrioSearch_When_t_PrioIsLessThanContextPrio_Set_context_t_To_t_AndReturn_CLIST_EXIT");
-}
-
 void add_CF_InsertSortPrio_tests(void)
 {
-    UtTest_Add(Test_CF_InsertSortPrio_Call_CF_CList_InsertBack_Ex_ListIsEmpty_AndSet_q_index_To_q, cf_utils_tests_Setup,
-               cf_utils_tests_Teardown,
-               "Test_CF_InsertSortPrio_Call_CF_CList_InsertBack_Ex_ListIsEmpty_AndSet_q_index_To_q");
-    UtTest_Add(Test_CF_InsertSortPrio_Call_CF_CList_InsertAfter_Ex_AndSet_q_index_To_q, cf_utils_tests_Setup,
-               cf_utils_tests_Teardown, "Test_CF_InsertSortPrio_Call_CF_CList_InsertAfter_Ex_AndSet_q_index_To_q");
-    UtTest_Add(Test_CF_InsertSortPrio_When_p_t_Is_NULL_Call_CF_CList_InsertBack_Ex, cf_utils_tests_Setup,
-               cf_utils_tests_Teardown, "Test_CF_InsertSortPrio_When_p_t_Is_NULL_Call_CF_CList_InsertBack_Ex");
+    UtTest_Add(Test_CF_InsertSortPrio, cf_utils_tests_Setup, cf_utils_tests_Teardown, "Test_CF_InsertSortPrio");
+    UtTest_Add(Test_CF_RemoveTransactionPrio, cf_utils_tests_Setup, cf_utils_tests_Teardown,
+               "Test_CF_RemoveTransactionPrio");
 }
 
 void add_CF_TraverseAllTransactions_Impl_tests(void)
@@ -1289,6 +1216,7 @@ void add_CF_WrappedLseek_tests(void)
 {
     UtTest_Add(Test_CF_WrappedLseek_Call_OS_lseek_WithGivenArgumentsAndReturnItsReturnValue, cf_utils_tests_Setup,
                cf_utils_tests_Teardown, "Test_CF_WrappedLseek_Call_OS_lseek_WithGivenArgumentsAndReturnItsReturnValue");
+    UtTest_Add(Test_CF_WrappedSeekTo, cf_utils_tests_Setup, cf_utils_tests_Teardown, "Test_CF_WrappedSeekTo");
 }
 
 /*******************************************************************************
@@ -1303,15 +1231,6 @@ void UtTest_Setup(void)
 
     add_cf_utils_h_tests();
 
-    add_CF_Traverse_WriteHistoryToFile_tests();
-
-    add_CF_Traverse_WriteAllTxnToFile_tests();
-
-    add_CF_WriteTxnQueueDataToFile_tests();
-
-    add_CF_WriteHistoryQueueDataToFile_tests();
-
-    add_CF_PrioSearch_tests();
 
     add_CF_InsertSortPrio_tests();
 
@@ -106,6 +106,20 @@ void CF_CFDP_R2_Complete(CF_Transaction_t *txn, int ok_to_send_nak)
     UT_GenStub_Execute(CF_CFDP_R2_Complete, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_R2_DigestGap()
+ * ----------------------------------------------------
+ */
+void CF_CFDP_R2_DigestGap(const CF_ChunkList_t *chunks, const CF_Chunk_t *chunk, void *opaque)
+{
+    UT_GenStub_AddParam(CF_CFDP_R2_DigestGap, const CF_ChunkList_t *, chunks);
+    UT_GenStub_AddParam(CF_CFDP_R2_DigestGap, const CF_Chunk_t *, chunk);
+    UT_GenStub_AddParam(CF_CFDP_R2_DigestGap, void *, opaque);
+
+    UT_GenStub_Execute(CF_CFDP_R2_DigestGap, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_CFDP_R2_GapCompute()
@@ -120,6 +134,23 @@ void CF_CFDP_R2_GapCompute(const CF_ChunkList_t *chunks, const CF_Chunk_t *chunk
     UT_GenStub_Execute(CF_CFDP_R2_GapCompute, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_R2_GetBitmap()
+ * ----------------------------------------------------
+ */
+CF_RecvBitmap_t *CF_CFDP_R2_GetBitmap(CF_Transaction_t *txn, uint32 granule)
+{
+    UT_GenStub_SetupReturnBuffer(CF_CFDP_R2_GetBitmap, CF_RecvBitmap_t *);
+
+    UT_GenStub_AddParam(CF_CFDP_R2_GetBitmap, CF_Transaction_t *, txn);
+    UT_GenStub_AddParam(CF_CFDP_R2_GetBitmap, uint32, granule);
+
+    UT_GenStub_Execute(CF_CFDP_R2_GetBitmap, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_CFDP_R2_GetBitmap, CF_RecvBitmap_t *);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_CFDP_R2_Recv()
@@ -171,6 +202,23 @@ void CF_CFDP_R2_Reset(CF_Transaction_t *txn)
     UT_GenStub_Execute(CF_CFDP_R2_Reset, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_R2_SendImmediateNak()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CF_CFDP_R2_SendImmediateNak(CF_Transaction_t *txn, CF_FileSize_t scope_end)
+{
+    UT_GenStub_SetupReturnBuffer(CF_CFDP_R2_SendImmediateNak, CFE_Status_t);
+
+    UT_GenStub_AddParam(CF_CFDP_R2_SendImmediateNak, CF_Transaction_t *, txn);
+    UT_GenStub_AddParam(CF_CFDP_R2_SendImmediateNak, CF_FileSize_t, scope_end);
+
+    UT_GenStub_Execute(CF_CFDP_R2_SendImmediateNak, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_CFDP_R2_SendImmediateNak, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_CFDP_R2_SetFinTxnStatus()
@@ -255,6 +303,38 @@ CFE_Status_t CF_CFDP_R_CheckCrc(CF_Transaction_t *txn, uint32 expected_crc)
     return UT_GenStub_GetReturnValue(CF_CFDP_R_CheckCrc, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_R_FlushWriteBehind()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CF_CFDP_R_FlushWriteBehind(CF_Transaction_t *txn)
+{
+    UT_GenStub_SetupReturnBuffer(CF_CFDP_R_FlushWriteBehind, CFE_Status_t);
+
+    UT_GenStub_AddParam(CF_CFDP_R_FlushWriteBehind, CF_Transaction_t *, txn);
+
+    UT_GenStub_Execute(CF_CFDP_R_FlushWriteBehind, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_CFDP_R_FlushWriteBehind, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_R_GetWriteBehind()
+ * ----------------------------------------------------
+ */
+CF_WriteBehind_t *CF_CFDP_R_GetWriteBehind(CF_Transaction_t *txn)
+{
+    UT_GenStub_SetupReturnBuffer(CF_CFDP_R_GetWriteBehind, CF_WriteBehind_t *);
+
+    UT_GenStub_AddParam(CF_CFDP_R_GetWriteBehind, CF_Transaction_t *, txn);
+
+    UT_GenStub_Execute(CF_CFDP_R_GetWriteBehind, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_CFDP_R_GetWriteBehind, CF_WriteBehind_t *);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_CFDP_R_Init()
@@ -341,3 +421,22 @@ void CF_CFDP_R_Tick(CF_Transaction_t *txn, int *cont)
 
     UT_GenStub_Execute(CF_CFDP_R_Tick, Basic, NULL);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_R_WriteFile()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CF_CFDP_R_WriteFile(CF_Transaction_t *txn, CF_FileSize_t offset, const void *data, uint32 len)
+{
+    UT_GenStub_SetupReturnBuffer(CF_CFDP_R_WriteFile, CFE_Status_t);
+
+    UT_GenStub_AddParam(CF_CFDP_R_WriteFile, CF_Transaction_t *, txn);
+    UT_GenStub_AddParam(CF_CFDP_R_WriteFile, CF_FileSize_t, offset);
+    UT_GenStub_AddParam(CF_CFDP_R_WriteFile, const void *, data);
+    UT_GenStub_AddParam(CF_CFDP_R_WriteFile, uint32, len);
+
+    UT_GenStub_Execute(CF_CFDP_R_WriteFile, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_CFDP_R_WriteFile, CFE_Status_t);
+}
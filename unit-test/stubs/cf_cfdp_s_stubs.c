@@ -205,6 +205,60 @@ CFE_Status_t CF_CFDP_S_CheckAndRespondNak(CF_Transaction_t *txn)
     return UT_GenStub_GetReturnValue(CF_CFDP_S_CheckAndRespondNak, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_S_GetReadAhead()
+ * ----------------------------------------------------
+ */
+CF_ReadAhead_t *CF_CFDP_S_GetReadAhead(CF_Transaction_t *txn)
+{
+    UT_GenStub_SetupReturnBuffer(CF_CFDP_S_GetReadAhead, CF_ReadAhead_t *);
+
+    UT_GenStub_AddParam(CF_CFDP_S_GetReadAhead, CF_Transaction_t *, txn);
+
+    UT_GenStub_Execute(CF_CFDP_S_GetReadAhead, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_CFDP_S_GetReadAhead, CF_ReadAhead_t *);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_S_ReadCached()
+ * ----------------------------------------------------
+ */
+bool CF_CFDP_S_ReadCached(CF_Transaction_t *txn, CF_FileSize_t foffs, void *buf, uint32 len)
+{
+    UT_GenStub_SetupReturnBuffer(CF_CFDP_S_ReadCached, bool);
+
+    UT_GenStub_AddParam(CF_CFDP_S_ReadCached, CF_Transaction_t *, txn);
+    UT_GenStub_AddParam(CF_CFDP_S_ReadCached, CF_FileSize_t, foffs);
+    UT_GenStub_AddParam(CF_CFDP_S_ReadCached, void *, buf);
+    UT_GenStub_AddParam(CF_CFDP_S_ReadCached, uint32, len);
+
+    UT_GenStub_Execute(CF_CFDP_S_ReadCached, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_CFDP_S_ReadCached, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_S_ReadFile()
+ * ----------------------------------------------------
+ */
+bool CF_CFDP_S_ReadFile(CF_Transaction_t *txn, CF_FileSize_t foffs, void *buf, uint32 len)
+{
+    UT_GenStub_SetupReturnBuffer(CF_CFDP_S_ReadFile, bool);
+
+    UT_GenStub_AddParam(CF_CFDP_S_ReadFile, CF_Transaction_t *, txn);
+    UT_GenStub_AddParam(CF_CFDP_S_ReadFile, CF_FileSize_t, foffs);
+    UT_GenStub_AddParam(CF_CFDP_S_ReadFile, void *, buf);
+    UT_GenStub_AddParam(CF_CFDP_S_ReadFile, uint32, len);
+
+    UT_GenStub_Execute(CF_CFDP_S_ReadFile, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_CFDP_S_ReadFile, bool);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_CFDP_S_SendEof()
@@ -226,13 +280,14 @@ CFE_Status_t CF_CFDP_S_SendEof(CF_Transaction_t *txn)
  * Generated stub function for CF_CFDP_S_SendFileData()
  * ----------------------------------------------------
  */
-CFE_Status_t CF_CFDP_S_SendFileData(CF_Transaction_t *txn, uint32 foffs, uint32 bytes_to_read, uint8 calc_crc)
+CFE_Status_t CF_CFDP_S_SendFileData(CF_Transaction_t *txn, CF_FileSize_t foffs, CF_FileSize_t bytes_to_read,
+                                    uint8 calc_crc)
 {
     UT_GenStub_SetupReturnBuffer(CF_CFDP_S_SendFileData, CFE_Status_t);
 
     UT_GenStub_AddParam(CF_CFDP_S_SendFileData, CF_Transaction_t *, txn);
-    UT_GenStub_AddParam(CF_CFDP_S_SendFileData, uint32, foffs);
-    UT_GenStub_AddParam(CF_CFDP_S_SendFileData, uint32, bytes_to_read);
+    UT_GenStub_AddParam(CF_CFDP_S_SendFileData, CF_FileSize_t, foffs);
+    UT_GenStub_AddParam(CF_CFDP_S_SendFileData, CF_FileSize_t, bytes_to_read);
     UT_GenStub_AddParam(CF_CFDP_S_SendFileData, uint8, calc_crc);
 
     UT_GenStub_Execute(CF_CFDP_S_SendFileData, Basic, NULL);
@@ -57,6 +57,41 @@ void CF_CFDP_ReceiveMessage(CF_Channel_t *chan)
     UT_GenStub_Execute(CF_CFDP_ReceiveMessage, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_RefillOutputTokens()
+ * ----------------------------------------------------
+ */
+void CF_CFDP_RefillOutputTokens(CF_Channel_t *chan)
+{
+    UT_GenStub_AddParam(CF_CFDP_RefillOutputTokens, CF_Channel_t *, chan);
+
+    UT_GenStub_Execute(CF_CFDP_RefillOutputTokens, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_ReleaseOutput()
+ * ----------------------------------------------------
+ */
+void CF_CFDP_ReleaseOutput(CF_Channel_t *chan)
+{
+    UT_GenStub_AddParam(CF_CFDP_ReleaseOutput, CF_Channel_t *, chan);
+
+    UT_GenStub_Execute(CF_CFDP_ReleaseOutput, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_RxTaskMain()
+ * ----------------------------------------------------
+ */
+void CF_CFDP_RxTaskMain(void)
+{
+
+    UT_GenStub_Execute(CF_CFDP_RxTaskMain, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_CFDP_Send()
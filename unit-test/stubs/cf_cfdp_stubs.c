@@ -32,6 +32,18 @@ void UT_DefaultHandler_CF_CFDP_PlaybackDir(void *, UT_EntryKey_t, const UT_StubC
 void UT_DefaultHandler_CF_CFDP_ResetTransaction(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_CF_CFDP_TxFile(void *, UT_EntryKey_t, const UT_StubContext_t *);
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_AckTimerExpired()
+ * ----------------------------------------------------
+ */
+void CF_CFDP_AckTimerExpired(CF_Timer_t *timer)
+{
+    UT_GenStub_AddParam(CF_CFDP_AckTimerExpired, CF_Timer_t *, timer);
+
+    UT_GenStub_Execute(CF_CFDP_AckTimerExpired, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_CFDP_AppendTlv()
@@ -57,6 +69,18 @@ void CF_CFDP_ArmAckTimer(CF_Transaction_t *txn)
     UT_GenStub_Execute(CF_CFDP_ArmAckTimer, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_ArmInactTimer()
+ * ----------------------------------------------------
+ */
+void CF_CFDP_ArmInactTimer(CF_Transaction_t *txn)
+{
+    UT_GenStub_AddParam(CF_CFDP_ArmInactTimer, CF_Transaction_t *, txn);
+
+    UT_GenStub_Execute(CF_CFDP_ArmInactTimer, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_CFDP_CancelTransaction()
@@ -86,6 +110,23 @@ CF_CListTraverse_Status_t CF_CFDP_CloseFiles(CF_CListNode_t *node, void *context
     return UT_GenStub_GetReturnValue(CF_CFDP_CloseFiles, CF_CListTraverse_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_ConstructFileDataHeader()
+ * ----------------------------------------------------
+ */
+CF_Logical_PduBuffer_t *CF_CFDP_ConstructFileDataHeader(CF_Transaction_t *txn, bool silent)
+{
+    UT_GenStub_SetupReturnBuffer(CF_CFDP_ConstructFileDataHeader, CF_Logical_PduBuffer_t *);
+
+    UT_GenStub_AddParam(CF_CFDP_ConstructFileDataHeader, CF_Transaction_t *, txn);
+    UT_GenStub_AddParam(CF_CFDP_ConstructFileDataHeader, bool, silent);
+
+    UT_GenStub_Execute(CF_CFDP_ConstructFileDataHeader, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_CFDP_ConstructFileDataHeader, CF_Logical_PduBuffer_t *);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_CFDP_ConstructPduHeader()
@@ -128,6 +169,35 @@ int CF_CFDP_CopyStringFromLV(char *buf, size_t buf_maxsz, const CF_Logical_Lv_t
     return UT_GenStub_GetReturnValue(CF_CFDP_CopyStringFromLV, int);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_CountActiveTx()
+ * ----------------------------------------------------
+ */
+CF_CListTraverse_Status_t CF_CFDP_CountActiveTx(CF_CListNode_t *node, void *context)
+{
+    UT_GenStub_SetupReturnBuffer(CF_CFDP_CountActiveTx, CF_CListTraverse_Status_t);
+
+    UT_GenStub_AddParam(CF_CFDP_CountActiveTx, CF_CListNode_t *, node);
+    UT_GenStub_AddParam(CF_CFDP_CountActiveTx, void *, context);
+
+    UT_GenStub_Execute(CF_CFDP_CountActiveTx, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_CFDP_CountActiveTx, CF_CListTraverse_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_CycleChannel()
+ * ----------------------------------------------------
+ */
+void CF_CFDP_CycleChannel(CF_Channel_t *chan)
+{
+    UT_GenStub_AddParam(CF_CFDP_CycleChannel, CF_Channel_t *, chan);
+
+    UT_GenStub_Execute(CF_CFDP_CycleChannel, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_CFDP_CycleEngine()
@@ -151,6 +221,18 @@ void CF_CFDP_CycleTx(CF_Channel_t *chan)
     UT_GenStub_Execute(CF_CFDP_CycleTx, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_CycleTxDrr()
+ * ----------------------------------------------------
+ */
+void CF_CFDP_CycleTxDrr(CF_Channel_t *chan)
+{
+    UT_GenStub_AddParam(CF_CFDP_CycleTxDrr, CF_Channel_t *, chan);
+
+    UT_GenStub_Execute(CF_CFDP_CycleTxDrr, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_CFDP_CycleTxFirstActive()
@@ -168,6 +250,22 @@ CF_CListTraverse_Status_t CF_CFDP_CycleTxFirstActive(CF_CListNode_t *node, void
     return UT_GenStub_GetReturnValue(CF_CFDP_CycleTxFirstActive, CF_CListTraverse_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_DecodePh()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CF_CFDP_DecodePh(CF_Logical_PduBuffer_t *ph)
+{
+    UT_GenStub_SetupReturnBuffer(CF_CFDP_DecodePh, CFE_Status_t);
+
+    UT_GenStub_AddParam(CF_CFDP_DecodePh, CF_Logical_PduBuffer_t *, ph);
+
+    UT_GenStub_Execute(CF_CFDP_DecodePh, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_CFDP_DecodePh, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_CFDP_DecodeStart()
@@ -255,6 +353,18 @@ void CF_CFDP_HandleNotKeepFile(CF_Transaction_t *txn)
     UT_GenStub_Execute(CF_CFDP_HandleNotKeepFile, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_InactTimerExpired()
+ * ----------------------------------------------------
+ */
+void CF_CFDP_InactTimerExpired(CF_Timer_t *timer)
+{
+    UT_GenStub_AddParam(CF_CFDP_InactTimerExpired, CF_Timer_t *, timer);
+
+    UT_GenStub_Execute(CF_CFDP_InactTimerExpired, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_CFDP_InitEngine()
@@ -269,6 +379,18 @@ CFE_Status_t CF_CFDP_InitEngine(void)
     return UT_GenStub_GetReturnValue(CF_CFDP_InitEngine, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_InitFileDataHeader()
+ * ----------------------------------------------------
+ */
+void CF_CFDP_InitFileDataHeader(CF_Transaction_t *txn)
+{
+    UT_GenStub_AddParam(CF_CFDP_InitFileDataHeader, CF_Transaction_t *, txn);
+
+    UT_GenStub_Execute(CF_CFDP_InitFileDataHeader, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_CFDP_InitTxnTxFile()
@@ -688,3 +810,14 @@ CFE_Status_t CF_CFDP_TxFile(const char *src_filename, const char *dst_filename,
 
     return UT_GenStub_GetReturnValue(CF_CFDP_TxFile, CFE_Status_t);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_WorkerTaskMain()
+ * ----------------------------------------------------
+ */
+void CF_CFDP_WorkerTaskMain(void)
+{
+
+    UT_GenStub_Execute(CF_CFDP_WorkerTaskMain, Basic, NULL);
+}
@@ -56,6 +56,20 @@ void CF_ChunkListInit(CF_ChunkList_t *chunks, CF_ChunkIdx_t max_chunks, CF_Chunk
     UT_GenStub_Execute(CF_ChunkListInit, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_ChunkListInitPool()
+ * ----------------------------------------------------
+ */
+void CF_ChunkListInitPool(CF_ChunkList_t *chunks, CF_ChunkPool_t *pool, CF_ChunkIdx_t cap)
+{
+    UT_GenStub_AddParam(CF_ChunkListInitPool, CF_ChunkList_t *, chunks);
+    UT_GenStub_AddParam(CF_ChunkListInitPool, CF_ChunkPool_t *, pool);
+    UT_GenStub_AddParam(CF_ChunkListInitPool, CF_ChunkIdx_t, cap);
+
+    UT_GenStub_Execute(CF_ChunkListInitPool, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_ChunkListReset()
@@ -68,6 +82,40 @@ void CF_ChunkListReset(CF_ChunkList_t *chunks)
     UT_GenStub_Execute(CF_ChunkListReset, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_ChunkList_AttachBitmap()
+ * ----------------------------------------------------
+ */
+void CF_ChunkList_AttachBitmap(CF_ChunkList_t *chunks, uint32 *words, uint32 num_words, uint32 *summary,
+                               CF_ChunkSize_t granule)
+{
+    UT_GenStub_AddParam(CF_ChunkList_AttachBitmap, CF_ChunkList_t *, chunks);
+    UT_GenStub_AddParam(CF_ChunkList_AttachBitmap, uint32 *, words);
+    UT_GenStub_AddParam(CF_ChunkList_AttachBitmap, uint32, num_words);
+    UT_GenStub_AddParam(CF_ChunkList_AttachBitmap, uint32 *, summary);
+    UT_GenStub_AddParam(CF_ChunkList_AttachBitmap, CF_ChunkSize_t, granule);
+
+    UT_GenStub_Execute(CF_ChunkList_AttachBitmap, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_ChunkList_CoalesceFirst()
+ * ----------------------------------------------------
+ */
+CF_ChunkSize_t CF_ChunkList_CoalesceFirst(const CF_ChunkList_t *chunks, CF_ChunkSize_t max_size)
+{
+    UT_GenStub_SetupReturnBuffer(CF_ChunkList_CoalesceFirst, CF_ChunkSize_t);
+
+    UT_GenStub_AddParam(CF_ChunkList_CoalesceFirst, const CF_ChunkList_t *, chunks);
+    UT_GenStub_AddParam(CF_ChunkList_CoalesceFirst, CF_ChunkSize_t, max_size);
+
+    UT_GenStub_Execute(CF_ChunkList_CoalesceFirst, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_ChunkList_CoalesceFirst, CF_ChunkSize_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_ChunkList_ComputeGaps()
@@ -90,6 +138,28 @@ uint32 CF_ChunkList_ComputeGaps(const CF_ChunkList_t *chunks, CF_ChunkIdx_t max_
     return UT_GenStub_GetReturnValue(CF_ChunkList_ComputeGaps, uint32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_ChunkList_ComputeUncovered()
+ * ----------------------------------------------------
+ */
+CF_ChunkSize_t CF_ChunkList_ComputeUncovered(const CF_ChunkList_t *chunks, CF_ChunkOffset_t offset,
+                                             CF_ChunkSize_t size, CF_ChunkList_ComputeGapFn_t compute_gap_fn,
+                                             void *opaque)
+{
+    UT_GenStub_SetupReturnBuffer(CF_ChunkList_ComputeUncovered, CF_ChunkSize_t);
+
+    UT_GenStub_AddParam(CF_ChunkList_ComputeUncovered, const CF_ChunkList_t *, chunks);
+    UT_GenStub_AddParam(CF_ChunkList_ComputeUncovered, CF_ChunkOffset_t, offset);
+    UT_GenStub_AddParam(CF_ChunkList_ComputeUncovered, CF_ChunkSize_t, size);
+    UT_GenStub_AddParam(CF_ChunkList_ComputeUncovered, CF_ChunkList_ComputeGapFn_t, compute_gap_fn);
+    UT_GenStub_AddParam(CF_ChunkList_ComputeUncovered, void *, opaque);
+
+    UT_GenStub_Execute(CF_ChunkList_ComputeUncovered, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_ChunkList_ComputeUncovered, CF_ChunkSize_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_ChunkList_GetFirstChunk()
@@ -106,6 +176,19 @@ const CF_Chunk_t *CF_ChunkList_GetFirstChunk(const CF_ChunkList_t *chunks)
     return UT_GenStub_GetReturnValue(CF_ChunkList_GetFirstChunk, const CF_Chunk_t *);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_ChunkList_RemoveBelow()
+ * ----------------------------------------------------
+ */
+void CF_ChunkList_RemoveBelow(CF_ChunkList_t *chunks, CF_ChunkOffset_t offset)
+{
+    UT_GenStub_AddParam(CF_ChunkList_RemoveBelow, CF_ChunkList_t *, chunks);
+    UT_GenStub_AddParam(CF_ChunkList_RemoveBelow, CF_ChunkOffset_t, offset);
+
+    UT_GenStub_Execute(CF_ChunkList_RemoveBelow, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_ChunkList_RemoveFromFirst()
@@ -119,6 +202,23 @@ void CF_ChunkList_RemoveFromFirst(CF_ChunkList_t *chunks, CF_ChunkSize_t size)
     UT_GenStub_Execute(CF_ChunkList_RemoveFromFirst, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_ChunkPool_Init()
+ * ----------------------------------------------------
+ */
+void CF_ChunkPool_Init(CF_ChunkPool_t *pool, CF_Chunk_t *mem, uint8 *used, CF_ChunkIdx_t num_blocks,
+                       CF_ChunkIdx_t block_size)
+{
+    UT_GenStub_AddParam(CF_ChunkPool_Init, CF_ChunkPool_t *, pool);
+    UT_GenStub_AddParam(CF_ChunkPool_Init, CF_Chunk_t *, mem);
+    UT_GenStub_AddParam(CF_ChunkPool_Init, uint8 *, used);
+    UT_GenStub_AddParam(CF_ChunkPool_Init, CF_ChunkIdx_t, num_blocks);
+    UT_GenStub_AddParam(CF_ChunkPool_Init, CF_ChunkIdx_t, block_size);
+
+    UT_GenStub_Execute(CF_ChunkPool_Init, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_Chunks_CombineNext()
@@ -182,16 +282,32 @@ void CF_Chunks_EraseRange(CF_ChunkList_t *chunks, CF_ChunkIdx_t start, CF_ChunkI
     UT_GenStub_Execute(CF_Chunks_EraseRange, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_Chunks_FindClosestPair()
+ * ----------------------------------------------------
+ */
+CF_ChunkIdx_t CF_Chunks_FindClosestPair(CF_ChunkList_t *chunks)
+{
+    UT_GenStub_SetupReturnBuffer(CF_Chunks_FindClosestPair, CF_ChunkIdx_t);
+
+    UT_GenStub_AddParam(CF_Chunks_FindClosestPair, CF_ChunkList_t *, chunks);
+
+    UT_GenStub_Execute(CF_Chunks_FindClosestPair, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_Chunks_FindClosestPair, CF_ChunkIdx_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_Chunks_FindInsertPosition()
  * ----------------------------------------------------
  */
-CF_ChunkIdx_t CF_Chunks_FindInsertPosition(CF_ChunkList_t *chunks, const CF_Chunk_t *chunk)
+CF_ChunkIdx_t CF_Chunks_FindInsertPosition(const CF_ChunkList_t *chunks, const CF_Chunk_t *chunk)
 {
     UT_GenStub_SetupReturnBuffer(CF_Chunks_FindInsertPosition, CF_ChunkIdx_t);
 
-    UT_GenStub_AddParam(CF_Chunks_FindInsertPosition, CF_ChunkList_t *, chunks);
+    UT_GenStub_AddParam(CF_Chunks_FindInsertPosition, const CF_ChunkList_t *, chunks);
     UT_GenStub_AddParam(CF_Chunks_FindInsertPosition, const CF_Chunk_t *, chunk);
 
     UT_GenStub_Execute(CF_Chunks_FindInsertPosition, Basic, NULL);
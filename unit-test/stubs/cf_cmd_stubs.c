@@ -89,11 +89,11 @@ void CF_Cancel_TxnCmd(CF_Transaction_t *txn, void *ignored)
  * Generated stub function for CF_ValidateChunkSizeCmd()
  * ----------------------------------------------------
  */
-CF_ChanAction_Status_t CF_ValidateChunkSizeCmd(CF_ChunkSize_t val, uint8 chan_num)
+CF_ChanAction_Status_t CF_ValidateChunkSizeCmd(uint32 val, uint8 chan_num)
 {
     UT_GenStub_SetupReturnBuffer(CF_ValidateChunkSizeCmd, CF_ChanAction_Status_t);
 
-    UT_GenStub_AddParam(CF_ValidateChunkSizeCmd, CF_ChunkSize_t, val);
+    UT_GenStub_AddParam(CF_ValidateChunkSizeCmd, uint32, val);
     UT_GenStub_AddParam(CF_ValidateChunkSizeCmd, uint8, chan_num);
 
     UT_GenStub_Execute(CF_ValidateChunkSizeCmd, Basic, NULL);
@@ -143,6 +143,19 @@ void CF_CFDP_DecodeFileDirectiveHeader(CF_DecoderState_t *state, CF_Logical_PduF
     UT_GenStub_Execute(CF_CFDP_DecodeFileDirectiveHeader, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_DecodeFileSize()
+ * ----------------------------------------------------
+ */
+void CF_CFDP_DecodeFileSize(CF_DecoderState_t *state, CF_FileSize_t *plsize)
+{
+    UT_GenStub_AddParam(CF_CFDP_DecodeFileSize, CF_DecoderState_t *, state);
+    UT_GenStub_AddParam(CF_CFDP_DecodeFileSize, CF_FileSize_t *, plsize);
+
+    UT_GenStub_Execute(CF_CFDP_DecodeFileSize, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_CFDP_DecodeFin()
@@ -364,6 +377,19 @@ void CF_CFDP_EncodeFileDirectiveHeader(CF_EncoderState_t *state, CF_Logical_PduF
     UT_GenStub_Execute(CF_CFDP_EncodeFileDirectiveHeader, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_EncodeFileSize()
+ * ----------------------------------------------------
+ */
+void CF_CFDP_EncodeFileSize(CF_EncoderState_t *state, CF_FileSize_t *plsize)
+{
+    UT_GenStub_AddParam(CF_CFDP_EncodeFileSize, CF_EncoderState_t *, state);
+    UT_GenStub_AddParam(CF_CFDP_EncodeFileSize, CF_FileSize_t *, plsize);
+
+    UT_GenStub_Execute(CF_CFDP_EncodeFileSize, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_CFDP_EncodeFin()
@@ -390,6 +416,34 @@ void CF_CFDP_EncodeHeaderFinalSize(CF_EncoderState_t *state, CF_Logical_PduHeade
     UT_GenStub_Execute(CF_CFDP_EncodeHeaderFinalSize, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_EncodeHeaderFromTemplate()
+ * ----------------------------------------------------
+ */
+void CF_CFDP_EncodeHeaderFromTemplate(CF_EncoderState_t *state, CF_Logical_PduHeader_t *plh,
+                                      const CF_EncodedHeader_t *tmpl)
+{
+    UT_GenStub_AddParam(CF_CFDP_EncodeHeaderFromTemplate, CF_EncoderState_t *, state);
+    UT_GenStub_AddParam(CF_CFDP_EncodeHeaderFromTemplate, CF_Logical_PduHeader_t *, plh);
+    UT_GenStub_AddParam(CF_CFDP_EncodeHeaderFromTemplate, const CF_EncodedHeader_t *, tmpl);
+
+    UT_GenStub_Execute(CF_CFDP_EncodeHeaderFromTemplate, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CFDP_EncodeHeaderTemplate()
+ * ----------------------------------------------------
+ */
+void CF_CFDP_EncodeHeaderTemplate(CF_EncodedHeader_t *tmpl, const CF_Logical_PduHeader_t *plh)
+{
+    UT_GenStub_AddParam(CF_CFDP_EncodeHeaderTemplate, CF_EncodedHeader_t *, tmpl);
+    UT_GenStub_AddParam(CF_CFDP_EncodeHeaderTemplate, const CF_Logical_PduHeader_t *, plh);
+
+    UT_GenStub_Execute(CF_CFDP_EncodeHeaderTemplate, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_CFDP_EncodeHeaderWithoutSize()
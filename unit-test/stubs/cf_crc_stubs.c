@@ -40,6 +40,25 @@ void CF_CRC_Digest(CF_Crc_t *crc, const uint8 *data, size_t len)
     UT_GenStub_Execute(CF_CRC_Digest, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CRC_DigestAt()
+ * ----------------------------------------------------
+ */
+bool CF_CRC_DigestAt(CF_Crc_t *crc, uint64 offset, const uint8 *data, size_t len)
+{
+    UT_GenStub_SetupReturnBuffer(CF_CRC_DigestAt, bool);
+
+    UT_GenStub_AddParam(CF_CRC_DigestAt, CF_Crc_t *, crc);
+    UT_GenStub_AddParam(CF_CRC_DigestAt, uint64, offset);
+    UT_GenStub_AddParam(CF_CRC_DigestAt, const uint8 *, data);
+    UT_GenStub_AddParam(CF_CRC_DigestAt, size_t, len);
+
+    UT_GenStub_Execute(CF_CRC_DigestAt, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_CRC_DigestAt, bool);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_CRC_Finalize()
@@ -52,14 +71,75 @@ void CF_CRC_Finalize(CF_Crc_t *crc)
     UT_GenStub_Execute(CF_CRC_Finalize, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CRC_GetKernel()
+ * ----------------------------------------------------
+ */
+const CF_CRC_Kernel_t *CF_CRC_GetKernel(uint32 idx)
+{
+    UT_GenStub_SetupReturnBuffer(CF_CRC_GetKernel, const CF_CRC_Kernel_t *);
+
+    UT_GenStub_AddParam(CF_CRC_GetKernel, uint32, idx);
+
+    UT_GenStub_Execute(CF_CRC_GetKernel, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_CRC_GetKernel, const CF_CRC_Kernel_t *);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CRC_Init()
+ * ----------------------------------------------------
+ */
+void CF_CRC_Init(void)
+{
+
+    UT_GenStub_Execute(CF_CRC_Init, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CRC_IsSupported()
+ * ----------------------------------------------------
+ */
+bool CF_CRC_IsSupported(uint8 type)
+{
+    UT_GenStub_SetupReturnBuffer(CF_CRC_IsSupported, bool);
+
+    UT_GenStub_AddParam(CF_CRC_IsSupported, uint8, type);
+
+    UT_GenStub_Execute(CF_CRC_IsSupported, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_CRC_IsSupported, bool);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_CRC_Start()
  * ----------------------------------------------------
  */
-void CF_CRC_Start(CF_Crc_t *crc)
+void CF_CRC_Start(CF_Crc_t *crc, uint8 type)
 {
     UT_GenStub_AddParam(CF_CRC_Start, CF_Crc_t *, crc);
+    UT_GenStub_AddParam(CF_CRC_Start, uint8, type);
 
     UT_GenStub_Execute(CF_CRC_Start, Basic, NULL);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_CRC_SumWords_Generic()
+ * ----------------------------------------------------
+ */
+uint32 CF_CRC_SumWords_Generic(const uint8 *data, size_t nwords)
+{
+    UT_GenStub_SetupReturnBuffer(CF_CRC_SumWords_Generic, uint32);
+
+    UT_GenStub_AddParam(CF_CRC_SumWords_Generic, const uint8 *, data);
+    UT_GenStub_AddParam(CF_CRC_SumWords_Generic, size_t, nwords);
+
+    UT_GenStub_Execute(CF_CRC_SumWords_Generic, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_CRC_SumWords_Generic, uint32);
+}
@@ -0,0 +1,72 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,447-1, and identified as “CFS CFDP (CF)
+ * Application version 3.0.0”
+ *
+ * Copyright (c) 2019 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Auto-Generated stub implementations for functions defined in cf_names header
+ */
+
+#include "cf_names.h"
+#include "utgenstub.h"
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_Names_Get()
+ * ----------------------------------------------------
+ */
+void CF_Names_Get(const CF_NameArena_t *arena, CF_NameRef_t ref, CF_TxnFilenames_t *fnames)
+{
+    UT_GenStub_AddParam(CF_Names_Get, const CF_NameArena_t *, arena);
+    UT_GenStub_AddParam(CF_Names_Get, CF_NameRef_t, ref);
+    UT_GenStub_AddParam(CF_Names_Get, CF_TxnFilenames_t *, fnames);
+
+    UT_GenStub_Execute(CF_Names_Get, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_Names_Release()
+ * ----------------------------------------------------
+ */
+void CF_Names_Release(CF_NameArena_t *arena, CF_NameRef_t ref)
+{
+    UT_GenStub_AddParam(CF_Names_Release, CF_NameArena_t *, arena);
+    UT_GenStub_AddParam(CF_Names_Release, CF_NameRef_t, ref);
+
+    UT_GenStub_Execute(CF_Names_Release, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_Names_Store()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CF_Names_Store(CF_NameArena_t *arena, const CF_TxnFilenames_t *fnames, CF_NameRef_t *ref)
+{
+    UT_GenStub_SetupReturnBuffer(CF_Names_Store, CFE_Status_t);
+
+    UT_GenStub_AddParam(CF_Names_Store, CF_NameArena_t *, arena);
+    UT_GenStub_AddParam(CF_Names_Store, const CF_TxnFilenames_t *, fnames);
+    UT_GenStub_AddParam(CF_Names_Store, CF_NameRef_t *, ref);
+
+    UT_GenStub_Execute(CF_Names_Store, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CF_Names_Store, CFE_Status_t);
+}
@@ -31,11 +31,11 @@
  * Generated stub function for CF_Timer_Expired()
  * ----------------------------------------------------
  */
-bool CF_Timer_Expired(const CF_Timer_t *txn)
+bool CF_Timer_Expired(const CF_Timer_t *timer)
 {
     UT_GenStub_SetupReturnBuffer(CF_Timer_Expired, bool);
 
-    UT_GenStub_AddParam(CF_Timer_Expired, const CF_Timer_t *, txn);
+    UT_GenStub_AddParam(CF_Timer_Expired, const CF_Timer_t *, timer);
 
     UT_GenStub_Execute(CF_Timer_Expired, Basic, NULL);
 
@@ -47,14 +47,43 @@ bool CF_Timer_Expired(const CF_Timer_t *txn)
  * Generated stub function for CF_Timer_InitRelSec()
  * ----------------------------------------------------
  */
-void CF_Timer_InitRelSec(CF_Timer_t *txn, CF_Timer_Seconds_t rel_sec)
+void CF_Timer_InitRelSec(CF_TimerWheel_t *wheel, CF_Timer_t *timer, CF_Timer_Seconds_t rel_sec,
+                         CF_Timer_ExpireFn_t fn)
 {
-    UT_GenStub_AddParam(CF_Timer_InitRelSec, CF_Timer_t *, txn);
+    UT_GenStub_AddParam(CF_Timer_InitRelSec, CF_TimerWheel_t *, wheel);
+    UT_GenStub_AddParam(CF_Timer_InitRelSec, CF_Timer_t *, timer);
     UT_GenStub_AddParam(CF_Timer_InitRelSec, CF_Timer_Seconds_t, rel_sec);
+    UT_GenStub_AddParam(CF_Timer_InitRelSec, CF_Timer_ExpireFn_t, fn);
 
     UT_GenStub_Execute(CF_Timer_InitRelSec, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_Timer_Pause()
+ * ----------------------------------------------------
+ */
+void CF_Timer_Pause(CF_TimerWheel_t *wheel, CF_Timer_t *timer)
+{
+    UT_GenStub_AddParam(CF_Timer_Pause, CF_TimerWheel_t *, wheel);
+    UT_GenStub_AddParam(CF_Timer_Pause, CF_Timer_t *, timer);
+
+    UT_GenStub_Execute(CF_Timer_Pause, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_Timer_Resume()
+ * ----------------------------------------------------
+ */
+void CF_Timer_Resume(CF_TimerWheel_t *wheel, CF_Timer_t *timer)
+{
+    UT_GenStub_AddParam(CF_Timer_Resume, CF_TimerWheel_t *, wheel);
+    UT_GenStub_AddParam(CF_Timer_Resume, CF_Timer_t *, timer);
+
+    UT_GenStub_Execute(CF_Timer_Resume, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_Timer_Sec2Ticks()
@@ -71,14 +100,26 @@ uint32 CF_Timer_Sec2Ticks(CF_Timer_Seconds_t sec)
     return UT_GenStub_GetReturnValue(CF_Timer_Sec2Ticks, uint32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_Timer_Stop()
+ * ----------------------------------------------------
+ */
+void CF_Timer_Stop(CF_Timer_t *timer)
+{
+    UT_GenStub_AddParam(CF_Timer_Stop, CF_Timer_t *, timer);
+
+    UT_GenStub_Execute(CF_Timer_Stop, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_Timer_Tick()
  * ----------------------------------------------------
  */
-void CF_Timer_Tick(CF_Timer_t *txn)
+void CF_Timer_Tick(CF_TimerWheel_t *wheel)
 {
-    UT_GenStub_AddParam(CF_Timer_Tick, CF_Timer_t *, txn);
+    UT_GenStub_AddParam(CF_Timer_Tick, CF_TimerWheel_t *, wheel);
 
     UT_GenStub_Execute(CF_Timer_Tick, Basic, NULL);
 }
@@ -101,44 +101,6 @@ void UT_DefaultHandler_CF_FindUnusedTransaction(void *UserObj, UT_EntryKey_t Fun
     UT_Stub_SetReturnValue(FuncKey, forced_return);
 }
 
-/*----------------------------------------------------------------
- *
- * For compatibility with other tests, this has a mechanism to save its
- * arguments to a test-provided context capture buffer.
- *
- *-----------------------------------------------------------------*/
-void UT_DefaultHandler_CF_WriteTxnQueueDataToFile(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
-{
-    CF_WriteTxnQueueDataToFile_context_t *ctxt = UT_CF_GetContextBuffer(FuncKey, CF_WriteTxnQueueDataToFile_context_t);
-
-    if (ctxt)
-    {
-        ctxt->fd    = UT_Hook_GetArgValueByName(Context, "fd", int32);
-        ctxt->chan  = UT_Hook_GetArgValueByName(Context, "chan", CF_Channel_t *);
-        ctxt->queue = UT_Hook_GetArgValueByName(Context, "queue", CF_QueueIdx_t);
-    }
-}
-
-/*----------------------------------------------------------------
- *
- * For compatibility with other tests, this has a mechanism to save its
- * arguments to a test-provided context capture buffer.
- *
- *-----------------------------------------------------------------*/
-void UT_DefaultHandler_CF_WriteHistoryQueueDataToFile(void *UserObj, UT_EntryKey_t FuncKey,
-                                                      const UT_StubContext_t *Context)
-{
-    CF_WriteHistoryQueueDataToFile_context_t *ctxt =
-        UT_CF_GetContextBuffer(FuncKey, CF_WriteHistoryQueueDataToFile_context_t);
-
-    if (ctxt)
-    {
-        ctxt->fd   = UT_Hook_GetArgValueByName(Context, "fd", int32);
-        ctxt->chan = UT_Hook_GetArgValueByName(Context, "chan", CF_Channel_t *);
-        ctxt->dir  = UT_Hook_GetArgValueByName(Context, "dir", CF_Direction_t);
-    }
-}
-
 /*----------------------------------------------------------------
  *
  * For compatibility with other tests, this has a mechanism to save its
@@ -33,8 +33,6 @@ void UT_DefaultHandler_CF_TraverseAllTransactions(void *, UT_EntryKey_t, const U
 void UT_DefaultHandler_CF_TraverseAllTransactions_All_Channels(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_CF_TxnStatus_IsError(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_CF_WrappedOpenCreate(void *, UT_EntryKey_t, const UT_StubContext_t *);
-void UT_DefaultHandler_CF_WriteHistoryQueueDataToFile(void *, UT_EntryKey_t, const UT_StubContext_t *);
-void UT_DefaultHandler_CF_WriteTxnQueueDataToFile(void *, UT_EntryKey_t, const UT_StubContext_t *);
 
 /*
  * ----------------------------------------------------
@@ -116,19 +114,64 @@ void CF_InsertSortPrio(CF_Transaction_t *txn, CF_QueueIdx_t queue)
 
 /*
  * ----------------------------------------------------
- * Generated stub function for CF_PrioSearch()
+ * Generated stub function for CF_InsertTransactionIndex()
  * ----------------------------------------------------
  */
-CF_CListTraverse_Status_t CF_PrioSearch(CF_CListNode_t *node, void *context)
+void CF_InsertTransactionIndex(CF_Channel_t *chan, CF_Transaction_t *txn)
 {
-    UT_GenStub_SetupReturnBuffer(CF_PrioSearch, CF_CListTraverse_Status_t);
+    UT_GenStub_AddParam(CF_InsertTransactionIndex, CF_Channel_t *, chan);
+    UT_GenStub_AddParam(CF_InsertTransactionIndex, CF_Transaction_t *, txn);
 
-    UT_GenStub_AddParam(CF_PrioSearch, CF_CListNode_t *, node);
-    UT_GenStub_AddParam(CF_PrioSearch, void *, context);
+    UT_GenStub_Execute(CF_InsertTransactionIndex, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_InsertTransactionTick()
+ * ----------------------------------------------------
+ */
+void CF_InsertTransactionTick(CF_Channel_t *chan, CF_Transaction_t *txn)
+{
+    UT_GenStub_AddParam(CF_InsertTransactionTick, CF_Channel_t *, chan);
+    UT_GenStub_AddParam(CF_InsertTransactionTick, CF_Transaction_t *, txn);
+
+    UT_GenStub_Execute(CF_InsertTransactionTick, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_RemoveTransactionIndex()
+ * ----------------------------------------------------
+ */
+void CF_RemoveTransactionIndex(CF_Transaction_t *txn)
+{
+    UT_GenStub_AddParam(CF_RemoveTransactionIndex, CF_Transaction_t *, txn);
 
-    UT_GenStub_Execute(CF_PrioSearch, Basic, NULL);
+    UT_GenStub_Execute(CF_RemoveTransactionIndex, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_RemoveTransactionPrio()
+ * ----------------------------------------------------
+ */
+void CF_RemoveTransactionPrio(CF_Transaction_t *txn)
+{
+    UT_GenStub_AddParam(CF_RemoveTransactionPrio, CF_Transaction_t *, txn);
 
-    return UT_GenStub_GetReturnValue(CF_PrioSearch, CF_CListTraverse_Status_t);
+    UT_GenStub_Execute(CF_RemoveTransactionPrio, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_RemoveTransactionTick()
+ * ----------------------------------------------------
+ */
+void CF_RemoveTransactionTick(CF_Transaction_t *txn)
+{
+    UT_GenStub_AddParam(CF_RemoveTransactionTick, CF_Transaction_t *, txn);
+
+    UT_GenStub_Execute(CF_RemoveTransactionTick, Basic, NULL);
 }
 
 /*
@@ -144,6 +187,20 @@ void CF_ResetHistory(CF_Channel_t *chan, CF_History_t *history)
     UT_GenStub_Execute(CF_ResetHistory, Basic, UT_DefaultHandler_CF_ResetHistory);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CF_StoreHistoryNames()
+ * ----------------------------------------------------
+ */
+void CF_StoreHistoryNames(CF_Channel_t *chan, CF_History_t *history, const CF_TxnFilenames_t *fnames)
+{
+    UT_GenStub_AddParam(CF_StoreHistoryNames, CF_Channel_t *, chan);
+    UT_GenStub_AddParam(CF_StoreHistoryNames, CF_History_t *, history);
+    UT_GenStub_AddParam(CF_StoreHistoryNames, const CF_TxnFilenames_t *, fnames);
+
+    UT_GenStub_Execute(CF_StoreHistoryNames, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_TraverseAllTransactions()
@@ -197,40 +254,6 @@ CF_CListTraverse_Status_t CF_TraverseAllTransactions_Impl(CF_CListNode_t *node,
     return UT_GenStub_GetReturnValue(CF_TraverseAllTransactions_Impl, CF_CListTraverse_Status_t);
 }
 
-/*
- * ----------------------------------------------------
- * Generated stub function for CF_Traverse_WriteHistoryQueueEntryToFile()
- * ----------------------------------------------------
- */
-CF_CListTraverse_Status_t CF_Traverse_WriteHistoryQueueEntryToFile(CF_CListNode_t *node, void *arg)
-{
-    UT_GenStub_SetupReturnBuffer(CF_Traverse_WriteHistoryQueueEntryToFile, CF_CListTraverse_Status_t);
-
-    UT_GenStub_AddParam(CF_Traverse_WriteHistoryQueueEntryToFile, CF_CListNode_t *, node);
-    UT_GenStub_AddParam(CF_Traverse_WriteHistoryQueueEntryToFile, void *, arg);
-
-    UT_GenStub_Execute(CF_Traverse_WriteHistoryQueueEntryToFile, Basic, NULL);
-
-    return UT_GenStub_GetReturnValue(CF_Traverse_WriteHistoryQueueEntryToFile, CF_CListTraverse_Status_t);
-}
-
-/*
- * ----------------------------------------------------
- * Generated stub function for CF_Traverse_WriteTxnQueueEntryToFile()
- * ----------------------------------------------------
- */
-CF_CListTraverse_Status_t CF_Traverse_WriteTxnQueueEntryToFile(CF_CListNode_t *node, void *arg)
-{
-    UT_GenStub_SetupReturnBuffer(CF_Traverse_WriteTxnQueueEntryToFile, CF_CListTraverse_Status_t);
-
-    UT_GenStub_AddParam(CF_Traverse_WriteTxnQueueEntryToFile, CF_CListNode_t *, node);
-    UT_GenStub_AddParam(CF_Traverse_WriteTxnQueueEntryToFile, void *, arg);
-
-    UT_GenStub_Execute(CF_Traverse_WriteTxnQueueEntryToFile, Basic, NULL);
-
-    return UT_GenStub_GetReturnValue(CF_Traverse_WriteTxnQueueEntryToFile, CF_CListTraverse_Status_t);
-}
-
 /*
  * ----------------------------------------------------
  * Generated stub function for CF_TxnStatus_From_ConditionCode()
@@ -348,71 +371,35 @@ CFE_Status_t CF_WrappedRead(osal_id_t fd, void *buf, size_t read_size)
 
 /*
  * ----------------------------------------------------
- * Generated stub function for CF_WrappedWrite()
+ * Generated stub function for CF_WrappedSeekTo()
  * ----------------------------------------------------
  */
-CFE_Status_t CF_WrappedWrite(osal_id_t fd, const void *buf, size_t write_size)
+CFE_Status_t CF_WrappedSeekTo(osal_id_t fd, CF_FileSize_t offset)
 {
-    UT_GenStub_SetupReturnBuffer(CF_WrappedWrite, CFE_Status_t);
+    UT_GenStub_SetupReturnBuffer(CF_WrappedSeekTo, CFE_Status_t);
 
-    UT_GenStub_AddParam(CF_WrappedWrite, osal_id_t, fd);
-    UT_GenStub_AddParam(CF_WrappedWrite, const void *, buf);
-    UT_GenStub_AddParam(CF_WrappedWrite, size_t, write_size);
+    UT_GenStub_AddParam(CF_WrappedSeekTo, osal_id_t, fd);
+    UT_GenStub_AddParam(CF_WrappedSeekTo, CF_FileSize_t, offset);
 
-    UT_GenStub_Execute(CF_WrappedWrite, Basic, NULL);
+    UT_GenStub_Execute(CF_WrappedSeekTo, Basic, NULL);
 
-    return UT_GenStub_GetReturnValue(CF_WrappedWrite, CFE_Status_t);
+    return UT_GenStub_GetReturnValue(CF_WrappedSeekTo, CFE_Status_t);
 }
 
 /*
  * ----------------------------------------------------
- * Generated stub function for CF_WriteHistoryEntryToFile()
- * ----------------------------------------------------
- */
-CFE_Status_t CF_WriteHistoryEntryToFile(osal_id_t fd, const CF_History_t *history)
-{
-    UT_GenStub_SetupReturnBuffer(CF_WriteHistoryEntryToFile, CFE_Status_t);
-
-    UT_GenStub_AddParam(CF_WriteHistoryEntryToFile, osal_id_t, fd);
-    UT_GenStub_AddParam(CF_WriteHistoryEntryToFile, const CF_History_t *, history);
-
-    UT_GenStub_Execute(CF_WriteHistoryEntryToFile, Basic, NULL);
-
-    return UT_GenStub_GetReturnValue(CF_WriteHistoryEntryToFile, CFE_Status_t);
-}
-
-/*
- * ----------------------------------------------------
- * Generated stub function for CF_WriteHistoryQueueDataToFile()
- * ----------------------------------------------------
- */
-CFE_Status_t CF_WriteHistoryQueueDataToFile(osal_id_t fd, CF_Channel_t *chan, CF_Direction_t dir)
-{
-    UT_GenStub_SetupReturnBuffer(CF_WriteHistoryQueueDataToFile, CFE_Status_t);
-
-    UT_GenStub_AddParam(CF_WriteHistoryQueueDataToFile, osal_id_t, fd);
-    UT_GenStub_AddParam(CF_WriteHistoryQueueDataToFile, CF_Channel_t *, chan);
-    UT_GenStub_AddParam(CF_WriteHistoryQueueDataToFile, CF_Direction_t, dir);
-
-    UT_GenStub_Execute(CF_WriteHistoryQueueDataToFile, Basic, UT_DefaultHandler_CF_WriteHistoryQueueDataToFile);
-
-    return UT_GenStub_GetReturnValue(CF_WriteHistoryQueueDataToFile, CFE_Status_t);
-}
-
-/*
- * ----------------------------------------------------
- * Generated stub function for CF_WriteTxnQueueDataToFile()
+ * Generated stub function for CF_WrappedWrite()
  * ----------------------------------------------------
  */
-CFE_Status_t CF_WriteTxnQueueDataToFile(osal_id_t fd, CF_Channel_t *chan, CF_QueueIdx_t queue)
+CFE_Status_t CF_WrappedWrite(osal_id_t fd, const void *buf, size_t write_size)
 {
-    UT_GenStub_SetupReturnBuffer(CF_WriteTxnQueueDataToFile, CFE_Status_t);
+    UT_GenStub_SetupReturnBuffer(CF_WrappedWrite, CFE_Status_t);
 
-    UT_GenStub_AddParam(CF_WriteTxnQueueDataToFile, osal_id_t, fd);
-    UT_GenStub_AddParam(CF_WriteTxnQueueDataToFile, CF_Channel_t *, chan);
-    UT_GenStub_AddParam(CF_WriteTxnQueueDataToFile, CF_QueueIdx_t, queue);
+    UT_GenStub_AddParam(CF_WrappedWrite, osal_id_t, fd);
+    UT_GenStub_AddParam(CF_WrappedWrite, const void *, buf);
+    UT_GenStub_AddParam(CF_WrappedWrite, size_t, write_size);
 
-    UT_GenStub_Execute(CF_WriteTxnQueueDataToFile, Basic, UT_DefaultHandler_CF_WriteTxnQueueDataToFile);
+    UT_GenStub_Execute(CF_WrappedWrite, Basic, NULL);
 
-    return UT_GenStub_GetReturnValue(CF_WriteTxnQueueDataToFile, CFE_Status_t);
+    return UT_GenStub_GetReturnValue(CF_WrappedWrite, CFE_Status_t);
 }
@@ -96,39 +96,6 @@ void UT_AltHandler_CF_CList_Traverse_POINTER(void *UserObj, UT_EntryKey_t FuncKe
     }
 }
 
-/*----------------------------------------------------------------
- *
- * A handler for CF_CList_Traverse which saves its arguments
- * including the opaque context pointer as a CF_Traverse_PriorityArg_t object.
- *
- *-----------------------------------------------------------------*/
-void UT_AltHandler_CF_CList_Traverse_R_PRIO(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
-{
-    CF_CList_Traverse_R_context_t *ctxt;
-    CF_Traverse_PriorityArg_t *    arg = UT_Hook_GetArgValueByName(Context, "context", CF_Traverse_PriorityArg_t *);
-
-    if (UserObj)
-    {
-        ctxt = UserObj;
-    }
-    else
-    {
-        ctxt = UT_CF_GetContextBuffer(FuncKey, CF_CList_Traverse_R_context_t);
-    }
-
-    if (ctxt)
-    {
-        ctxt->end = UT_Hook_GetArgValueByName(Context, "end", CF_CListNode_t *);
-        ctxt->fn  = UT_Hook_GetArgValueByName(Context, "fn", CF_CListFn_t);
-
-        /* This handler is a little different in that it sets the output to the caller */
-        if (arg)
-        {
-            arg->txn = ctxt->context_t;
-        }
-    }
-}
-
 /*----------------------------------------------------------------
  *
  * A handler for CF_TraverseAllTransactions which _sets_ the opaque context
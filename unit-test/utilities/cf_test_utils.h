@@ -119,20 +119,6 @@ typedef struct
     void *          context;
 } CF_CList_Traverse_POINTER_context_t;
 
-typedef struct
-{
-    int32         fd;
-    CF_Channel_t *chan;
-    CF_QueueIdx_t queue;
-} CF_WriteTxnQueueDataToFile_context_t;
-
-typedef struct
-{
-    int32          fd;
-    CF_Channel_t * chan;
-    CF_Direction_t dir;
-} CF_WriteHistoryQueueDataToFile_context_t;
-
 typedef struct
 {
     CF_Channel_t *                  chan;